@@ -0,0 +1,498 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Capture Processing Tool */
+
+// Runs HID captures (see ohmd_ctx_record_hid()) through the drivers and the
+// sensor fusion offline and writes the pose track of every captured device.
+// The captures are replayed stepwise, one recorded input report at a time and
+// without any pacing, and spread over a pool of worker threads, one context
+// per capture.
+//
+// For every capture <name>.ohmdhid two files are written:
+//
+//   <name>.csv       t_ns,device,qx,qy,qz,qw,px,py,pz, one row per device and
+//                    replayed report
+//   <name>.ohmdpose  the same samples column by column, little endian:
+//                      char[8] magic "OHMDPOSE", u32 version (1),
+//                      u32 device count, u64 sample count,
+//                      per device a u16 byte count and the product name,
+//                      i64 t_ns[count], u8 device[count],
+//                      f32 qx[count] ... f32 pz[count]
+//
+// t_ns is the capture's monotonic clock at the time the report was recorded.
+//
+// -f selects the sensor fusion backend (OHMD_IDS_FUSION_BACKEND) of every
+// device, to compare the backends on the same recordings.
+
+#include <openhmd.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#define MAX_DEVICES 16
+#define MAX_THREADS 64 // as many as WaitForMultipleObjects takes
+#define POSE_MAGIC "OHMDPOSE"
+#define POSE_VERSION 1
+#define NUM_FLOATS 7
+
+typedef struct {
+	int64_t t_ns;
+	uint8_t device;
+	float values[NUM_FLOATS]; // rotation quat, position vector
+} pose_sample;
+
+typedef struct {
+	const char* capture;
+	char error[OHMD_STR_SIZE];
+
+	int num_devices;
+	char products[MAX_DEVICES][OHMD_STR_SIZE];
+
+	pose_sample* samples;
+	size_t num_samples, samples_alloc;
+	int steps;
+	double seconds;
+} job;
+
+typedef struct {
+	job* jobs;
+	int num_jobs;
+	int next_job;
+	const char* out_dir;
+	int fusion_backend;
+#ifdef _WIN32
+	CRITICAL_SECTION lock;
+#else
+	pthread_mutex_t lock;
+#endif
+} job_queue;
+
+static double now_seconds(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
+	return (double)count.QuadPart / freq.QuadPart;
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec + now.tv_nsec / 1e9;
+#endif
+}
+
+static int num_cores(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (int)n : 1;
+#endif
+}
+
+static job* take_job(job_queue* queue)
+{
+	job* j = NULL;
+
+#ifdef _WIN32
+	EnterCriticalSection(&queue->lock);
+#else
+	pthread_mutex_lock(&queue->lock);
+#endif
+
+	if(queue->next_job < queue->num_jobs)
+		j = &queue->jobs[queue->next_job++];
+
+#ifdef _WIN32
+	LeaveCriticalSection(&queue->lock);
+#else
+	pthread_mutex_unlock(&queue->lock);
+#endif
+
+	return j;
+}
+
+static bool push_sample(job* j, const pose_sample* s)
+{
+	if(j->num_samples == j->samples_alloc){
+		size_t new_alloc = j->samples_alloc ? j->samples_alloc * 2 : 4096;
+		pose_sample* tmp = realloc(j->samples, new_alloc * sizeof(pose_sample));
+		if(!tmp)
+			return false;
+		j->samples = tmp;
+		j->samples_alloc = new_alloc;
+	}
+
+	j->samples[j->num_samples++] = *s;
+	return true;
+}
+
+// Replays the capture of a job and samples every device after each step.
+static bool process_capture(const job_queue* queue, job* j)
+{
+	ohmd_context* ctx = ohmd_ctx_create();
+	ohmd_device* devices[MAX_DEVICES];
+	bool ok = true;
+
+	if(!ctx){
+		snprintf(j->error, sizeof(j->error), "could not create a context");
+		return false;
+	}
+
+	if(ohmd_ctx_replay_hid(ctx, j->capture, OHMD_REPLAY_STEPPED) != OHMD_S_OK){
+		snprintf(j->error, sizeof(j->error), "%s", ohmd_ctx_get_error(ctx));
+		ohmd_ctx_destroy(ctx);
+		return false;
+	}
+
+	int num_listed = ohmd_ctx_probe(ctx);
+	ohmd_device_settings* settings = ohmd_device_settings_create(ctx);
+	int auto_update = 0;
+
+	ohmd_device_settings_seti(settings, OHMD_IDS_AUTOMATIC_UPDATE, &auto_update);
+	ohmd_device_settings_seti(settings, OHMD_IDS_FUSION_BACKEND, &queue->fusion_backend);
+
+	for(int i = 0; i < num_listed && j->num_devices < MAX_DEVICES; i++){
+		// skip the devices that are not backed by the capture
+		if(strcmp(ohmd_list_gets(ctx, i, OHMD_PATH), "(none)") == 0)
+			continue;
+
+		ohmd_device* dev = ohmd_list_open_device_s(ctx, i, settings);
+		if(!dev)
+			continue;
+
+		snprintf(j->products[j->num_devices], OHMD_STR_SIZE, "%s", ohmd_list_gets(ctx, i, OHMD_PRODUCT));
+		devices[j->num_devices++] = dev;
+	}
+
+	ohmd_device_settings_destroy(settings);
+
+	if(j->num_devices == 0){
+		snprintf(j->error, sizeof(j->error), "no device of the capture could be opened");
+		ohmd_ctx_destroy(ctx);
+		return false;
+	}
+
+	double start = now_seconds();
+	int64_t t_ns;
+
+	while(ok && (t_ns = ohmd_ctx_replay_hid_step(ctx)) >= 0){
+		ohmd_ctx_update(ctx);
+		j->steps++;
+
+		for(int i = 0; ok && i < j->num_devices; i++){
+			pose_sample s;
+
+			s.t_ns = t_ns;
+			s.device = (uint8_t)i;
+			ohmd_device_getf(devices[i], OHMD_ROTATION_QUAT, s.values);
+			ohmd_device_getf(devices[i], OHMD_POSITION_VECTOR, s.values + 4);
+
+			ok = push_sample(j, &s);
+		}
+	}
+
+	j->seconds = now_seconds() - start;
+
+	if(!ok)
+		snprintf(j->error, sizeof(j->error), "out of memory after %d steps", j->steps);
+
+	ohmd_ctx_destroy(ctx);
+
+	return ok;
+}
+
+// The output path of a capture with another extension.
+static void output_path(char* path, size_t size, const char* out_dir, const char* capture, const char* ext)
+{
+	const char* name = capture;
+
+	for(const char* p = capture; *p; p++){
+		if(*p == '/' || *p == '\\')
+			name = p + 1;
+	}
+
+	const char* dot = strrchr(name, '.');
+	int len = dot && dot != name ? (int)(dot - name) : (int)strlen(name);
+
+	if(out_dir)
+		snprintf(path, size, "%s/%.*s%s", out_dir, len, name, ext);
+	else
+		snprintf(path, size, "%.*s%s", (int)(name - capture) + len, capture, ext);
+}
+
+static bool write_csv(const job* j, const char* path)
+{
+	FILE* f = fopen(path, "w");
+	if(!f)
+		return false;
+
+	fprintf(f, "t_ns,device,qx,qy,qz,qw,px,py,pz\n");
+
+	for(size_t i = 0; i < j->num_samples; i++){
+		const pose_sample* s = &j->samples[i];
+		const float* v = s->values;
+
+		fprintf(f, "%lld,%d,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g,%.9g\n", (long long)s->t_ns, s->device,
+			v[0], v[1], v[2], v[3], v[4], v[5], v[6]);
+	}
+
+	return fclose(f) == 0;
+}
+
+static void put_u16(unsigned char* p, uint16_t v)
+{
+	p[0] = v & 0xff;
+	p[1] = v >> 8;
+}
+
+static void put_u32(unsigned char* p, uint32_t v)
+{
+	put_u16(p, v & 0xffff);
+	put_u16(p + 2, v >> 16);
+}
+
+static void put_u64(unsigned char* p, uint64_t v)
+{
+	put_u32(p, v & 0xffffffff);
+	put_u32(p + 4, v >> 32);
+}
+
+static bool write_columns(const job* j, const char* path)
+{
+	size_t n = j->num_samples;
+	unsigned char* column = malloc(n * 8 + 1);
+	unsigned char header[OHMD_STR_SIZE + 2];
+	FILE* f = fopen(path, "wb");
+	bool ok = column && f;
+
+	if(ok){
+		memcpy(header, POSE_MAGIC, 8);
+		put_u32(header + 8, POSE_VERSION);
+		put_u32(header + 12, (uint32_t)j->num_devices);
+		put_u64(header + 16, n);
+		ok = fwrite(header, 24, 1, f) == 1;
+	}
+
+	for(int d = 0; ok && d < j->num_devices; d++){
+		uint16_t len = (uint16_t)strlen(j->products[d]);
+		put_u16(header, len);
+		memcpy(header + 2, j->products[d], len);
+		ok = fwrite(header, 2 + len, 1, f) == 1;
+	}
+
+	if(ok){
+		for(size_t i = 0; i < n; i++)
+			put_u64(column + i * 8, (uint64_t)j->samples[i].t_ns);
+		ok = fwrite(column, 8, n, f) == n;
+	}
+
+	if(ok){
+		for(size_t i = 0; i < n; i++)
+			column[i] = j->samples[i].device;
+		ok = fwrite(column, 1, n, f) == n;
+	}
+
+	for(int c = 0; ok && c < NUM_FLOATS; c++){
+		for(size_t i = 0; i < n; i++){
+			uint32_t bits;
+			memcpy(&bits, &j->samples[i].values[c], 4);
+			put_u32(column + i * 4, bits);
+		}
+		ok = fwrite(column, 4, n, f) == n;
+	}
+
+	free(column);
+
+	if(f && fclose(f) != 0)
+		ok = false;
+
+	return ok;
+}
+
+static void run_job(job_queue* queue, job* j)
+{
+	char path[4096];
+
+	if(!process_capture(queue, j))
+		return;
+
+	output_path(path, sizeof(path), queue->out_dir, j->capture, ".csv");
+	if(!write_csv(j, path)){
+		snprintf(j->error, sizeof(j->error), "could not write the CSV pose track");
+		return;
+	}
+
+	output_path(path, sizeof(path), queue->out_dir, j->capture, ".ohmdpose");
+	if(!write_columns(j, path))
+		snprintf(j->error, sizeof(j->error), "could not write the columnar pose track");
+}
+
+#ifdef _WIN32
+static DWORD WINAPI worker(LPVOID arg)
+#else
+static void* worker(void* arg)
+#endif
+{
+	job_queue* queue = arg;
+	job* j;
+
+	while((j = take_job(queue)) != NULL){
+		run_job(queue, j);
+
+		// only the summary is needed from here on
+		free(j->samples);
+		j->samples = NULL;
+	}
+
+	return 0;
+}
+
+static void usage(const char* name)
+{
+	printf("usage: %s [-j jobs] [-o output directory] [-f fusion] capture...\n", name);
+	printf("Replays HID captures as fast as possible and writes the pose track of every device\n");
+	printf("as <capture>.csv and <capture>.ohmdpose. Uses one job per core by default.\n");
+	printf("fusion is one of default, complementary, mahony, madgwick or accel-only.\n");
+}
+
+// indexed by ohmd_fusion_backend
+static const char* const fusion_backends[] = { "default", "complementary", "mahony", "madgwick", "accel-only" };
+
+// returns the ohmd_fusion_backend of name, -1 if there is none
+static int parse_fusion_backend(const char* name)
+{
+	for(int i = 0; i < (int)(sizeof(fusion_backends) / sizeof(fusion_backends[0])); i++){
+		if(strcmp(name, fusion_backends[i]) == 0)
+			return i;
+	}
+
+	return -1;
+}
+
+int main(int argc, char** argv)
+{
+	job_queue queue;
+	int num_threads = num_cores();
+	int first = 1;
+
+	memset(&queue, 0, sizeof(queue));
+
+	for(; first < argc && argv[first][0] == '-'; first++){
+		if(strcmp(argv[first], "-j") == 0 && first + 1 < argc){
+			num_threads = atoi(argv[++first]);
+		}else if(strcmp(argv[first], "-o") == 0 && first + 1 < argc){
+			queue.out_dir = argv[++first];
+		}else if(strcmp(argv[first], "-f") == 0 && first + 1 < argc){
+			queue.fusion_backend = parse_fusion_backend(argv[++first]);
+		}else{
+			usage(argv[0]);
+			return strcmp(argv[first], "-h") == 0 ? 0 : 1;
+		}
+	}
+
+	if(first == argc || num_threads < 1 || queue.fusion_backend < 0){
+		usage(argv[0]);
+		return 1;
+	}
+
+	queue.num_jobs = argc - first;
+	queue.jobs = calloc((size_t)queue.num_jobs, sizeof(job));
+	if(!queue.jobs){
+		printf("out of memory\n");
+		return 1;
+	}
+
+	for(int i = 0; i < queue.num_jobs; i++)
+		queue.jobs[i].capture = argv[first + i];
+
+	if(num_threads > queue.num_jobs)
+		num_threads = queue.num_jobs;
+	if(num_threads > MAX_THREADS)
+		num_threads = MAX_THREADS;
+
+	double start = now_seconds();
+
+#ifdef _WIN32
+	HANDLE* threads = calloc((size_t)num_threads, sizeof(HANDLE));
+	int started = 0;
+	InitializeCriticalSection(&queue.lock);
+
+	for(; threads && started < num_threads; started++){
+		if(!(threads[started] = CreateThread(NULL, 0, worker, &queue, 0, NULL)))
+			break;
+	}
+
+	// the jobs are done on this thread if none could be started
+	if(started == 0)
+		worker(&queue);
+	else
+		WaitForMultipleObjects(started, threads, TRUE, INFINITE);
+
+	for(int i = 0; i < started; i++)
+		CloseHandle(threads[i]);
+
+	DeleteCriticalSection(&queue.lock);
+#else
+	pthread_t* threads = calloc((size_t)num_threads, sizeof(pthread_t));
+	int started = 0;
+	pthread_mutex_init(&queue.lock, NULL);
+
+	for(; threads && started < num_threads; started++){
+		if(pthread_create(&threads[started], NULL, worker, &queue) != 0)
+			break;
+	}
+
+	// the jobs are done on this thread if none could be started
+	if(started == 0)
+		worker(&queue);
+
+	for(int i = 0; i < started; i++)
+		pthread_join(threads[i], NULL);
+
+	pthread_mutex_destroy(&queue.lock);
+#endif
+
+	double elapsed = now_seconds() - start;
+	int failed = 0;
+	long long total_steps = 0;
+
+	for(int i = 0; i < queue.num_jobs; i++){
+		const job* j = &queue.jobs[i];
+
+		if(j->error[0]){
+			printf("%s: FAILED, %s\n", j->capture, j->error);
+			failed++;
+			continue;
+		}
+
+		printf("%s: %d reports in %.3f s\n", j->capture, j->steps, j->seconds);
+		for(int d = 0; d < j->num_devices; d++)
+			printf("  device %d: %s\n", d, j->products[d]);
+
+		total_steps += j->steps;
+	}
+
+	printf("%d captures, %lld reports in %.3f s on %d threads (%.0f reports/s)\n",
+		queue.num_jobs - failed, total_steps, elapsed, started ? started : 1, total_steps / elapsed);
+
+	free(threads);
+	free(queue.jobs);
+
+	return failed ? 1 : 0;
+}
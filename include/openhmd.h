@@ -13,6 +13,8 @@
 #ifndef OPENHMD_H
 #define OPENHMD_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -55,6 +57,8 @@ typedef enum {
 	OHMD_VENDOR    = 0,
 	OHMD_PRODUCT   = 1,
 	OHMD_PATH      = 2,
+	/** The serial number of the device, empty if it reports none. Key for ohmd_device_get_fusion_state(). */
+	OHMD_SERIAL    = 3,
 } ohmd_string_value;
 
 /** A collection of string descriptions, used for getting strings with ohmd_gets(). */
@@ -185,6 +189,9 @@ typedef enum {
 	
 	/** int[OHMD_CONTROL_COUNT] (get, ohmd_geti()): Get whether controls are digital or analog. */
 	OHMD_CONTROLS_TYPES                   =  6,
+
+	/** int[1] (get/set, default: 50000): Furthest ohmd_device_get_predicted_pose() extrapolates, in microseconds either way. 0 disables prediction. */
+	OHMD_PREDICTION_MAX_HORIZON_US        =  7,
 } ohmd_int_value;
 
 /** A collection of data information types used for setting information with ohmd_set_data(). */
@@ -204,8 +211,32 @@ typedef enum {
 	/** int[1] (set, default: 1): Set this to 0 to prevent OpenHMD from creating background threads to do automatic device ticking.
 	    Call ohmd_update(); must be called frequently, at least 10 times per second, if the background threads are disabled. */
 	OHMD_IDS_AUTOMATIC_UPDATE = 0,
+
+	/** int[1] (set, default: OHMD_FUSION_DEFAULT): Select the sensor fusion backend (ohmd_fusion_backend) that computes the rotation of the device. */
+	OHMD_IDS_FUSION_BACKEND = 1,
+
+	/** int[1] (set, default: 0): Set this to 1 to keep the IMU samples of the device for ohmd_device_read_imu_samples(). */
+	OHMD_IDS_IMU_SAMPLES = 2,
+
+	/** int[1] (set, default: 1): Set this to 0 to not fuse the IMU samples of the device, for applications that only read them
+	    with ohmd_device_read_imu_samples(). The rotation of the device then stays at identity. */
+	OHMD_IDS_SENSOR_FUSION = 3,
 } ohmd_int_settings;
 
+/** Sensor fusion backends, see OHMD_IDS_FUSION_BACKEND. */
+typedef enum {
+	/** The choice of the driver, the complementary filter unless the device lacks a gyroscope. */
+	OHMD_FUSION_DEFAULT       = 0,
+	/** Integrates the gyroscope and corrects the tilt from gravity whenever the device has been still for a moment. */
+	OHMD_FUSION_COMPLEMENTARY = 1,
+	/** Mahony filter, corrects the tilt from the accelerometer on every sample with proportional and integral feedback. */
+	OHMD_FUSION_MAHONY        = 2,
+	/** Madgwick filter, corrects the tilt from the accelerometer on every sample with a fixed rate gradient descent step. */
+	OHMD_FUSION_MADGWICK      = 3,
+	/** Tilt from the averaged accelerometer alone, without yaw, for devices without a gyroscope. */
+	OHMD_FUSION_ACCEL_ONLY    = 4,
+} ohmd_fusion_backend;
+
 /** Device classes. */
 typedef enum 
 {
@@ -228,6 +259,17 @@ typedef enum
 	OHMD_DEVICE_FLAGS_RIGHT_CONTROLLER    = 16,
 } ohmd_device_flags;
 
+/** Timing of replayed HID traffic, see ohmd_ctx_replay_hid(). */
+typedef enum {
+	/** Input reports arrive with the timing they were recorded with. */
+	OHMD_REPLAY_PACED = 0,
+	/** Input reports are returned as fast as the drivers read them. */
+	OHMD_REPLAY_FAST  = 1,
+	/** Input reports are only returned once released by ohmd_ctx_replay_hid_step(). Devices being opened read the
+	    reports recorded while they were opened freely, until the first step. */
+	OHMD_REPLAY_STEPPED = 2,
+} ohmd_replay_mode;
+
 /** An opaque pointer to a context structure. */
 typedef struct ohmd_context ohmd_context;
 
@@ -237,6 +279,15 @@ typedef struct ohmd_device ohmd_device;
 /** An opaque pointer to a structure representing arguments for a device. */
 typedef struct ohmd_device_settings ohmd_device_settings;
 
+/** A sample of the IMU of a device, calibrated by its driver, see ohmd_device_read_imu_samples(). */
+typedef struct {
+	int64_t sample_ns; /**< When the sample was taken, on the clock of ohmd_get_time_ns(). */
+	int64_t dt_ns;     /**< Time since the previous sample, as counted by the device. */
+	float ang_vel[3];  /**< Angular velocity in rad/s. */
+	float accel[3];    /**< Acceleration in m/s². */
+	float mag[3];      /**< Magnetic field, zero for devices without a magnetometer. */
+} ohmd_imu_sample;
+
 /**
  * Create an OpenHMD context.
  *
@@ -315,7 +366,7 @@ OHMD_APIENTRYDLL int ohmd_gets(ohmd_string_description type, const char** out);
  *
  * @param ctx A (probed) context.
  * @param index An index, between 0 and the value returned from ohmd_ctx_probe.
- * @param type The type of data to fetch. One of OHMD_VENDOR, OHMD_PRODUCT and OHMD_PATH.
+ * @param type The type of data to fetch. One of OHMD_VENDOR, OHMD_PRODUCT, OHMD_PATH and OHMD_SERIAL.
  * @return a string with a human readable device name.
  **/
 OHMD_APIENTRYDLL const char* OHMD_APIENTRY ohmd_list_gets(ohmd_context* ctx, int index, ohmd_string_value type);
@@ -452,6 +503,102 @@ OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_device_seti(ohmd_device* device, ohmd_in
  **/
 OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_device_set_data(ohmd_device* device, ohmd_data_value type, const void* in);
 
+/**
+ * Get the time the latest sensor sample fused into the rotation of a device was taken.
+ *
+ * The time is on the host's monotonic clock (CLOCK_MONOTONIC on Linux, see ohmd_get_time_ns()), in nanoseconds. Drivers that know the
+ * sample clock of their device map it onto the host clock, the others report when the report carrying the
+ * sample was read. Replayed captures report times on the clock of the recording.
+ *
+ * @param device An open device.
+ * @param out The sample time, 0 until the first sample has been fused.
+ * @return OHMD_S_OK on success or OHMD_S_UNSUPPORTED if the device does not run sensor fusion.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_sample_time(ohmd_device* device, int64_t* out);
+
+/**
+ * Get the pose of a device extrapolated to a time, for example when the next frame will be displayed.
+ *
+ * Starts from the pose of the last ohmd_ctx_update() and integrates the latest angular velocity from the sample time of
+ * that pose (see ohmd_device_get_sample_time()) to target_ns. Devices with positional tracking also extrapolate the
+ * position with the velocity of the latest position steps and the acceleration. The horizon is clamped to
+ * OHMD_PREDICTION_MAX_HORIZON_US, the cost does not depend on it. Corrections set with ohmd_device_setf() apply as to
+ * OHMD_ROTATION_QUAT and OHMD_POSITION_VECTOR.
+ *
+ * @param device An open device.
+ * @param target_ns The time to predict the pose at, on the clock of ohmd_get_time_ns().
+ * @param[out] out_rotation float[4], the rotation quaternion as OHMD_ROTATION_QUAT, or NULL.
+ * @param[out] out_position float[3], the position as OHMD_POSITION_VECTOR, or NULL.
+ * @return OHMD_S_OK on success or OHMD_S_UNSUPPORTED if the device does not run sensor fusion.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_predicted_pose(ohmd_device* device, int64_t target_ns, float* out_rotation, float* out_position);
+
+/**
+ * Get the pose of a device at a past time, for example when rendering of a frame started.
+ *
+ * Devices keep the poses of their recent sensor fusion updates, about half a second or more, and the pose between
+ * two of them is interpolated. Times after the latest update are extrapolated as by ohmd_device_get_predicted_pose(),
+ * up to OHMD_PREDICTION_MAX_HORIZON_US. Corrections set with ohmd_device_setf() apply to the poses of later updates.
+ *
+ * This takes no lock and can be called from any thread while the device is updated.
+ *
+ * @param device An open device.
+ * @param time_ns The time of the pose, on the clock of ohmd_get_time_ns().
+ * @param[out] out_rotation float[4], the rotation quaternion as OHMD_ROTATION_QUAT, or NULL.
+ * @param[out] out_position float[3], the position as OHMD_POSITION_VECTOR, or NULL.
+ * @return OHMD_S_OK on success, OHMD_S_INVALID_PARAMETER if no pose is kept for that time, or OHMD_S_UNSUPPORTED if
+ *         the device does not run sensor fusion.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_pose_at(ohmd_device* device, int64_t time_ns, float* out_rotation, float* out_position);
+
+/**
+ * Read the IMU samples of a device that arrived since the last read, oldest first.
+ *
+ * The samples are the ones the sensor fusion gets, without the gyro bias it estimates. Devices keep them when opened
+ * with OHMD_IDS_IMU_SAMPLES set, in a ring of about a second of samples or more. A reader falling further behind loses
+ * the oldest ones, which shows as a gap in sample_ns.
+ *
+ * This takes no lock and can be called from any one thread while the device is updated.
+ *
+ * @param device An open device.
+ * @param[out] out Array of max samples.
+ * @param max The number of samples out can take.
+ * @param[out] out_count The number of samples read.
+ * @return OHMD_S_OK on success or OHMD_S_UNSUPPORTED if the device does not keep its IMU samples.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_read_imu_samples(ohmd_device* device, ohmd_imu_sample* out, int max, int* out_count);
+
+/**
+ * Get the state of the sensor fusion of a device, to resume from with ohmd_device_set_fusion_state().
+ *
+ * A fusion takes a few seconds to converge after a device is opened, and the gyro bias it learns longer still. An
+ * application can save the state when it exits, keyed by OHMD_SERIAL, and restore it after opening the same device
+ * on the next start to have stable tracking from the first samples. The state is an opaque blob, only valid for the
+ * device it was taken from, the same fusion backend and a build of OpenHMD for the same platform.
+ *
+ * @param device An open device.
+ * @param[out] out Buffer of *size bytes for the state, or NULL to only get the size needed.
+ * @param[in,out] size The size of out, set to the size of the state.
+ * @return OHMD_S_OK on success, OHMD_S_INVALID_PARAMETER if out is too small, or OHMD_S_UNSUPPORTED if the device does
+ *         not run sensor fusion.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_fusion_state(ohmd_device* device, void* out, int* size);
+
+/**
+ * Resume the sensor fusion of a device from a state saved by ohmd_device_get_fusion_state().
+ *
+ * The fusion starts over from the saved orientation, gyro bias and filter state as one that has converged. Should the
+ * first samples show that the device was tilted in between, the fusion converges anew from there as after opening the
+ * device. The yaw can't be checked and is as saved.
+ *
+ * @param device An open device.
+ * @param in The state.
+ * @param size The size of the state.
+ * @return OHMD_S_OK on success, OHMD_S_INVALID_PARAMETER if the state is of another device, fusion backend or version,
+ *         or OHMD_S_UNSUPPORTED if the device does not run sensor fusion.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_set_fusion_state(ohmd_device* device, const void* in, int size);
+
 /**
  * Get the library version.
  *
@@ -471,6 +618,91 @@ OHMD_APIENTRYDLL void OHMD_APIENTRY ohmd_get_version(int* out_major, int* out_mi
  **/
 OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_require_version(int major, int minor, int patch);
 
+/**
+ * Enable or disable recording of internal trace events.
+ *
+ * Trace events cover the automatic update thread, driver updates, HID report reads, packet decoding,
+ * sensor fusion, radio commands and API lock waits. They are stored in preallocated per-thread ring buffers
+ * and can be written out with ohmd_trace_dump().
+ *
+ * Setting the OHMD_TRACE environment variable to a file name enables tracing when a context is created
+ * and writes the trace to that file when the context is destroyed.
+ *
+ * @param enable 1 to start recording, 0 to stop.
+ * @return OHMD_S_OK on success or OHMD_S_UNSUPPORTED if OpenHMD was built without tracing support.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_trace_enable(int enable);
+
+/**
+ * Write the recorded trace events to a file.
+ *
+ * The file uses the Chrome trace event JSON format and can be loaded in chrome://tracing or Perfetto.
+ * Timestamps are in microseconds on the monotonic system clock.
+ *
+ * @param filename The file to write.
+ * @return OHMD_S_OK on success or OHMD_S_UNSUPPORTED if OpenHMD was built without tracing support.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_trace_dump(const char* filename);
+
+/**
+ * Record the HID traffic of a context to a capture file.
+ *
+ * Every input report, output report and feature report exchanged with the devices opened after recording
+ * starts is written with a monotonic timestamp in nanoseconds, the device it belongs to and its direction.
+ * Devices that are already open when recording starts are not captured. Records are buffered and written
+ * to disk in large blocks, the file is complete once recording is stopped or the context is destroyed.
+ *
+ * Setting the OHMD_HID_RECORD environment variable to a file name starts recording to that file when a
+ * context is created.
+ *
+ * @param ctx A (valid) context.
+ * @param filename The file to record to, or NULL to stop recording.
+ * @return OHMD_S_OK on success, OHMD_S_INVALID_PARAMETER if the file could not be created or
+ * OHMD_S_UNSUPPORTED if OpenHMD was built without HID drivers.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_ctx_record_hid(ohmd_context* ctx, const char* filename);
+
+/**
+ * Replay a HID capture instead of talking to the connected devices.
+ *
+ * The devices recorded in the capture (see ohmd_ctx_record_hid()) are listed by ohmd_ctx_probe() and opened
+ * by the regular drivers, which get the recorded feature report responses and input reports. This has to be
+ * called before probing. The capture replaces the connected HID devices for the lifetime of the context.
+ *
+ * Setting the OHMD_HID_REPLAY environment variable to a capture file replays it with its original timing.
+ *
+ * @param ctx A (valid) context.
+ * @param filename The capture file.
+ * @param mode Whether input reports keep their recorded timing or are returned as fast as they are read.
+ * @return OHMD_S_OK on success, OHMD_S_INVALID_PARAMETER if the file is not a capture,
+ * OHMD_S_INVALID_OPERATION if the context is already replaying or OHMD_S_UNSUPPORTED if OpenHMD was built
+ * without HID drivers.
+ **/
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_ctx_replay_hid(ohmd_context* ctx, const char* filename, ohmd_replay_mode mode);
+
+/**
+ * Get the number of replayed input reports the open devices have not read yet.
+ *
+ * A replay has finished when this drops to zero after the devices were opened.
+ *
+ * @param ctx A (valid) context.
+ * @return The number of pending input reports, or -1 if the context is not replaying a capture.
+ **/
+OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_ctx_replay_hid_pending(ohmd_context* ctx);
+
+/**
+ * Release the next replayed input reports of a stepped replay.
+ *
+ * Makes the earliest input report any open device has not read yet available, together with all reports
+ * recorded at the same time. Calling ohmd_ctx_update() afterwards lets the drivers process exactly these
+ * reports, so the poses can be sampled once per recorded report without any pacing.
+ *
+ * @param ctx A (valid) context replaying a capture with OHMD_REPLAY_STEPPED.
+ * @return The capture timestamp of the released reports in nanoseconds, or -1 if no reports are left or the
+ * context is not replaying a capture stepwise.
+ **/
+OHMD_APIENTRYDLL int64_t OHMD_APIENTRY ohmd_ctx_replay_hid_step(ohmd_context* ctx);
+
 /**
  * Sleep for the given amount of seconds.
  *
@@ -478,6 +710,16 @@ OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_require_version(int major, int m
  **/
 OHMD_APIENTRYDLL void OHMD_APIENTRY ohmd_sleep(double time);
 
+/**
+ * Get the current time on the clock sample times are reported on.
+ *
+ * This is the host's monotonic clock (CLOCK_MONOTONIC on Linux) in nanoseconds, so the age of a sample is
+ * the difference to ohmd_device_get_sample_time().
+ *
+ * @return The current time in nanoseconds.
+ **/
+OHMD_APIENTRYDLL int64_t OHMD_APIENTRY ohmd_get_time_ns(void);
+
 #ifdef __cplusplus
 }
 #endif
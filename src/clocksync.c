@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Device Clock Synchronization Implementation */
+
+#include <math.h>
+#include <string.h>
+
+#include "clocksync.h"
+
+#define TIME_CONSTANT_S 30.0      // samples fade out of the fit over this much device time
+#define MIN_SPREAD_S 0.25         // spread of device time the fit needs before it estimates drift
+#define MAX_DRIFT 1000000.0       // 1000 ppm, in ns per second
+#define QUANTILE 0.05            // share of the reads expected to arrive earlier than the fit
+#define OUTLIER_NS 50000000.0     // samples further off the fit don't update it
+#define RESTART_OUTLIERS 8        // consecutive outliers before the fit is restarted
+#define INITIAL_JITTER_NS 1000000.0
+#define MIN_JITTER_NS 10000.0
+
+void oclock_sync_init(clock_sync* me, double tick_hz, int tick_bits)
+{
+	memset(me, 0, sizeof(clock_sync));
+
+	me->ns_per_tick = 1000000000.0 / tick_hz;
+	me->tick_mask = tick_bits >= 64 ? UINT64_MAX : ((uint64_t)1 << tick_bits) - 1;
+}
+
+static uint64_t restart(clock_sync* me, uint64_t tick, uint64_t host_ns)
+{
+	me->samples = 1;
+	me->outliers = 0;
+	me->last_tick = tick;
+	me->ticks = 0;
+	me->host_base = host_ns;
+	me->last_host_ns = host_ns;
+
+	me->sw = 1.0;
+	me->sx = me->sy = me->sxx = me->sxy = 0.0;
+	me->offset = me->drift = 0.0;
+	me->jitter = INITIAL_JITTER_NS;
+
+	me->dt_ns = 0;
+	if(host_ns > me->sample_ns)
+		me->sample_ns = host_ns;
+
+	return me->sample_ns;
+}
+
+uint64_t oclock_sync_update(clock_sync* me, uint64_t tick, uint64_t host_ns)
+{
+	tick &= me->tick_mask;
+
+	if(me->samples == 0)
+		return restart(me, tick, host_ns);
+
+	uint64_t delta = (tick - me->last_tick) & me->tick_mask;
+
+	// after a gap of more than half the counter range, count the wraps the host clock saw
+	if(me->tick_mask != UINT64_MAX && host_ns > me->last_host_ns){
+		double range = (double)me->tick_mask + 1.0;
+		double expected = (host_ns - me->last_host_ns) / me->ns_per_tick;
+
+		if(expected > range / 2){
+			double wraps = floor((expected - delta) / range + 0.5);
+			if(wraps > 0)
+				delta += (uint64_t)wraps * (me->tick_mask + 1);
+		}
+	}
+
+	double step = delta * me->ns_per_tick / 1000000000.0;
+	double device_ns = (me->ticks + delta) * me->ns_per_tick;
+	double offset = (double)(int64_t)(host_ns - me->host_base) - device_ns;
+	double residual = offset - (me->offset + me->drift * step);
+
+	// a counter that jumped, or samples buffered long ago
+	if(fabs(residual) > OUTLIER_NS){
+		if(++me->outliers >= RESTART_OUTLIERS)
+			return restart(me, tick, host_ns);
+
+		me->dt_ns = 0;
+		return me->sample_ns;
+	}
+
+	// rounding the unwrapped counter instead of the step keeps the sum of the steps exact
+	me->dt_ns = llround(device_ns) - llround(me->ticks * me->ns_per_tick);
+
+	me->samples++;
+	me->outliers = 0;
+	me->last_tick = tick;
+	me->ticks += delta;
+	me->last_host_ns = host_ns;
+
+	// reads are only ever delayed, so fit a low quantile of the offsets
+	// instead of the mean, with iteratively reweighted least squares
+	double scale = me->jitter / 4.0;
+	double w = (residual > 0 ? QUANTILE : 1.0 - QUANTILE) * scale / fmax(fabs(residual), scale);
+
+	me->jitter += (fmin(fabs(residual), 4.0 * me->jitter) - me->jitter) / 32.0;
+	if(me->jitter < MIN_JITTER_NS)
+		me->jitter = MIN_JITTER_NS;
+
+	// move the origin to this sample and fade the older ones
+	double decay = exp(-step / TIME_CONSTANT_S);
+	me->sxx = (me->sxx - 2.0 * step * me->sx + step * step * me->sw) * decay;
+	me->sxy = (me->sxy - step * me->sy) * decay;
+	me->sx = (me->sx - step * me->sw) * decay;
+	me->sy *= decay;
+	me->sw *= decay;
+
+	me->sw += w;
+	me->sy += w * offset;
+
+	double var = me->sw * me->sxx - me->sx * me->sx;
+	if(var > MIN_SPREAD_S * MIN_SPREAD_S * me->sw * me->sw){
+		me->drift = (me->sw * me->sxy - me->sx * me->sy) / var;
+		me->drift = fmax(-MAX_DRIFT, fmin(MAX_DRIFT, me->drift));
+	}
+	me->offset = (me->sy - me->drift * me->sx) / me->sw;
+
+	// a sample can't be taken after the report carrying it was read
+	uint64_t sample_ns = me->host_base + (uint64_t)llround(device_ns + me->offset);
+	if(sample_ns > host_ns)
+		sample_ns = host_ns;
+	if(sample_ns > me->sample_ns)
+		me->sample_ns = sample_ns;
+
+	return me->sample_ns;
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Device Clock Synchronization */
+
+/*
+ * Maps the sample counter of a device onto host monotonic time. Every sample
+ * is fed with its raw counter value and the host time the report carrying it
+ * was read at. The counter is unwrapped, taking the host time into account
+ * for gaps longer than half the counter range, and the offset between the
+ * two clocks is fitted as a line over device time with exponentially
+ * weighted, iteratively reweighted least squares. As reads only ever get
+ * delayed, the fit follows a low quantile of the offsets, the earliest
+ * arrivals, instead of the scheduling jitter. The slope is the drift between
+ * the clocks.
+ *
+ * A sample's host time is the fitted line at its device time, so it has the
+ * device's sample spacing instead of the host's read jitter. When the device
+ * clock jumps (reset, stale buffered samples) the fit is restarted after a
+ * few samples that don't match it.
+ */
+
+#ifndef CLOCKSYNC_H
+#define CLOCKSYNC_H
+
+#include <stdint.h>
+
+typedef struct {
+	double ns_per_tick;
+	uint64_t tick_mask;
+
+	int samples;        // samples in the fit, 0 before the first
+	int outliers;       // consecutive samples too far off the fit
+	uint64_t last_tick; // raw counter value of the latest sample
+	uint64_t ticks;     // unwrapped counter of the latest sample, since the fit started
+	uint64_t host_base; // host time of the first sample of the fit
+	uint64_t last_host_ns;
+
+	// weighted sums of the offset (host - device ns) over device seconds,
+	// relative to the latest sample
+	double sw, sx, sy, sxx, sxy;
+	double offset; // fitted offset at the latest sample, ns
+	double drift;  // fitted drift, ns of offset per second of device time
+	double jitter; // running mean absolute residual, ns
+
+	uint64_t dt_ns;     // device time since the previous sample, 0 on the first one of a fit
+	uint64_t sample_ns; // host time of the latest sample
+} clock_sync;
+
+// Starts tracking a counter running at tick_hz that wraps after tick_bits bits.
+void oclock_sync_init(clock_sync* me, double tick_hz, int tick_bits);
+// Feeds the counter value of a sample from a report read at host_ns, returns the host time of the sample.
+uint64_t oclock_sync_update(clock_sync* me, uint64_t tick, uint64_t host_ns);
+
+#endif
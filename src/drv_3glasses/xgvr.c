@@ -14,7 +14,6 @@
  */
 
 #include <stdlib.h>
-#include <hidapi.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
@@ -65,7 +64,7 @@ static const xgvr_platform_sku_t platform_sku[] = {
 
 typedef struct {
     ohmd_device device;
-    hid_device* hid_handle;
+    ohmd_hid_device* hid_handle;
     int sku;
     xgvr_hmd_data_t hmd_data;
     struct {
@@ -85,7 +84,7 @@ static int _get_feature_report(xgvr_priv* priv, unsigned char report_id, unsigne
 {
     memset(buf, 0, FEATURE_BUFFER_SIZE);
     buf[0] = report_id;
-    return hid_get_feature_report(priv->hid_handle, buf, FEATURE_BUFFER_SIZE);
+    return ohmd_hid_get_feature_report(priv->hid_handle, buf, FEATURE_BUFFER_SIZE);
 }
 
 static void _priv_update_firmware_version(xgvr_priv* priv)
@@ -136,7 +135,7 @@ static void _update_device(ohmd_device* device)
     unsigned char buffer[FEATURE_BUFFER_SIZE];
     xgvr_priv* priv = _xgvr_priv_get(device);
 
-    while ((size = hid_read(priv->hid_handle, buffer, FEATURE_BUFFER_SIZE)) > 0) {
+    while ((size = ohmd_hid_read(priv->hid_handle, buffer, FEATURE_BUFFER_SIZE)) > 0) {
         if (buffer[0] == FEATURE_SENSOR_ID) {
             xgvr_decode_hmd_data_packet(buffer, size, &priv->hmd_data);
         } else {
@@ -187,7 +186,7 @@ static void _close_device(ohmd_device* device)
 {
     LOGD("closing device");
     xgvr_priv* priv = _xgvr_priv_get(device);
-    hid_close(priv->hid_handle);
+    ohmd_hid_close(priv->hid_handle);
     free(priv);
 }
 
@@ -201,7 +200,7 @@ static ohmd_device* _open_device(ohmd_driver* driver, ohmd_device_desc* desc)
     priv->device.ctx = driver->ctx;
 
     // Open the HID device
-    priv->hid_handle = hid_open_path(desc->path);
+    priv->hid_handle = ohmd_hid_open_path(driver->ctx, desc->path);
 
     if (!priv->hid_handle) {
         char* path = _hid_to_unix_path(desc->path);
@@ -212,7 +211,7 @@ static ohmd_device* _open_device(ohmd_driver* driver, ohmd_device_desc* desc)
         goto cleanup;
     }
 
-    if (hid_set_nonblocking(priv->hid_handle, 1) == -1) {
+    if (ohmd_hid_set_nonblocking(priv->hid_handle, 1) == -1) {
         ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
         goto cleanup;
     }
@@ -251,8 +250,8 @@ static void _get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 
     // enumerate HID devices and add any 3Glasses HMD found to the device list
     for (i = 0; i < sizeof(platform_sku) / sizeof(xgvr_platform_sku_t); i++) {
-        struct hid_device_info* devs = hid_enumerate(platform_sku[i].usb_vid, platform_sku[i].usb_pid);
-        struct hid_device_info* cur_dev = devs;
+        ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, platform_sku[i].usb_vid, platform_sku[i].usb_pid);
+        ohmd_hid_device_info* cur_dev = devs;
 
         if (devs == NULL)
             continue;
@@ -270,18 +269,19 @@ static void _get_device_list(ohmd_driver* driver, ohmd_device_list* list)
             desc->device_flags = OHMD_DEVICE_FLAGS_ROTATIONAL_TRACKING;
 
             strcpy(desc->path, cur_dev->path);
+            ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
             desc->driver_ptr = driver;
             cur_dev = cur_dev->next;
         }
 
-        hid_free_enumeration(devs);
+        ohmd_hid_free_enumeration(driver->ctx, devs);
     }
 }
 
 static void _destroy_driver(ohmd_driver* drv)
 {
     LOGD("shutting down 3Glasses driver");
-    hid_exit();
+    ohmd_hid_exit(drv->ctx);
     free(drv);
 }
 
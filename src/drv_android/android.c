@@ -32,8 +32,6 @@ typedef struct {
 
 //Forward decelerations
 static void set_android_properties(ohmd_device* device, ohmd_device_properties* props);
-static void nofusion_init(fusion* me);
-static void nofusion_update(fusion* me, float dt, const vec3f* accel);
 
 
 //Static variable for timeDelta;
@@ -47,7 +45,7 @@ static int android_sensor_callback(int fd, int events, void* data)
     if (priv->accelerometerSensor != NULL)
     {
         ASensorEvent event;
-        vec3f gyro;
+        vec3f gyro = {{0.0f, 0.0f, 0.0f}};
         vec3f accel;
         vec3f mag;
         float lastevent_timestamp;
@@ -73,15 +71,12 @@ static int android_sensor_callback(int fd, int events, void* data)
             lastevent_timestamp = event.timestamp;
         }
             //apply data to the fusion
-            float dT = 0.0f;
+            uint64_t dt_ns = 0;
             if (timestamp != 0)
-                dT= (lastevent_timestamp - timestamp) * (1.0f / 1000000000.0f);
+                dt_ns = (uint64_t)(lastevent_timestamp - timestamp);
 
-            //Check if accelerometer only fallback is required
-            if (!priv->gyroscopeSensor)
-                nofusion_update(&priv->sensor_fusion, dT, &accel);
-            else
-                ofusion_update(&priv->sensor_fusion, dT, &gyro, &accel, &mag); //default
+            // the events are taken as they are polled, host time for the IMU samples
+            ofusion_update_at(&priv->sensor_fusion, ohmd_monotonic_ns(), dt_ns, &gyro, &accel, &mag);
 
             timestamp = lastevent_timestamp;
     }
@@ -219,12 +214,11 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
     priv->firstRun = 1; //need this since ASensorManager_createEventQueue requires a set android_app*
 
     //Check if accelerometer only fallback is required
+    ofusion_init(&priv->sensor_fusion); //Default when all sensors are available
     if (!priv->gyroscopeSensor)
-        nofusion_init(&priv->sensor_fusion);
-    else {
-        ofusion_init(&priv->sensor_fusion); //Default when all sensors are available
+        ofusion_set_backend(&priv->sensor_fusion, OHMD_FUSION_ACCEL_ONLY);
+    else
         priv->sensor_fusion.flags = 0; // Disable the gravity
-    }
 
 	return (ohmd_device*)priv;
 }
@@ -265,57 +259,6 @@ ohmd_driver* ohmd_create_android_drv(ohmd_context* ctx)
 	return drv;
 }
 
-/* Android specific functions */
-static void nofusion_update(fusion* me, float dt, const vec3f* accel)
-{
-	//avg raw accel data to smooth jitter, and normalise
-	ofq_add(&me->accel_fq, accel);
-	vec3f accel_mean;
-	ofq_get_mean(&me->accel_fq, &accel_mean);
-	vec3f acc_n = accel_mean;
-	ovec3f_normalize_me(&acc_n);
-
-
-	//reference vectors for axis-angle
-	vec3f xyzv[3] = {
-		{1,0,0},
-		{0,1,0},
-		{0,0,1}
-	};
-	quatf roll, pitch;
-
-	//pitch is rot around x, based on gravity in z and y axes
-	oquatf_init_axis(&pitch, xyzv+0, atan2f(-acc_n.z, -acc_n.y));
-
-	//roll is rot around z, based on gravity in x and y axes
-	//note we need to invert the values when the device is upside down (y < 0) for proper results
-	oquatf_init_axis(&roll, xyzv+2, acc_n.y < 0 ? atan2f(-acc_n.x, -acc_n.y) : atan2f(acc_n.x, acc_n.y));
-
-
-
-	quatf or = {0,0,0,1};
-	//order of applying is yaw-pitch-roll
-	//yaw is not possible using only accel
-	oquatf_mult_me(&or, &pitch);
-	oquatf_mult_me(&or, &roll);
-
-	me->orient = or;
-}
-
-//shorter buffers for frame smoothing
-static void nofusion_init(fusion* me)
-{
-	memset(me, 0, sizeof(fusion));
-	me->orient.w = 1.0f;
-
-	ofq_init(&me->mag_fq, 10);
-	ofq_init(&me->accel_fq, 10);
-	ofq_init(&me->ang_vel_fq, 10);
-
-	me->flags = FF_USE_GRAVITY;
-	me->grav_gain = 0.05f;
-}
-
 static void set_android_properties(ohmd_device* device, ohmd_device_properties* props)
 {
     android_priv* priv = (android_priv*)device;
@@ -9,7 +9,6 @@
 
 
 #include <stdlib.h>
-#include <hidapi.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
@@ -18,7 +17,7 @@
 #include "deepoon.h"
 #include "../hid.h"
 
-#define TICK_LEN (1.0f / 1000000.0f) // 1000 Hz ticks
+#define TICK_NS 1000 // 1 MHz ticks
 #define KEEP_ALIVE_VALUE (10 * 1000)
 #define SETFLAG(_s, _flag, _val) (_s) = ((_s) & ~(_flag)) | ((_val) ? (_flag) : 0)
 
@@ -28,14 +27,15 @@
 typedef struct {
 	ohmd_device base;
 
-	hid_device* handle;
+	ohmd_hid_device* handle;
 	pkt_sensor_range sensor_range;
 	pkt_sensor_display_info display_info;
 	rift_coordinate_frame coordinate_frame, hw_coordinate_frame;
 	pkt_sensor_config sensor_config;
 	pkt_tracker_sensor sensor;
-	double last_keep_alive;
+	uint64_t last_keep_alive_ns;
 	fusion sensor_fusion;
+	clock_sync imu_clock;
 	vec3f raw_mag, raw_accel, raw_gyro;
 } rift_priv;
 
@@ -48,12 +48,12 @@ static int get_feature_report(rift_priv* priv, rift_sensor_feature_cmd cmd, unsi
 {
 	memset(buf, 0, FEATURE_BUFFER_SIZE);
 	buf[0] = (unsigned char)cmd;
-	return hid_get_feature_report(priv->handle, buf, FEATURE_BUFFER_SIZE);
+	return ohmd_hid_get_feature_report(priv->handle, buf, FEATURE_BUFFER_SIZE);
 }
 
 static int send_feature_report(rift_priv* priv, const unsigned char *data, size_t length)
 {
-	return hid_send_feature_report(priv->handle, data, length);
+	return ohmd_hid_send_feature_report(priv->handle, data, length);
 }
 
 static void set_coordinate_frame(rift_priv* priv, rift_coordinate_frame coordframe)
@@ -87,10 +87,8 @@ static void set_coordinate_frame(rift_priv* priv, rift_coordinate_frame coordfra
 	}
 }
 
-static void handle_tracker_sensor_msg(rift_priv* priv, unsigned char* buffer, int size)
+static void handle_tracker_sensor_msg(rift_priv* priv, unsigned char* buffer, int size, uint64_t host_ns)
 {
-	uint32_t last_sample_tick = priv->sensor.tick;
-
 	if(!dp_decode_tracker_sensor_msg(&priv->sensor, buffer, size)){
 		LOGE("couldn't decode tracker sensor message");
 	}
@@ -99,21 +97,20 @@ static void handle_tracker_sensor_msg(rift_priv* priv, unsigned char* buffer, in
 
 	dp_dump_packet_tracker_sensor(s);
 
-	uint32_t tick_delta = 1000;
-	if(last_sample_tick > 0) //startup correction
-		tick_delta = s->tick - last_sample_tick;
-
-	float dt = tick_delta * TICK_LEN;
+	uint64_t sample_ns = oclock_sync_update(&priv->imu_clock, s->tick, host_ns);
+	uint64_t dt_ns = priv->imu_clock.dt_ns;
+	if(dt_ns == 0) //startup correction
+		dt_ns = 1000 * TICK_NS;
 	vec3f mag = {{0.0f, 0.0f, 0.0f}};
 
 	for(int i = 0; i < 1; i++){ //just use 1 sample since we don't have sample order for this frame
 		vec3f_from_dp_vec(s->samples[i].accel, &priv->raw_accel);
 		vec3f_from_dp_vec(s->samples[i].gyro, &priv->raw_gyro);
 
-		ofusion_update(&priv->sensor_fusion, dt, &priv->raw_gyro, &priv->raw_accel, &mag);
+		ofusion_update_at(&priv->sensor_fusion, sample_ns, dt_ns, &priv->raw_gyro, &priv->raw_accel, &mag);
 
 		// reset dt to tick_len for the last samples if there were more than one sample
-		dt = TICK_LEN;
+		dt_ns = TICK_NS;
 	}
 }
 
@@ -123,20 +120,20 @@ static void update_device(ohmd_device* device)
 	unsigned char buffer[FEATURE_BUFFER_SIZE];
 
 	// Handle keep alive messages
-	double t = ohmd_get_tick();
-	if(t - priv->last_keep_alive >= (double)priv->sensor_config.keep_alive_interval / 1000.0 - .2){
+	uint64_t t = ohmd_monotonic_ns();
+	if(t - priv->last_keep_alive_ns + 200000000 >= priv->sensor_config.keep_alive_interval * 1000000ull){
 		// send keep alive message
 		pkt_keep_alive keep_alive = { 0, priv->sensor_config.keep_alive_interval };
 		int ka_size = dp_encode_keep_alive(buffer, &keep_alive);
 		send_feature_report(priv, buffer, ka_size);
 
 		// Update the time of the last keep alive we have sent.
-		priv->last_keep_alive = t;
+		priv->last_keep_alive_ns = t;
 	}
 
 	// Read all the messages from the device.
 	while(true){
-		int size = hid_read(priv->handle, buffer, FEATURE_BUFFER_SIZE);
+		int size = ohmd_hid_read(priv->handle, buffer, FEATURE_BUFFER_SIZE);
 		if(size < 0){
 			LOGE("error reading from device");
 			return;
@@ -146,7 +143,7 @@ static void update_device(ohmd_device* device)
 
 		// currently the only message type the hardware supports (I think)
 		if(buffer[0] == RIFT_IRQ_SENSORS || buffer[0] == 11){
-			handle_tracker_sensor_msg(priv, buffer, size);
+			handle_tracker_sensor_msg(priv, buffer, size, priv->handle->read_ns);
 		}else{
 			LOGE("unknown message type: %u", buffer[0]);
 		}
@@ -187,7 +184,7 @@ static void close_device(ohmd_device* device)
 {
 	LOGD("closing device");
 	rift_priv* priv = rift_priv_get(device);
-	hid_close(priv->handle);
+	ohmd_hid_close(priv->handle);
 	free(priv);
 }
 
@@ -200,7 +197,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->base.ctx = driver->ctx;
 
 	// Open the HID device
-	priv->handle = hid_open_path(desc->path);
+	priv->handle = ohmd_hid_open_path(driver->ctx, desc->path);
 
 	if(!priv->handle) {
 		char* path = _hid_to_unix_path(desc->path);
@@ -210,7 +207,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 		goto cleanup;
 	}
 
-	if(hid_set_nonblocking(priv->handle, 1) == -1){
+	if(ohmd_hid_set_nonblocking(priv->handle, 1) == -1){
 		ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 		goto cleanup;
 	}
@@ -235,7 +232,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	send_feature_report(priv, buf, size);
 
 	// Update the time of the last keep alive we have sent.
-	priv->last_keep_alive = ohmd_get_tick();
+	priv->last_keep_alive_ns = ohmd_monotonic_ns();
 
 	// Set default device properties
 	ohmd_set_default_device_properties(&priv->base.properties);
@@ -261,6 +258,8 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 
 	// initialize sensor fusion
 	ofusion_init(&priv->sensor_fusion);
+	oclock_sync_init(&priv->imu_clock, 1000000.0, 32);
+	priv->base.sensor_fusion = &priv->sensor_fusion;
 
 	return &priv->base;
 
@@ -273,8 +272,8 @@ cleanup:
 
 static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 {
-	struct hid_device_info* devs = hid_enumerate(DEEPOON_ID, DEEPOON_HMD);
-	struct hid_device_info* cur_dev = devs;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, DEEPOON_ID, DEEPOON_HMD);
+	ohmd_hid_device_info* cur_dev = devs;
 
 	while (cur_dev) {
 		// This is needed because DeePoon share USB IDs with the Nolo.
@@ -292,18 +291,19 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 
 			desc->revision = 0;
 			strcpy(desc->path, cur_dev->path);
+			ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 			desc->driver_ptr = driver;
 		}
 		cur_dev = cur_dev->next;
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(driver->ctx, devs);
 }
 
 static void destroy_driver(ohmd_driver* drv)
 {
 	LOGD("shutting down driver");
-	hid_exit();
+	ohmd_hid_exit(drv->ctx);
 	free(drv);
 }
 
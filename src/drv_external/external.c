@@ -50,7 +50,8 @@ static int setf(ohmd_device* device, ohmd_float_value type, const float* in)
 
 	switch(type){
 		case OHMD_EXTERNAL_SENSOR_FUSION: {
-				ofusion_update(&priv->sensor_fusion, *in, (vec3f*)(in + 1), (vec3f*)(in + 4), (vec3f*)(in + 7));
+				// the sample arrives now, the application has no way to pass its time
+				ofusion_update_at(&priv->sensor_fusion, ohmd_monotonic_ns(), (uint64_t)llround(*in * 1000000000.0), (vec3f*)(in + 1), (vec3f*)(in + 4), (vec3f*)(in + 7));
 			}
 			break;
 
@@ -100,6 +101,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->base.setf = setf;
 	
 	ofusion_init(&priv->sensor_fusion);
+	priv->base.sensor_fusion = &priv->sensor_fusion;
 
 	return (ohmd_device*)priv;
 }
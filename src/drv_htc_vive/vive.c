@@ -21,10 +21,11 @@
 #define VIVE_LHR                 0x2300 // VIVE PRO
 
 #define VIVE_CLOCK_FREQ 48000000.0f // Hz = 48 MHz
+#define VIVE_SAMPLE_NS 1000000 // the IMU samples at 1 kHz
 
 #include <string.h>
 #include <wchar.h>
-#include <hidapi.h>
+#include "../hid.h"
 #include <assert.h>
 #include <limits.h>
 #include <stdint.h>
@@ -40,16 +41,14 @@ typedef enum {
 typedef struct {
 	ohmd_device base;
 
-	hid_device* hmd_handle;
-	hid_device* imu_handle;
+	ohmd_hid_device* hmd_handle;
+	ohmd_hid_device* imu_handle;
 	fusion sensor_fusion;
 	vec3f raw_accel, raw_gyro;
-	uint32_t last_ticks;
+	clock_sync imu_clock;
+	uint64_t imu_dt_ns; // the last sample interval the clock measured, for the samples it has none for
 	uint8_t last_seq;
 
-	vec3f gyro_error;
-	filter_queue gyro_q;
-
 	vive_revision revision;
 
 	vive_imu_config imu_config;
@@ -76,22 +75,6 @@ static void vec3f_from_vive_vec_gyro(const vive_imu_config* config,
 	out->z = range * config->gyro_scale.z * (float)smp[2] - config->gyro_bias.z;
 }
 
-static bool process_error(vive_priv* priv)
-{
-	if(priv->gyro_q.at >= priv->gyro_q.size - 1)
-		return true;
-
-	ofq_add(&priv->gyro_q, &priv->raw_gyro);
-
-	if(priv->gyro_q.at >= priv->gyro_q.size - 1){
-		ofq_get_mean(&priv->gyro_q, &priv->gyro_error);
-		LOGE("gyro error: %f, %f, %f\n",
-		     priv->gyro_error.x, priv->gyro_error.y, priv->gyro_error.z);
-	}
-
-	return false;
-}
-
 static vive_headset_imu_sample* get_next_sample(vive_headset_imu_packet* pkt,
                                                 int last_seq)
 {
@@ -123,25 +106,23 @@ static vive_headset_imu_sample* get_next_sample(vive_headset_imu_packet* pkt,
 	return NULL;
 }
 
-static void handle_imu_packet(vive_priv* priv, unsigned char *buffer, int size)
+static void handle_imu_packet(vive_priv* priv, unsigned char *buffer, int size, uint64_t host_ns)
 {
 	vive_headset_imu_packet pkt;
+
+	OHMD_TRACE_BEGIN("vive_decode_sensor_packet");
 	vive_decode_sensor_packet(&pkt, buffer, size);
+	OHMD_TRACE_END();
 
 	vive_headset_imu_sample* smp = NULL;
+	fusion_sample samples[3];
+	int num_samples = 0;
 
 	while((smp = get_next_sample(&pkt, priv->last_seq)) != NULL)
 	{
-		if(priv->last_ticks == 0)
-			priv->last_ticks = smp->time_ticks;
-
-		uint32_t t1, t2;
-		t1 = smp->time_ticks;
-		t2 = priv->last_ticks;
-
-		float dt = (t1 - t2) / VIVE_CLOCK_FREQ;
-
-		priv->last_ticks = smp->time_ticks;
+		uint64_t sample_ns = oclock_sync_update(&priv->imu_clock, smp->time_ticks, host_ns);
+		if(priv->imu_clock.dt_ns > 0)
+			priv->imu_dt_ns = priv->imu_clock.dt_ns;
 
 		vec3f_from_vive_vec_accel(&priv->imu_config, smp->acc, &priv->raw_accel);
 		vec3f_from_vive_vec_gyro(&priv->imu_config, smp->rot, &priv->raw_gyro);
@@ -164,17 +145,22 @@ static void handle_imu_packet(vive_priv* priv, unsigned char *buffer, int size)
 				LOGE("Unknown VIVE revision.\n");
 		}
 
-		if(process_error(priv)){
-			vec3f mag = {{0.0f, 0.0f, 0.0f}};
-			vec3f gyro;
-			ovec3f_subtract(&priv->raw_gyro, &priv->gyro_error, &gyro);
-
-			ofusion_update(&priv->sensor_fusion, dt,
-			               &gyro, &priv->raw_accel, &mag);
+		// the fusion estimates what is left of the gyro bias after the factory calibration
+		if(num_samples < 3){
+			fusion_sample* fs = samples + num_samples++;
+			fs->sample_ns = sample_ns;
+			fs->dt_ns = priv->imu_dt_ns;
+			fs->ang_vel = priv->raw_gyro;
+			fs->accel = priv->raw_accel;
+			fs->mag = (vec3f){{0.0f, 0.0f, 0.0f}};
 		}
 
 		priv->last_seq = smp->seq;
 	}
+
+	OHMD_TRACE_BEGIN("ofusion_update");
+	ofusion_update_batch(&priv->sensor_fusion, samples, num_samples);
+	OHMD_TRACE_END();
 }
 
 static void update_device(ohmd_device* device)
@@ -185,13 +171,15 @@ static void update_device(ohmd_device* device)
 
 	unsigned char buffer[FEATURE_BUFFER_SIZE];
 
-	while((size = hid_read(priv->imu_handle, buffer, FEATURE_BUFFER_SIZE)) > 0) {
+	OHMD_TRACE_BEGIN("vive_hid_read");
+	while((size = ohmd_hid_read(priv->imu_handle, buffer, FEATURE_BUFFER_SIZE)) > 0) {
 		if(buffer[0] == VIVE_HMD_IMU_PACKET_ID){
-			handle_imu_packet(priv, buffer, size);
+			handle_imu_packet(priv, buffer, size, priv->imu_handle->read_ns);
 		}else{
 			LOGE("unknown message type: %u", buffer[0]);
 		}
 	}
+	OHMD_TRACE_END();
 
 	if(size < 0){
 		LOGE("error reading from device");
@@ -235,18 +223,18 @@ static void close_device(ohmd_device* device)
 	// turn the display off
 	switch (priv->revision) {
 		case REV_VIVE:
-			hret = hid_send_feature_report(priv->hmd_handle,
+			hret = ohmd_hid_send_feature_report(priv->hmd_handle,
 			                               vive_magic_power_off1,
 			                               sizeof(vive_magic_power_off1));
 			LOGI("power off magic 1: %d\n", hret);
 
-			hret = hid_send_feature_report(priv->hmd_handle,
+			hret = ohmd_hid_send_feature_report(priv->hmd_handle,
 			                               vive_magic_power_off2,
 			                               sizeof(vive_magic_power_off2));
 			LOGI("power off magic 2: %d\n", hret);
 			break;
 		case REV_VIVE_PRO:
-			hret = hid_send_feature_report(priv->hmd_handle,
+			hret = ohmd_hid_send_feature_report(priv->hmd_handle,
 			                               vive_pro_magic_power_off,
 			                               sizeof(vive_pro_magic_power_off));
 			LOGI("vive pro power off magic: %d\n", hret);
@@ -255,19 +243,19 @@ static void close_device(ohmd_device* device)
 			LOGE("Unknown VIVE revision.\n");
 	}
 
-	hid_close(priv->hmd_handle);
-	hid_close(priv->imu_handle);
+	ohmd_hid_close(priv->hmd_handle);
+	ohmd_hid_close(priv->imu_handle);
 
 	free(device);
 }
 
 #if 0
-static void dump_indexed_string(hid_device* device, int index)
+static void dump_indexed_string(ohmd_hid_device* device, int index)
 {
 	wchar_t wbuffer[512] = {0};
 	char buffer[1024] = {0};
 
-	int hret = hid_get_indexed_string(device, index, wbuffer, 511);
+	int hret = ohmd_hid_get_indexed_string(device, index, wbuffer, 511);
 
 	if(hret == 0){
 		wcstombs(buffer, wbuffer, sizeof(buffer));
@@ -276,8 +264,8 @@ static void dump_indexed_string(hid_device* device, int index)
 }
 #endif
 
-static void dump_info_string(int (*fun)(hid_device*, wchar_t*, size_t),
-                            const char* what, hid_device* device)
+static void dump_info_string(int (*fun)(ohmd_hid_device*, wchar_t*, size_t),
+                             const char* what, ohmd_hid_device* device)
 {
 	wchar_t wbuffer[512] = {0};
 	char buffer[1024] = {0};
@@ -303,21 +291,21 @@ static void dumpbin(const char* label, const unsigned char* data, int length)
 }
 #endif
 
-static hid_device* open_device_idx(int manufacturer, int product, int iface,
-                                   int iface_tot, int device_index)
+static ohmd_hid_device* open_device_idx(ohmd_context* ctx, int manufacturer, int product, int iface,
+                                        int iface_tot, int device_index)
 {
-	struct hid_device_info* devs = hid_enumerate(manufacturer, product);
-	struct hid_device_info* cur_dev = devs;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(ctx, manufacturer, product);
+	ohmd_hid_device_info* cur_dev = devs;
 
 	int idx = 0;
 	int iface_cur = 0;
-	hid_device* ret = NULL;
+	ohmd_hid_device* ret = NULL;
 
 	while (cur_dev) {
 		LOGI("%04x:%04x %s\n", manufacturer, product, cur_dev->path);
 
 		if(idx == device_index && iface == iface_cur){
-			ret = hid_open_path(cur_dev->path);
+			ret = ohmd_hid_open_path(ctx, cur_dev->path);
 			LOGI("opening\n");
 		}
 
@@ -331,12 +319,12 @@ static hid_device* open_device_idx(int manufacturer, int product, int iface,
 		}
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(ctx, devs);
 
 	return ret;
 }
 
-static int vive_read_firmware(hid_device* device)
+static int vive_read_firmware(ohmd_hid_device* device)
 {
 	vive_firmware_version_packet packet = {
 		.id = VIVE_FIRMWARE_VERSION_PACKET_ID,
@@ -345,7 +333,7 @@ static int vive_read_firmware(hid_device* device)
 	int bytes;
 
 	LOGI("Getting vive_firmware_version_packet...");
-	bytes = hid_get_feature_report(device,
+	bytes = ohmd_hid_get_feature_report(device,
 	                               (unsigned char*) &packet,
 	                               sizeof(packet));
 
@@ -375,14 +363,14 @@ static int vive_read_config(vive_priv* priv)
 	int bytes;
 
 	LOGI("Getting vive_config_start_packet...");
-	bytes = hid_get_feature_report(priv->imu_handle,
+	bytes = ohmd_hid_get_feature_report(priv->imu_handle,
 	                               (unsigned char*) &start_packet,
 	                               sizeof(start_packet));
 
 	if (bytes < 0)
 	{
 		LOGE("Could not get vive_config_start_packet: %ls (%d)",
-		     hid_error(priv->imu_handle), bytes);
+		     ohmd_hid_error(priv->imu_handle), bytes);
 		return bytes;
 	}
 
@@ -396,7 +384,7 @@ static int vive_read_config(vive_priv* priv)
 
 	int offset = 0;
 	do {
-		bytes = hid_get_feature_report(priv->imu_handle,
+		bytes = ohmd_hid_get_feature_report(priv->imu_handle,
 		                               (unsigned char*) &read_packet,
 		                               sizeof(read_packet));
 
@@ -423,7 +411,7 @@ static int vive_get_range_packet(vive_priv* priv)
 		.id = VIVE_IMU_RANGE_MODES_PACKET_ID
 	};
 
-	ret = hid_get_feature_report(priv->imu_handle,
+	ret = ohmd_hid_get_feature_report(priv->imu_handle,
 	                             (unsigned char*) &packet,
 	                             sizeof(packet));
 
@@ -436,7 +424,7 @@ static int vive_get_range_packet(vive_priv* priv)
 	if (!packet.gyro_range || !packet.accel_range)
 	{
 		LOGW("Invalid gyroscope and accelerometer data. Trying to fetch again.");
-		ret = hid_get_feature_report(priv->imu_handle,
+		ret = ohmd_hid_get_feature_report(priv->imu_handle,
 		                             (unsigned char*) &packet,
 		                             sizeof(packet));
 		if (ret < 0)
@@ -496,10 +484,10 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	// Open the HMD device
 	switch (desc->revision) {
 		case REV_VIVE:
-			priv->hmd_handle = open_device_idx(HTC_ID, VIVE_HMD, 0, 1, idx);
+			priv->hmd_handle = open_device_idx(driver->ctx, HTC_ID, VIVE_HMD, 0, 1, idx);
 			break;
 		case REV_VIVE_PRO:
-			priv->hmd_handle = open_device_idx(HTC_ID, VIVE_PRO_HMD, 0, 1, idx);
+			priv->hmd_handle = open_device_idx(driver->ctx, HTC_ID, VIVE_PRO_HMD, 0, 1, idx);
 			break;
 		default:
 			LOGE("Unknown VIVE revision.\n");
@@ -508,18 +496,18 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	if(!priv->hmd_handle)
 		goto cleanup;
 
-	if(hid_set_nonblocking(priv->hmd_handle, 1) == -1){
+	if(ohmd_hid_set_nonblocking(priv->hmd_handle, 1) == -1){
 		ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 		goto cleanup;
 	}
 
 	switch (desc->revision) {
 		case REV_VIVE:
-			priv->imu_handle = open_device_idx(VALVE_ID,
+			priv->imu_handle = open_device_idx(driver->ctx, VALVE_ID,
 			                                   VIVE_LIGHTHOUSE_FPGA_RX, 0, 2, idx);
 			break;
 		case REV_VIVE_PRO:
-			priv->imu_handle = open_device_idx(VALVE_ID, VIVE_LHR, 0, 1, idx);
+			priv->imu_handle = open_device_idx(driver->ctx, VALVE_ID, VIVE_LHR, 0, 1, idx);
 			break;
 		default:
 			LOGE("Unknown VIVE revision.\n");
@@ -528,20 +516,20 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	if(!priv->imu_handle)
 		goto cleanup;
 
-	if(hid_set_nonblocking(priv->imu_handle, 1) == -1){
+	if(ohmd_hid_set_nonblocking(priv->imu_handle, 1) == -1){
 		ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 		goto cleanup;
 	}
 
-	dump_info_string(hid_get_manufacturer_string,
+	dump_info_string(ohmd_hid_get_manufacturer_string,
 	                 "manufacturer", priv->hmd_handle);
-	dump_info_string(hid_get_product_string, "product", priv->hmd_handle);
-	dump_info_string(hid_get_serial_number_string,
+	dump_info_string(ohmd_hid_get_product_string, "product", priv->hmd_handle);
+	dump_info_string(ohmd_hid_get_serial_number_string,
 	                 "serial number", priv->hmd_handle);
 
 #if 0
 	// enable lighthouse
-	hret = hid_send_feature_report(priv->hmd_handle,
+	hret = ohmd_hid_send_feature_report(priv->hmd_handle,
 	                               vive_magic_enable_lighthouse,
 	                               sizeof(vive_magic_enable_lighthouse));
 	LOGD("enable lighthouse magic: %d\n", hret);
@@ -585,7 +573,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 			}
 
 			// turn the display on
-			hret = hid_send_feature_report(priv->hmd_handle,
+			hret = ohmd_hid_send_feature_report(priv->hmd_handle,
 			                               vive_magic_power_on,
 			                               sizeof(vive_magic_power_on));
 			LOGI("power on magic: %d\n", hret);
@@ -593,13 +581,13 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 			break;
 		case REV_VIVE_PRO:
 			// turn the display on
-			hret = hid_send_feature_report(priv->hmd_handle,
+			hret = ohmd_hid_send_feature_report(priv->hmd_handle,
 			                               vive_pro_magic_power_on,
 			                               sizeof(vive_pro_magic_power_on));
 			LOGI("power on magic: %d\n", hret);
 
 			// Enable VIVE Pro IMU
-			hret = hid_send_feature_report(priv->imu_handle,
+			hret = ohmd_hid_send_feature_report(priv->imu_handle,
 			                               vive_pro_enable_imu,
 			                               sizeof(vive_pro_enable_imu));
 			LOGI("Enable Pro IMU magic: %d\n", hret);
@@ -652,8 +640,9 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->base.getf = getf;
 
 	ofusion_init(&priv->sensor_fusion);
-
-	ofq_init(&priv->gyro_q, 128);
+	oclock_sync_init(&priv->imu_clock, VIVE_CLOCK_FREQ, 32);
+	priv->imu_dt_ns = VIVE_SAMPLE_NS;
+	priv->base.sensor_fusion = &priv->sensor_fusion;
 
 	return (ohmd_device*)priv;
 
@@ -667,17 +656,17 @@ cleanup:
 static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 {
 	vive_revision rev;
-	struct hid_device_info* devs = hid_enumerate(HTC_ID, VIVE_HMD);
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, HTC_ID, VIVE_HMD);
 
 	if (devs != NULL) {
 		rev = REV_VIVE;
 	} else {
-		devs = hid_enumerate(HTC_ID, VIVE_PRO_HMD);
+		devs = ohmd_hid_enumerate(driver->ctx, HTC_ID, VIVE_PRO_HMD);
 		if (devs != NULL)
 			rev = REV_VIVE_PRO;
 	}
 
-	struct hid_device_info* cur_dev = devs;
+	ohmd_hid_device_info* cur_dev = devs;
 
 	int idx = 0;
 	while (cur_dev) {
@@ -690,6 +679,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 		desc->revision = rev;
 
 		snprintf(desc->path, OHMD_STR_SIZE, "%d", idx);
+		ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 		desc->driver_ptr = driver;
 		desc->device_class = OHMD_DEVICE_CLASS_HMD;
@@ -699,7 +689,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 		idx++;
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(driver->ctx, devs);
 }
 
 static void destroy_driver(ohmd_driver* drv)
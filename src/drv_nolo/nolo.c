@@ -18,10 +18,7 @@
 #include "nolo.h"
 #include "../hid.h"
 
-#define TICK_LEN (1.0f / 120000.0f) // 120 Hz ticks
-
 static const int controllerLength = 3 + (3+4)*2 + 2 + 2 + 1;
-static devices_t* nolo_devices;
 
 static drv_priv* drv_priv_get(ohmd_device* device)
 {
@@ -42,29 +39,33 @@ static void gyro_from_nolo_vec(const int16_t* smp, vec3f* out_vec)
 	out_vec->z = -(float)smp[2];
 }
 
-static void handle_tracker_sensor_msg(drv_priv* priv, unsigned char* buffer, int size, int type)
+static void handle_tracker_sensor_msg(drv_priv* priv, unsigned char* buffer, int size, int type, uint64_t host_ns)
 {
 	uint64_t last_sample_tick = priv->sample.tick;
 
 	//Type 0 is Head Tracker, type 1 is Controller
+	OHMD_TRACE_BEGIN("nolo_decode");
 	switch(type) {
 		case 0: nolo_decode_hmd_marker(priv, buffer); break;
 		case 1: nolo_decode_controller(priv, buffer); break;
 	}
+	OHMD_TRACE_END();
 	
-	priv->sample.tick = ohmd_monotonic_get(priv->base.ctx);
+	// The samples carry no device time, use the time the host read them at
+	priv->sample.tick = host_ns;
 
 	// Startup correction, ignore last_sample_tick if zero.
 	uint64_t tick_delta = 0;
 	if(last_sample_tick > 0) //startup correction
 		tick_delta = priv->sample.tick - last_sample_tick;
 
-	float dt = (tick_delta/(float)priv->base.ctx->monotonic_ticks_per_sec)/1000.0f;
-
 	vec3f mag = {{0.0f, 0.0f, 0.0f}};
 	accel_from_nolo_vec(priv->sample.accel, &priv->raw_gyro);
 	gyro_from_nolo_vec(priv->sample.gyro, &priv->raw_accel);
-	ofusion_update(&priv->sensor_fusion, dt, &priv->raw_gyro, &priv->raw_accel, &mag);
+
+	OHMD_TRACE_BEGIN("ofusion_update");
+	ofusion_update_at(&priv->sensor_fusion, host_ns, tick_delta / 1000, &priv->raw_gyro, &priv->raw_accel, &mag);
+	OHMD_TRACE_END();
 }
 
 static void update_device(ohmd_device* device)
@@ -76,34 +77,24 @@ static void update_device(ohmd_device* device)
 	if (priv->id != 0)
 		return;
 
-	devices_t* current = nolo_devices;
-	drv_priv* controller0 = NULL;
-	drv_priv* controller1 = NULL;
-
-	//Check if controllers exist
-	while (current != NULL) {
-		if (current->drv->hmd_tracker == priv)
-		{
-			if (current->drv->controller0)
-				controller0 = current->drv->controller0;
-			if (current->drv->controller1)
-				controller1 = current->drv->controller1;
-			break;
-		}
-		current = current->next;
-	}
+	//Controllers of the same group, if opened
+	drv_priv* controller0 = priv->group->controller0;
+	drv_priv* controller1 = priv->group->controller1;
 
 	// Read all the messages from the device.
+	OHMD_TRACE_BEGIN("nolo_hid_read");
 	while(true){
-		int size = hid_read(priv->handle, buffer, FEATURE_BUFFER_SIZE);
+		int size = ohmd_hid_read(priv->handle, buffer, FEATURE_BUFFER_SIZE);
 		if(size < 0){
 			LOGE("error reading from device");
-			return;
+			break;
 		} else if(size == 0) {
-			return; // No more messages, return.
+			break; // No more messages, return.
 		}
 
+		OHMD_TRACE_BEGIN("nolo_decrypt_data");
 		nolo_decrypt_data(buffer);
+		OHMD_TRACE_END();
 
 		// currently the only message type the hardware supports
 		switch (buffer[0]) {
@@ -122,24 +113,24 @@ static void update_device(ohmd_device* device)
 			case NOLO_CONTROLLER_0_HMD_SMP1:
 			{
 				if (controller0)
-					handle_tracker_sensor_msg(controller0, buffer, size, 1);
+					handle_tracker_sensor_msg(controller0, buffer, size, 1, priv->handle->read_ns);
 
-				handle_tracker_sensor_msg(priv, buffer, size, 0);
+				handle_tracker_sensor_msg(priv, buffer, size, 0, priv->handle->read_ns);
 				break;
 			}
 			case NOLO_CONTROLLER_1_HMD_SMP2:
 			{
 				if (controller1)
-					handle_tracker_sensor_msg(controller1, buffer, size, 1);
+					handle_tracker_sensor_msg(controller1, buffer, size, 1, priv->handle->read_ns);
 
-				handle_tracker_sensor_msg(priv, buffer, size, 0);
+				handle_tracker_sensor_msg(priv, buffer, size, 0, priv->handle->read_ns);
 				break;
 			}
 			default:
 				LOGE("unknown message type: %u", buffer[0]);
 		}
 	}
-	return;
+	OHMD_TRACE_END();
 }
 
 static int getf(ohmd_device* device, ohmd_float_value type, float* out)
@@ -192,18 +183,27 @@ static void close_device(ohmd_device* device)
 {
 	LOGD("closing device");
 	drv_priv* priv = drv_priv_get(device);
-	hid_close(priv->handle);
+
+	//Remove from the group so the tracker stops updating it
+	if (priv->group->hmd_tracker == priv)
+		priv->group->hmd_tracker = NULL;
+	if (priv->group->controller0 == priv)
+		priv->group->controller0 = NULL;
+	if (priv->group->controller1 == priv)
+		priv->group->controller1 = NULL;
+
+	ohmd_hid_close(priv->handle);
 	free(priv);
 }
 
-static void push_device(devices_t * head, drv_nolo* val) {
-	devices_t* current = head;
+static void push_device(nolo_driver* driver, drv_nolo* val) {
+	devices_t* current = driver->devices;
 
-	if (!nolo_devices)
+	if (!driver->devices)
 	{
-		nolo_devices = calloc(1, sizeof(devices_t));
-		nolo_devices->drv = val;
-		nolo_devices->next = NULL;
+		driver->devices = calloc(1, sizeof(devices_t));
+		driver->devices->drv = val;
+		driver->devices->next = NULL;
 		return;
 	}
 
@@ -230,7 +230,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	// Open the HID device when physical device
 	if (priv->id == 0)
 	{
-		priv->handle = hid_open_path(desc->path);
+		priv->handle = ohmd_hid_open_path(driver->ctx, desc->path);
 
 		if(!priv->handle) {
 			char* path = _hid_to_unix_path(desc->path);
@@ -240,14 +240,14 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 			goto cleanup;
 		}
 
-		if(hid_set_nonblocking(priv->handle, 1) == -1){
+		if(ohmd_hid_set_nonblocking(priv->handle, 1) == -1){
 			ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 			goto cleanup;
 		}
 
 	}
 
-	devices_t* current = nolo_devices;
+	devices_t* current = ((nolo_driver*)driver)->devices;
 	drv_nolo* mNOLO = NULL;
 
 	//Check if the opened device is part of a group
@@ -265,9 +265,11 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 		mNOLO->controller0 = NULL;
 		mNOLO->controller1 = NULL;
 		strcpy(mNOLO->path, desc->path);
-		push_device(nolo_devices, mNOLO);
+		push_device((nolo_driver*)driver, mNOLO);
 	}
 
+	priv->group = mNOLO;
+
 	if (priv->id == 0) {
 		mNOLO->hmd_tracker = priv;
 	}
@@ -321,6 +323,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->base.getf = getf;
 
 	ofusion_init(&priv->sensor_fusion);
+	priv->base.sensor_fusion = &priv->sensor_fusion;
 
 	return &priv->base;
 
@@ -337,7 +340,7 @@ typedef struct {
 	int product;
 } nolo_verions;
 
-static int is_nolo_device(struct hid_device_info* device)
+static int is_nolo_device(ohmd_hid_device_info* device)
 {
 	if (!ohmd_wstring_match(device->manufacturer_string, L"LYRobotix")) {
 		return 0;
@@ -362,8 +365,8 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 	};
 
 	for(int i = 0; i < 2; i++) {
-		struct hid_device_info* devs = hid_enumerate(rd[i].vendor, rd[i].product);
-		struct hid_device_info* cur_dev = devs;
+		ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, rd[i].vendor, rd[i].product);
+		ohmd_hid_device_info* cur_dev = devs;
 
 		int id = 0;
 		while (cur_dev && is_nolo_device(cur_dev)) {
@@ -376,6 +379,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 			desc->revision = is_nolo_device(cur_dev);
 
 			strcpy(desc->path, cur_dev->path);
+			ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 			desc->device_flags = OHMD_DEVICE_FLAGS_POSITIONAL_TRACKING | OHMD_DEVICE_FLAGS_ROTATIONAL_TRACKING;
 			desc->device_class = OHMD_DEVICE_CLASS_HMD;
@@ -391,6 +395,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 			strcpy(desc->product, "NOLO CV1: Controller 0");
 
 			strcpy(desc->path, cur_dev->path);
+			ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 			desc->device_flags =
 				OHMD_DEVICE_FLAGS_POSITIONAL_TRACKING |
@@ -410,6 +415,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 			strcpy(desc->product, "NOLO CV1: Controller 1");
 
 			strcpy(desc->path, cur_dev->path);
+			ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 			desc->device_flags =
 				OHMD_DEVICE_FLAGS_POSITIONAL_TRACKING |
@@ -423,23 +429,34 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 
 			cur_dev = cur_dev->next;
 		}
-		hid_free_enumeration(devs);
+		ohmd_hid_free_enumeration(driver->ctx, devs);
 	}
 }
 
 static void destroy_driver(ohmd_driver* drv)
 {
 	LOGD("shutting down NOLO CV1 driver");
-	hid_exit();
+
+	devices_t* current = ((nolo_driver*)drv)->devices;
+	while (current != NULL) {
+		devices_t* next = current->next;
+		free(current->drv);
+		free(current);
+		current = next;
+	}
+
+	ohmd_hid_exit(drv->ctx);
 	free(drv);
 }
 
 ohmd_driver* ohmd_create_nolo_drv(ohmd_context* ctx)
 {
-	ohmd_driver* drv = ohmd_alloc(ctx, sizeof(ohmd_driver));
-	if(drv == NULL)
+	nolo_driver* nolo = ohmd_alloc(ctx, sizeof(nolo_driver));
+	if(nolo == NULL)
 		return NULL;
 
+	ohmd_driver* drv = &nolo->base;
+
 	drv->get_device_list = get_device_list;
 	drv->open_device = open_device;
 	drv->destroy = destroy_driver;
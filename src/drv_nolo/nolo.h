@@ -12,7 +12,7 @@
 #define NOLODRIVER_H
 
 #include "../openhmdi.h"
-#include <hidapi.h>
+#include "../hid.h"
 
 #define FEATURE_BUFFER_SIZE 64
 
@@ -23,10 +23,13 @@ typedef struct
 	uint64_t tick;
 } nolo_sample;
 
+typedef struct drv_nolo_s drv_nolo;
+
 typedef struct {
 	ohmd_device base;
 
-	hid_device* handle;
+	ohmd_hid_device* handle;
+	drv_nolo* group;
 	int id;
 	int rev;
 	float controller_values[8];
@@ -46,18 +49,23 @@ typedef enum
 	NOLO_CONTROLLER_1_HMD_SMP2 = 17,
 } nolo_irq_cmd;
 
-typedef struct{
+struct drv_nolo_s {
 	char path[OHMD_STR_SIZE];
 	drv_priv* hmd_tracker;
 	drv_priv* controller0;
 	drv_priv* controller1;
-} drv_nolo;
+};
 
 typedef struct devices{
 	drv_nolo* drv;
 	struct devices * next;
 } devices_t;
 
+typedef struct {
+	ohmd_driver base;
+	devices_t* devices;
+} nolo_driver;
+
 void btea_decrypt(uint32_t *v, int n, int base_rounds, uint32_t const key[4]);
 void nolo_decrypt_data(unsigned char* buf);
 
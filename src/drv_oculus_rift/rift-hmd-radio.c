@@ -10,43 +10,47 @@
 #include "rift-hmd-radio.h"
 #include "../ext_deps/nxjson.h"
 
-static int get_feature_report(hid_device *handle, rift_sensor_feature_cmd cmd, unsigned char* buf)
+static int get_feature_report(ohmd_hid_device *handle, rift_sensor_feature_cmd cmd, unsigned char* buf)
 {
 	memset(buf, 0, FEATURE_BUFFER_SIZE);
 	buf[0] = (unsigned char)cmd;
-	return hid_get_feature_report(handle, buf, FEATURE_BUFFER_SIZE);
+	return ohmd_hid_get_feature_report(handle, buf, FEATURE_BUFFER_SIZE);
 }
 
-static int send_feature_report(hid_device *handle, unsigned char* buf, int length)
+static int send_feature_report(ohmd_hid_device *handle, unsigned char* buf, int length)
 {
-	return hid_send_feature_report(handle, buf, length);
+	return ohmd_hid_send_feature_report(handle, buf, length);
 }
 
-static bool rift_hmd_radio_send_cmd(hid_device *handle, uint8_t a, uint8_t b, uint8_t c)
+static bool rift_hmd_radio_send_cmd(ohmd_hid_device *handle, uint8_t a, uint8_t b, uint8_t c)
 {
 	unsigned char buffer[FEATURE_BUFFER_SIZE];
 	int cmd_size = encode_radio_control_cmd(buffer, a, b, c);
 	int ret_size;
+	bool ret = false;
+
+	OHMD_TRACE_BEGIN("rift_hmd_radio_send_cmd");
 
 	if (send_feature_report(handle, buffer, cmd_size) < 0)
-		return false;
+		goto done;
 
 	do {
 		ret_size = get_feature_report(handle, RIFT_CMD_RADIO_CONTROL, buffer);
 		if (ret_size < 1) {
 			LOGE("HMD radio command 0x%02x/%02x/%02x failed - response too small", a, b, c);
-			return false;
+			goto done;
 		}
 	} while (buffer[3] & 0x80);
 
 	/* 0x08 means the device isn't responding */
-	if (buffer[3] & 0x08)
-		return false;
+	ret = !(buffer[3] & 0x08);
 
-	return true;
+done:
+	OHMD_TRACE_END();
+	return ret;
 }
 
-static int rift_radio_read_flash(hid_device *handle, uint8_t device_type,
+static int rift_radio_read_flash(ohmd_hid_device *handle, uint8_t device_type,
 				uint16_t offset, uint16_t length, uint8_t *flash_data)
 {
 	int ret;
@@ -73,13 +77,13 @@ done:
 	return ret;
 }
 
-static int rift_radio_read_calibration_hash(hid_device *handle, uint8_t device_type,
+static int rift_radio_read_calibration_hash(ohmd_hid_device *handle, uint8_t device_type,
 					    uint8_t hash[16])
 {
 	return rift_radio_read_flash(handle, device_type, 0x1bf0, 16, hash);
 }
 
-static int rift_radio_read_calibration(hid_device *handle, uint8_t device_type,
+static int rift_radio_read_calibration(ohmd_hid_device *handle, uint8_t device_type,
 		char **json_out, uint16_t *length)
 {
 	char *json;
@@ -199,7 +203,7 @@ fail:
 	return -1;
 }
 
-int rift_touch_get_calibration(hid_device *handle, int device_id,
+int rift_touch_get_calibration(ohmd_hid_device *handle, int device_id,
 		rift_touch_calibration *calibration)
 {
 	uint8_t hash[16];
@@ -228,7 +232,7 @@ int rift_touch_get_calibration(hid_device *handle, int device_id,
 	return 0;
 }
 
-bool rift_hmd_radio_get_address(hid_device *handle, uint8_t radio_address[5])
+bool rift_hmd_radio_get_address(ohmd_hid_device *handle, uint8_t radio_address[5])
 {
 	unsigned char buf[FEATURE_BUFFER_SIZE];
 	int ret_size;
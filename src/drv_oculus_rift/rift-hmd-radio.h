@@ -7,11 +7,11 @@
 #ifndef RIFT_HMD_RADIO_H
 #define RIFT_HMD_RADIO_H
 
-#include <hidapi.h>
+#include "../hid.h"
 #include "rift.h"
 
-int rift_touch_get_calibration(hid_device *handle,
+int rift_touch_get_calibration(ohmd_hid_device *handle,
 		int device_id,
 		rift_touch_calibration *calibration);
-bool rift_hmd_radio_get_address(hid_device *handle, uint8_t address[5]);
+bool rift_hmd_radio_get_address(ohmd_hid_device *handle, uint8_t address[5]);
 #endif /* RIFT_HMD_RADIO_H */
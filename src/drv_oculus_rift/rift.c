@@ -12,7 +12,6 @@
 
 
 #include <stdlib.h>
-#include <hidapi.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
@@ -29,23 +28,27 @@
 #define SAMSUNG_ELECTRONICS_CO_ID 0x04e8
 #define RIFT_CV1_PID 0x0031
 
-#define TICK_LEN (1.0f / 1000.0f) // 1000 Hz ticks
+#define TICK_NS 1000000 // 1000 Hz ticks
+#define TOUCH_TICK_NS 2000000 // the Touch controllers report at about 500 Hz
 #define KEEP_ALIVE_VALUE (10 * 1000)
 #define SETFLAG(_s, _flag, _val) (_s) = ((_s) & ~(_flag)) | ((_val) ? (_flag) : 0)
 
+typedef struct rift_driver_s rift_driver;
+
 struct rift_hmd_s {
 	ohmd_context* ctx;
+	rift_driver* driver;
 	int use_count;
 
-	hid_device* handle;
-	hid_device* radio_handle;
+	ohmd_hid_device* handle;
+	ohmd_hid_device* radio_handle;
 	pkt_sensor_range sensor_range;
 	pkt_sensor_display_info display_info;
 	rift_coordinate_frame coordinate_frame, hw_coordinate_frame;
 	pkt_sensor_config sensor_config;
 	pkt_tracker_sensor sensor;
-	uint32_t last_imu_timestamp;
-	double last_keep_alive;
+	clock_sync imu_clock;
+	uint64_t last_keep_alive_ns;
 	fusion sensor_fusion;
 	vec3f raw_mag, raw_accel, raw_gyro;
 
@@ -72,6 +75,12 @@ struct device_list_s {
 	device_list_t* next;
 };
 
+/* Per context driver state, holds the list of (probably 1) active HMD devices */
+struct rift_driver_s {
+	ohmd_driver base;
+	device_list_t* hmds;
+};
+
 typedef enum {
 	REV_DK1,
 	REV_DK2,
@@ -88,15 +97,12 @@ typedef struct {
 	rift_revision rev;
 } rift_devices;
 
-/* Global list of (probably 1) active HMD devices */
-static device_list_t* rift_hmds;
-
-static hid_device* open_hid_dev (ohmd_context* ctx, int vid, int pid, int iface_num);
+static ohmd_hid_device* open_hid_dev (ohmd_context* ctx, int vid, int pid, int iface_num);
 static void close_hmd (rift_hmd_t *hmd);
 
-static rift_hmd_t *find_hmd(char *hid_path)
+static rift_hmd_t *find_hmd(rift_driver *driver, char *hid_path)
 {
-	device_list_t* current = rift_hmds;
+	device_list_t* current = driver->hmds;
 
 	while (current != NULL) {
 		if (strcmp(current->path, hid_path)==0) {
@@ -108,19 +114,21 @@ static rift_hmd_t *find_hmd(char *hid_path)
 	return NULL;
 }
 
-static void push_hmd(rift_hmd_t *hmd, char *hid_path)
+static void push_hmd(rift_driver *driver, rift_hmd_t *hmd, char *hid_path)
 {
 	device_list_t* d = calloc(1, sizeof(device_list_t));
 	d->hmd = hmd;
 	strcpy (d->path, hid_path);
 
-	d->next = rift_hmds;
-	rift_hmds = d;
+	hmd->driver = driver;
+	d->next = driver->hmds;
+	driver->hmds = d;
 }
 
 static void release_hmd(rift_hmd_t *hmd)
 {
 	device_list_t* current, *prev;
+	rift_driver* driver;
 
 	if (hmd->use_count > 1) {
 		hmd->use_count--;
@@ -129,14 +137,15 @@ static void release_hmd(rift_hmd_t *hmd)
 
 	/* Use count on the HMD device hit 0, release it
 	 * and remove from the list */
-	current = rift_hmds;
+	driver = hmd->driver;
+	current = driver->hmds;
 	prev = NULL;
 	while (current != NULL) {
 		if (current->hmd == hmd) {
 			close_hmd (current->hmd);
 
 			if (prev == NULL)
-				rift_hmds = current->next;
+				driver->hmds = current->next;
 			else
 				prev->next = current->next;
 			free (current);
@@ -158,12 +167,12 @@ static int get_feature_report(rift_hmd_t* priv, rift_sensor_feature_cmd cmd, uns
 {
 	memset(buf, 0, FEATURE_BUFFER_SIZE);
 	buf[0] = (unsigned char)cmd;
-	return hid_get_feature_report(priv->handle, buf, FEATURE_BUFFER_SIZE);
+	return ohmd_hid_get_feature_report(priv->handle, buf, FEATURE_BUFFER_SIZE);
 }
 
 static int send_feature_report(rift_hmd_t* priv, const unsigned char *data, size_t length)
 {
-	return hid_send_feature_report(priv->handle, data, length);
+	return ohmd_hid_send_feature_report(priv->handle, data, length);
 }
 
 static void set_coordinate_frame(rift_hmd_t* priv, rift_coordinate_frame coordframe)
@@ -198,8 +207,9 @@ static void set_coordinate_frame(rift_hmd_t* priv, rift_coordinate_frame coordfr
 	}
 }
 
-static void handle_tracker_sensor_msg(rift_hmd_t* priv, unsigned char* buffer, int size)
+static void handle_tracker_sensor_msg(rift_hmd_t* priv, unsigned char* buffer, int size, uint64_t host_ns)
 {
+	OHMD_TRACE_BEGIN("decode_tracker_sensor_msg");
 	if (buffer[0] == RIFT_IRQ_SENSORS_DK1
 	  && !decode_tracker_sensor_msg_dk1(&priv->sensor, buffer, size)){
 		LOGE("couldn't decode tracker sensor message");
@@ -208,6 +218,7 @@ static void handle_tracker_sensor_msg(rift_hmd_t* priv, unsigned char* buffer, i
 	  && !decode_tracker_sensor_msg_dk2(&priv->sensor, buffer, size)){
 		LOGE("couldn't decode tracker sensor message");
 	}
+	OHMD_TRACE_END();
 
 	pkt_tracker_sensor* s = &priv->sensor;
 
@@ -216,27 +227,36 @@ static void handle_tracker_sensor_msg(rift_hmd_t* priv, unsigned char* buffer, i
 	int32_t mag32[] = { s->mag[0], s->mag[1], s->mag[2] };
 	vec3f_from_rift_vec(mag32, &priv->raw_mag);
 
-	// TODO: handle overflows in a nicer way
-	float dt = TICK_LEN; // TODO: query the Rift for the sample rate
-	if (s->timestamp > priv->last_imu_timestamp)
-	{
-		dt = (s->timestamp - priv->last_imu_timestamp) / 1000000.0f;
-		dt -= (s->num_samples - 1) * TICK_LEN; // TODO: query the Rift for the sample rate
-	}
+	// the timestamp is the one of the last sample, the DK1 counts in milliseconds
+	bool dk1 = buffer[0] == RIFT_IRQ_SENSORS_DK1;
+	uint32_t tick = dk1 ? s->timestamp / 1000 : s->timestamp;
+	uint32_t sample_ticks = dk1 ? 1 : 1000; // TODO: query the Rift for the sample rate
 
+	fusion_sample samples[3];
 	for(int i = 0; i < s->num_samples; i++){
-		vec3f_from_rift_vec(s->samples[i].accel, &priv->raw_accel);
-		vec3f_from_rift_vec(s->samples[i].gyro, &priv->raw_gyro);
+		fusion_sample* smp = &samples[i];
+
+		smp->sample_ns = oclock_sync_update(&priv->imu_clock,
+			tick - (s->num_samples - 1 - i) * sample_ticks, host_ns);
+		smp->dt_ns = priv->imu_clock.dt_ns > 0 ? priv->imu_clock.dt_ns : TICK_NS;
+
+		vec3f_from_rift_vec(s->samples[i].accel, &smp->accel);
+		vec3f_from_rift_vec(s->samples[i].gyro, &smp->ang_vel);
+		smp->mag = priv->raw_mag;
+	}
 
-		ofusion_update(&priv->sensor_fusion, dt, &priv->raw_gyro, &priv->raw_accel, &priv->raw_mag);
-		dt = TICK_LEN; // TODO: query the Rift for the sample rate
+	if(s->num_samples > 0){
+		priv->raw_accel = samples[s->num_samples - 1].accel;
+		priv->raw_gyro = samples[s->num_samples - 1].ang_vel;
 	}
 
-	priv->last_imu_timestamp = s->timestamp;
+	OHMD_TRACE_BEGIN("ofusion_update");
+	ofusion_update_batch(&priv->sensor_fusion, samples, s->num_samples);
+	OHMD_TRACE_END();
 }
 
 static void handle_touch_controller_message(rift_hmd_t *hmd,
-		rift_touch_controller_t *touch, pkt_rift_radio_message *msg)
+		rift_touch_controller_t *touch, pkt_rift_radio_message *msg, uint64_t host_ns)
 {
 	// The top bits are carrying something unknown. Ignore them
 	uint8_t buttons = msg->touch.buttons & 0xf;
@@ -262,13 +282,7 @@ static void handle_touch_controller_message(rift_hmd_t *hmd,
 	}
 
 	// time in microseconds
-	int32_t dt;
-	if (touch->time_valid)
-		dt = msg->touch.timestamp - touch->last_timestamp;
-	else
-		dt = 0;
-
-	const double dt_s = 1e-6 * dt;
+	uint64_t sample_ns = oclock_sync_update(&touch->imu_clock, msg->touch.timestamp, host_ns);
 	double a[3] = {
 		OHMD_GRAVITY_EARTH / 2048 * msg->touch.accel[0],
 		OHMD_GRAVITY_EARTH / 2048 * msg->touch.accel[1],
@@ -310,9 +324,11 @@ static void handle_touch_controller_message(rift_hmd_t *hmd,
 			  c->gyro_calibration[7] * g[1] +
 			  c->gyro_calibration[8] * g[2];
 
-	ofusion_update(&touch->imu_fusion, dt_s, &gyro, &accel, &mag);
-	touch->last_timestamp = msg->touch.timestamp;
-	touch->time_valid = true;
+	// the clock has no interval for the first sample after a restart or an outlier, the sample still turns the fusion
+	if(touch->imu_clock.dt_ns > 0)
+		touch->imu_dt_ns = touch->imu_clock.dt_ns;
+
+	ofusion_update_at(&touch->imu_fusion, sample_ns, touch->imu_dt_ns, &gyro, &accel, &mag);
 
 	float t;
 	if (msg->touch.trigger < c->trigger_mid_range) {
@@ -381,7 +397,7 @@ static void handle_touch_controller_message(rift_hmd_t *hmd,
 	}
 }
 
-static void handle_rift_radio_message(rift_hmd_t *hmd, pkt_rift_radio_message *msg)
+static void handle_rift_radio_message(rift_hmd_t *hmd, pkt_rift_radio_message *msg, uint64_t host_ns)
 {
 	switch (msg->device_type) {
 		case RIFT_REMOTE:
@@ -391,25 +407,29 @@ static void handle_rift_radio_message(rift_hmd_t *hmd, pkt_rift_radio_message *m
 			hmd->remote_buttons_state = msg->remote.buttons;
 			break;
 		case RIFT_TOUCH_CONTROLLER_RIGHT:
-			handle_touch_controller_message (hmd, &hmd->touch_dev[0], msg);
+			handle_touch_controller_message (hmd, &hmd->touch_dev[0], msg, host_ns);
 			break;
 		case RIFT_TOUCH_CONTROLLER_LEFT:
-			handle_touch_controller_message (hmd, &hmd->touch_dev[1], msg);
+			handle_touch_controller_message (hmd, &hmd->touch_dev[1], msg, host_ns);
 			break;
 	}
 }
 
-static void handle_rift_radio_report(rift_hmd_t* hmd, unsigned char* buffer, int size)
+static void handle_rift_radio_report(rift_hmd_t* hmd, unsigned char* buffer, int size, uint64_t host_ns)
 {
 	pkt_rift_radio_report r;
 
-	if (!decode_rift_radio_report(&r, buffer, size))
+	OHMD_TRACE_BEGIN("decode_rift_radio_report");
+	bool valid = decode_rift_radio_report(&r, buffer, size);
+	OHMD_TRACE_END();
+
+	if (!valid)
 		return;
 
 	if (r.message[0].valid)
-		handle_rift_radio_message(hmd, &r.message[0]);
+		handle_rift_radio_message(hmd, &r.message[0], host_ns);
 	if (r.message[1].valid)
-		handle_rift_radio_message(hmd, &r.message[1]);
+		handle_rift_radio_message(hmd, &r.message[1], host_ns);
 }
 
 static void update_hmd(rift_hmd_t *priv)
@@ -417,8 +437,8 @@ static void update_hmd(rift_hmd_t *priv)
 	unsigned char buffer[FEATURE_BUFFER_SIZE];
 
 	// Handle keep alive messages
-	double t = ohmd_get_tick();
-	if(t - priv->last_keep_alive >= (double)priv->sensor_config.keep_alive_interval / 1000.0 - .2){
+	uint64_t t = ohmd_monotonic_ns();
+	if(t - priv->last_keep_alive_ns + 200000000 >= priv->sensor_config.keep_alive_interval * 1000000ull){
 		// send keep alive message
 		pkt_keep_alive keep_alive = { 0, priv->sensor_config.keep_alive_interval };
 		int ka_size = encode_dk1_keep_alive(buffer, &keep_alive);
@@ -426,12 +446,13 @@ static void update_hmd(rift_hmd_t *priv)
 			LOGE("error sending keepalive");
 
 		// Update the time of the last keep alive we have sent.
-		priv->last_keep_alive = t;
+		priv->last_keep_alive_ns = t;
 	}
 
 	// Read all the messages from the device.
+	OHMD_TRACE_BEGIN("rift_hid_read");
 	while(true){
-		int size = hid_read(priv->handle, buffer, FEATURE_BUFFER_SIZE);
+		int size = ohmd_hid_read(priv->handle, buffer, FEATURE_BUFFER_SIZE);
 		if(size < 0){
 			LOGE("error reading from device");
 			break;
@@ -441,18 +462,20 @@ static void update_hmd(rift_hmd_t *priv)
 
 		// currently the only message type the hardware supports (I think)
 		if(buffer[0] == RIFT_IRQ_SENSORS_DK1 || buffer[0] == RIFT_IRQ_SENSORS_DK2) {
-			handle_tracker_sensor_msg(priv, buffer, size);
+			handle_tracker_sensor_msg(priv, buffer, size, priv->handle->read_ns);
 		}else{
 			LOGE("unknown message type: %u", buffer[0]);
 		}
 	}
+	OHMD_TRACE_END();
 
 	if (priv->radio_handle == NULL)
 		return;
 
 	// Read all the controller messages from the radio device.
+	OHMD_TRACE_BEGIN("rift_radio_hid_read");
 	while(true){
-		int size = hid_read(priv->radio_handle, buffer, FEATURE_BUFFER_SIZE);
+		int size = ohmd_hid_read(priv->radio_handle, buffer, FEATURE_BUFFER_SIZE);
 		if(size < 0){
 			LOGE("error reading from device");
 			break;
@@ -461,8 +484,9 @@ static void update_hmd(rift_hmd_t *priv)
 		}
 
 		if (buffer[0] == RIFT_RADIO_REPORT_ID)
-			handle_rift_radio_report (priv, buffer, size);
+			handle_rift_radio_report (priv, buffer, size, priv->radio_handle->read_ns);
 	}
+	OHMD_TRACE_END();
 }
 
 static void update_device(ohmd_device* device)
@@ -732,7 +756,8 @@ static void init_touch_device(rift_touch_controller_t *touch, int id, int device
 
 	touch->device_num = device_num;
 	ofusion_init(&touch->imu_fusion);
-	touch->time_valid = false;
+	oclock_sync_init(&touch->imu_clock, 1000000.0, 32);
+	touch->imu_dt_ns = TOUCH_TICK_NS;
 
 	ohmd_set_default_device_properties(&ohmd_dev->properties);
 
@@ -776,10 +801,9 @@ static rift_hmd_t *open_hmd(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->use_count = 1;
 	priv->ctx = driver->ctx;
 
-	priv->last_imu_timestamp = -1;
 
 	// Open the HID device
-	priv->handle = hid_open_path(desc->path);
+	priv->handle = ohmd_hid_open_path(driver->ctx, desc->path);
 
 	if(!priv->handle) {
 		char* path = _hid_to_unix_path(desc->path);
@@ -790,7 +814,7 @@ static rift_hmd_t *open_hmd(ohmd_driver* driver, ohmd_device_desc* desc)
 		goto cleanup;
 	}
 
-	if(hid_set_nonblocking(priv->handle, 1) == -1){
+	if(ohmd_hid_set_nonblocking(priv->handle, 1) == -1){
 		ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 		goto cleanup;
 	}
@@ -800,7 +824,7 @@ static rift_hmd_t *open_hmd(ohmd_driver* driver, ohmd_device_desc* desc)
 		priv->radio_handle = open_hid_dev (driver->ctx, OCULUS_VR_INC_ID, RIFT_CV1_PID, 1);
 		if (priv->radio_handle == NULL)
 			goto cleanup;
-		if(hid_set_nonblocking(priv->radio_handle, 1) == -1){
+		if(ohmd_hid_set_nonblocking(priv->radio_handle, 1) == -1){
 			ohmd_set_error(driver->ctx, "Failed to set non-blocking on radio device");
 			goto cleanup;
 		}
@@ -868,7 +892,7 @@ static rift_hmd_t *open_hmd(ohmd_driver* driver, ohmd_device_desc* desc)
 		LOGE("error setting up keepalive");
 
 	// Update the time of the last keep alive we have sent.
-	priv->last_keep_alive = ohmd_get_tick();
+	priv->last_keep_alive_ns = ohmd_monotonic_ns();
 
 	// update sensor settings with new keep alive value
 	// (which will have been ignored in favor of the default 1000 ms one)
@@ -966,6 +990,10 @@ static rift_hmd_t *open_hmd(ohmd_driver* driver, ohmd_device_desc* desc)
 
 	// initialize sensor fusion
 	ofusion_init(&priv->sensor_fusion);
+	if (desc->revision == REV_DK1)
+		oclock_sync_init(&priv->imu_clock, 1000.0, 16);
+	else
+		oclock_sync_init(&priv->imu_clock, 1000000.0, 32);
 
 	return priv;
 
@@ -981,8 +1009,8 @@ static void close_hmd(rift_hmd_t *hmd)
 		free (hmd->leds);
 
 	if (hmd->radio_handle)
-		hid_close(hmd->radio_handle);
-	hid_close(hmd->handle);
+		ohmd_hid_close(hmd->radio_handle);
+	ohmd_hid_close(hmd->handle);
 	free(hmd);
 }
 
@@ -990,19 +1018,19 @@ static void close_hmd(rift_hmd_t *hmd)
  * requested VID/PID/interface, which works fine if there's
  * 1 rift attached. To support multiple rift, we need to
  * match parent USB devices like ouvrt does */
-static hid_device* open_hid_dev(ohmd_context* ctx,
+static ohmd_hid_device* open_hid_dev(ohmd_context* ctx,
 		int vid, int pid, int iface_num)
 {
-	struct hid_device_info* devs = hid_enumerate(vid, pid);
-	struct hid_device_info* cur_dev = devs;
-	hid_device *handle = NULL;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(ctx, vid, pid);
+	ohmd_hid_device_info* cur_dev = devs;
+	ohmd_hid_device *handle = NULL;
 
 	if(devs == NULL)
 		return NULL;
 
 	while (cur_dev) {
 		if (cur_dev->interface_number == iface_num) {
-			handle = hid_open_path(cur_dev->path);
+			handle = ohmd_hid_open_path(ctx, cur_dev->path);
 			if (handle)
 				break;
 			else {
@@ -1016,28 +1044,34 @@ static hid_device* open_hid_dev(ohmd_context* ctx,
 		cur_dev = cur_dev->next;
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(ctx, devs);
 	return handle;
 }
 
 static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 {
 	rift_device_priv *dev = NULL;
-	rift_hmd_t *hmd = find_hmd(desc->path);
+	rift_hmd_t *hmd = find_hmd((rift_driver*)driver, desc->path);
 
 	if (hmd == NULL) {
 		hmd = open_hmd (driver, desc);
 		if (hmd == NULL)
 			return NULL;
-		push_hmd (hmd, desc->path);
+		push_hmd ((rift_driver*)driver, hmd, desc->path);
 	}
 
-	if (desc->id == 0)
+	if (desc->id == 0) {
 		dev = &hmd->hmd_dev;
-	else if (desc->id == 1)
+		dev->base.sensor_fusion = &hmd->sensor_fusion;
+	}
+	else if (desc->id == 1) {
 		dev = &hmd->touch_dev[0].base;
-	else if (desc->id == 2)
+		dev->base.sensor_fusion = &hmd->touch_dev[0].imu_fusion;
+	}
+	else if (desc->id == 2) {
 		dev = &hmd->touch_dev[1].base;
+		dev->base.sensor_fusion = &hmd->touch_dev[1].imu_fusion;
+	}
 	else {
 		LOGE ("Invalid device description passed to open_device()");
 		release_hmd(hmd);
@@ -1072,8 +1106,8 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 	};
 
 	for(int i = 0; i < RIFT_ID_COUNT; i++){
-		struct hid_device_info* devs = hid_enumerate(rd[i].company, rd[i].id);
-		struct hid_device_info* cur_dev = devs;
+		ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, rd[i].company, rd[i].id);
+		ohmd_hid_device_info* cur_dev = devs;
 
 		if(devs == NULL)
 			continue;
@@ -1096,6 +1130,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 				desc->device_flags = OHMD_DEVICE_FLAGS_ROTATIONAL_TRACKING;
 
 				strcpy(desc->path, cur_dev->path);
+				ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 				desc->driver_ptr = driver;
 				desc->id = id++;
@@ -1111,6 +1146,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 					sprintf(desc->product, "%s: Right Controller", rd[i].name);
 
 					strcpy(desc->path, cur_dev->path);
+					ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 					desc->device_flags =
 						//OHMD_DEVICE_FLAGS_POSITIONAL_TRACKING |
@@ -1130,6 +1166,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 					sprintf(desc->product, "%s: Left Controller", rd[i].name);
 
 					strcpy(desc->path, cur_dev->path);
+					ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 					desc->device_flags =
 						//OHMD_DEVICE_FLAGS_POSITIONAL_TRACKING |
@@ -1144,14 +1181,14 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 			cur_dev = cur_dev->next;
 		}
 
-		hid_free_enumeration(devs);
+		ohmd_hid_free_enumeration(driver->ctx, devs);
 	}
 }
 
 static void destroy_driver(ohmd_driver* drv)
 {
 	LOGD("shutting down driver");
-	hid_exit();
+	ohmd_hid_exit(drv->ctx);
 	free(drv);
 
 	ohmd_toggle_ovr_service(1); //re-enable OVRService if previously running
@@ -1159,10 +1196,12 @@ static void destroy_driver(ohmd_driver* drv)
 
 ohmd_driver* ohmd_create_oculus_rift_drv(ohmd_context* ctx)
 {
-	ohmd_driver* drv = ohmd_alloc(ctx, sizeof(ohmd_driver));
-	if(drv == NULL)
+	rift_driver* rift = ohmd_alloc(ctx, sizeof(rift_driver));
+	if(rift == NULL)
 		return NULL;
 
+	ohmd_driver* drv = &rift->base;
+
 	ohmd_toggle_ovr_service(0); //disable OVRService if running
 
 	drv->get_device_list = get_device_list;
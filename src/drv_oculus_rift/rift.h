@@ -214,13 +214,12 @@ struct rift_touch_controller_s {
 
 	int device_num;
 	fusion imu_fusion;
+	clock_sync imu_clock; // 1 MHz
+	uint64_t imu_dt_ns;   // the last sample interval the clock measured, for the samples it has none for
 
 	bool have_calibration;
 	rift_touch_calibration calibration;
 
-	bool time_valid;
-	uint32_t last_timestamp;
-
 	uint8_t buttons;
 
 	float trigger;
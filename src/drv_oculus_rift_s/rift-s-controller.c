@@ -6,7 +6,7 @@
  */
 #define __STDC_FORMAT_MACROS
 
-#include <hidapi.h>
+#include "../hid.h"
 #include <string.h>
 #include <assert.h>
 #include <inttypes.h>
@@ -20,8 +20,18 @@
 /* Set to 1 to print controller states continuously */
 #define DUMP_CONTROLLER_STATE 0
 
+/* Controllers are matched to their devices late, after the devices were
+ * opened with the fusion backend of their settings */
+static void
+bind_controller_fusion (ohmd_device *dev, fusion *imu_fusion)
+{
+	dev->sensor_fusion = imu_fusion;
+	if (dev->settings.fusion_backend != OHMD_FUSION_DEFAULT)
+		ofusion_set_backend (imu_fusion, dev->settings.fusion_backend);
+}
+
 static int
-update_device_types (rift_s_hmd_t *hmd, hid_device *hid) {
+update_device_types (rift_s_hmd_t *hmd, ohmd_hid_device *hid) {
 	int res;
 	rift_s_devices_list_t dev_list;
 
@@ -39,9 +49,11 @@ update_device_types (rift_s_hmd_t *hmd, hid_device *hid) {
 					hmd->controllers[c].device_type = dev->device_type;
 					if (dev->device_type == RIFT_S_DEVICE_LEFT_CONTROLLER) {
 						hmd->touch_dev[0].device_num = c;
+						bind_controller_fusion (&hmd->touch_dev[0].base.base, &hmd->controllers[c].imu_fusion);
 					}
 					else if (dev->device_type == RIFT_S_DEVICE_RIGHT_CONTROLLER) {
 						hmd->touch_dev[1].device_num = c;
+						bind_controller_fusion (&hmd->touch_dev[1].base.base, &hmd->controllers[c].imu_fusion);
 					}
 				}
 				break;
@@ -108,24 +120,19 @@ vec3f_rotate_3x3(vec3f *vec, float rot[3][3])
 }
 
 static void
-handle_imu_update (rift_s_controller_state *ctrl, uint32_t imu_timestamp, const int16_t raw_accel[3], const int16_t raw_gyro[3])
+handle_imu_update (rift_s_controller_state *ctrl, uint64_t host_ns, uint32_t imu_timestamp, const int16_t raw_accel[3], const int16_t raw_gyro[3])
 {
-	int32_t dt = 0;
-
-	if (ctrl->imu_time_valid)
-		dt = imu_timestamp - ctrl->imu_timestamp;
+	uint64_t sample_ns = oclock_sync_update(&ctrl->imu_clock, imu_timestamp, host_ns);
+	uint64_t dt_ns = ctrl->imu_clock.dt_ns;
 
 	ctrl->imu_timestamp = imu_timestamp;
-	ctrl->imu_time_valid = true;
 
 	if (!ctrl->have_calibration || !ctrl->have_config)
 		return; /* We need to finish reading the calibration or config blocks first */
 
 	/* If this is the first IMU update, use default interval */
-	if (dt == 0)
-		dt = 1000000 / ctrl->config.accel_hz;
-
-	float dt_sec = dt / 1000000.0;
+	if (dt_ns == 0)
+		dt_ns = 1000000000 / ctrl->config.accel_hz;
 
 	const float gyro_scale = ctrl->config.gyro_scale;
 	const float accel_scale = OHMD_GRAVITY_EARTH * ctrl->config.accel_scale;
@@ -147,10 +154,12 @@ handle_imu_update (rift_s_controller_state *ctrl, uint32_t imu_timestamp, const
 	vec3f_rotate_3x3(&ctrl->accel, ctrl->calibration.accel.rectification);
 	vec3f_rotate_3x3(&ctrl->gyro, ctrl->calibration.gyro.rectification);
 
-	ofusion_update(&ctrl->imu_fusion, dt_sec, &ctrl->gyro, &ctrl->accel, &ctrl->mag);
+	OHMD_TRACE_BEGIN("ofusion_update");
+	ofusion_update_at(&ctrl->imu_fusion, sample_ns, dt_ns, &ctrl->gyro, &ctrl->accel, &ctrl->mag);
+	OHMD_TRACE_END();
 #if 0
 	printf ("dt = %f raw accel %d %d %d gyro %d %d %d -> accel %f %f %f  gyro %f %f %f\n",
-			dt_sec,
+			dt_ns / 1e9,
 			raw_accel[0], raw_accel[1], raw_accel[2],
 			raw_gyro[0], raw_gyro[1], raw_gyro[2],
 			ctrl->accel.x, ctrl->accel.y, ctrl->accel.z,
@@ -159,7 +168,7 @@ handle_imu_update (rift_s_controller_state *ctrl, uint32_t imu_timestamp, const
 }
 
 static bool
-update_controller_state (rift_s_controller_state *ctrl, rift_s_controller_report_t *report)
+update_controller_state (rift_s_controller_state *ctrl, rift_s_controller_report_t *report, uint64_t host_ns)
 {
 #if DUMP_CONTROLLER_STATE
   bool saw_imu_update = false;
@@ -216,7 +225,7 @@ update_controller_state (rift_s_controller_state *ctrl, rift_s_controller_report
 					ctrl->raw_accel[j] = info->imu.accel[j];
 					ctrl->raw_gyro[j] = info->imu.gyro[j];
 				}
-				handle_imu_update (ctrl, info->imu.timestamp, ctrl->raw_accel, ctrl->raw_gyro);
+				handle_imu_update (ctrl, host_ns, info->imu.timestamp, ctrl->raw_accel, ctrl->raw_gyro);
 				break;
 			}
 			default:
@@ -347,11 +356,15 @@ get_controller_configuration (rift_s_hmd_t *hmd, rift_s_controller_state *ctrl)
 }
 
 void
-rift_s_handle_controller_report (rift_s_hmd_t *hmd, hid_device *hid, const unsigned char *buf, int size)
+rift_s_handle_controller_report (rift_s_hmd_t *hmd, ohmd_hid_device *hid, const unsigned char *buf, int size, uint64_t host_ns)
 {
 	rift_s_controller_report_t report;
 
-	if (!rift_s_parse_controller_report (&report, buf, size)) {
+	OHMD_TRACE_BEGIN("rift_s_parse_controller_report");
+	bool valid = rift_s_parse_controller_report (&report, buf, size);
+	OHMD_TRACE_END();
+
+	if (!valid) {
 		rift_s_hexdump_buffer ("Invalid Controller Report", buf, size);
 		return;
 	}
@@ -384,6 +397,7 @@ rift_s_handle_controller_report (rift_s_hmd_t *hmd, hid_device *hid, const unsig
 		memset (ctrl, 0, sizeof (rift_s_controller_state));
 		ctrl->device_id = report.device_id;
 		ofusion_init(&ctrl->imu_fusion);
+		oclock_sync_init(&ctrl->imu_clock, 1000000.0, 32);
 
 		update_device_types (hmd, hid);
 		get_controller_configuration (hmd, ctrl);
@@ -393,6 +407,6 @@ rift_s_handle_controller_report (rift_s_hmd_t *hmd, hid_device *hid, const unsig
 	if (ctrl->device_type == 0x00)
 		update_device_types (hmd, hid);
 
-	if (!update_controller_state (ctrl, &report))
+	if (!update_controller_state (ctrl, &report, host_ns))
 		rift_s_hexdump_buffer ("Invalid Controller Report Content", buf, size);
 }
@@ -32,7 +32,7 @@ typedef struct {
   int log_bytes;
   uint8_t log[MAX_LOG_SIZE];
 
-	bool imu_time_valid;
+	clock_sync imu_clock; /* 1 MHz */
   uint32_t imu_timestamp;
   uint16_t imu_unknown_varying2;
 	int16_t raw_accel[3];
@@ -70,6 +70,6 @@ typedef struct {
 	fusion imu_fusion;
 } rift_s_controller_state;
 
-void rift_s_handle_controller_report (rift_s_hmd_t *hmd, hid_device *hid, const unsigned char *buf, int size);
+void rift_s_handle_controller_report (rift_s_hmd_t *hmd, ohmd_hid_device *hid, const unsigned char *buf, int size, uint64_t host_ns);
 
 #endif
@@ -24,12 +24,13 @@
 
 struct rift_s_hmd_s {
 	ohmd_context* ctx;
+	rift_s_driver* driver;
 	int use_count;
 
-	hid_device* handles[3];
+	ohmd_hid_device* handles[3];
 
-	uint32_t last_imu_timestamp;
-	double last_keep_alive;
+	clock_sync imu_clock; // 1 MHz
+	uint64_t last_keep_alive_ns;
 	fusion sensor_fusion;
 	vec3f raw_mag, raw_accel, raw_gyro;
 	float temperature;
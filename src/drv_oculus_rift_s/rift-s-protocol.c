@@ -12,7 +12,6 @@
 /* Oculus Rift S Driver - HID/USB Driver Implementation */
 
 #include <assert.h>
-#include <hidapi.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -166,15 +165,15 @@ void rift_s_hexdump_buffer (const char *label, const unsigned char *buf, int len
 	printf("\n");
 }
 
-static int get_feature_report(hid_device *hid, uint8_t cmd, uint8_t *buf, int len)
+static int get_feature_report(ohmd_hid_device *hid, uint8_t cmd, uint8_t *buf, int len)
 {
 	memset(buf, 0, len);
 	buf[0] = cmd;
-	return hid_get_feature_report(hid, (unsigned char *) buf, len);
+	return ohmd_hid_get_feature_report(hid, (unsigned char *) buf, len);
 }
 
 static int
-read_one_fw_block (hid_device *dev, uint8_t block_id, uint32_t pos, uint8_t read_len, uint8_t *buf)
+read_one_fw_block (ohmd_hid_device *dev, uint8_t block_id, uint32_t pos, uint8_t read_len, uint8_t *buf)
 {
 	unsigned char req[64] = { 0x4a, 0x00, };
 	int ret, loops = 0;
@@ -187,7 +186,7 @@ read_one_fw_block (hid_device *dev, uint8_t block_id, uint32_t pos, uint8_t read
 			/* FIXME: Little-endian code: */
 			* (uint32_t *)(req + 3) = pos;
 			req[7] = read_len;
-			ret = hid_send_feature_report(dev, req, 64);
+			ret = ohmd_hid_send_feature_report(dev, req, 64);
 			if (ret < 0) {
 				LOGE("Report 74 SET failed");
 				return ret;
@@ -218,7 +217,7 @@ read_one_fw_block (hid_device *dev, uint8_t block_id, uint32_t pos, uint8_t read
 	return ret;
 }
 
-int rift_s_read_firmware_block (hid_device *dev, uint8_t block_id,
+int rift_s_read_firmware_block (ohmd_hid_device *dev, uint8_t block_id,
 		char **data_out, int *len_out)
 {
 	uint32_t pos = 0x00, block_len;
@@ -289,15 +288,15 @@ int rift_s_read_firmware_block (hid_device *dev, uint8_t block_id,
 }
 
 void
-rift_s_send_keepalive (hid_device *hid)
+rift_s_send_keepalive (ohmd_hid_device *hid)
 {
 	/* HID report 147 (0x93) 0xbb8 = 3000ms timeout, sent every 1000ms */
 	unsigned char buf[6] = { 0x93, 0x01, 0xb8, 0x0b, 0x00, 0x00 };
-	hid_send_feature_report(hid, buf, 6);
+	ohmd_hid_send_feature_report(hid, buf, 6);
 }
 
 int
-rift_s_send_camera_report (hid_device *hid, bool enable, bool radio_sync_bit)
+rift_s_send_camera_report (ohmd_hid_device *hid, bool enable, bool radio_sync_bit)
 {
 /*
  *	 05 O1 O2 P1 P1 P2 P2 P3 P3 P4 P4 P5 P5 E1 E1 E3
@@ -327,21 +326,21 @@ rift_s_send_camera_report (hid_device *hid, bool enable, bool radio_sync_bit)
 	buf[1] = enable ? 0x1 : 0x0;
 	buf[2] = radio_sync_bit ? 0x1 : 0x0;
 
-	return hid_send_feature_report(hid, buf, 41);
+	return ohmd_hid_send_feature_report(hid, buf, 41);
 }
 
 int
-rift_s_set_screen_enable (hid_device *hid, bool enable)
+rift_s_set_screen_enable (ohmd_hid_device *hid, bool enable)
 {
 	uint8_t buf[2];
 
 	// Enable/disable LCD screen
 	buf[0] = 0x08;
 	buf[1] = enable ? 0x01 : 0;
-	return hid_send_feature_report(hid, buf, 2);
+	return ohmd_hid_send_feature_report(hid, buf, 2);
 }
 
-int rift_s_read_device_info (hid_device *hid, rift_s_device_info_t *device_info)
+int rift_s_read_device_info (ohmd_hid_device *hid, rift_s_device_info_t *device_info)
 {
 	uint8_t buf[FEATURE_BUFFER_SIZE];
 
@@ -357,7 +356,7 @@ int rift_s_read_device_info (hid_device *hid, rift_s_device_info_t *device_info)
 	return 0;
 }
 
-int rift_s_get_report1 (hid_device *hid) {
+int rift_s_get_report1 (ohmd_hid_device *hid) {
 	uint8_t buf[FEATURE_BUFFER_SIZE];
 	int res;
 
@@ -371,7 +370,7 @@ int rift_s_get_report1 (hid_device *hid) {
 	return 0;
 }
 
-int rift_s_read_imu_config (hid_device *hid, rift_s_imu_config_t *imu_config)
+int rift_s_read_imu_config (ohmd_hid_device *hid, rift_s_imu_config_t *imu_config)
 {
 	uint8_t buf[FEATURE_BUFFER_SIZE];
 	int res;
@@ -385,7 +384,7 @@ int rift_s_read_imu_config (hid_device *hid, rift_s_imu_config_t *imu_config)
 	return 0;
 }
 
-int rift_s_hmd_enable (hid_device *hid, bool enable) {
+int rift_s_hmd_enable (ohmd_hid_device *hid, bool enable) {
 	uint8_t buf[3];
 	int res;
 
@@ -394,20 +393,20 @@ int rift_s_hmd_enable (hid_device *hid, bool enable) {
 		buf[0] = 0x07;
 		buf[1] = 0xa3;
 		buf[2] = 0x01;
-		if ((res = hid_send_feature_report(hid, buf, 3)) < 0)
+		if ((res = ohmd_hid_send_feature_report(hid, buf, 3)) < 0)
 				return res;
 	}
 
 	/* Not sure what this is doing, everything seems to work anyway without it */
 	buf[0] = 0x14;
 	buf[1] = enable ? 0x01 : 0x00;
-	if ((res = hid_send_feature_report(hid, buf, 2)) < 0)
+	if ((res = ohmd_hid_send_feature_report(hid, buf, 2)) < 0)
 			return res;
 
 	/* Turn on radio to controllers */
 	buf[0] = 0x0A;
 	buf[1] = enable ? 0x02 : 0x00;
-	if ((res = hid_send_feature_report(hid, buf, 2)) < 0)
+	if ((res = ohmd_hid_send_feature_report(hid, buf, 2)) < 0)
 			return res;
 
 	if (!enable) {
@@ -420,7 +419,7 @@ int rift_s_hmd_enable (hid_device *hid, bool enable) {
 	/* Enables prox sensor + HMD IMU etc */
 	buf[0] = 0x02;
 	buf[1] = enable ? 0x01 : 0x00;
-	if ((res = hid_send_feature_report(hid, buf, 2)) < 0)
+	if ((res = ohmd_hid_send_feature_report(hid, buf, 2)) < 0)
 			return res;
 
 	/* Send camera report with enable=true enables the streaming. The
@@ -429,7 +428,7 @@ int rift_s_hmd_enable (hid_device *hid, bool enable) {
 	return rift_s_send_camera_report (hid, enable, false);
 }
 
-int rift_s_read_devices_list (hid_device *handle, rift_s_devices_list_t *dev_list)
+int rift_s_read_devices_list (ohmd_hid_device *handle, rift_s_devices_list_t *dev_list)
 {
 	unsigned char buf[200];
 
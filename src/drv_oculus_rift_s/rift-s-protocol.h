@@ -9,6 +9,7 @@
 #define __RTFT_S_PROTOCOL__
 
 #include "../openhmdi.h"
+#include "../hid.h"
 
 #define FEATURE_BUFFER_SIZE 256
 
@@ -206,18 +207,18 @@ typedef struct {
 } rift_s_devices_list_t;
 
 /* FIXME: Rename this - report1 gets the firmware version */
-int rift_s_get_report1 (hid_device *hid);
-int rift_s_read_device_info (hid_device *hid, rift_s_device_info_t *device_info);
-int rift_s_read_imu_config (hid_device *hid, rift_s_imu_config_t *imu_config);
-int rift_s_hmd_enable (hid_device *hid, bool enable);
-int rift_s_set_screen_enable (hid_device *hid, bool enable);
+int rift_s_get_report1 (ohmd_hid_device *hid);
+int rift_s_read_device_info (ohmd_hid_device *hid, rift_s_device_info_t *device_info);
+int rift_s_read_imu_config (ohmd_hid_device *hid, rift_s_imu_config_t *imu_config);
+int rift_s_hmd_enable (ohmd_hid_device *hid, bool enable);
+int rift_s_set_screen_enable (ohmd_hid_device *hid, bool enable);
 
-void rift_s_send_keepalive (hid_device *hid);
+void rift_s_send_keepalive (ohmd_hid_device *hid);
 bool rift_s_parse_hmd_report (rift_s_hmd_report_t *report, const unsigned char *buf, int size);
 bool rift_s_parse_controller_report (rift_s_controller_report_t *report, const unsigned char *buf, int size);
-int rift_s_read_firmware_block (hid_device *handle, uint8_t block_id, char **data_out, int *len_out);
+int rift_s_read_firmware_block (ohmd_hid_device *handle, uint8_t block_id, char **data_out, int *len_out);
 
-int rift_s_read_devices_list (hid_device *handle, rift_s_devices_list_t *dev_list);
+int rift_s_read_devices_list (ohmd_hid_device *handle, rift_s_devices_list_t *dev_list);
 
 void rift_s_hexdump_buffer (const char *label, const unsigned char *buf, int length); // Debugging
 #endif
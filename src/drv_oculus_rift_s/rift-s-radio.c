@@ -5,7 +5,7 @@
  * OpenHMD - Free and Open Source API and drivers for immersive technology.
  */
 #include <stdlib.h>
-#include <hidapi.h>
+#include "../hid.h"
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
@@ -28,18 +28,18 @@ struct rift_s_radio_command {
 		void *cb_data;
 };
 
-static int get_radio_response_report (hid_device *hid, rift_s_hmd_radio_response_t *radio_response)
+static int get_radio_response_report (ohmd_hid_device *hid, rift_s_hmd_radio_response_t *radio_response)
 {
 	int ret;
 
 	radio_response->cmd = 0xb;
-	ret = hid_get_feature_report(hid, (unsigned char *)(radio_response), sizeof(rift_s_hmd_radio_response_t));
+	ret = ohmd_hid_get_feature_report(hid, (unsigned char *)(radio_response), sizeof(rift_s_hmd_radio_response_t));
 
 	return ret;
 }
 
 void
-rift_s_radio_update (rift_s_radio_state *state, hid_device *hid)
+rift_s_radio_update (rift_s_radio_state *state, ohmd_hid_device *hid)
 {
 	bool read_another = false;
 	
@@ -50,7 +50,7 @@ rift_s_radio_update (rift_s_radio_state *state, hid_device *hid)
  			rift_s_hmd_radio_command_t *pkt = &cmd->read_command;
 
  			pkt->cmd = 0x12;
-			hid_send_feature_report(hid, (unsigned char *)(pkt), sizeof(*pkt));
+			ohmd_hid_send_feature_report(hid, (unsigned char *)(pkt), sizeof(*pkt));
  			// rift_s_hexdump_buffer ("ControllerFWSend", (unsigned char *)(pkt), sizeof(*pkt));
 			state->command_result_pending = true;
 		}
@@ -31,7 +31,7 @@ struct rift_s_radio_state {
 void rift_s_radio_state_init (rift_s_radio_state *state, ohmd_context *ctx);
 void rift_s_radio_state_clear (rift_s_radio_state *state);
 
-void rift_s_radio_update (rift_s_radio_state *state, hid_device *hid);
+void rift_s_radio_update (rift_s_radio_state *state, ohmd_hid_device *hid);
 void rift_s_radio_queue_command (rift_s_radio_state *state, const uint64_t device_id, const uint8_t *cmd_bytes,
 		const int cmd_bytes_len, rift_s_radio_completion_fn cb, void *cb_data);
 void rift_s_radio_get_json_block (rift_s_radio_state *state, const uint64_t device_id, 
@@ -11,7 +11,7 @@
 /* Oculus Rift S Driver - HID/USB Driver Implementation */
 
 #include <stdlib.h>
-#include <hidapi.h>
+#include "../hid.h"
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
@@ -37,6 +37,12 @@ struct device_list_s {
 	device_list_t* next;
 };
 
+/* Per context driver state, holds the list of (probably 1) active HMD devices */
+struct rift_s_driver_s {
+	ohmd_driver base;
+	device_list_t* hmds;
+};
+
 typedef struct {
 	const char* name;
 	int company;
@@ -44,15 +50,12 @@ typedef struct {
 	int iface;
 } rift_devices;
 
-/* Global list of (probably 1) active HMD devices */
-static device_list_t* rift_hmds;
-
-static hid_device* open_hid_dev (ohmd_context* ctx, int vid, int pid, int iface_num);
+static ohmd_hid_device* open_hid_dev (ohmd_context* ctx, int vid, int pid, int iface_num);
 static void close_hmd (rift_s_hmd_t *hmd);
 
-static rift_s_hmd_t *find_hmd(char *hid_path)
+static rift_s_hmd_t *find_hmd(rift_s_driver *driver, char *hid_path)
 {
-	device_list_t* current = rift_hmds;
+	device_list_t* current = driver->hmds;
 
 	while (current != NULL) {
 		if (strcmp(current->path, hid_path)==0) {
@@ -64,19 +67,21 @@ static rift_s_hmd_t *find_hmd(char *hid_path)
 	return NULL;
 }
 
-static void push_hmd(rift_s_hmd_t *hmd, char *hid_path)
+static void push_hmd(rift_s_driver *driver, rift_s_hmd_t *hmd, char *hid_path)
 {
 	device_list_t* d = calloc(1, sizeof(device_list_t));
 	d->hmd = hmd;
 	strcpy (d->path, hid_path);
 
-	d->next = rift_hmds;
-	rift_hmds = d;
+	hmd->driver = driver;
+	d->next = driver->hmds;
+	driver->hmds = d;
 }
 
 static void release_hmd(rift_s_hmd_t *hmd)
 {
 	device_list_t* current, *prev;
+	rift_s_driver* driver;
 
 	if (hmd->use_count > 1) {
 		hmd->use_count--;
@@ -85,14 +90,15 @@ static void release_hmd(rift_s_hmd_t *hmd)
 
 	/* Use count on the HMD device hit 0, release it
 	 * and remove from the list */
-	current = rift_hmds;
+	driver = hmd->driver;
+	current = driver->hmds;
 	prev = NULL;
 	while (current != NULL) {
 		if (current->hmd == hmd) {
 			close_hmd (current->hmd);
 
 			if (prev == NULL)
-				rift_hmds = current->next;
+				driver->hmds = current->next;
 			else
 				prev->next = current->next;
 			free (current);
@@ -119,28 +125,29 @@ vec3f_rotate_3x3(vec3f *vec, float rot[3][3])
 }
 
 static void
-handle_hmd_report (rift_s_hmd_t *priv, const unsigned char *buf, int size)
+handle_hmd_report (rift_s_hmd_t *priv, const unsigned char *buf, int size, uint64_t host_ns)
 {
 	rift_s_hmd_report_t report;
 
-	if (!rift_s_parse_hmd_report (&report, buf, size)) {
+	OHMD_TRACE_BEGIN("rift_s_parse_hmd_report");
+	bool valid = rift_s_parse_hmd_report (&report, buf, size);
+	OHMD_TRACE_END();
+
+	if (!valid) {
 		return;
 	}
 
+	/* The timestamp is the one of the first sample */
 	const int32_t TICK_LEN_US = 1000000 / priv->imu_config.imu_hz;
-	int32_t dt = TICK_LEN_US;
-	uint32_t end_ts = report.timestamp;
-
-	if (priv->last_imu_timestamp != 0) {
-		dt = report.timestamp - priv->last_imu_timestamp;
-		end_ts -= dt;
-	}
 
 	const float gyro_scale = 1.0 / priv->imu_config.gyro_scale;
 	const float accel_scale = OHMD_GRAVITY_EARTH / priv->imu_config.accel_scale;
 	const float temperature_scale = 1.0 / priv->imu_config.temperature_scale;
 	const float temperature_offset = priv->imu_config.temperature_offset;
 
+	fusion_sample samples[3];
+	int num_samples = 0;
+
 	for(int i = 0; i < 3; i++) {
 		rift_s_hmd_imu_sample_t *s = report.samples + i;
 
@@ -148,7 +155,8 @@ handle_hmd_report (rift_s_hmd_t *priv, const unsigned char *buf, int size)
 				break; /* Sample (and remaining ones) are invalid */
 
 		vec3f gyro, accel;
-		float dt_sec = dt / 1000000.0;
+		uint64_t sample_ns = oclock_sync_update(&priv->imu_clock, report.timestamp + i * TICK_LEN_US, host_ns);
+		uint64_t dt_ns = priv->imu_clock.dt_ns > 0 ? priv->imu_clock.dt_ns : TICK_LEN_US * 1000;
 
 		gyro.x = DEG_TO_RAD(gyro_scale * s->gyro[0]);
 		gyro.y = DEG_TO_RAD(gyro_scale * s->gyro[1]);
@@ -174,16 +182,17 @@ handle_hmd_report (rift_s_hmd_t *priv, const unsigned char *buf, int size)
 
 #if 0
 		printf ("Sample %d dt %f accel %f %f %f gyro %f %f %f\n",
-			i, dt_sec, priv->raw_accel.x, priv->raw_accel.y, priv->raw_accel.z,
+			i, dt_ns / 1e9, priv->raw_accel.x, priv->raw_accel.y, priv->raw_accel.z,
 			priv->raw_gyro.x, priv->raw_gyro.y, priv->raw_gyro.z);
 #endif
 
-		ofusion_update(&priv->sensor_fusion, dt_sec, &priv->raw_gyro, &priv->raw_accel, &priv->raw_mag);
-		end_ts += dt;
-		dt = TICK_LEN_US;
+		fusion_sample smp = { sample_ns, dt_ns, gyro, accel, priv->raw_mag };
+		samples[num_samples++] = smp;
 	}
 
-	priv->last_imu_timestamp = end_ts;
+	OHMD_TRACE_BEGIN("ofusion_update");
+	ofusion_update_batch(&priv->sensor_fusion, samples, num_samples);
+	OHMD_TRACE_END();
 }
 
 static void update_hmd(rift_s_hmd_t *priv)
@@ -191,21 +200,22 @@ static void update_hmd(rift_s_hmd_t *priv)
 	unsigned char buf[FEATURE_BUFFER_SIZE];
 
 	// Handle keep alive messages
-	double t = ohmd_get_tick();
-	if(t - priv->last_keep_alive >= ((double)(KEEPALIVE_INTERVAL_MS) / 1000.0)) {
+	uint64_t t = ohmd_monotonic_ns();
+	if(t - priv->last_keep_alive_ns >= KEEPALIVE_INTERVAL_MS * 1000000ull) {
 		// send keep alive message
 		rift_s_send_keepalive (priv->handles[0]);
 		// Update the time of the last keep alive we have sent.
-		priv->last_keep_alive = t;
+		priv->last_keep_alive_ns = t;
 	}
 
 	/* Poll each of the 3 devices for messages and process them */
+	OHMD_TRACE_BEGIN("rift_s_hid_read");
 	for (int i = 0; i < 3; i++) {
 		if (priv->handles[i] == NULL)
 				continue;
 
 		while(true){
-			int size = hid_read(priv->handles[i], buf, FEATURE_BUFFER_SIZE);
+			int size = ohmd_hid_read(priv->handles[i], buf, FEATURE_BUFFER_SIZE);
 			if(size < 0){
 				LOGE("error reading from HMD device");
 				break;
@@ -214,9 +224,9 @@ static void update_hmd(rift_s_hmd_t *priv)
 			}
 
 			if (buf[0] == 0x65)
-				handle_hmd_report (priv, buf, size);
+				handle_hmd_report (priv, buf, size, priv->handles[i]->read_ns);
 			else if (buf[0] == 0x67)
-				rift_s_handle_controller_report (priv, priv->handles[0], buf, size);
+				rift_s_handle_controller_report (priv, priv->handles[0], buf, size, priv->handles[i]->read_ns);
 			else if (buf[0] == 0x66) {
 				// System state packet. Enable the screen if the prox sensor is
 				// triggered
@@ -230,8 +240,11 @@ static void update_hmd(rift_s_hmd_t *priv)
 			 LOGW("Unknown Rift S report 0x%02x!", buf[0]);
 		}
 	}
+	OHMD_TRACE_END();
 
+	OHMD_TRACE_BEGIN("rift_s_radio_update");
 	rift_s_radio_update (&priv->radio_state, priv->handles[0]);
+	OHMD_TRACE_END();
 }
 
 static void update_device(ohmd_device* device)
@@ -338,7 +351,7 @@ static void close_device(ohmd_device* device)
 
 #if 0
 static int
-dump_fw_block(hid_device *handle, uint8_t block_id) {
+dump_fw_block(ohmd_hid_device *handle, uint8_t block_id) {
 	int res;
 	char *data = NULL;
 	int len;
@@ -352,7 +365,7 @@ dump_fw_block(hid_device *handle, uint8_t block_id) {
 }
 #endif
 
-static int read_calibration (rift_s_hmd_t *hmd, hid_device *hid) {
+static int read_calibration (rift_s_hmd_t *hmd, ohmd_hid_device *hid) {
 
 	char *json = NULL;
 	int json_len = 0;
@@ -411,7 +424,7 @@ static rift_s_hmd_t *open_hmd(ohmd_driver* driver, ohmd_device_desc* desc)
 			RIFT_S_INTF_STATUS,
 			RIFT_S_INTF_CONTROLLERS,
 	};
-	hid_device *hid = NULL;
+	ohmd_hid_device *hid = NULL;
 	rift_s_hmd_t* priv = ohmd_alloc(driver->ctx, sizeof(rift_s_hmd_t));
 	rift_s_device_priv *hmd_dev;
 	if(!priv)
@@ -422,7 +435,7 @@ static rift_s_hmd_t *open_hmd(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->use_count = 1;
 	priv->ctx = driver->ctx;
 
-	priv->last_imu_timestamp = -1;
+	oclock_sync_init(&priv->imu_clock, 1000000.0, 32);
 
 	// Open the HID devices
 	for (int i = 0; i < 3; i++) {
@@ -531,7 +544,7 @@ static void close_hmd(rift_s_hmd_t *hmd)
 
 	for (int i = 0; i < 3; i++) {
 		if (hmd->handles[i])
-			hid_close(hmd->handles[i]);
+			ohmd_hid_close(hmd->handles[i]);
 	}
 	free(hmd);
 }
@@ -540,19 +553,19 @@ static void close_hmd(rift_s_hmd_t *hmd)
  * requested VID/PID/interface, which works fine if there's
  * 1 rift attached. To support multiple rift, we need to
  * match parent USB devices like ouvrt does */
-static hid_device* open_hid_dev(ohmd_context* ctx,
+static ohmd_hid_device* open_hid_dev(ohmd_context* ctx,
 		int vid, int pid, int iface_num)
 {
-	struct hid_device_info* devs = hid_enumerate(vid, pid);
-	struct hid_device_info* cur_dev = devs;
-	hid_device *handle = NULL;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(ctx, vid, pid);
+	ohmd_hid_device_info* cur_dev = devs;
+	ohmd_hid_device *handle = NULL;
 
 	if(devs == NULL)
 		return NULL;
 
 	while (cur_dev) {
 		if (cur_dev->interface_number == iface_num) {
-			handle = hid_open_path(cur_dev->path);
+			handle = ohmd_hid_open_path(ctx, cur_dev->path);
 			if (handle)
 				break;
 			else {
@@ -565,10 +578,10 @@ static hid_device* open_hid_dev(ohmd_context* ctx,
 		}
 		cur_dev = cur_dev->next;
 	}
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(ctx, devs);
 
 	if (handle) {
-		if(hid_set_nonblocking(handle, 1) == -1){
+		if(ohmd_hid_set_nonblocking(handle, 1) == -1){
 			ohmd_set_error(ctx, "Failed to set non-blocking mode on USB device");
 			goto cleanup;
 		}
@@ -576,24 +589,26 @@ static hid_device* open_hid_dev(ohmd_context* ctx,
 
 	return handle;
 cleanup:
-	hid_close(handle);
+	ohmd_hid_close(handle);
 	return NULL;
 }
 
 static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 {
 	rift_s_device_priv *dev = NULL;
-	rift_s_hmd_t *hmd = find_hmd(desc->path);
+	rift_s_hmd_t *hmd = find_hmd((rift_s_driver*)driver, desc->path);
 
 	if (hmd == NULL) {
 		hmd = open_hmd (driver, desc);
 		if (hmd == NULL)
 			return NULL;
-		push_hmd (hmd, desc->path);
+		push_hmd ((rift_s_driver*)driver, hmd, desc->path);
 	}
 
-	if (desc->id == 0)
+	if (desc->id == 0) {
 		dev = &hmd->hmd_dev;
+		dev->base.sensor_fusion = &hmd->sensor_fusion;
+	}
 	else if (desc->id <= MAX_CONTROLLERS) {
 		dev = &hmd->touch_dev[desc->id-1].base;
 	}
@@ -627,8 +642,8 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 	const int RIFT_ID_COUNT = sizeof(rd) / sizeof(rd[0]);
 
 	for(int i = 0; i < RIFT_ID_COUNT; i++){
-		struct hid_device_info* devs = hid_enumerate(rd[i].company, rd[i].id);
-		struct hid_device_info* cur_dev = devs;
+		ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, rd[i].company, rd[i].id);
+		ohmd_hid_device_info* cur_dev = devs;
 
 		if(devs == NULL)
 			continue;
@@ -648,6 +663,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 				desc->device_flags = OHMD_DEVICE_FLAGS_ROTATIONAL_TRACKING;
 
 				strcpy(desc->path, cur_dev->path);
+				ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 				desc->driver_ptr = driver;
 				desc->id = id++;
@@ -661,6 +677,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 				sprintf(desc->product, "%s: Left Controller", rd[i].name);
 
 				strcpy(desc->path, cur_dev->path);
+				ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 				desc->device_flags =
 					//OHMD_DEVICE_FLAGS_POSITIONAL_TRACKING |
@@ -680,6 +697,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 				sprintf(desc->product, "%s: Right Controller", rd[i].name);
 
 				strcpy(desc->path, cur_dev->path);
+				ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 				desc->device_flags =
 					//OHMD_DEVICE_FLAGS_POSITIONAL_TRACKING |
@@ -693,14 +711,14 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 			cur_dev = cur_dev->next;
 		}
 
-		hid_free_enumeration(devs);
+		ohmd_hid_free_enumeration(driver->ctx, devs);
 	}
 }
 
 static void destroy_driver(ohmd_driver* drv)
 {
 	LOGD("shutting down driver");
-	hid_exit();
+	ohmd_hid_exit(drv->ctx);
 	free(drv);
 
 	ohmd_toggle_ovr_service(1); //re-enable OVRService if previously running
@@ -708,10 +726,12 @@ static void destroy_driver(ohmd_driver* drv)
 
 ohmd_driver* ohmd_create_oculus_rift_s_drv(ohmd_context* ctx)
 {
-	ohmd_driver* drv = ohmd_alloc(ctx, sizeof(ohmd_driver));
-	if(drv == NULL)
+	rift_s_driver* rift_s = ohmd_alloc(ctx, sizeof(rift_s_driver));
+	if(rift_s == NULL)
 		return NULL;
 
+	ohmd_driver* drv = &rift_s->base;
+
 	ohmd_toggle_ovr_service(0); //disable OVRService if running
 
 	drv->get_device_list = get_device_list;
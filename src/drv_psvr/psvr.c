@@ -11,14 +11,14 @@
 
 #define FEATURE_BUFFER_SIZE 256
 
-#define TICK_LEN (1.0f / 1000000.0f) // 1 MHz ticks
+#define TICK_NS 1000 // 1 MHz ticks
 
 #define SONY_ID                  0x054c
 #define PSVR_HMD                 0x09af
 
 #include <string.h>
 #include <wchar.h>
-#include <hidapi.h>
+#include "../hid.h"
 #include <assert.h>
 #include <limits.h>
 #include <stdint.h>
@@ -29,9 +29,10 @@
 typedef struct {
 	ohmd_device base;
 
-	hid_device* hmd_handle;
-	hid_device* hmd_control;
+	ohmd_hid_device* hmd_handle;
+	ohmd_hid_device* hmd_control;
 	fusion sensor_fusion;
+	clock_sync imu_clock;
 	vec3f raw_accel, raw_gyro;
 	uint8_t last_seq;
 	uint8_t buttons;
@@ -54,73 +55,55 @@ static void gyro_from_psvr_vec(const int16_t* smp, vec3f* out_vec)
 }
 
 
-static uint32_t calc_delta_and_handle_rollover(uint32_t next, uint32_t last)
+static void handle_tracker_sensor_msg(psvr_priv* priv, unsigned char* buffer, int size, uint64_t host_ns)
 {
-	uint32_t tick_delta = next - last;
-
-	// The 24-bit tick counter has rolled over,
-	// adjust the "negative" value to be positive.
-	if (tick_delta > 0xffffff) {
-		tick_delta += 0x1000000;
-	}
-
-	return tick_delta;
-}
-
-static void handle_tracker_sensor_msg(psvr_priv* priv, unsigned char* buffer, int size)
-{
-	uint32_t last_sample_tick = priv->sensor.samples[1].tick;
-
+	OHMD_TRACE_BEGIN("psvr_decode_sensor_packet");
 	if(!psvr_decode_sensor_packet(&priv->sensor, buffer, size)){
 		LOGE("couldn't decode tracker sensor message");
 	}
+	OHMD_TRACE_END();
 
 	psvr_sensor_packet* s = &priv->sensor;
 
-	uint32_t tick_delta = 500;
+	vec3f mag = {{0.0f, 0.0f, 0.0f}};
+	fusion_sample samples[2];
 
-	// Startup correction, ignore last_sample_tick if zero.
-	if (last_sample_tick > 0) {
-		tick_delta = calc_delta_and_handle_rollover(
-			s->samples[0].tick, last_sample_tick);
+	for (int i = 0; i < 2; i++) {
+		uint64_t sample_ns = oclock_sync_update(&priv->imu_clock, s->samples[i].tick, host_ns);
+		uint64_t dt_ns = priv->imu_clock.dt_ns;
 
 		// The PSVR device can buffer sensor data from previous
 		// sessions which we can get at the start of new sessions.
 		// @todo Maybe just skip the first 10 sensor packets?
 		// @todo Maybe reset sensor fusion?
-		if (tick_delta < 475 || tick_delta > 525) {
-			LOGD("tick_delta = %u", tick_delta);
-			tick_delta = 500;
+		if (dt_ns < 475 * TICK_NS || dt_ns > 525 * TICK_NS) {
+			LOGD("dt = %u us", (unsigned)(dt_ns / TICK_NS));
+			dt_ns = 500 * TICK_NS;
 		}
-	}
-
-	vec3f mag = {{0.0f, 0.0f, 0.0f}};
 
-	for (int i = 0; i < 2; i++) {
-		float dt = tick_delta * TICK_LEN;
 		accel_from_psvr_vec(s->samples[i].accel, &priv->raw_accel);
 		gyro_from_psvr_vec(s->samples[i].gyro, &priv->raw_gyro);
 
-		ofusion_update(&priv->sensor_fusion, dt, &priv->raw_gyro, &priv->raw_accel, &mag);
-
-		if (i == 0) {
-			tick_delta = calc_delta_and_handle_rollover(
-				s->samples[1].tick, s->samples[0].tick);
-		}
+		fusion_sample smp = { sample_ns, dt_ns, priv->raw_gyro, priv->raw_accel, mag };
+		samples[i] = smp;
 	}
 
+	OHMD_TRACE_BEGIN("ofusion_update");
+	ofusion_update_batch(&priv->sensor_fusion, samples, 2);
+	OHMD_TRACE_END();
+
 	priv->buttons = s->buttons;
 }
 
 static void teardown(psvr_priv* priv)
 {
 	if (priv->hmd_handle != NULL) {
-		hid_close(priv->hmd_handle);
+		ohmd_hid_close(priv->hmd_handle);
 		priv->hmd_handle = NULL;
 	}
 
 	if (priv->hmd_control != NULL) {
-		hid_close(priv->hmd_control);
+		ohmd_hid_close(priv->hmd_control);
 		priv->hmd_control = NULL;
 	}
 }
@@ -132,17 +115,19 @@ static void update_device(ohmd_device* device)
 	int size = 0;
 	unsigned char buffer[FEATURE_BUFFER_SIZE];
 
+	OHMD_TRACE_BEGIN("psvr_hid_read");
 	while(true){
-		int size = hid_read(priv->hmd_handle, buffer, FEATURE_BUFFER_SIZE);
+		int size = ohmd_hid_read(priv->hmd_handle, buffer, FEATURE_BUFFER_SIZE);
 		if(size < 0){
 			LOGE("error reading from device");
-			return;
+			break;
 		} else if(size == 0) {
-			return; // No more messages, return.
+			break; // No more messages, return.
 		}
 
-		handle_tracker_sensor_msg(priv, buffer, size);
+		handle_tracker_sensor_msg(priv, buffer, size, priv->hmd_handle->read_ns);
 	}
+	OHMD_TRACE_END();
 
 	if(size < 0){
 		LOGE("error reading from device");
@@ -187,7 +172,7 @@ static void close_device(ohmd_device* device)
 	psvr_priv* priv = (psvr_priv*)device;
 
 	// set cinematic mode for the hmd
-	hid_write(priv->hmd_control, psvr_cinematicmode_on, sizeof(psvr_cinematicmode_on));
+	ohmd_hid_write(priv->hmd_control, psvr_cinematicmode_on, sizeof(psvr_cinematicmode_on));
 
 	LOGD("Closing Sony PSVR device.");
 
@@ -196,13 +181,13 @@ static void close_device(ohmd_device* device)
 	free(device);
 }
 
-static hid_device* open_device_idx(int manufacturer, int product, int iface, int device_index)
+static ohmd_hid_device* open_device_idx(ohmd_context* ctx, int manufacturer, int product, int iface, int device_index)
 {
-	struct hid_device_info* devs = hid_enumerate(manufacturer, product);
-	struct hid_device_info* cur_dev = devs;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(ctx, manufacturer, product);
+	ohmd_hid_device_info* cur_dev = devs;
 
 	int idx = 0;
-	hid_device* ret = NULL;
+	ohmd_hid_device* ret = NULL;
 
 	while (cur_dev) {
 		LOGI("%04x:%04x %s", manufacturer, product, cur_dev->path);
@@ -210,7 +195,7 @@ static hid_device* open_device_idx(int manufacturer, int product, int iface, int
 		if (cur_dev->interface_number == iface) {
 			if(idx == device_index){
 				LOGI("\topening '%s'", cur_dev->path);
-				ret = hid_open_path(cur_dev->path);
+				ret = ohmd_hid_open_path(ctx, cur_dev->path);
 				break;
 			}
 
@@ -220,7 +205,7 @@ static hid_device* open_device_idx(int manufacturer, int product, int iface, int
 		cur_dev = cur_dev->next;
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(ctx, devs);
 
 	return ret;
 }
@@ -237,35 +222,35 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	int idx = atoi(desc->path);
 
 	// Open the HMD device
-	priv->hmd_handle = open_device_idx(SONY_ID, PSVR_HMD, 4, idx);
+	priv->hmd_handle = open_device_idx(driver->ctx, SONY_ID, PSVR_HMD, 4, idx);
 
 	if(!priv->hmd_handle)
 		goto cleanup;
 
-	if(hid_set_nonblocking(priv->hmd_handle, 1) == -1){
+	if(ohmd_hid_set_nonblocking(priv->hmd_handle, 1) == -1){
 		ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 		goto cleanup;
 	}
 
 	// Open the HMD Control device
-	priv->hmd_control = open_device_idx(SONY_ID, PSVR_HMD, 5, idx);
+	priv->hmd_control = open_device_idx(driver->ctx, SONY_ID, PSVR_HMD, 5, idx);
 
 	if(!priv->hmd_control)
 		goto cleanup;
 
-	if(hid_set_nonblocking(priv->hmd_control, 1) == -1){
+	if(ohmd_hid_set_nonblocking(priv->hmd_control, 1) == -1){
 		ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 		goto cleanup;
 	}
 
 	// turn the display on
-	if (hid_write(priv->hmd_control, psvr_power_on, sizeof(psvr_power_on)) == -1) {
+	if (ohmd_hid_write(priv->hmd_control, psvr_power_on, sizeof(psvr_power_on)) == -1) {
 		ohmd_set_error(driver->ctx, "failed to write to device (power on)");
 		goto cleanup;
 	}
 
 	// set VR mode for the hmd
-	if (hid_write(priv->hmd_control, psvr_vrmode_on, sizeof(psvr_vrmode_on)) == -1) {
+	if (ohmd_hid_write(priv->hmd_control, psvr_vrmode_on, sizeof(psvr_vrmode_on)) == -1) {
 		ohmd_set_error(driver->ctx, "failed to write to device (set VR mode)");
 		goto cleanup;
 	}
@@ -304,6 +289,8 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->base.getf = getf;
 
 	ofusion_init(&priv->sensor_fusion);
+	oclock_sync_init(&priv->imu_clock, 1000000.0, 24);
+	priv->base.sensor_fusion = &priv->sensor_fusion;
 
 	return (ohmd_device*)priv;
 
@@ -318,8 +305,8 @@ cleanup:
 
 static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 {
-	struct hid_device_info* devs = hid_enumerate(SONY_ID, PSVR_HMD);
-	struct hid_device_info* cur_dev = devs;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, SONY_ID, PSVR_HMD);
+	ohmd_hid_device_info* cur_dev = devs;
 
 	int idx = 0;
 	while (cur_dev) {
@@ -345,6 +332,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 			desc->revision = 0;
 
 			snprintf(desc->path, OHMD_STR_SIZE, "%d", idx);
+			ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 			desc->driver_ptr = driver;
 
@@ -357,7 +345,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 		cur_dev = cur_dev->next;
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(driver->ctx, devs);
 }
 
 static void destroy_driver(ohmd_driver* drv)
@@ -7,7 +7,6 @@
 /* VR-Tek Driver */
 
 #include <stdlib.h>
-#include <hidapi.h>
 #include <string.h>
 #include <stdio.h>
 #include <assert.h>
@@ -26,7 +25,7 @@
 
 typedef struct {
     ohmd_device device;
-    hid_device* hid_handle;
+    ohmd_hid_device* hid_handle;
     vrtek_sensor_fusion_t* ofusion;
     vrtek_hmd_sku sku;
     char model_str[MODEL_STRING_LENGTH+1];
@@ -44,12 +43,12 @@ static int vrtek_send_init(vrtek_priv* priv)
 {
     uint8_t buf[] = { 0x1, 0x0 };
     int ret;
-    ret = hid_write(priv->hid_handle, buf, 2);
+    ret = ohmd_hid_write(priv->hid_handle, buf, 2);
     LOGD("%s: sent %d bytes\n", __func__, ret);
 
     if (ret == -1) {
         LOGE("%s: hid_write encountered an error: %ls", __func__,
-             hid_error(priv->hid_handle));
+             ohmd_hid_error(priv->hid_handle));
     }
 
     ohmd_sleep(0.1);
@@ -60,12 +59,12 @@ static int vrtek_send_init(vrtek_priv* priv)
 static int send_command_packet(vrtek_priv* priv, const uint8_t* data,
                                size_t length)
 {
-    int ret = hid_write(priv->hid_handle, data, length);
+    int ret = ohmd_hid_write(priv->hid_handle, data, length);
     LOGD("%s: sent command packet of %d bytes\n", __func__, ret);
 
     if (ret == -1) {
         LOGE("%s: hid_write encountered an error: %ls", __func__,
-             hid_error(priv->hid_handle));
+             ohmd_hid_error(priv->hid_handle));
     } else if (ret != length) {
         LOGE("%s: failed to send all bytes of command packet. "
              "Sent %d, expected %lu", __func__, ret, length);
@@ -86,12 +85,12 @@ static int receive_response_packet(vrtek_priv* priv, uint8_t* buf,
     const int max_hid_reads = 100;
 
     while (report_num != VRTEK_REPORT_CONTROL_INPUT) {
-        ret = hid_read_timeout(priv->hid_handle, buf, read_length,
+        ret = ohmd_hid_read_timeout(priv->hid_handle, buf, read_length,
                                read_timeout);
         ++hid_reads;
         if (ret == -1) {
             LOGE("%s: hid_read_timeout hit an error: %ls",
-                 __func__, hid_error(priv->hid_handle));
+                 __func__, ohmd_hid_error(priv->hid_handle));
         } else if (ret == 0) {
             LOGW("%s: hid_read_timeout received no packet", __func__);
         }
@@ -441,9 +440,9 @@ static uint16_t calc_delta_and_handle_rollover(uint16_t next, uint16_t last)
     return message_num_delta;
 }
 
-#define TICK_LEN (1.0f / 500.0f)    /* 500 Hz ticks */
+#define TICK_NS 2000000    /* 500 Hz ticks */
 
-static void handle_hmd_data_packet(vrtek_priv* priv, uint8_t* buf, int size)
+static void handle_hmd_data_packet(vrtek_priv* priv, uint8_t* buf, int size, uint64_t host_ns)
 {
     vrtek_hmd_data_t* hmd_data = &priv->hmd_data;
     uint16_t last_message_num = hmd_data->message_num;
@@ -460,21 +459,21 @@ static void handle_hmd_data_packet(vrtek_priv* priv, uint8_t* buf, int size)
 
     vrtek_sensor_fusion_t* ofusion = priv->ofusion;
 
-    float dt = TICK_LEN;
+    uint64_t dt_ns = TICK_NS;
 
     /* Startup correction */
     if (last_message_num != 256) {
         uint8_t delta = calc_delta_and_handle_rollover(hmd_data->message_num,
                                                        last_message_num);
-        dt *= delta;
+        dt_ns *= delta;
     }
 
     gyro_from_hmd_data(ofusion, hmd_data->gyroscope, &ofusion->raw_gyro);
     accel_from_hmd_data(ofusion, hmd_data->acceleration, &ofusion->raw_accel);
     mag_from_hmd_data(ofusion, hmd_data->magnetometer, &ofusion->raw_mag);
 
-    ofusion_update(&ofusion->sensor_fusion, dt,
-                   &ofusion->raw_gyro, &ofusion->raw_accel, &ofusion->raw_mag);
+    ofusion_update_at(&ofusion->sensor_fusion, host_ns, dt_ns,
+                      &ofusion->raw_gyro, &ofusion->raw_accel, &ofusion->raw_mag);
 }
 
 static void update_device(ohmd_device* device)
@@ -483,9 +482,9 @@ static void update_device(ohmd_device* device)
     uint8_t buf[REPORT_BUFFER_SIZE];
     vrtek_priv* priv = vrtek_priv_get(device);
 
-    while ((size = hid_read(priv->hid_handle, buf, REPORT_BUFFER_SIZE)) > 0) {
+    while ((size = ohmd_hid_read(priv->hid_handle, buf, REPORT_BUFFER_SIZE)) > 0) {
         if (buf[0] == VRTEK_REPORT_SENSOR) {
-            handle_hmd_data_packet(priv, buf, size);
+            handle_hmd_data_packet(priv, buf, size, priv->hid_handle->read_ns);
         } else {
             LOGE("unknown message type: %u", buf[0]);
         }
@@ -533,7 +532,7 @@ static void close_device(ohmd_device* device)
 {
     LOGD("closing device");
     vrtek_priv* priv = vrtek_priv_get(device);
-    hid_close(priv->hid_handle);
+    ohmd_hid_close(priv->hid_handle);
     free(priv->ofusion);
     free(priv);
 }
@@ -548,7 +547,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
     priv->device.ctx = driver->ctx;
 
     /* Open the HID device */
-    priv->hid_handle = hid_open_path(desc->path);
+    priv->hid_handle = ohmd_hid_open_path(driver->ctx, desc->path);
 
     if (!priv->hid_handle) {
         char* path = _hid_to_unix_path(desc->path);
@@ -559,7 +558,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
         goto cleanup;
     }
 
-    if (hid_set_nonblocking(priv->hid_handle, 1) == -1) {
+    if (ohmd_hid_set_nonblocking(priv->hid_handle, 1) == -1) {
         ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
         goto cleanup;
     }
@@ -606,6 +605,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 
     if (priv->ofusion) {
         ofusion_init(&priv->ofusion->sensor_fusion);
+        priv->device.sensor_fusion = &priv->ofusion->sensor_fusion;
 
         /* Known initial value for startup correction */
         priv->hmd_data.message_num = 256;
@@ -626,9 +626,9 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
      * VR-Tek reuses the Oculus Vendor ID, but the manufacturer string is
      * "STMicroelectronics" rather than "Oculus VR, Inc." and the product
      * string is "HID". */
-    struct hid_device_info* devs = hid_enumerate(OCULUS_VR_INC_ID,
+    ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, OCULUS_VR_INC_ID,
                                                  VRTEK_WVR_HMD);
-    struct hid_device_info* cur_dev = devs;
+    ohmd_hid_device_info* cur_dev = devs;
 
     while (cur_dev) {
         if (ohmd_wstring_match(cur_dev->manufacturer_string, L"STMicroelectronics") &&
@@ -643,18 +643,19 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
             desc->device_flags = OHMD_DEVICE_FLAGS_ROTATIONAL_TRACKING;
 
             strcpy(desc->path, cur_dev->path);
+            ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
             desc->driver_ptr = driver;
         }
         cur_dev = cur_dev->next;
     }
 
-    hid_free_enumeration(devs);
+    ohmd_hid_free_enumeration(driver->ctx, devs);
 }
 
 static void destroy_driver(ohmd_driver* drv)
 {
     LOGD("Shutting down VR-Tek driver");
-    hid_exit();
+    ohmd_hid_exit(drv->ctx);
     free(drv);
 }
 
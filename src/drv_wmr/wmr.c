@@ -9,14 +9,14 @@
 
 #define FEATURE_BUFFER_SIZE 497
 
-#define TICK_LEN (1.0f / 10000000.0f) // 1000 Hz ticks
+#define TICK_NS 100 // 10 MHz ticks
 
 #define MICROSOFT_VID        0x045e
 #define HOLOLENS_SENSORS_PID 0x0659
 
 #include <string.h>
 #include <wchar.h>
-#include <hidapi.h>
+#include "../hid.h"
 #include <assert.h>
 #include <limits.h>
 #include <stdint.h>
@@ -30,10 +30,10 @@
 typedef struct {
 	ohmd_device base;
 
-	hid_device* hmd_imu;
+	ohmd_hid_device* hmd_imu;
 	fusion sensor_fusion;
 	vec3f raw_accel, raw_gyro;
-	uint32_t last_ticks;
+	clock_sync imu_clock;
 	uint8_t last_seq;
 	hololens_sensors_packet sensor;
 
@@ -74,33 +74,36 @@ static void vec3f_from_hololens_accel(int32_t smp[3][4], int i, vec3f* out_vec)
 	out_vec->z = (float)smp[2][i] * 0.001f * -1.0f;
 }
 
-static void handle_tracker_sensor_msg(wmr_priv* priv, unsigned char* buffer, int size)
+static void handle_tracker_sensor_msg(wmr_priv* priv, unsigned char* buffer, int size, uint64_t host_ns)
 {
-	uint64_t last_sample_tick = priv->sensor.gyro_timestamp[3];
-
+	OHMD_TRACE_BEGIN("hololens_sensors_decode_packet");
 	if(!hololens_sensors_decode_packet(&priv->sensor, buffer, size)){
 		LOGE("couldn't decode tracker sensor message");
 	}
+	OHMD_TRACE_END();
 
 	hololens_sensors_packet* s = &priv->sensor;
 
 
 	vec3f mag = {{0.0f, 0.0f, 0.0f}};
+	fusion_sample samples[4];
 
 	for(int i = 0; i < 4; i++){
-		uint64_t tick_delta = 1000;
-		if(last_sample_tick > 0) //startup correction
-			tick_delta = s->gyro_timestamp[i] - last_sample_tick;
-
-		float dt = tick_delta * TICK_LEN;
+		uint64_t sample_ns = oclock_sync_update(&priv->imu_clock, s->gyro_timestamp[i], host_ns);
+		uint64_t dt_ns = priv->imu_clock.dt_ns;
+		if(dt_ns == 0) //startup correction
+			dt_ns = 1000 * TICK_NS;
 
 		vec3f_from_hololens_gyro(s->gyro, i, &priv->raw_gyro);
 		vec3f_from_hololens_accel(s->accel, i, &priv->raw_accel);
 
-		ofusion_update(&priv->sensor_fusion, dt, &priv->raw_gyro, &priv->raw_accel, &mag);
-
-		last_sample_tick = s->gyro_timestamp[i];
+		fusion_sample smp = { sample_ns, dt_ns, priv->raw_gyro, priv->raw_accel, mag };
+		samples[i] = smp;
 	}
+
+	OHMD_TRACE_BEGIN("ofusion_update");
+	ofusion_update_batch(&priv->sensor_fusion, samples, 4);
+	OHMD_TRACE_END();
 }
 
 static void update_device(ohmd_device* device)
@@ -109,22 +112,24 @@ static void update_device(ohmd_device* device)
 
 	unsigned char buffer[FEATURE_BUFFER_SIZE];
 
+	OHMD_TRACE_BEGIN("wmr_hid_read");
 	while(true){
-		int size = hid_read(priv->hmd_imu, buffer, FEATURE_BUFFER_SIZE);
+		int size = ohmd_hid_read(priv->hmd_imu, buffer, FEATURE_BUFFER_SIZE);
 		if(size < 0){
 			LOGE("error reading from device");
-			return;
+			break;
 		} else if(size == 0) {
-			return; // No more messages, return.
+			break; // No more messages, return.
 		}
 
 		// currently the only message type the hardware supports (I think)
 		if(buffer[0] == HOLOLENS_IRQ_SENSORS){
-			handle_tracker_sensor_msg(priv, buffer, size);
+			handle_tracker_sensor_msg(priv, buffer, size, priv->hmd_imu->read_ns);
 		}else if(buffer[0] != HOLOLENS_IRQ_DEBUG){
 			LOGE("unknown message type: %u", buffer[0]);
 		}
 	}
+	OHMD_TRACE_END();
 }
 
 static int getf(ohmd_device* device, ohmd_float_value type, float* out)
@@ -160,25 +165,25 @@ static void close_device(ohmd_device* device)
 
 	LOGD("closing Microsoft HoloLens Sensors device");
 
-	hid_close(priv->hmd_imu);
+	ohmd_hid_close(priv->hmd_imu);
 
 	free(device);
 }
 
-static hid_device* open_device_idx(int manufacturer, int product, int iface, int iface_tot, int device_index)
+static ohmd_hid_device* open_device_idx(ohmd_context* ctx, int manufacturer, int product, int iface, int iface_tot, int device_index)
 {
-	struct hid_device_info* devs = hid_enumerate(manufacturer, product);
-	struct hid_device_info* cur_dev = devs;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(ctx, manufacturer, product);
+	ohmd_hid_device_info* cur_dev = devs;
 
 	int idx = 0;
 	int iface_cur = 0;
-	hid_device* ret = NULL;
+	ohmd_hid_device* ret = NULL;
 
 	while (cur_dev) {
 		LOGI("%04x:%04x %s\n", manufacturer, product, cur_dev->path);
 
 		if(idx == device_index && iface == iface_cur){
-			ret = hid_open_path(cur_dev->path);
+			ret = ohmd_hid_open_path(ctx, cur_dev->path);
 			LOGI("opening\n");
 		}
 
@@ -192,19 +197,19 @@ static hid_device* open_device_idx(int manufacturer, int product, int iface, int
 		}
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(ctx, devs);
 
 	return ret;
 }
 
-static int config_command_sync(hid_device* hmd_imu, unsigned char type,
+static int config_command_sync(ohmd_hid_device* hmd_imu, unsigned char type,
 			       unsigned char* buf, int len)
 {
 	unsigned char cmd[64] = { 0x02, type };
 
-	hid_write(hmd_imu, cmd, sizeof(cmd));
+	ohmd_hid_write(hmd_imu, cmd, sizeof(cmd));
 	do {
-		int size = hid_read(hmd_imu, buf, len);
+		int size = ohmd_hid_read(hmd_imu, buf, len);
 		if (size == -1)
 			return -1;
 		if (buf[0] == HOLOLENS_IRQ_CONTROL)
@@ -338,7 +343,7 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	int idx = atoi(desc->path);
 
 	// Open the HMD device
-	priv->hmd_imu = open_device_idx(MICROSOFT_VID, HOLOLENS_SENSORS_PID, 0, 1, idx);
+	priv->hmd_imu = open_device_idx(driver->ctx, MICROSOFT_VID, HOLOLENS_SENSORS_PID, 0, 1, idx);
 
 	if(!priv->hmd_imu)
 		goto cleanup;
@@ -402,13 +407,13 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 		LOGE("Could not read config from the firmware\n");
 	}
 
-	if(hid_set_nonblocking(priv->hmd_imu, 1) == -1){
+	if(ohmd_hid_set_nonblocking(priv->hmd_imu, 1) == -1){
 		ohmd_set_error(driver->ctx, "failed to set non-blocking on device");
 		goto cleanup;
 	}
 
 	// turn the IMU on
-	hid_write(priv->hmd_imu, hololens_sensors_imu_on, sizeof(hololens_sensors_imu_on));
+	ohmd_hid_write(priv->hmd_imu, hololens_sensors_imu_on, sizeof(hololens_sensors_imu_on));
 
 	// Set default device properties
 	ohmd_set_default_device_properties(&priv->base.properties);
@@ -445,6 +450,8 @@ static ohmd_device* open_device(ohmd_driver* driver, ohmd_device_desc* desc)
 	priv->base.getf = getf;
 
 	ofusion_init(&priv->sensor_fusion);
+	oclock_sync_init(&priv->imu_clock, 10000000.0, 64);
+	priv->base.sensor_fusion = &priv->sensor_fusion;
 
 	return (ohmd_device*)priv;
 
@@ -457,8 +464,8 @@ cleanup:
 
 static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 {
-	struct hid_device_info* devs = hid_enumerate(MICROSOFT_VID, HOLOLENS_SENSORS_PID);
-	struct hid_device_info* cur_dev = devs;
+	ohmd_hid_device_info* devs = ohmd_hid_enumerate(driver->ctx, MICROSOFT_VID, HOLOLENS_SENSORS_PID);
+	ohmd_hid_device_info* cur_dev = devs;
 
 	int idx = 0;
 	while (cur_dev) {
@@ -471,6 +478,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 		desc->revision = 0;
 
 		snprintf(desc->path, OHMD_STR_SIZE, "%d", idx);
+		ohmd_hid_copy_wstr(desc->serial, OHMD_STR_SIZE, cur_dev->serial_number);
 
 		desc->driver_ptr = driver;
 
@@ -481,7 +489,7 @@ static void get_device_list(ohmd_driver* driver, ohmd_device_list* list)
 		idx++;
 	}
 
-	hid_free_enumeration(devs);
+	ohmd_hid_free_enumeration(driver->ctx, devs);
 }
 
 static void destroy_driver(ohmd_driver* drv)
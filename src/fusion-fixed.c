@@ -0,0 +1,303 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Sensor Fusion - Fixed Point Filters */
+
+/*
+ * The complementary, Mahony and Madgwick filters of fusion.c step for step in
+ * the Q formats of omath-fixed.h, for targets without a fast FPU. Samples are
+ * converted on the way in and the orientation on the way out, the state in
+ * fusion.fx is all integer.
+ */
+
+#include "openhmdi.h"
+
+// (a * b + c * d + ...) >> 30 of products in Q30, rounded
+static inline int32_t sum_q30(int64_t s)
+{
+	return (int32_t)((s + ((int64_t)1 << 29)) >> 30);
+}
+
+// a squared length in Q32 of a constant in m/s²
+#define SQ_Q32(_f) ((int64_t)((double)(_f) * (double)(_f) * 4294967296.0))
+
+// Adds a sample to the fused time, returns its integration step in seconds in Q32, saturated at 1 s
+static inline uint32_t advance(fusion* me, const fusion_sample* s)
+{
+	me->time_ns += s->dt_ns;
+
+	// dt_ns * 2^32 / 10^9, as dt_ns * (2^61 / 10^9) >> 29
+	return s->dt_ns >= 1000000000ull ? 0xffffffffu : (uint32_t)((s->dt_ns * 2305843009ull) >> 29);
+}
+
+// Rotates orient by ang_vel (Q16) over dt (Q32) in the body frame, returns the length of ang_vel in Q16.
+static int32_t rotate_by_gyro(quatx* orient, const vec3x* ang_vel, uint32_t dt)
+{
+	int32_t ang_vel_length = ovec3x_get_length(ang_vel);
+
+	if(ang_vel_length > OFIX_CONST(0.0001, 16)){
+		// half the angle turned in Q30, Q16 * Q32 >> 19
+		int64_t half_angle = (int64_t)(((uint64_t)ang_vel_length * dt) >> 19);
+		int32_t sin_half, cos_half;
+
+		if(half_angle < OFIX_CONST(0.01, 30)){
+			int32_t h = (int32_t)half_angle, sq = ofix_mul(h, h, 30);
+			sin_half = h - ofix_mul(h, sq, 30) / 6;
+			cos_half = OFIX_ONE(30) - ofix_mul(sq, OFIX_ONE(30) / 2 - sq / 24, 30);
+		}else{
+			ofix_sincos(half_angle, &sin_half, &cos_half);
+		}
+
+		// sin_half / ang_vel_length in Q40, times a component of ang_vel in Q16 is at most sin_half in Q56
+		int64_t s = (int64_t)sin_half * ((int64_t)1 << 26) / ang_vel_length;
+		quatx delta_orient = {{
+			(int32_t)((ang_vel->x * s + ((int64_t)1 << 25)) >> 26),
+			(int32_t)((ang_vel->y * s + ((int64_t)1 << 25)) >> 26),
+			(int32_t)((ang_vel->z * s + ((int64_t)1 << 25)) >> 26),
+			cos_half
+		}};
+
+		oquatx_mult_me(orient, &delta_orient);
+	}
+
+	return ang_vel_length;
+}
+
+static void finish(fusion* me)
+{
+	oquatx_normalize_me(&me->fx.orient);
+	oquatx_to_quatf(&me->fx.orient, &me->orient);
+}
+
+/* Complementary filter */
+
+// grav_error_axis in Q30, corr_angle in Q29
+static void get_correction(const fusion* me, int32_t corr_angle, quatx* corr_quat)
+{
+	// half of the angle in Q29 is the same number in Q30
+	int32_t sin_half, cos_half;
+	ofix_sincos(corr_angle, &sin_half, &cos_half);
+
+	const vec3x* axis = &me->fx.grav_error_axis;
+	corr_quat->x = ofix_mul(axis->x, sin_half, 30);
+	corr_quat->y = ofix_mul(axis->y, sin_half, 30);
+	corr_quat->z = ofix_mul(axis->z, sin_half, 30);
+	corr_quat->w = cos_half;
+}
+
+static void apply_correction(fusion* me, int32_t corr_angle)
+{
+	if(corr_angle == 0)
+		return;
+
+	quatx corr_quat;
+	get_correction(me, corr_angle, &corr_quat);
+	quatx old_orient = me->fx.orient;
+
+	oquatx_mult(&corr_quat, &old_orient, &me->fx.orient);
+}
+
+static void add_accel(fusion_fixed* fx, const vec3x* vec)
+{
+	vec3x* elem = fx->accel_elems + fx->accel_at;
+
+	for(int i = 0; i < 3; i++)
+		fx->accel_sum[i] += vec->arr[i] - elem->arr[i];
+	*elem = *vec;
+
+	if(++fx->accel_at == FUSION_FILTER_QUEUE_SIZE)
+		fx->accel_at = 0;
+}
+
+static void integrate(fusion* me, uint32_t dt, const vec3x* ang_vel, const vec3x* accel, int32_t* corr_angle)
+{
+	fusion_fixed* fx = &me->fx;
+
+	// in the world frame of the orientation with the corrections of the batch so far, as in fusion.c
+	vec3x world_accel;
+	oquatx_get_rotated(&fx->orient, accel, &world_accel);
+	if(*corr_angle != 0){
+		quatx corr_quat;
+		vec3x uncorrected = world_accel;
+		get_correction(me, *corr_angle, &corr_quat);
+		oquatx_get_rotated(&corr_quat, &uncorrected, &world_accel);
+	}
+
+	me->iterations += 1;
+	add_accel(fx, &world_accel);
+
+	int32_t ang_vel_length = rotate_by_gyro(&fx->orient, ang_vel, dt);
+
+	// gravity correction, as integrate in fusion.c
+	if(me->flags & FF_USE_GRAVITY){
+		const int64_t min_level_accel_sq = SQ_Q32(9.82 - 0.8), max_level_accel_sq = SQ_Q32(9.82 + 0.8);
+		const int32_t min_tilt_error = OFIX_CONST(0.05, 29), max_tilt_error = OFIX_CONST(0.01, 29);
+		int64_t accel_sq = ovec3x_get_dot(accel, accel);
+
+		me->device_level_count =
+			accel_sq > min_level_accel_sq && accel_sq < max_level_accel_sq &&
+			ang_vel_length < OFIX_CONST(0.1, 16)
+			? me->device_level_count + 1 : 0;
+
+		if(me->device_level_count > 50){
+			me->device_level_count = 0;
+
+			vec3x accel_mean;
+			for(int i = 0; i < 3; i++)
+				accel_mean.arr[i] = (int32_t)(fx->accel_sum[i] / FUSION_FILTER_QUEUE_SIZE);
+
+			if(ovec3x_get_length(&accel_mean) - OFIX_CONST(9.82, 16) < OFIX_CONST(0.4, 16)){
+				vec3x tilt = {{ accel_mean.z, 0, -accel_mean.x }};
+				ovec3x_normalize_me(&tilt);
+
+				// the angle between up and the mean
+				int32_t horizontal = (int32_t)ofix_isqrt64((uint64_t)((int64_t)accel_mean.x * accel_mean.x + (int64_t)accel_mean.z * accel_mean.z));
+				int32_t tilt_angle = ofix_atan2(horizontal, accel_mean.y);
+
+				if(tilt_angle > max_tilt_error){
+					apply_correction(me, *corr_angle);
+					*corr_angle = 0;
+
+					fx->grav_error_angle = tilt_angle;
+					fx->grav_error_axis = tilt;
+				}
+			}
+		}
+
+		if(fx->grav_error_angle > min_tilt_error){
+			if(me->iterations < FUSION_SNAP_ITERATIONS){
+				apply_correction(me, *corr_angle - fx->grav_error_angle);
+				*corr_angle = 0;
+				fx->grav_error_angle = 0;
+			}else{
+				// grav_gain * angle in Q29, times 5 * ang_vel_length + 1 in Q16
+				int64_t scaled = ofix_mul(fx->grav_gain, fx->grav_error_angle, 30);
+				int32_t use_angle = (int32_t)(-(scaled * (5 * (int64_t)ang_vel_length + OFIX_ONE(16))) >> 16);
+
+				fx->grav_error_angle += use_angle;
+				*corr_angle += use_angle;
+			}
+		}
+	}
+}
+
+void ofusion_fixed_complementary_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	int32_t corr_angle = 0;
+
+	for(int i = 0; i < count; i++){
+		const fusion_sample* s = samples + i;
+		vec3x ang_vel, accel;
+
+		vec3f gyro;
+		ofusion_sample_ang_vel(me, s, &gyro);
+		ovec3x_from_vec3f(&gyro, 16, &ang_vel);
+		ovec3x_from_vec3f(&s->accel, 16, &accel);
+
+		integrate(me, advance(me, s), &ang_vel, &accel, &corr_angle);
+	}
+
+	apply_correction(me, corr_angle);
+	finish(me);
+}
+
+/* Mahony and Madgwick filters */
+
+// The tilt error of tilt_error in fusion.c in Q30, accel in Q16
+static bool tilt_error(const quatx* q, const vec3x* accel, vec3x* err)
+{
+	const int64_t min_accel_sq = SQ_Q32(9.82 - FUSION_ACCEL_TOLERANCE), max_accel_sq = SQ_Q32(9.82 + FUSION_ACCEL_TOLERANCE);
+	int64_t accel_sq = ovec3x_get_dot(accel, accel);
+
+	if(accel_sq < min_accel_sq || accel_sq > max_accel_sq)
+		return false;
+
+	// world up in the body frame, twice a sum of products is that sum >> 29
+	int64_t x = q->x, y = q->y, z = q->z, w = q->w;
+	int32_t up_x = (int32_t)((x * y + w * z + ((int64_t)1 << 28)) >> 29);
+	int32_t up_y = OFIX_ONE(30) - (int32_t)((x * x + z * z + ((int64_t)1 << 28)) >> 29);
+	int32_t up_z = (int32_t)((y * z - w * x + ((int64_t)1 << 28)) >> 29);
+
+	// 1 / |accel| in Q30 of |accel| in Q16
+	int32_t inv_len = (int32_t)(((int64_t)1 << 46) / ofix_isqrt64((uint64_t)accel_sq));
+	int64_t a_x = ofix_mul(accel->x, inv_len, 16), a_y = ofix_mul(accel->y, inv_len, 16), a_z = ofix_mul(accel->z, inv_len, 16);
+
+	err->x = sum_q30(a_y * up_z - a_z * up_y);
+	err->y = sum_q30(a_z * up_x - a_x * up_z);
+	err->z = sum_q30(a_x * up_y - a_y * up_x);
+
+	return true;
+}
+
+void ofusion_fixed_mahony_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	const int32_t ki = OFIX_CONST(FUSION_MAHONY_KI, 30);
+	fusion_fixed* fx = &me->fx;
+
+	for(int i = 0; i < count; i++){
+		const fusion_sample* s = samples + i;
+		uint32_t dt = advance(me, s);
+		bool startup = me->time_ns < FUSION_STARTUP_NS;
+		vec3x ang_vel, accel, err;
+
+		vec3f gyro;
+		ofusion_sample_ang_vel(me, s, &gyro);
+		ovec3x_from_vec3f(&gyro, 16, &ang_vel);
+		ovec3x_from_vec3f(&s->accel, 16, &accel);
+
+		if(tilt_error(&fx->orient, &accel, &err)){
+			int32_t kp = startup ? OFIX_CONST(FUSION_MAHONY_KP * FUSION_STARTUP_GAIN, 16) : OFIX_CONST(FUSION_MAHONY_KP, 16);
+
+			for(int j = 0; j < 3; j++){
+				if(!startup)
+					fx->integral_error.arr[j] += (int32_t)(((int64_t)ofix_mul(ki, err.arr[j], 30) * dt + ((int64_t)1 << 31)) >> 32);
+
+				ang_vel.arr[j] += ofix_mul(kp, err.arr[j], 30);
+			}
+		}
+
+		// the integral feedback from Q30 to Q16
+		for(int j = 0; j < 3; j++)
+			ang_vel.arr[j] += (fx->integral_error.arr[j] + (1 << 13)) >> 14;
+
+		rotate_by_gyro(&fx->orient, &ang_vel, dt);
+	}
+
+	finish(me);
+}
+
+void ofusion_fixed_madgwick_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	fusion_fixed* fx = &me->fx;
+
+	for(int i = 0; i < count; i++){
+		const fusion_sample* s = samples + i;
+		uint32_t dt = advance(me, s);
+		vec3x ang_vel, accel, err;
+
+		vec3f gyro;
+		ofusion_sample_ang_vel(me, s, &gyro);
+		ovec3x_from_vec3f(&gyro, 16, &ang_vel);
+		ovec3x_from_vec3f(&s->accel, 16, &accel);
+
+		if(tilt_error(&fx->orient, &accel, &err)){
+			int32_t err_length = ovec3x_get_length(&err);
+
+			if(err_length > OFIX_CONST(0.000001, 30)){
+				int64_t beta = me->time_ns < FUSION_STARTUP_NS
+					? OFIX_CONST(FUSION_MADGWICK_BETA * FUSION_STARTUP_GAIN, 16) : OFIX_CONST(FUSION_MADGWICK_BETA, 16);
+				// 2 beta / err_length in Q16, times a component of err is at most 2 beta in Q46
+				int64_t step = 2 * beta * OFIX_ONE(30) / err_length;
+
+				for(int j = 0; j < 3; j++)
+					ang_vel.arr[j] += (int32_t)((step * err.arr[j] + ((int64_t)1 << 29)) >> 30);
+			}
+		}
+
+		rotate_by_gyro(&fx->orient, &ang_vel, dt);
+	}
+
+	finish(me);
+}
@@ -0,0 +1,366 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Sensor Fusion of Many Trackers Implementation */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "openhmdi.h"
+#include "fusion-group.h"
+
+// FUSION_GROUP_WIDTH floats, one per lane, and lane masks. l_queued_gt masks the lanes with more than n samples queued.
+#if OMATH_SSE2
+typedef __m128 lanef;
+typedef __m128 lanem;
+#define l_set _mm_set1_ps
+#define l_load _mm_loadu_ps
+#define l_store _mm_storeu_ps
+#define l_add _mm_add_ps
+#define l_sub _mm_sub_ps
+#define l_mul _mm_mul_ps
+#define l_div _mm_div_ps
+#define l_sqrt _mm_sqrt_ps
+#define l_gt _mm_cmpgt_ps
+#define l_ge _mm_cmpge_ps
+#define l_le _mm_cmple_ps
+#define l_and _mm_and_ps
+#define l_andnot(_a, _b) _mm_andnot_ps(_b, _a)
+#define l_sel(_m, _a, _b) _mm_or_ps(_mm_and_ps(_m, _a), _mm_andnot_ps(_m, _b))
+#define l_any(_m) (_mm_movemask_ps(_m) != 0)
+#define l_queued_gt(_p, _n) _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_loadu_si128((const __m128i*)(_p)), _mm_set1_epi32(_n)))
+#elif OMATH_NEON
+typedef float32x4_t lanef;
+typedef uint32x4_t lanem;
+#define l_set vdupq_n_f32
+#define l_load vld1q_f32
+#define l_store vst1q_f32
+#define l_add vaddq_f32
+#define l_sub vsubq_f32
+#define l_mul vmulq_f32
+#define l_div vdivq_f32
+#define l_sqrt vsqrtq_f32
+#define l_gt vcgtq_f32
+#define l_ge vcgeq_f32
+#define l_le vcleq_f32
+#define l_and vandq_u32
+#define l_andnot vbicq_u32
+#define l_sel vbslq_f32
+#define l_any(_m) (vmaxvq_u32(_m) != 0)
+#define l_queued_gt(_p, _n) vcgtq_s32(vld1q_s32(_p), vdupq_n_s32(_n))
+#else
+typedef float lanef;
+typedef bool lanem;
+#define l_set(_f) (_f)
+#define l_load(_p) (*(_p))
+#define l_store(_p, _v) (*(_p) = (_v))
+#define l_add(_a, _b) ((_a) + (_b))
+#define l_sub(_a, _b) ((_a) - (_b))
+#define l_mul(_a, _b) ((_a) * (_b))
+#define l_div(_a, _b) ((_a) / (_b))
+#define l_sqrt sqrtf
+#define l_gt(_a, _b) ((_a) > (_b))
+#define l_ge(_a, _b) ((_a) >= (_b))
+#define l_le(_a, _b) ((_a) <= (_b))
+#define l_and(_a, _b) ((_a) && (_b))
+#define l_andnot(_a, _b) ((_a) && !(_b))
+#define l_sel(_m, _a, _b) ((_m) ? (_a) : (_b))
+#define l_any(_m) (_m)
+#define l_queued_gt(_p, _n) (*(_p) > (_n))
+#endif
+
+typedef struct { lanef x, y, z; } lane3;
+typedef struct { lanef x, y, z, w; } lane4;
+
+bool ofusion_group_init(fusion_group* me, ohmd_fusion_backend backend, int capacity, int max_samples)
+{
+	memset(me, 0, sizeof(fusion_group));
+
+	if((backend != OHMD_FUSION_MAHONY && backend != OHMD_FUSION_MADGWICK) || capacity <= 0 || max_samples <= 0)
+		return false;
+
+	int n = (capacity + FUSION_GROUP_WIDTH - 1) / FUSION_GROUP_WIDTH * FUSION_GROUP_WIDTH;
+	size_t lanes = (size_t)n, slots = (size_t)n * max_samples;
+
+	// one block, the 64 bit arrays first to keep everything aligned
+	size_t size = 3 * lanes * sizeof(uint64_t) + (7 * lanes + 8 * slots) * sizeof(float)
+		+ lanes * sizeof(int) + lanes * sizeof(bool);
+
+	char* mem = calloc(1, size);
+	if(!mem)
+		return false;
+
+	me->backend = backend;
+	me->capacity = n;
+	me->max_samples = max_samples;
+	me->mem = mem;
+
+	uint64_t* u = (uint64_t*)mem;
+	me->time_ns = u; u += lanes;
+	me->sample_ns = u; u += lanes;
+	me->queued_ns = u; u += lanes;
+
+	float* f = (float*)u;
+	float** state[] = { &me->qx, &me->qy, &me->qz, &me->qw, &me->ix, &me->iy, &me->iz };
+	for(int i = 0; i < 7; i++, f += lanes)
+		*state[i] = f;
+
+	float** samples[] = { &me->gx, &me->gy, &me->gz, &me->ax, &me->ay, &me->az, &me->dt, &me->startup };
+	for(int i = 0; i < 8; i++, f += slots)
+		*samples[i] = f;
+
+	me->queued = (int*)f;
+	me->used = (bool*)(me->queued + lanes);
+
+	for(int i = 0; i < n; i++)
+		me->qw[i] = 1.0f;
+
+	return true;
+}
+
+void ofusion_group_destroy(fusion_group* me)
+{
+	free(me->mem);
+	memset(me, 0, sizeof(fusion_group));
+}
+
+int ofusion_group_add(fusion_group* me)
+{
+	for(int l = 0; l < me->capacity; l++){
+		if(me->used[l])
+			continue;
+
+		me->qx[l] = me->qy[l] = me->qz[l] = 0.0f;
+		me->qw[l] = 1.0f;
+		me->ix[l] = me->iy[l] = me->iz[l] = 0.0f;
+		me->time_ns[l] = me->sample_ns[l] = me->queued_ns[l] = 0;
+		me->queued[l] = 0;
+		me->used[l] = true;
+
+		return l;
+	}
+
+	return -1;
+}
+
+void ofusion_group_remove(fusion_group* me, int lane)
+{
+	if(lane < 0 || lane >= me->capacity)
+		return;
+
+	me->used[lane] = false;
+	me->queued[lane] = 0;
+}
+
+bool ofusion_group_push(fusion_group* me, int lane, const fusion_sample* sample)
+{
+	if(lane < 0 || lane >= me->capacity || !me->used[lane] || me->queued[lane] >= me->max_samples)
+		return false;
+
+	size_t at = (size_t)me->queued[lane]++ * me->capacity + lane;
+
+	me->gx[at] = sample->ang_vel.x;
+	me->gy[at] = sample->ang_vel.y;
+	me->gz[at] = sample->ang_vel.z;
+	me->ax[at] = sample->accel.x;
+	me->ay[at] = sample->accel.y;
+	me->az[at] = sample->accel.z;
+	me->queued_ns[lane] = sample->sample_ns;
+
+	// time stays in integer nanoseconds, like in fusion.c
+	me->time_ns[lane] += sample->dt_ns;
+	me->dt[at] = sample->dt_ns / 1000000000.0f;
+	me->startup[at] = me->time_ns[lane] < FUSION_STARTUP_NS ? 1.0f : 0.0f;
+
+	return true;
+}
+
+// The lane versions of tilt_error and rotate_by_gyro in fusion.c
+
+static inline lanem tilt_error(lane4 q, lane3 a, lanem active, lane3* err)
+{
+	const float min_accel = 9.82f - FUSION_ACCEL_TOLERANCE, max_accel = 9.82f + FUSION_ACCEL_TOLERANCE;
+	lanef accel_sq = l_add(l_add(l_mul(a.x, a.x), l_mul(a.y, a.y)), l_mul(a.z, a.z));
+
+	lanem ok = l_and(l_ge(accel_sq, l_set(min_accel * min_accel)), l_le(accel_sq, l_set(max_accel * max_accel)));
+
+	// world up in the body frame
+	lanef two = l_set(2.0f);
+	lane3 up = {
+		l_mul(two, l_add(l_mul(q.x, q.y), l_mul(q.w, q.z))),
+		l_sub(l_set(1.0f), l_mul(two, l_add(l_mul(q.x, q.x), l_mul(q.z, q.z)))),
+		l_mul(two, l_sub(l_mul(q.y, q.z), l_mul(q.w, q.x)))
+	};
+
+	lanef inv_len = l_div(l_set(1.0f), l_sqrt(accel_sq));
+	a.x = l_mul(a.x, inv_len);
+	a.y = l_mul(a.y, inv_len);
+	a.z = l_mul(a.z, inv_len);
+
+	err->x = l_sub(l_mul(a.y, up.z), l_mul(a.z, up.y));
+	err->y = l_sub(l_mul(a.z, up.x), l_mul(a.x, up.z));
+	err->z = l_sub(l_mul(a.x, up.y), l_mul(a.y, up.x));
+
+	return l_and(ok, active);
+}
+
+static inline lane4 rotate_by_gyro(lane4 q, lane3 w, lanef dt, lanem active)
+{
+	lanef len = l_sqrt(l_add(l_add(l_mul(w.x, w.x), l_mul(w.y, w.y)), l_mul(w.z, w.z)));
+	lanem moving = l_and(l_gt(len, l_set(0.0001f)), active);
+
+	lanef half = l_mul(l_mul(len, dt), l_set(0.5f));
+	lanef sq = l_mul(half, half);
+	lanef sin_half = l_mul(half, l_sub(l_set(1.0f), l_mul(sq, l_set(1.0f / 6.0f))));
+	lanef cos_half = l_sub(l_set(1.0f), l_mul(sq, l_sub(l_set(0.5f), l_mul(sq, l_set(1.0f / 24.0f)))));
+
+	// steps too large for the series are rare, those lanes take the library functions
+	if(l_any(l_ge(half, l_set(0.01f)))){
+		float h[FUSION_GROUP_WIDTH], s[FUSION_GROUP_WIDTH], c[FUSION_GROUP_WIDTH];
+		l_store(h, half);
+		l_store(s, sin_half);
+		l_store(c, cos_half);
+
+		for(int j = 0; j < FUSION_GROUP_WIDTH; j++){
+			if(h[j] >= 0.01f){
+				s[j] = sinf(h[j]);
+				c[j] = cosf(h[j]);
+			}
+		}
+
+		sin_half = l_load(s);
+		cos_half = l_load(c);
+	}
+
+	lanef s = l_div(sin_half, len);
+	lane4 d = { l_mul(w.x, s), l_mul(w.y, s), l_mul(w.z, s), cos_half };
+
+	// q * d, in the order of oquatf_mult
+	lane4 r = {
+		l_sub(l_add(l_add(l_mul(q.w, d.x), l_mul(q.x, d.w)), l_mul(q.y, d.z)), l_mul(q.z, d.y)),
+		l_add(l_add(l_sub(l_mul(q.w, d.y), l_mul(q.x, d.z)), l_mul(q.y, d.w)), l_mul(q.z, d.x)),
+		l_add(l_sub(l_add(l_mul(q.w, d.z), l_mul(q.x, d.y)), l_mul(q.y, d.x)), l_mul(q.z, d.w)),
+		l_sub(l_sub(l_sub(l_mul(q.w, d.w), l_mul(q.x, d.x)), l_mul(q.y, d.y)), l_mul(q.z, d.z))
+	};
+
+	q.x = l_sel(moving, r.x, q.x);
+	q.y = l_sel(moving, r.y, q.y);
+	q.z = l_sel(moving, r.z, q.z);
+	q.w = l_sel(moving, r.w, q.w);
+
+	return q;
+}
+
+// One queued sample of each lane of the block of lanes starting at first, the lanes with fewer queued are left alone
+static void fuse_slot(fusion_group* me, int first, int s)
+{
+	const lanef zero = l_set(0.0f);
+	size_t at = (size_t)s * me->capacity + first;
+
+	lane4 q = { l_load(me->qx + first), l_load(me->qy + first), l_load(me->qz + first), l_load(me->qw + first) };
+	lane3 integral = { l_load(me->ix + first), l_load(me->iy + first), l_load(me->iz + first) };
+
+	lanem active = l_queued_gt(me->queued + first, s);
+	lanem startup = l_gt(l_load(me->startup + at), l_set(0.5f));
+	lanef dt = l_load(me->dt + at);
+
+	lane3 ang_vel = { l_load(me->gx + at), l_load(me->gy + at), l_load(me->gz + at) };
+	lane3 accel = { l_load(me->ax + at), l_load(me->ay + at), l_load(me->az + at) };
+	lane3 err;
+	lanem ok = tilt_error(q, accel, active, &err);
+
+	if(me->backend == OHMD_FUSION_MAHONY){
+		lanef kp = l_sel(startup, l_set(FUSION_MAHONY_KP * FUSION_STARTUP_GAIN), l_set(FUSION_MAHONY_KP));
+		lanef ki = l_set(FUSION_MAHONY_KI);
+
+		// the gyro bias is only learned once the start transient is over
+		lanem learn = l_andnot(ok, startup);
+		integral.x = l_add(integral.x, l_sel(learn, l_mul(l_mul(ki, err.x), dt), zero));
+		integral.y = l_add(integral.y, l_sel(learn, l_mul(l_mul(ki, err.y), dt), zero));
+		integral.z = l_add(integral.z, l_sel(learn, l_mul(l_mul(ki, err.z), dt), zero));
+
+		ang_vel.x = l_add(l_add(ang_vel.x, l_sel(ok, l_mul(kp, err.x), zero)), integral.x);
+		ang_vel.y = l_add(l_add(ang_vel.y, l_sel(ok, l_mul(kp, err.y), zero)), integral.y);
+		ang_vel.z = l_add(l_add(ang_vel.z, l_sel(ok, l_mul(kp, err.z), zero)), integral.z);
+
+		l_store(me->ix + first, integral.x);
+		l_store(me->iy + first, integral.y);
+		l_store(me->iz + first, integral.z);
+	}else{
+		lanef err_length = l_sqrt(l_add(l_add(l_mul(err.x, err.x), l_mul(err.y, err.y)), l_mul(err.z, err.z)));
+		lanem descend = l_and(ok, l_gt(err_length, l_set(0.000001f)));
+
+		lanef beta = l_sel(startup, l_set(FUSION_MADGWICK_BETA * FUSION_STARTUP_GAIN), l_set(FUSION_MADGWICK_BETA));
+		lanef step = l_div(l_mul(l_set(2.0f), beta), err_length);
+
+		ang_vel.x = l_add(ang_vel.x, l_sel(descend, l_mul(step, err.x), zero));
+		ang_vel.y = l_add(ang_vel.y, l_sel(descend, l_mul(step, err.y), zero));
+		ang_vel.z = l_add(ang_vel.z, l_sel(descend, l_mul(step, err.z), zero));
+	}
+
+	q = rotate_by_gyro(q, ang_vel, dt, active);
+
+	l_store(me->qx + first, q.x);
+	l_store(me->qy + first, q.y);
+	l_store(me->qz + first, q.z);
+	l_store(me->qw + first, q.w);
+}
+
+// Normalizes the orientations of the lanes that had samples queued, once per step like once per batch in fusion.c
+static void finish_block(fusion_group* me, int first)
+{
+	lanem fused = l_queued_gt(me->queued + first, 0);
+	lane4 q = { l_load(me->qx + first), l_load(me->qy + first), l_load(me->qz + first), l_load(me->qw + first) };
+	lanef len = l_sqrt(l_add(l_add(l_add(l_mul(q.x, q.x), l_mul(q.y, q.y)), l_mul(q.z, q.z)), l_mul(q.w, q.w)));
+
+	l_store(me->qx + first, l_sel(fused, l_div(q.x, len), q.x));
+	l_store(me->qy + first, l_sel(fused, l_div(q.y, len), q.y));
+	l_store(me->qz + first, l_sel(fused, l_div(q.z, len), q.z));
+	l_store(me->qw + first, l_sel(fused, l_div(q.w, len), q.w));
+
+	for(int l = first; l < first + FUSION_GROUP_WIDTH; l++){
+		if(me->queued[l] > 0)
+			me->sample_ns[l] = me->queued_ns[l];
+		me->queued[l] = 0;
+	}
+}
+
+void ofusion_group_step_blocks(fusion_group* me, int first, int count)
+{
+	int begin = first * FUSION_GROUP_WIDTH, end = (first + count) * FUSION_GROUP_WIDTH;
+	int slots = 0;
+
+	for(int l = begin; l < end; l++)
+		slots = OHMD_MAX(slots, me->queued[l]);
+
+	// a slot of all blocks at a time, the blocks don't depend on each other
+	// and overlap in the pipeline where the samples of one block can't
+	for(int s = 0; s < slots; s++){
+		for(int b = begin; b < end; b += FUSION_GROUP_WIDTH){
+			bool any = false;
+			for(int l = b; l < b + FUSION_GROUP_WIDTH; l++)
+				any |= me->queued[l] > s;
+
+			if(any)
+				fuse_slot(me, b, s);
+		}
+	}
+
+	for(int b = begin; b < end; b += FUSION_GROUP_WIDTH)
+		finish_block(me, b);
+}
+
+void ofusion_group_step(fusion_group* me)
+{
+	ofusion_group_step_blocks(me, 0, me->capacity / FUSION_GROUP_WIDTH);
+}
+
+void ofusion_group_get_orient(const fusion_group* me, int lane, quatf* orient)
+{
+	orient->x = me->qx[lane];
+	orient->y = me->qy[lane];
+	orient->z = me->qz[lane];
+	orient->w = me->qw[lane];
+}
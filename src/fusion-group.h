@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Sensor Fusion of Many Trackers */
+
+/*
+ * Fuses the IMUs of many trackers together. The state of all trackers is
+ * kept in structure of arrays layout, one lane per tracker, instead of a
+ * fusion struct each.
+ * Samples are queued per lane as the reports come in, and a step fuses the
+ * queued samples of all lanes, FUSION_GROUP_WIDTH lanes at a time with SIMD
+ * kernels. Each lane ends up where a fusion struct with the same backend fed
+ * the same samples in one ofusion_update_batch would, up to float rounding.
+ *
+ * Only the per sample filters, Mahony and Madgwick, are supported: the
+ * complementary filter branches on the history of each tracker.
+ *
+ * Blocks of FUSION_GROUP_WIDTH lanes don't share any state, so a step can be
+ * split over threads with ofusion_group_step_blocks.
+ *
+ * Built into the benchmarks and unit tests only, not the library: devices
+ * keep a fusion struct each for the gyro bias estimation, pose history, saved
+ * state and IMU samples that lanes lack.
+ */
+
+#ifndef FUSION_GROUP_H
+#define FUSION_GROUP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "fusion.h"
+
+#if OMATH_SSE2 || OMATH_NEON
+#define FUSION_GROUP_WIDTH 4
+#else
+#define FUSION_GROUP_WIDTH 1
+#endif
+
+typedef struct {
+	ohmd_fusion_backend backend;
+	int capacity;    // lanes, a multiple of FUSION_GROUP_WIDTH
+	int max_samples; // samples a lane can queue between steps
+
+	// per lane: orientation, Mahony integral feedback (rad/s), device time of the samples fused and queued,
+	// host time of the latest sample fused and of the latest queued
+	float *qx, *qy, *qz, *qw;
+	float *ix, *iy, *iz;
+	uint64_t *time_ns, *sample_ns, *queued_ns;
+	int* queued;
+	bool* used;
+
+	// queued samples, slot s of lane l at [s * capacity + l]: angular velocity, acceleration,
+	// time step in seconds and 1 while the lane is still in the start transient
+	float *gx, *gy, *gz;
+	float *ax, *ay, *az;
+	float *dt, *startup;
+
+	void* mem;
+} fusion_group;
+
+// Sets up a group of at least capacity lanes fused by backend, OHMD_FUSION_MAHONY or OHMD_FUSION_MADGWICK.
+// Returns false for other backends or when out of memory.
+bool ofusion_group_init(fusion_group* me, ohmd_fusion_backend backend, int capacity, int max_samples);
+void ofusion_group_destroy(fusion_group* me);
+
+// Registers a tracker, returns its lane or -1 if all lanes are taken
+int ofusion_group_add(fusion_group* me);
+void ofusion_group_remove(fusion_group* me, int lane);
+
+// Queues a sample of lane for the next step, false if max_samples are queued already
+bool ofusion_group_push(fusion_group* me, int lane, const fusion_sample* sample);
+// Fuses the queued samples of all lanes
+void ofusion_group_step(fusion_group* me);
+// Fuses the queued samples of the lanes in blocks [first, first + count) of FUSION_GROUP_WIDTH lanes
+void ofusion_group_step_blocks(fusion_group* me, int first, int count);
+
+void ofusion_group_get_orient(const fusion_group* me, int lane, quatf* orient);
+
+#endif
@@ -11,62 +11,500 @@
 #include <string.h>
 #include "openhmdi.h"
 
+#define ACCEL_ONLY_QUEUE_SIZE 10  // shorter buffer for frame smoothing
+
+// the device counts as level when the accelerometer reads within 2 * LEVEL_GRAVITY_TOLERANCE of gravity
+// and it turns slower than LEVEL_ANG_VEL_TOLERANCE rad/s
+#define LEVEL_GRAVITY_TOLERANCE 0.4f
+#define LEVEL_ANG_VEL_TOLERANCE 0.1f
+
+typedef struct {
+	void (*init)(fusion* me); // optional, sets up the state after it was cleared
+	void (*update_batch)(fusion* me, const fusion_sample* samples, int count);
+	// optional, the fixed point version of update_batch, which also normalizes orient (fusion-fixed.c)
+	void (*update_batch_fixed)(fusion* me, const fusion_sample* samples, int count);
+} fusion_backend;
+
+static void complementary_init(fusion* me);
+static void complementary_update_batch(fusion* me, const fusion_sample* samples, int count);
+static void mahony_update_batch(fusion* me, const fusion_sample* samples, int count);
+static void madgwick_update_batch(fusion* me, const fusion_sample* samples, int count);
+static void accel_only_init(fusion* me);
+static void accel_only_update_batch(fusion* me, const fusion_sample* samples, int count);
+
+static const fusion_backend backends[] = {
+	[OHMD_FUSION_COMPLEMENTARY] = { complementary_init, complementary_update_batch, ofusion_fixed_complementary_update_batch },
+	[OHMD_FUSION_MAHONY]        = { NULL, mahony_update_batch, ofusion_fixed_mahony_update_batch },
+	[OHMD_FUSION_MADGWICK]      = { NULL, madgwick_update_batch, ofusion_fixed_madgwick_update_batch },
+	[OHMD_FUSION_ACCEL_ONLY]    = { accel_only_init, accel_only_update_batch, NULL },
+};
+
 void ofusion_init(fusion* me)
 {
+	me->backend = OHMD_FUSION_COMPLEMENTARY;
+	me->fixed_point = FUSION_FIXED_POINT_DEFAULT;
+	me->history = NULL;
+	me->imu_samples = NULL;
+	me->skip_fusion = false;
+	ofusion_reset(me);
+}
+
+void ofusion_set_backend(fusion* me, ohmd_fusion_backend backend)
+{
+	me->backend = backend == OHMD_FUSION_DEFAULT ? OHMD_FUSION_COMPLEMENTARY : backend;
+	ofusion_reset(me);
+}
+
+void ofusion_set_fixed_point(fusion* me, bool fixed_point)
+{
+	me->fixed_point = fixed_point;
+	ofusion_reset(me);
+}
+
+void ofusion_reset(fusion* me)
+{
+	ohmd_fusion_backend backend = me->backend;
+	bool fixed_point = me->fixed_point;
+	pose_history* history = me->history;
+	imu_ring* imu_samples = me->imu_samples;
+	bool skip_fusion = me->skip_fusion;
+
 	memset(me, 0, sizeof(fusion));
+	me->backend = backend;
+	me->fixed_point = fixed_point;
+	me->history = history;
+	me->imu_samples = imu_samples;
+	me->skip_fusion = skip_fusion;
 	me->orient.w = 1.0f;
+	me->fx.orient.w = OFIX_ONE(30);
+	me->flags = FF_ESTIMATE_GYRO_BIAS;
 
-	ofq_init(&me->mag_fq, 20);
-	ofq_init(&me->accel_fq, 20);
-	ofq_init(&me->ang_vel_fq, 20);
+	if(backends[backend].init)
+		backends[backend].init(me);
+}
 
-	me->flags = FF_USE_GRAVITY;
-	me->grav_gain = 0.05f;
+static void fill_queue(filter_queue* fq, const vec3f* mean)
+{
+	// queues the backend doesn't use have no storage
+	if(!fq->elems)
+		return;
+
+	for(int i = 0; i < fq->size; i++)
+		fq->elems[i] = *mean;
+
+	fq->at = 0;
+	for(int i = 0; i < 3; i++)
+		fq->sum.arr[i] = mean->arr[i] * fq->size;
 }
 
-void ofusion_update(fusion* me, float dt, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag)
+static void get_queue_mean(const filter_queue* fq, vec3f* mean)
+{
+	if(fq->elems)
+		ofq_get_mean(fq, mean);
+	else
+		mean->x = mean->y = mean->z = 0;
+}
+
+void ofusion_save_state(const fusion* me, fusion_state* state)
+{
+	memset(state, 0, sizeof(fusion_state));
+
+	state->version = FUSION_STATE_VERSION;
+	state->backend = me->backend;
+	state->fixed_point = me->fixed_point;
+
+	state->orient = me->orient;
+	state->grav_error_axis = me->grav_error_axis;
+	state->grav_error_angle = me->grav_error_angle;
+	state->integral_error = me->integral_error;
+	state->gyro_bias = me->gyro_bias;
+	state->gyro_bias_windows = me->gyro_bias_windows;
+	get_queue_mean(&me->mag_fq, &state->mag_mean);
+	get_queue_mean(&me->accel_fq, &state->accel_mean);
+	get_queue_mean(&me->ang_vel_fq, &state->ang_vel_mean);
+
+	state->fx_orient = me->fx.orient;
+	state->fx_grav_error_axis = me->fx.grav_error_axis;
+	state->fx_grav_error_angle = me->fx.grav_error_angle;
+	state->fx_integral_error = me->fx.integral_error;
+	for(int i = 0; i < 3; i++)
+		state->fx_accel_mean.arr[i] = (int32_t)(me->fx.accel_sum[i] / FUSION_FILTER_QUEUE_SIZE);
+}
+
+bool ofusion_restore_state(fusion* me, const fusion_state* state)
+{
+	if(state->version != FUSION_STATE_VERSION || state->backend != (int32_t)me->backend ||
+	   state->fixed_point != (int32_t)me->fixed_point)
+		return false;
+
+	ofusion_reset(me);
+
+	me->orient = state->orient;
+	me->grav_error_axis = state->grav_error_axis;
+	me->grav_error_angle = state->grav_error_angle;
+	me->integral_error = state->integral_error;
+	me->gyro_bias = state->gyro_bias;
+	me->gyro_bias_windows = state->gyro_bias_windows;
+	fill_queue(&me->mag_fq, &state->mag_mean);
+	fill_queue(&me->accel_fq, &state->accel_mean);
+	fill_queue(&me->ang_vel_fq, &state->ang_vel_mean);
+
+	me->fx.orient = state->fx_orient;
+	me->fx.grav_error_axis = state->fx_grav_error_axis;
+	me->fx.grav_error_angle = state->fx_grav_error_angle;
+	me->fx.integral_error = state->fx_integral_error;
+	for(int i = 0; i < FUSION_FILTER_QUEUE_SIZE; i++)
+		me->fx.accel_elems[i] = state->fx_accel_mean;
+	for(int i = 0; i < 3; i++)
+		me->fx.accel_sum[i] = (int64_t)state->fx_accel_mean.arr[i] * FUSION_FILTER_QUEUE_SIZE;
+
+	// as far along as a fusion needs to be for neither the snapping nor the startup gains
+	me->iterations = FUSION_SNAP_ITERATIONS;
+	me->time_ns = FUSION_STARTUP_NS;
+	me->restored = true;
+
+	return true;
+}
+
+// The first sample of a restored fusion that tells where up is decides whether the device is still as it was
+// saved. If it isn't, the fusion goes back to converging with the startup gains and the snapping of the tilt.
+static void check_restored(fusion* me, const fusion_sample* samples, int count)
+{
+	const float min_accel = 9.82f - FUSION_ACCEL_TOLERANCE, max_accel = 9.82f + FUSION_ACCEL_TOLERANCE;
+
+	for(int i = 0; i < count; i++){
+		const vec3f* accel = &samples[i].accel;
+		float accel_sq = ovec3f_get_dot(accel, accel);
+
+		if(accel_sq < min_accel * min_accel || accel_sq > max_accel * max_accel)
+			continue;
+
+		vec3f world_accel, up = {{0, 1.0f, 0}};
+		oquatf_get_rotated(&me->orient, accel, &world_accel);
+
+		if(ovec3f_get_angle(&up, &world_accel) > FUSION_RESTORE_MAX_TILT){
+			me->iterations = 0;
+			me->time_ns = 0;
+		}
+
+		me->restored = false;
+		return;
+	}
+}
+
+static void set_latest(fusion* me, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag)
 {
 	me->ang_vel = *ang_vel;
 	me->accel = *accel;
 	me->raw_mag = *mag;
 
 	me->mag = *mag;
+}
 
-	vec3f world_accel;
-	oquatf_get_rotated(&me->orient, accel, &world_accel);
+void ofusion_update(fusion* me, float dt, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag)
+{
+	uint64_t dt_ns = dt > 0.0f ? (uint64_t)(dt * 1000000000.0 + 0.5) : 0;
+	fusion_sample sample = { me->sample_ns, dt_ns, *ang_vel, *accel, *mag };
+	ofusion_update_batch(me, &sample, 1);
+}
 
-	me->iterations += 1;
-	me->time += dt;
+void ofusion_update_at(fusion* me, uint64_t sample_ns, uint64_t dt_ns, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag)
+{
+	fusion_sample sample = { sample_ns, dt_ns, *ang_vel, *accel, *mag };
+	ofusion_update_batch(me, &sample, 1);
+}
 
-	ofq_add(&me->mag_fq, mag);
-	ofq_add(&me->accel_fq, &world_accel);
-	ofq_add(&me->ang_vel_fq, ang_vel);
+static inline bool device_level(const vec3f* accel, float ang_vel_sq)
+{
+	// |accel| within 9.82 +- 2 * LEVEL_GRAVITY_TOLERANCE, compared squared
+	const float min_level_accel = 9.82f - LEVEL_GRAVITY_TOLERANCE * 2.0f, max_level_accel = 9.82f + LEVEL_GRAVITY_TOLERANCE * 2.0f;
+	float accel_sq = ovec3f_get_dot(accel, accel);
+
+	return accel_sq > min_level_accel * min_level_accel && accel_sq < max_level_accel * max_level_accel &&
+		ang_vel_sq < LEVEL_ANG_VEL_TOLERANCE * LEVEL_ANG_VEL_TOLERANCE;
+}
+
+// The bias the Mahony filter has learned on top of gyro_bias, zero for the other backends
+static void get_integral_error(const fusion* me, vec3f* integral_error)
+{
+	if(me->fixed_point){
+		for(int i = 0; i < 3; i++)
+			integral_error->arr[i] = ofix_to_float(me->fx.integral_error.arr[i], 30);
+	}else{
+		*integral_error = me->integral_error;
+	}
+}
+
+static void reset_bias_window(fusion* me)
+{
+	me->bias_window_ns = 0;
+	me->bias_window_samples = 0;
+	memset(&me->bias_sum, 0, sizeof(vec3f));
+	memset(&me->bias_sum_sq, 0, sizeof(vec3f));
+}
+
+static void take_bias_window(fusion* me);
+
+// Adds a sample to the window of the gyro bias estimate while the device is still. The window measures what is left
+// of the bias after gyro_bias and the integral feedback, so the estimate takes over from the Mahony filter instead of
+// correcting for the same bias twice.
+static inline void estimate_gyro_bias(fusion* me, const fusion_sample* s, const vec3f* integral_error)
+{
+	vec3f residual;
+	ofusion_sample_ang_vel(me, s, &residual);
+	for(int i = 0; i < 3; i++)
+		residual.arr[i] += integral_error->arr[i];
+
+	if(!device_level(&s->accel, ovec3f_get_dot(&residual, &residual))){
+		if(me->bias_window_samples)
+			reset_bias_window(me);
+		return;
+	}
+
+	for(int i = 0; i < 3; i++){
+		me->bias_sum.arr[i] += residual.arr[i];
+		me->bias_sum_sq.arr[i] += residual.arr[i] * residual.arr[i];
+	}
+	me->bias_window_samples++;
+	me->bias_window_ns += s->dt_ns;
+
+	if(me->bias_window_ns >= FUSION_BIAS_WINDOW_NS)
+		take_bias_window(me);
+}
+
+// Moves the gyro bias estimate by the mean of a full window, if the gyro read steady through it
+static void take_bias_window(fusion* me)
+{
+	vec3f mean;
+	bool steady = true;
+	for(int i = 0; i < 3; i++){
+		mean.arr[i] = me->bias_sum.arr[i] / me->bias_window_samples;
+		steady = steady && me->bias_sum_sq.arr[i] / me->bias_window_samples - mean.arr[i] * mean.arr[i] < FUSION_BIAS_MAX_VARIANCE;
+	}
+
+	if(steady){
+		float gain = me->gyro_bias_windows ? FUSION_BIAS_GAIN : 1.0f;
+		for(int i = 0; i < 3; i++)
+			me->gyro_bias.arr[i] += gain * mean.arr[i];
+		me->gyro_bias_windows++;
+	}
+
+	reset_bias_window(me);
+}
+
+static void push_imu_samples(imu_ring* ring, const fusion_sample* samples, int count)
+{
+	for(int i = 0; i < count; i++){
+		const fusion_sample* s = samples + i;
+		ohmd_imu_sample sample = { (int64_t)s->sample_ns, (int64_t)s->dt_ns };
+
+		for(int j = 0; j < 3; j++){
+			sample.ang_vel[j] = s->ang_vel.arr[j];
+			sample.accel[j] = s->accel.arr[j];
+			sample.mag[j] = s->mag.arr[j];
+		}
+
+		oimu_ring_push(ring, &sample);
+	}
+}
+
+static void fuse(fusion* me, const fusion_sample* samples, int count)
+{
+	if(me->fixed_point && backends[me->backend].update_batch_fixed){
+		backends[me->backend].update_batch_fixed(me, samples, count);
+	}else{
+		backends[me->backend].update_batch(me, samples, count);
+
+		// the samples are a few ms apart, the orientation stays close enough
+		// to unit length to be normalized once per batch
+		oquatf_normalize_me(&me->orient);
+	}
+
+	const fusion_sample* last = samples + count - 1;
+	vec3f ang_vel;
+	ofusion_sample_ang_vel(me, last, &ang_vel);
+	set_latest(me, &ang_vel, &last->accel, &last->mag);
+	me->sample_ns = last->sample_ns;
+
+	if(me->history){
+		// with the integral feedback of the Mahony filter, as predictions extrapolate with
+		vec3f history_ang_vel;
+		ofusion_get_ang_vel(me, &history_ang_vel);
+		opose_history_push(me->history, me->sample_ns, &me->orient, &history_ang_vel);
+	}
+}
+
+void ofusion_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	if(count <= 0)
+		return;
 
+	if(me->imu_samples)
+		push_imu_samples(me->imu_samples, samples, count);
+
+	if(me->skip_fusion){
+		const fusion_sample* last = samples + count - 1;
+		set_latest(me, &last->ang_vel, &last->accel, &last->mag);
+		me->sample_ns = last->sample_ns;
+		return;
+	}
+
+	if(me->restored)
+		check_restored(me, samples, count);
+
+	// a window completed in this batch applies to all of its samples
+	if(me->flags & FF_ESTIMATE_GYRO_BIAS){
+		vec3f integral_error;
+		get_integral_error(me, &integral_error);
+
+		for(int i = 0; i < count; i++)
+			estimate_gyro_bias(me, samples + i, &integral_error);
+	}
+
+	fuse(me, samples, count);
+}
+
+void ofusion_get_ang_vel(const fusion* me, vec3f* ang_vel)
+{
+	// the latest sample is less the estimated gyro bias, and the Mahony filter learns more of it
+	vec3f bias;
+	get_integral_error(me, &bias);
+
+	for(int i = 0; i < 3; i++)
+		ang_vel->arr[i] = me->ang_vel.arr[i] + bias.arr[i];
+}
+
+void ofusion_get_linear_accel(const fusion* me, vec3f* accel)
+{
+	oquatf_get_rotated(&me->orient, &me->accel, accel);
+	accel->y -= 9.81f;
+}
+
+// Adds a sample to the fused time, returns its integration step in seconds.
+// Time is kept in integer nanoseconds, only the integration step is a float.
+static inline float advance(fusion* me, const fusion_sample* s)
+{
+	me->time_ns += s->dt_ns;
+	return s->dt_ns / 1000000000.0f;
+}
+
+// Rotates orient by ang_vel over dt in the body frame, returns the length of ang_vel.
+static inline float rotate_by_gyro(quatf* orient, const vec3f* ang_vel, float dt)
+{
 	float ang_vel_length = ovec3f_get_length(ang_vel);
 
 	if(ang_vel_length > 0.0001f){
-		vec3f rot_axis =
-			{{ ang_vel->x / ang_vel_length, ang_vel->y / ang_vel_length, ang_vel->z / ang_vel_length }};
+		// rotation by ang_vel_length * dt about the normalized angular velocity
+		float half_angle = ang_vel_length * dt * 0.5f;
+		float sin_half, cos_half;
 
-		float rot_angle = ang_vel_length * dt;
+		// at IMU rates the step is tiny, where the series is exact in float
+		if(half_angle < 0.01f){
+			float sq = half_angle * half_angle;
+			sin_half = half_angle * (1.0f - sq / 6.0f);
+			cos_half = 1.0f - sq * (0.5f - sq / 24.0f);
+		}else{
+			sin_half = sinf(half_angle);
+			cos_half = cosf(half_angle);
+		}
 
-		quatf delta_orient;
-		oquatf_init_axis(&delta_orient, &rot_axis, rot_angle);
+		float s = sin_half / ang_vel_length;
+		quatf delta_orient = {{ ang_vel->x * s, ang_vel->y * s, ang_vel->z * s, cos_half }};
 
-		oquatf_mult_me(&me->orient, &delta_orient);
+		oquatf_mult_me(orient, &delta_orient);
 	}
 
+	return ang_vel_length;
+}
+
+/* Complementary filter */
+
+static void complementary_init(fusion* me)
+{
+	ofq_init(&me->mag_fq, me->mag_elems, FUSION_FILTER_QUEUE_SIZE);
+	ofq_init(&me->accel_fq, me->accel_elems, FUSION_FILTER_QUEUE_SIZE);
+	ofq_init(&me->ang_vel_fq, me->ang_vel_elems, FUSION_FILTER_QUEUE_SIZE);
+
+	me->flags |= FF_USE_GRAVITY;
+	me->grav_gain = 0.05f;
+	me->fx.grav_gain = ofix_from_float(me->grav_gain * 0.005f, 30);
+}
+
+// Integrates one sample. Gravity corrections are rotations about grav_error_axis applied in the world frame,
+// so they commute with the integration and are summed up in *corr_angle for apply_correction.
+static void integrate(fusion* me, float dt, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag, float* corr_angle);
+
+static void apply_correction(fusion* me, float corr_angle)
+{
+	if(corr_angle == 0.0f)
+		return;
+
+	quatf corr_quat, old_orient;
+	oquatf_init_axis(&corr_quat, &me->grav_error_axis, corr_angle);
+	old_orient = me->orient;
+
+	oquatf_mult(&corr_quat, &old_orient, &me->orient);
+}
+
+static void complementary_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	float corr_angle = 0.0f;
+
+	for(int i = 0; i < count; i++){
+		const fusion_sample* s = samples + i;
+		vec3f ang_vel;
+		ofusion_sample_ang_vel(me, s, &ang_vel);
+		integrate(me, advance(me, s), &ang_vel, &s->accel, &s->mag, &corr_angle);
+	}
+
+	apply_correction(me, corr_angle);
+}
+
+// Rotates v about the unit axis by angle, the gravity corrections of a batch still pending in the world frame
+static void rotate_pending(const vec3f* axis, float angle, vec3f* v)
+{
+	// Rodrigues' formula, with the series where the angle is small as the corrections of a sample are
+	float sin_angle, one_minus_cos;
+	if(fabsf(angle) < 0.01f){
+		float sq = angle * angle;
+		sin_angle = angle * (1.0f - sq / 6.0f);
+		one_minus_cos = sq * (0.5f - sq / 24.0f);
+	}else{
+		sin_angle = sinf(angle);
+		one_minus_cos = 1.0f - cosf(angle);
+	}
+
+	vec3f kv = {{ axis->y * v->z - axis->z * v->y, axis->z * v->x - axis->x * v->z, axis->x * v->y - axis->y * v->x }};
+	vec3f kkv = {{ axis->y * kv.z - axis->z * kv.y, axis->z * kv.x - axis->x * kv.z, axis->x * kv.y - axis->y * kv.x }};
+
+	for(int i = 0; i < 3; i++)
+		v->arr[i] += sin_angle * kv.arr[i] + one_minus_cos * kkv.arr[i];
+}
+
+static void integrate(fusion* me, float dt, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag, float* corr_angle)
+{
+	// in the world frame of the orientation with the corrections of the batch so far, as fusing one by one would
+	vec3f world_accel;
+	oquatf_get_rotated(&me->orient, accel, &world_accel);
+	if(*corr_angle != 0.0f)
+		rotate_pending(&me->grav_error_axis, *corr_angle, &world_accel);
+
+	me->iterations += 1;
+
+	ofq_add(&me->mag_fq, mag);
+	ofq_add(&me->accel_fq, &world_accel);
+	ofq_add(&me->ang_vel_fq, ang_vel);
+
+	float ang_vel_length = rotate_by_gyro(&me->orient, ang_vel, dt);
+
 	// gravity correction
 	if(me->flags & FF_USE_GRAVITY){
-		const float gravity_tolerance = .4f, ang_vel_tolerance = .1f;
+		const float gravity_tolerance = LEVEL_GRAVITY_TOLERANCE;
 		const float min_tilt_error = 0.05f, max_tilt_error = 0.01f;
 
 		// if the device is within tolerance levels, count this as the device is level and add to the counter
 		// otherwise reset the counter and start over
-
-		me->device_level_count =
-			fabsf(ovec3f_get_length(accel) - 9.82f) < gravity_tolerance * 2.0f && ang_vel_length < ang_vel_tolerance
-			? me->device_level_count + 1 : 0;
+		me->device_level_count = device_level(accel, ang_vel_length * ang_vel_length) ? me->device_level_count + 1 : 0;
 
 		// device has been level for long enough, grab mean from the accelerometer filter queue (last n values)
 		// and use for correction
@@ -91,6 +529,10 @@ void ofusion_update(fusion* me, float dt, const vec3f* ang_vel, const vec3f* acc
 				float tilt_angle = ovec3f_get_angle(&up, &accel_mean);
 
 				if(tilt_angle > max_tilt_error){
+					// corrections so far were about the old axis
+					apply_correction(me, *corr_angle);
+					*corr_angle = 0.0f;
+
 					me->grav_error_angle = tilt_angle;
 					me->grav_error_axis = tilt;
 				}
@@ -99,29 +541,146 @@ void ofusion_update(fusion* me, float dt, const vec3f* ang_vel, const vec3f* acc
 
 		// perform gravity tilt correction
 		if(me->grav_error_angle > min_tilt_error){
-			float use_angle;
-			// if less than 2000 iterations have passed, set the up axis to the correction value outright
-			if(me->iterations < 2000){
-				use_angle = -me->grav_error_angle;
+			// if less than FUSION_SNAP_ITERATIONS iterations have passed, set the up axis to the correction value
+			// outright, right away as it's a large step the following samples should see
+			if(me->iterations < FUSION_SNAP_ITERATIONS){
+				apply_correction(me, *corr_angle - me->grav_error_angle);
+				*corr_angle = 0.0f;
 				me->grav_error_angle = 0;
 			}
 
 			// otherwise try to correct
 			else {
-				use_angle = -me->grav_gain * me->grav_error_angle * 0.005f * (5.0f * ang_vel_length + 1.0f);
+				float use_angle = -me->grav_gain * me->grav_error_angle * 0.005f * (5.0f * ang_vel_length + 1.0f);
 				me->grav_error_angle += use_angle;
+				*corr_angle += use_angle;
 			}
+		}
+	}
+}
+
+/* Mahony and Madgwick filters */
 
-			// perform the correction
-			quatf corr_quat, old_orient;
-			oquatf_init_axis(&corr_quat, &me->grav_error_axis, use_angle);
-			old_orient = me->orient;
+// Cross product of the measured and the estimated up direction in the body frame, the axis and sine of
+// the tilt error. False if the accelerometer reads too far off gravity to tell where up is.
+static bool tilt_error(const quatf* q, const vec3f* accel, vec3f* err)
+{
+	const float min_accel = 9.82f - FUSION_ACCEL_TOLERANCE, max_accel = 9.82f + FUSION_ACCEL_TOLERANCE;
+	float accel_sq = ovec3f_get_dot(accel, accel);
+
+	if(accel_sq < min_accel * min_accel || accel_sq > max_accel * max_accel)
+		return false;
+
+	// world up in the body frame, the second row of the rotation matrix of q
+	vec3f up = {{
+		2.0f * (q->x * q->y + q->w * q->z),
+		1.0f - 2.0f * (q->x * q->x + q->z * q->z),
+		2.0f * (q->y * q->z - q->w * q->x)
+	}};
+
+	float inv_len = 1.0f / sqrtf(accel_sq);
+	vec3f a = {{ accel->x * inv_len, accel->y * inv_len, accel->z * inv_len }};
+
+	err->x = a.y * up.z - a.z * up.y;
+	err->y = a.z * up.x - a.x * up.z;
+	err->z = a.x * up.y - a.y * up.x;
+
+	return true;
+}
 
-			oquatf_mult(&corr_quat, &old_orient, &me->orient);
+static void mahony_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	for(int i = 0; i < count; i++){
+		const fusion_sample* s = samples + i;
+		float dt = advance(me, s);
+		bool startup = me->time_ns < FUSION_STARTUP_NS;
+		vec3f ang_vel, err;
+		ofusion_sample_ang_vel(me, s, &ang_vel);
+
+		if(tilt_error(&me->orient, &s->accel, &err)){
+			float kp = startup ? FUSION_MAHONY_KP * FUSION_STARTUP_GAIN : FUSION_MAHONY_KP;
+
+			for(int j = 0; j < 3; j++){
+				// the gyro bias is only learned once the start transient is over
+				if(!startup)
+					me->integral_error.arr[j] += FUSION_MAHONY_KI * err.arr[j] * dt;
+
+				ang_vel.arr[j] += kp * err.arr[j];
+			}
 		}
+
+		for(int j = 0; j < 3; j++)
+			ang_vel.arr[j] += me->integral_error.arr[j];
+
+		rotate_by_gyro(&me->orient, &ang_vel, dt);
 	}
+}
+
+static void madgwick_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	for(int i = 0; i < count; i++){
+		const fusion_sample* s = samples + i;
+		float dt = advance(me, s);
+		vec3f ang_vel, err;
+		ofusion_sample_ang_vel(me, s, &ang_vel);
+
+		// the normalized gradient of the tilt error is its axis, descended at a fixed rate of 2 beta
+		if(tilt_error(&me->orient, &s->accel, &err)){
+			float err_length = ovec3f_get_length(&err);
+
+			if(err_length > 0.000001f){
+				float beta = me->time_ns < FUSION_STARTUP_NS ? FUSION_MADGWICK_BETA * FUSION_STARTUP_GAIN : FUSION_MADGWICK_BETA;
+				float step = 2.0f * beta / err_length;
+
+				for(int j = 0; j < 3; j++)
+					ang_vel.arr[j] += step * err.arr[j];
+			}
+		}
+
+		rotate_by_gyro(&me->orient, &ang_vel, dt);
+	}
+}
+
+/* Accelerometer only */
+
+static void accel_only_init(fusion* me)
+{
+	ofq_init(&me->accel_fq, me->accel_elems, ACCEL_ONLY_QUEUE_SIZE);
+}
+
+static void accel_only_update_batch(fusion* me, const fusion_sample* samples, int count)
+{
+	for(int i = 0; i < count; i++){
+		advance(me, samples + i);
+
+		//avg raw accel data to smooth jitter
+		ofq_add(&me->accel_fq, &samples[i].accel);
+	}
+
+	vec3f acc_n;
+	ofq_get_mean(&me->accel_fq, &acc_n);
+	ovec3f_normalize_me(&acc_n);
+
+	//reference vectors for axis-angle
+	vec3f xyzv[3] = {
+		{{1,0,0}},
+		{{0,1,0}},
+		{{0,0,1}}
+	};
+	quatf roll, pitch;
+
+	//pitch is rot around x, based on gravity in z and y axes
+	oquatf_init_axis(&pitch, xyzv+0, atan2f(-acc_n.z, -acc_n.y));
+
+	//roll is rot around z, based on gravity in x and y axes
+	//note we need to invert the values when the device is upside down (y < 0) for proper results
+	oquatf_init_axis(&roll, xyzv+2, acc_n.y < 0 ? atan2f(-acc_n.x, -acc_n.y) : atan2f(acc_n.x, acc_n.y));
+
+	//order of applying is yaw-pitch-roll
+	//yaw is not possible using only accel
+	quatf orient = {{0,0,0,1}};
+	oquatf_mult_me(&orient, &pitch);
+	oquatf_mult_me(&orient, &roll);
 
-	// mitigate drift due to floating point
-	// inprecision with quat multiplication.
-	oquatf_normalize_me(&me->orient);
+	me->orient = orient;
 }
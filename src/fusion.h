@@ -11,12 +11,64 @@
 #ifndef FUSION_H
 #define FUSION_H
 
+#include <stdint.h>
+
+#include "openhmd.h"
 #include "omath.h"
+#include "omath-fixed.h"
+#include "pose-history.h"
+#include "imu-ring.h"
 
 #define FF_USE_GRAVITY 1
+#define FF_ESTIMATE_GYRO_BIAS 2 // set by ofusion_reset for all backends
+#define FUSION_FILTER_QUEUE_SIZE 20
+#define FUSION_SNAP_ITERATIONS 2000 // the complementary filter sets the tilt outright for this many samples
+
+// Mahony and Madgwick parameters, shared with the fusion of many trackers in fusion-group.c
+#define FUSION_STARTUP_NS 1000000000ull // the per sample filters converge from any start with raised gains for this long
+#define FUSION_STARTUP_GAIN 10.0f
+#define FUSION_ACCEL_TOLERANCE 0.8f      // m/s², further off gravity the accelerometer doesn't tell where up is
+#define FUSION_MAHONY_KP 1.0f            // rad/s of correction per unit of tilt error
+#define FUSION_MAHONY_KI 0.02f           // rate the gyro bias is learned at, 1/s
+#define FUSION_MADGWICK_BETA 0.041f      // a gyro error of 2.7 deg/s, as suggested by Madgwick
+
+#define FUSION_RESTORE_MAX_TILT 0.1f     // rad, see ofusion_restore_state
+
+// The gyro bias is estimated from windows of samples with the device still, in the sense of the level count of the
+// complementary filter. A window is only taken if the gyro reads steady through it, a device held by hand or turned
+// slowly on purpose reads far less steady than the noise of a gyro lying still.
+#define FUSION_BIAS_WINDOW_NS 250000000ull // still this long for a window
+#define FUSION_BIAS_MAX_VARIANCE 0.0001f   // (rad/s)², of each axis through a window
+#define FUSION_BIAS_GAIN 0.2f              // the share of a window in the estimate, the first window is taken outright
+
+// Builds with OHMD_FIXED_FUSION fuse in fixed point by default, for targets without a fast FPU
+#ifdef OHMD_FIXED_FUSION
+#define FUSION_FIXED_POINT_DEFAULT true
+#else
+#define FUSION_FIXED_POINT_DEFAULT false
+#endif
+
+// State of the fixed point filters (fusion-fixed.c), in the formats of omath-fixed.h
+typedef struct {
+	quatx orient;             // Q30
+	vec3x integral_error;     // Q30 rad/s
+	vec3x grav_error_axis;    // Q30
+	int32_t grav_error_angle; // Q29 rad
+	int32_t grav_gain;        // Q30, the gain per unit of angular velocity of the gravity correction
+
+	// accelerometer filter queue, the sum of integers doesn't drift
+	int accel_at;
+	int64_t accel_sum[3];
+	vec3x accel_elems[FUSION_FILTER_QUEUE_SIZE];
+} fusion_fixed;
 
 typedef struct {
 	int state;
+	ohmd_fusion_backend backend; // never OHMD_FUSION_DEFAULT
+	bool fixed_point;            // fused by the fixed point filters where the backend has one, orient is a copy of theirs
+	pose_history* history;       // optional, gets the pose of each update
+	imu_ring* imu_samples;       // optional, gets the samples of each update as they came
+	bool skip_fusion;            // only passes the samples on to imu_samples, orient stays as it is
 
 	quatf orient;   // orientation
 	vec3f accel;    // acceleration
@@ -25,7 +77,9 @@ typedef struct {
 	vec3f raw_mag;  // raw magnetometer values
 
 	int iterations;
-	float time;
+	uint64_t time_ns;   // device time fused so far
+	bool restored;      // resumed by ofusion_restore_state, until a sample has confirmed the tilt
+	uint64_t sample_ns; // host time of the latest sample, 0 before the first
 
 	int flags;
 
@@ -37,9 +91,98 @@ typedef struct {
 	float grav_error_angle;
 	vec3f grav_error_axis;
 	float grav_gain; // amount of correction
+
+	// integral feedback of the Mahony filter, rad/s
+	vec3f integral_error;
+
+	// gyro bias estimate (FF_ESTIMATE_GYRO_BIAS), the backends fuse the samples less it
+	vec3f gyro_bias;
+	int gyro_bias_windows;       // windows the estimate was taken from
+	uint64_t bias_window_ns;     // still time of the current window
+	int bias_window_samples;
+	vec3f bias_sum, bias_sum_sq; // residual angular velocity of the current window, and its square
+
+	// storage of the filter queues
+	vec3f mag_elems[FUSION_FILTER_QUEUE_SIZE];
+	vec3f accel_elems[FUSION_FILTER_QUEUE_SIZE];
+	vec3f ang_vel_elems[FUSION_FILTER_QUEUE_SIZE];
+
+	fusion_fixed fx;
 } fusion;
 
+#define FUSION_STATE_VERSION 2
+
+// What a fusion converges to, saved by ofusion_save_state to resume from without starting over: the orientation,
+// the gravity correction in progress, the gyro bias estimates and the means of the filter queues. Plain data in the
+// byte order and float format of the host.
+typedef struct {
+	uint32_t version; // FUSION_STATE_VERSION
+	int32_t backend;
+	int32_t fixed_point;
+
+	quatf orient;
+	vec3f grav_error_axis;
+	float grav_error_angle;
+	vec3f integral_error;
+	vec3f gyro_bias;
+	int32_t gyro_bias_windows;
+	vec3f mag_mean, accel_mean, ang_vel_mean;
+
+	// the same of the fixed point filters
+	quatx fx_orient;
+	vec3x fx_grav_error_axis;
+	int32_t fx_grav_error_angle;
+	vec3x fx_integral_error;
+	vec3x fx_accel_mean;
+} fusion_state;
+
+// One IMU sample for ofusion_update_batch
+typedef struct {
+	uint64_t sample_ns; // host time the sample was taken at (see clocksync.h)
+	uint64_t dt_ns;     // time since the previous sample
+	vec3f ang_vel, accel, mag;
+} fusion_sample;
+
+/*
+ * All backends keep the orientation in orient and the latest sample in
+ * accel, ang_vel and mag. ofusion_init selects the complementary filter.
+ */
 void ofusion_init(fusion* me);
+// Switches to another backend, starting over as after ofusion_init
+void ofusion_set_backend(fusion* me, ohmd_fusion_backend backend);
+// Starts over with the current backend
+void ofusion_reset(fusion* me);
+// Switches between the float and the fixed point filters, starting over
+void ofusion_set_fixed_point(fusion* me, bool fixed_point);
+
+void ofusion_save_state(const fusion* me, fusion_state* state);
+// Starts over from a saved state as a fusion that has converged, past the startup gains and the snapping of the
+// tilt. If the first sample with the device about still shows a tilt off by more than FUSION_RESTORE_MAX_TILT, the
+// device was moved in between and the fusion converges from the restored orientation as after a reset. Returns
+// false, changing nothing, for states of another version, backend or of the other of float and fixed point.
+bool ofusion_restore_state(fusion* me, const fusion_state* state);
+
 void ofusion_update(fusion* me, float dt, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag_field);
+// ofusion_update for a sample taken at host time sample_ns (see clocksync.h), dt_ns after the previous one
+void ofusion_update_at(fusion* me, uint64_t sample_ns, uint64_t dt_ns, const vec3f* ang_vel, const vec3f* accel, const vec3f* mag_field);
+// Fuses the samples of a report in order, normalizing and applying the gravity correction once for all of them
+void ofusion_update_batch(fusion* me, const fusion_sample* samples, int count);
+
+// The latest angular velocity less the gyro bias the filter has learned, rad/s in the body frame
+void ofusion_get_ang_vel(const fusion* me, vec3f* ang_vel);
+// The latest acceleration in the world frame less gravity, m/s²
+void ofusion_get_linear_accel(const fusion* me, vec3f* accel);
+
+// The angular velocity of a sample as the backends fuse it, less the estimated gyro bias
+static inline void ofusion_sample_ang_vel(const fusion* me, const fusion_sample* s, vec3f* ang_vel)
+{
+	for(int i = 0; i < 3; i++)
+		ang_vel->arr[i] = s->ang_vel.arr[i] - me->gyro_bias.arr[i];
+}
+
+// Fixed point versions of the filters (fusion-fixed.c), the accelerometer only backend has none
+void ofusion_fixed_complementary_update_batch(fusion* me, const fusion_sample* samples, int count);
+void ofusion_fixed_mahony_update_batch(fusion* me, const fusion_sample* samples, int count);
+void ofusion_fixed_madgwick_update_batch(fusion* me, const fusion_sample* samples, int count);
 
 #endif
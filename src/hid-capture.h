@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* HID Capture File Format */
+
+/*
+ * A capture starts with an 8 byte magic and a 4 byte version, followed by
+ * length prefixed records, all integers little endian:
+ *
+ *   u32 size        payload bytes following the record header
+ *   u16 interface   capture local id of the opened device
+ *   u8  type        capture_record_type
+ *   u8  direction   capture_direction
+ *   u64 timestamp   monotonic clock, nanoseconds
+ *   i32 result      return value of the HID call
+ *   u8  payload[size]
+ *
+ * Input reports and feature report responses carry the data as received,
+ * output reports and feature reports sent the data as written. A get feature
+ * record that failed only holds the requested report id. An open record's
+ * payload describes the device, see capture_device.
+ */
+
+#ifndef OPENHMD_HID_CAPTURE_H
+#define OPENHMD_HID_CAPTURE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define CAPTURE_MAGIC "OHMDHID\0"
+#define CAPTURE_MAGIC_SIZE 8
+#define CAPTURE_VERSION 1
+#define CAPTURE_FILE_HEADER_SIZE 12
+#define CAPTURE_RECORD_HEADER_SIZE 20
+
+typedef enum {
+	CAPTURE_OPEN = 1,
+	CAPTURE_CLOSE = 2,
+	CAPTURE_INPUT = 3,
+	CAPTURE_OUTPUT = 4,
+	CAPTURE_GET_FEATURE = 5,
+	CAPTURE_SEND_FEATURE = 6,
+} capture_record_type;
+
+typedef enum {
+	CAPTURE_TO_HOST = 0,
+	CAPTURE_TO_DEVICE = 1,
+} capture_direction;
+
+typedef struct {
+	uint32_t size;
+	uint16_t interface;
+	uint8_t type;
+	uint8_t direction;
+	uint64_t timestamp;
+	int32_t result;
+} capture_record;
+
+/*
+ * Open record payload: u16 vendor id, u16 product id, i32 interface number,
+ * u16 release number, u16 usage page, u16 usage, then the path, manufacturer, product and serial number
+ * strings, each a u16 byte count followed by UTF-8 without terminator.
+ */
+#define CAPTURE_STRING_SIZE 256
+#define CAPTURE_DEVICE_FIXED_SIZE 14
+#define CAPTURE_DEVICE_MAX_SIZE (CAPTURE_DEVICE_FIXED_SIZE + 4 * (2 + CAPTURE_STRING_SIZE))
+
+typedef struct {
+	uint16_t vendor_id;
+	uint16_t product_id;
+	int32_t interface_number;
+	uint16_t release_number;
+	uint16_t usage_page;
+	uint16_t usage;
+	char path[CAPTURE_STRING_SIZE];
+	char manufacturer[CAPTURE_STRING_SIZE];
+	char product[CAPTURE_STRING_SIZE];
+	char serial_number[CAPTURE_STRING_SIZE];
+} capture_device;
+
+static inline void capture_put_u16(unsigned char* p, uint16_t v)
+{
+	p[0] = v & 0xff;
+	p[1] = v >> 8;
+}
+
+static inline void capture_put_u32(unsigned char* p, uint32_t v)
+{
+	capture_put_u16(p, v & 0xffff);
+	capture_put_u16(p + 2, v >> 16);
+}
+
+static inline void capture_put_u64(unsigned char* p, uint64_t v)
+{
+	capture_put_u32(p, v & 0xffffffff);
+	capture_put_u32(p + 4, v >> 32);
+}
+
+static inline uint16_t capture_get_u16(const unsigned char* p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t capture_get_u32(const unsigned char* p)
+{
+	return capture_get_u16(p) | ((uint32_t)capture_get_u16(p + 2) << 16);
+}
+
+static inline uint64_t capture_get_u64(const unsigned char* p)
+{
+	return capture_get_u32(p) | ((uint64_t)capture_get_u32(p + 4) << 32);
+}
+
+static inline void capture_write_record_header(unsigned char* p, const capture_record* rec)
+{
+	capture_put_u32(p, rec->size);
+	capture_put_u16(p + 4, rec->interface);
+	p[6] = rec->type;
+	p[7] = rec->direction;
+	capture_put_u64(p + 8, rec->timestamp);
+	capture_put_u32(p + 16, (uint32_t)rec->result);
+}
+
+static inline void capture_read_record_header(const unsigned char* p, capture_record* rec)
+{
+	rec->size = capture_get_u32(p);
+	rec->interface = capture_get_u16(p + 4);
+	rec->type = p[6];
+	rec->direction = p[7];
+	rec->timestamp = capture_get_u64(p + 8);
+	rec->result = (int32_t)capture_get_u32(p + 16);
+}
+
+// Encodes a device description, returns the payload size.
+static inline int capture_write_device(unsigned char* p, const capture_device* dev)
+{
+	const char* strings[4] = { dev->path, dev->manufacturer, dev->product, dev->serial_number };
+	int size = CAPTURE_DEVICE_FIXED_SIZE;
+
+	capture_put_u16(p, dev->vendor_id);
+	capture_put_u16(p + 2, dev->product_id);
+	capture_put_u32(p + 4, (uint32_t)dev->interface_number);
+	capture_put_u16(p + 8, dev->release_number);
+	capture_put_u16(p + 10, dev->usage_page);
+	capture_put_u16(p + 12, dev->usage);
+
+	for(int i = 0; i < 4; i++){
+		uint16_t len = (uint16_t)strlen(strings[i]);
+		capture_put_u16(p + size, len);
+		memcpy(p + size + 2, strings[i], len);
+		size += 2 + len;
+	}
+
+	return size;
+}
+
+// Decodes a device description, returns 0 if the payload is malformed.
+static inline int capture_read_device(const unsigned char* p, uint32_t size, capture_device* dev)
+{
+	char* strings[4] = { dev->path, dev->manufacturer, dev->product, dev->serial_number };
+	uint32_t pos = CAPTURE_DEVICE_FIXED_SIZE;
+
+	if(size < pos)
+		return 0;
+
+	dev->vendor_id = capture_get_u16(p);
+	dev->product_id = capture_get_u16(p + 2);
+	dev->interface_number = (int32_t)capture_get_u32(p + 4);
+	dev->release_number = capture_get_u16(p + 8);
+	dev->usage_page = capture_get_u16(p + 10);
+	dev->usage = capture_get_u16(p + 12);
+
+	for(int i = 0; i < 4; i++){
+		if(pos + 2 > size)
+			return 0;
+
+		uint16_t len = capture_get_u16(p + pos);
+		if(len >= CAPTURE_STRING_SIZE || pos + 2 + len > size)
+			return 0;
+
+		memcpy(strings[i], p + pos + 2, len);
+		strings[i][len] = 0;
+		pos += 2 + len;
+	}
+
+	return 1;
+}
+
+#endif
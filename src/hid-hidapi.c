@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* HID Transport - hidapi */
+
+
+#include <string.h>
+#include <hidapi.h>
+
+#include "hid.h"
+
+typedef struct {
+	ohmd_hid_device base;
+	hid_device* handle;
+} hidapi_device;
+
+static hid_device* get_handle(ohmd_hid_device* dev)
+{
+	return ((hidapi_device*)dev)->handle;
+}
+
+static char* copy_str(const char* str)
+{
+	if(!str)
+		return NULL;
+
+	char* copy = malloc(strlen(str) + 1);
+	if(copy)
+		strcpy(copy, str);
+	return copy;
+}
+
+static wchar_t* copy_wstr(const wchar_t* str)
+{
+	if(!str)
+		return NULL;
+
+	wchar_t* copy = malloc((wcslen(str) + 1) * sizeof(wchar_t));
+	if(copy)
+		wcscpy(copy, str);
+	return copy;
+}
+
+static void free_enumeration(ohmd_hid_transport* transport, ohmd_hid_device_info* devs)
+{
+	(void)transport;
+
+	while(devs){
+		ohmd_hid_device_info* next = devs->next;
+		free(devs->path);
+		free(devs->serial_number);
+		free(devs->manufacturer_string);
+		free(devs->product_string);
+		free(devs);
+		devs = next;
+	}
+}
+
+static ohmd_hid_device_info* enumerate(ohmd_hid_transport* transport, unsigned short vendor_id, unsigned short product_id)
+{
+	(void)transport;
+
+	struct hid_device_info* devs = hid_enumerate(vendor_id, product_id);
+	ohmd_hid_device_info* head = NULL;
+	ohmd_hid_device_info** tail = &head;
+
+	for(struct hid_device_info* cur_dev = devs; cur_dev; cur_dev = cur_dev->next){
+		ohmd_hid_device_info* info = calloc(1, sizeof(ohmd_hid_device_info));
+		if(!info){
+			LOGE("could not allocate RAM for HID device info");
+			break;
+		}
+
+		info->path = copy_str(cur_dev->path);
+		info->vendor_id = cur_dev->vendor_id;
+		info->product_id = cur_dev->product_id;
+		info->serial_number = copy_wstr(cur_dev->serial_number);
+		info->release_number = cur_dev->release_number;
+		info->manufacturer_string = copy_wstr(cur_dev->manufacturer_string);
+		info->product_string = copy_wstr(cur_dev->product_string);
+		info->usage_page = cur_dev->usage_page;
+		info->usage = cur_dev->usage;
+		info->interface_number = cur_dev->interface_number;
+
+		*tail = info;
+		tail = &info->next;
+	}
+
+	hid_free_enumeration(devs);
+
+	return head;
+}
+
+static ohmd_hid_device* open_path(ohmd_hid_transport* transport, const char* path)
+{
+	hid_device* handle = hid_open_path(path);
+	if(!handle)
+		return NULL;
+
+	hidapi_device* dev = calloc(1, sizeof(hidapi_device));
+	if(!dev){
+		LOGE("could not allocate RAM for HID device");
+		hid_close(handle);
+		return NULL;
+	}
+
+	dev->base.transport = transport;
+	dev->handle = handle;
+
+	return &dev->base;
+}
+
+static void transport_exit(ohmd_hid_transport* transport)
+{
+	(void)transport;
+	hid_exit();
+}
+
+static void close_device(ohmd_hid_device* dev)
+{
+	hid_close(get_handle(dev));
+	free(dev);
+}
+
+static int set_nonblocking(ohmd_hid_device* dev, int nonblock)
+{
+	return hid_set_nonblocking(get_handle(dev), nonblock);
+}
+
+static int stamp_read(ohmd_hid_device* dev, int ret)
+{
+	if(ret > 0)
+		dev->read_ns = ohmd_monotonic_ns();
+	return ret;
+}
+
+static int read_timeout(ohmd_hid_device* dev, unsigned char* data, size_t length, int milliseconds)
+{
+	return stamp_read(dev, hid_read_timeout(get_handle(dev), data, length, milliseconds));
+}
+
+static int read_report(ohmd_hid_device* dev, unsigned char* data, size_t length)
+{
+	return stamp_read(dev, hid_read(get_handle(dev), data, length));
+}
+
+static int write_report(ohmd_hid_device* dev, const unsigned char* data, size_t length)
+{
+	return hid_write(get_handle(dev), data, length);
+}
+
+static int get_feature_report(ohmd_hid_device* dev, unsigned char* data, size_t length)
+{
+	return hid_get_feature_report(get_handle(dev), data, length);
+}
+
+static int send_feature_report(ohmd_hid_device* dev, const unsigned char* data, size_t length)
+{
+	return hid_send_feature_report(get_handle(dev), data, length);
+}
+
+static int get_manufacturer_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen)
+{
+	return hid_get_manufacturer_string(get_handle(dev), string, maxlen);
+}
+
+static int get_product_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen)
+{
+	return hid_get_product_string(get_handle(dev), string, maxlen);
+}
+
+static int get_serial_number_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen)
+{
+	return hid_get_serial_number_string(get_handle(dev), string, maxlen);
+}
+
+static int get_indexed_string(ohmd_hid_device* dev, int string_index, wchar_t* string, size_t maxlen)
+{
+	return hid_get_indexed_string(get_handle(dev), string_index, string, maxlen);
+}
+
+static const wchar_t* error(ohmd_hid_device* dev)
+{
+	return hid_error(get_handle(dev));
+}
+
+ohmd_hid_transport ohmd_hid_transport_hidapi = {
+	"hidapi",
+	enumerate,
+	free_enumeration,
+	open_path,
+	transport_exit,
+	close_device,
+	set_nonblocking,
+	read_timeout,
+	read_report,
+	write_report,
+	get_feature_report,
+	send_feature_report,
+	get_manufacturer_string,
+	get_product_string,
+	get_serial_number_string,
+	get_indexed_string,
+	error,
+};
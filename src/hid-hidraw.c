@@ -0,0 +1,449 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* HID Transport - Linux hidraw */
+
+/*
+ * Talks to /dev/hidraw* directly. Reads go straight from the kernel into the
+ * caller's buffer, without the reader thread and per report allocation some
+ * hidapi backends have, and feature reports use the HIDIOC*FEATURE ioctls.
+ * Devices are discovered through sysfs, only enumeration and open allocate.
+ */
+
+#define _GNU_SOURCE
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/hidraw.h>
+
+#include "hid.h"
+
+#define HIDRAW_SYSFS "/sys/class/hidraw"
+#define HIDRAW_BUS_USB 0x03
+
+typedef struct {
+	ohmd_hid_device base;
+	int fd;
+	int nonblocking;
+	ohmd_hid_device_info* info;
+	wchar_t error[128];
+} hidraw_device;
+
+static wchar_t* utf8_to_wstr(const char* str)
+{
+	size_t len = strlen(str);
+	wchar_t* out = malloc((len + 1) * sizeof(wchar_t));
+	if(!out)
+		return NULL;
+
+	const unsigned char* p = (const unsigned char*)str;
+	size_t n = 0;
+
+	while(*p){
+		unsigned int c = *p++;
+		int extra = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : c >= 0xc0 ? 1 : 0;
+
+		if(extra)
+			c &= 0x3f >> extra;
+		for(; extra > 0 && (*p & 0xc0) == 0x80; extra--)
+			c = (c << 6) | (*p++ & 0x3f);
+
+		out[n++] = (wchar_t)c;
+	}
+
+	out[n] = 0;
+	return out;
+}
+
+// Reads a single line sysfs attribute, NULL if it does not exist.
+static char* read_attr(const char* dir, const char* name)
+{
+	char path[PATH_MAX];
+	char buf[256];
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+
+	FILE* f = fopen(path, "r");
+	if(!f)
+		return NULL;
+
+	char* line = fgets(buf, sizeof(buf), f);
+	fclose(f);
+
+	if(!line)
+		return NULL;
+
+	buf[strcspn(buf, "\n")] = 0;
+	return strdup(buf);
+}
+
+static wchar_t* read_attr_wstr(const char* dir, const char* name)
+{
+	char* str = read_attr(dir, name);
+	if(!str)
+		return NULL;
+
+	wchar_t* wstr = utf8_to_wstr(str);
+	free(str);
+	return wstr;
+}
+
+static void parent_dir(char* path)
+{
+	char* slash = strrchr(path, '/');
+	if(slash && slash != path)
+		*slash = 0;
+}
+
+static void free_info(ohmd_hid_device_info* info)
+{
+	free(info->path);
+	free(info->serial_number);
+	free(info->manufacturer_string);
+	free(info->product_string);
+	free(info);
+}
+
+// Fills in a device info from sysfs for the hidraw node `name` (hidrawN).
+static ohmd_hid_device_info* get_info(const char* name)
+{
+	char link[PATH_MAX];
+	char hid_dir[PATH_MAX];
+
+	snprintf(link, sizeof(link), HIDRAW_SYSFS "/%s/device", name);
+	if(!realpath(link, hid_dir))
+		return NULL;
+
+	// the HID device's uevent holds the bus, the ids, its name and serial
+	char uevent_path[PATH_MAX + 8];
+	snprintf(uevent_path, sizeof(uevent_path), "%s/uevent", hid_dir);
+
+	FILE* f = fopen(uevent_path, "r");
+	if(!f)
+		return NULL;
+
+	char line[256];
+	char hid_name[256] = "", hid_uniq[256] = "";
+	unsigned int bus = 0, vendor_id = 0, product_id = 0;
+	bool have_id = false;
+
+	while(fgets(line, sizeof(line), f)){
+		line[strcspn(line, "\n")] = 0;
+
+		if(strncmp(line, "HID_ID=", 7) == 0)
+			have_id = sscanf(line + 7, "%x:%x:%x", &bus, &vendor_id, &product_id) == 3;
+		else if(strncmp(line, "HID_NAME=", 9) == 0)
+			snprintf(hid_name, sizeof(hid_name), "%s", line + 9);
+		else if(strncmp(line, "HID_UNIQ=", 9) == 0)
+			snprintf(hid_uniq, sizeof(hid_uniq), "%s", line + 9);
+	}
+
+	fclose(f);
+
+	if(!have_id)
+		return NULL;
+
+	ohmd_hid_device_info* info = calloc(1, sizeof(ohmd_hid_device_info));
+	if(!info)
+		return NULL;
+
+	char dev_path[PATH_MAX];
+	snprintf(dev_path, sizeof(dev_path), "/dev/%s", name);
+
+	info->path = strdup(dev_path);
+	info->vendor_id = vendor_id;
+	info->product_id = product_id;
+	info->interface_number = -1;
+
+	if(bus == HIDRAW_BUS_USB){
+		// .../<usb device>/<usb interface>/<hid device>
+		char dir[PATH_MAX];
+		strcpy(dir, hid_dir);
+		parent_dir(dir);
+
+		char* iface = read_attr(dir, "bInterfaceNumber");
+		if(iface){
+			info->interface_number = (int)strtol(iface, NULL, 16);
+			free(iface);
+		}
+
+		parent_dir(dir);
+		info->manufacturer_string = read_attr_wstr(dir, "manufacturer");
+		info->product_string = read_attr_wstr(dir, "product");
+		info->serial_number = read_attr_wstr(dir, "serial");
+
+		char* bcd = read_attr(dir, "bcdDevice");
+		if(bcd){
+			info->release_number = (unsigned short)strtol(bcd, NULL, 16);
+			free(bcd);
+		}
+	}
+
+	// Bluetooth and other buses only have the HID name and unique id
+	if(!info->product_string)
+		info->product_string = utf8_to_wstr(hid_name);
+	if(!info->serial_number)
+		info->serial_number = utf8_to_wstr(hid_uniq);
+	if(!info->manufacturer_string)
+		info->manufacturer_string = utf8_to_wstr("");
+
+	return info;
+}
+
+static void free_enumeration(ohmd_hid_transport* transport, ohmd_hid_device_info* devs)
+{
+	(void)transport;
+
+	while(devs){
+		ohmd_hid_device_info* next = devs->next;
+		free_info(devs);
+		devs = next;
+	}
+}
+
+static ohmd_hid_device_info* enumerate(ohmd_hid_transport* transport, unsigned short vendor_id, unsigned short product_id)
+{
+	(void)transport;
+
+	DIR* dir = opendir(HIDRAW_SYSFS);
+	if(!dir)
+		return NULL;
+
+	ohmd_hid_device_info* head = NULL;
+	ohmd_hid_device_info** tail = &head;
+	struct dirent* entry;
+
+	while((entry = readdir(dir)) != NULL){
+		if(strncmp(entry->d_name, "hidraw", 6) != 0)
+			continue;
+
+		ohmd_hid_device_info* info = get_info(entry->d_name);
+		if(!info)
+			continue;
+
+		if((vendor_id && info->vendor_id != vendor_id) || (product_id && info->product_id != product_id)){
+			free_info(info);
+			continue;
+		}
+
+		*tail = info;
+		tail = &info->next;
+	}
+
+	closedir(dir);
+
+	return head;
+}
+
+static void set_error(hidraw_device* dev, const char* what)
+{
+	swprintf(dev->error, sizeof(dev->error) / sizeof(wchar_t), L"%s: %s", what, strerror(errno));
+}
+
+static ohmd_hid_device* open_path(ohmd_hid_transport* transport, const char* path)
+{
+	const char* name = strrchr(path, '/');
+	name = name ? name + 1 : path;
+
+	int fd = open(path, O_RDWR | O_CLOEXEC);
+	if(fd < 0)
+		return NULL;
+
+	hidraw_device* dev = calloc(1, sizeof(hidraw_device));
+	if(!dev){
+		LOGE("could not allocate RAM for HID device");
+		close(fd);
+		return NULL;
+	}
+
+	dev->base.transport = transport;
+	dev->fd = fd;
+	dev->info = get_info(name);
+
+	return &dev->base;
+}
+
+static void close_device(ohmd_hid_device* base)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+
+	close(dev->fd);
+	if(dev->info)
+		free_info(dev->info);
+	free(dev);
+}
+
+static int set_nonblocking(ohmd_hid_device* base, int nonblock)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+
+	int flags = fcntl(dev->fd, F_GETFL);
+	if(flags < 0 || fcntl(dev->fd, F_SETFL, nonblock ? flags | O_NONBLOCK : flags & ~O_NONBLOCK) < 0){
+		set_error(dev, "fcntl");
+		return -1;
+	}
+
+	dev->nonblocking = nonblock;
+	return 0;
+}
+
+static int read_nonblocking(hidraw_device* dev, unsigned char* data, size_t length)
+{
+	ssize_t size = read(dev->fd, data, length);
+	if(size < 0){
+		if(errno == EAGAIN || errno == EINTR)
+			return 0;
+
+		set_error(dev, "read");
+		return -1;
+	}
+
+	if(size > 0)
+		dev->base.read_ns = ohmd_monotonic_ns();
+
+	return (int)size;
+}
+
+static int read_timeout(ohmd_hid_device* base, unsigned char* data, size_t length, int milliseconds)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+
+	struct pollfd pfd = { dev->fd, POLLIN, 0 };
+	int ret;
+
+	do {
+		ret = poll(&pfd, 1, milliseconds);
+	} while(ret < 0 && errno == EINTR);
+
+	if(ret < 0){
+		set_error(dev, "poll");
+		return -1;
+	}
+
+	if(ret == 0)
+		return 0;
+
+	if(pfd.revents & (POLLERR | POLLHUP | POLLNVAL)){
+		swprintf(dev->error, sizeof(dev->error) / sizeof(wchar_t), L"device disconnected");
+		return -1;
+	}
+
+	return read_nonblocking(dev, data, length);
+}
+
+static int read_report(ohmd_hid_device* base, unsigned char* data, size_t length)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+
+	// the update loop path, a single read() that returns at once when idle
+	if(dev->nonblocking)
+		return read_nonblocking(dev, data, length);
+
+	return read_timeout(base, data, length, -1);
+}
+
+static int write_report(ohmd_hid_device* base, const unsigned char* data, size_t length)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+
+	ssize_t size = write(dev->fd, data, length);
+	if(size < 0){
+		set_error(dev, "write");
+		return -1;
+	}
+
+	return (int)size;
+}
+
+static int get_feature_report(ohmd_hid_device* base, unsigned char* data, size_t length)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+
+	int ret = ioctl(dev->fd, HIDIOCGFEATURE(length), data);
+	if(ret < 0)
+		set_error(dev, "HIDIOCGFEATURE");
+
+	return ret;
+}
+
+static int send_feature_report(ohmd_hid_device* base, const unsigned char* data, size_t length)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+
+	int ret = ioctl(dev->fd, HIDIOCSFEATURE(length), data);
+	if(ret < 0)
+		set_error(dev, "HIDIOCSFEATURE");
+
+	return ret;
+}
+
+static int copy_string(const wchar_t* str, wchar_t* string, size_t maxlen)
+{
+	if(!str || maxlen == 0)
+		return -1;
+
+	wcsncpy(string, str, maxlen);
+	string[maxlen - 1] = 0;
+
+	return 0;
+}
+
+static int get_manufacturer_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+	return copy_string(dev->info ? dev->info->manufacturer_string : NULL, string, maxlen);
+}
+
+static int get_product_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+	return copy_string(dev->info ? dev->info->product_string : NULL, string, maxlen);
+}
+
+static int get_serial_number_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	hidraw_device* dev = (hidraw_device*)base;
+	return copy_string(dev->info ? dev->info->serial_number : NULL, string, maxlen);
+}
+
+static int get_indexed_string(ohmd_hid_device* base, int string_index, wchar_t* string, size_t maxlen)
+{
+	// hidraw has no access to arbitrary USB string descriptors
+	(void)base;
+	(void)string_index;
+	(void)string;
+	(void)maxlen;
+	return -1;
+}
+
+static const wchar_t* error(ohmd_hid_device* base)
+{
+	return ((hidraw_device*)base)->error;
+}
+
+ohmd_hid_transport ohmd_hid_transport_hidraw = {
+	"hidraw",
+	enumerate,
+	free_enumeration,
+	open_path,
+	NULL,
+	close_device,
+	set_nonblocking,
+	read_timeout,
+	read_report,
+	write_report,
+	get_feature_report,
+	send_feature_report,
+	get_manufacturer_string,
+	get_product_string,
+	get_serial_number_string,
+	get_indexed_string,
+	error,
+};
@@ -0,0 +1,528 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* HID Transport - Traffic Recorder */
+
+// Wraps the transport of a context and writes every input report, output
+// report and feature report of the devices opened through it to a capture
+// file (see hid-capture.h). Records are collected in one of two buffers.
+// When it fills up the buffers are swapped and a writer thread writes the
+// full one out, so the drivers' read loops neither wait on the disk nor on
+// each other while it writes. Only when the disk falls behind by a whole
+// buffer does the next swap wait for the write.
+//
+// Once recording was started the recorder stays in front of the context's
+// transport until the context is destroyed, so devices opened while it is
+// stopped are still known when the next recording starts.
+
+#include <string.h>
+
+#include "hid.h"
+#include "hid-capture.h"
+
+#define RECORD_BUFFER_SIZE (256 * 1024)
+#define RECORD_MAX_ENUMERATED 64
+#define RECORD_WRITE_SLEEP 0.01 // seconds between the writer thread looking for a full buffer
+
+typedef struct ohmd_hid_recorder ohmd_hid_recorder;
+typedef struct recorded_device recorded_device;
+
+struct ohmd_hid_recorder {
+	ohmd_hid_transport base;
+	ohmd_context* ctx;
+	ohmd_mutex* lock;       // everything below, held only to copy records
+	ohmd_mutex* write_lock; // held while writing out pending, taken before lock
+	ohmd_thread* writer;
+	volatile bool quit;
+	FILE* file;
+
+	// the last enumeration results, an open record describes the device with them
+	capture_device enumerated[RECORD_MAX_ENUMERATED];
+	int num_enumerated, next_enumerated;
+
+	recorded_device* devices;
+	uint16_t next_interface;
+
+	// the buffer being filled, and the full one waiting for the writer, NULL once written
+	unsigned char* buffer;
+	size_t used;
+	unsigned char* pending;
+	size_t pending_used;
+
+	unsigned char buffers[2][RECORD_BUFFER_SIZE];
+};
+
+struct recorded_device {
+	ohmd_hid_device base;
+	ohmd_hid_device* inner;
+	ohmd_hid_recorder* recorder;
+	uint16_t interface;
+	capture_device desc;
+	recorded_device* next;
+};
+
+static void write_out(FILE* file, const unsigned char* data, size_t size)
+{
+	if(size > 0 && fwrite(data, 1, size, file) != size)
+		LOGE("could not write HID capture");
+}
+
+// Writes the pending buffer, if any, without holding lock while at it
+static void write_pending(ohmd_hid_recorder* rec)
+{
+	ohmd_lock_mutex(rec->write_lock);
+
+	ohmd_lock_mutex(rec->lock);
+	unsigned char* buffer = rec->pending;
+	size_t size = rec->pending_used;
+	FILE* file = rec->file;
+	ohmd_unlock_mutex(rec->lock);
+
+	if(buffer){
+		write_out(file, buffer, size);
+
+		ohmd_lock_mutex(rec->lock);
+		rec->pending = NULL;
+		ohmd_unlock_mutex(rec->lock);
+	}
+
+	ohmd_unlock_mutex(rec->write_lock);
+}
+
+// Returns with lock held again and no write in progress, the file is then only written under lock
+static void wait_pending_locked(ohmd_hid_recorder* rec)
+{
+	while(rec->pending){
+		ohmd_unlock_mutex(rec->lock);
+		write_pending(rec);
+		ohmd_lock_mutex(rec->lock);
+	}
+}
+
+// Hands the buffer being filled to the writer thread
+static void swap_locked(ohmd_hid_recorder* rec)
+{
+	wait_pending_locked(rec);
+
+	rec->pending = rec->buffer;
+	rec->pending_used = rec->used;
+	rec->buffer = rec->buffer == rec->buffers[0] ? rec->buffers[1] : rec->buffers[0];
+	rec->used = 0;
+}
+
+// Writes out everything recorded so far before returning
+static void flush_locked(ohmd_hid_recorder* rec)
+{
+	wait_pending_locked(rec);
+
+	if(rec->file)
+		write_out(rec->file, rec->buffer, rec->used);
+
+	rec->used = 0;
+}
+
+static unsigned int writer_thread(void* arg)
+{
+	ohmd_hid_recorder* rec = arg;
+
+	while(!rec->quit){
+		write_pending(rec);
+		ohmd_sleep(RECORD_WRITE_SLEEP);
+	}
+
+	return 0;
+}
+
+static void append_locked(ohmd_hid_recorder* rec, uint64_t timestamp, uint16_t interface, capture_record_type type,
+	capture_direction direction, int result, const unsigned char* data, size_t size)
+{
+	if(!rec->file)
+		return;
+
+	capture_record header = {
+		(uint32_t)size, interface, (uint8_t)type, (uint8_t)direction, timestamp, result
+	};
+
+	if(rec->used + CAPTURE_RECORD_HEADER_SIZE + size > RECORD_BUFFER_SIZE)
+		swap_locked(rec);
+
+	capture_write_record_header(rec->buffer + rec->used, &header);
+	rec->used += CAPTURE_RECORD_HEADER_SIZE;
+
+	// larger than a whole buffer, goes straight to the file in order with what came before
+	if(size > RECORD_BUFFER_SIZE - rec->used){
+		flush_locked(rec);
+		write_out(rec->file, data, size);
+		return;
+	}
+
+	if(size > 0)
+		memcpy(rec->buffer + rec->used, data, size);
+	rec->used += size;
+}
+
+static void append(recorded_device* dev, capture_record_type type, capture_direction direction,
+	int result, const unsigned char* data, size_t size)
+{
+	ohmd_hid_recorder* rec = dev->recorder;
+
+	ohmd_lock_mutex(rec->lock);
+	append_locked(rec, ohmd_monotonic_ns(), dev->interface, type, direction, result, data, size);
+	ohmd_unlock_mutex(rec->lock);
+}
+
+// Input reports keep the time the inner transport read them at.
+static void append_input(recorded_device* dev, int size, const unsigned char* data)
+{
+	ohmd_hid_recorder* rec = dev->recorder;
+
+	dev->base.read_ns = dev->inner->read_ns;
+
+	ohmd_lock_mutex(rec->lock);
+	append_locked(rec, dev->base.read_ns, dev->interface, CAPTURE_INPUT, CAPTURE_TO_HOST, size, data, size);
+	ohmd_unlock_mutex(rec->lock);
+}
+
+static void append_open_locked(ohmd_hid_recorder* rec, recorded_device* dev)
+{
+	unsigned char payload[CAPTURE_DEVICE_MAX_SIZE];
+	int size = capture_write_device(payload, &dev->desc);
+	append_locked(rec, ohmd_monotonic_ns(), dev->interface, CAPTURE_OPEN, CAPTURE_TO_HOST, 0, payload, size);
+}
+
+static ohmd_hid_transport* inner_transport(ohmd_hid_recorder* rec)
+{
+	return ohmd_hid_get_backend(rec->ctx);
+}
+
+static ohmd_hid_device_info* record_enumerate(ohmd_hid_transport* transport, unsigned short vendor_id, unsigned short product_id)
+{
+	ohmd_hid_recorder* rec = (ohmd_hid_recorder*)transport;
+	ohmd_hid_transport* inner = inner_transport(rec);
+	ohmd_hid_device_info* devs = inner->enumerate(inner, vendor_id, product_id);
+
+	ohmd_lock_mutex(rec->lock);
+
+	for(ohmd_hid_device_info* cur = devs; cur; cur = cur->next){
+		if(!cur->path || strlen(cur->path) >= CAPTURE_STRING_SIZE)
+			continue;
+
+		capture_device* desc = NULL;
+		for(int i = 0; i < rec->num_enumerated; i++){
+			if(strcmp(rec->enumerated[i].path, cur->path) == 0){
+				desc = &rec->enumerated[i];
+				break;
+			}
+		}
+
+		if(!desc){
+			desc = &rec->enumerated[rec->next_enumerated];
+			rec->next_enumerated = (rec->next_enumerated + 1) % RECORD_MAX_ENUMERATED;
+			rec->num_enumerated = OHMD_MIN(rec->num_enumerated + 1, RECORD_MAX_ENUMERATED);
+		}
+
+		desc->vendor_id = cur->vendor_id;
+		desc->product_id = cur->product_id;
+		desc->interface_number = cur->interface_number;
+		desc->release_number = cur->release_number;
+		desc->usage_page = cur->usage_page;
+		desc->usage = cur->usage;
+		strcpy(desc->path, cur->path);
+		ohmd_hid_copy_wstr(desc->manufacturer, CAPTURE_STRING_SIZE, cur->manufacturer_string);
+		ohmd_hid_copy_wstr(desc->product, CAPTURE_STRING_SIZE, cur->product_string);
+		ohmd_hid_copy_wstr(desc->serial_number, CAPTURE_STRING_SIZE, cur->serial_number);
+	}
+
+	ohmd_unlock_mutex(rec->lock);
+
+	return devs;
+}
+
+static void record_free_enumeration(ohmd_hid_transport* transport, ohmd_hid_device_info* devs)
+{
+	ohmd_hid_transport* inner = inner_transport((ohmd_hid_recorder*)transport);
+	inner->free_enumeration(inner, devs);
+}
+
+static ohmd_hid_device* record_open_path(ohmd_hid_transport* transport, const char* path)
+{
+	ohmd_hid_recorder* rec = (ohmd_hid_recorder*)transport;
+	ohmd_hid_transport* inner = inner_transport(rec);
+	ohmd_hid_device* handle = inner->open_path(inner, path);
+
+	if(!handle)
+		return NULL;
+
+	recorded_device* dev = ohmd_alloc(rec->ctx, sizeof(recorded_device));
+	if(!dev){
+		inner->close(handle);
+		return NULL;
+	}
+
+	dev->base.transport = transport;
+	dev->inner = handle;
+	dev->recorder = rec;
+
+	ohmd_lock_mutex(rec->lock);
+
+	for(int i = 0; i < rec->num_enumerated; i++){
+		if(strcmp(rec->enumerated[i].path, path) == 0){
+			dev->desc = rec->enumerated[i];
+			break;
+		}
+	}
+
+	// opened without enumerating first, only the path is known
+	if(dev->desc.path[0] == 0){
+		dev->desc.interface_number = -1;
+		snprintf(dev->desc.path, CAPTURE_STRING_SIZE, "%s", path);
+	}
+
+	dev->interface = rec->next_interface++;
+	dev->next = rec->devices;
+	rec->devices = dev;
+
+	append_open_locked(rec, dev);
+
+	ohmd_unlock_mutex(rec->lock);
+
+	return &dev->base;
+}
+
+static void record_exit(ohmd_hid_transport* transport)
+{
+	ohmd_hid_transport* inner = inner_transport((ohmd_hid_recorder*)transport);
+	if(inner->exit)
+		inner->exit(inner);
+}
+
+static void record_close(ohmd_hid_device* base)
+{
+	recorded_device* dev = (recorded_device*)base;
+	ohmd_hid_recorder* rec = dev->recorder;
+
+	ohmd_lock_mutex(rec->lock);
+
+	append_locked(rec, ohmd_monotonic_ns(), dev->interface, CAPTURE_CLOSE, CAPTURE_TO_DEVICE, 0, NULL, 0);
+
+	for(recorded_device** it = &rec->devices; *it; it = &(*it)->next){
+		if(*it == dev){
+			*it = dev->next;
+			break;
+		}
+	}
+
+	ohmd_unlock_mutex(rec->lock);
+
+	ohmd_hid_close(dev->inner);
+	free(dev);
+}
+
+static int record_set_nonblocking(ohmd_hid_device* base, int nonblock)
+{
+	return ohmd_hid_set_nonblocking(((recorded_device*)base)->inner, nonblock);
+}
+
+static int record_read_timeout(ohmd_hid_device* base, unsigned char* data, size_t length, int milliseconds)
+{
+	recorded_device* dev = (recorded_device*)base;
+	int ret = ohmd_hid_read_timeout(dev->inner, data, length, milliseconds);
+
+	if(ret > 0)
+		append_input(dev, ret, data);
+
+	return ret;
+}
+
+static int record_read(ohmd_hid_device* base, unsigned char* data, size_t length)
+{
+	recorded_device* dev = (recorded_device*)base;
+	int ret = ohmd_hid_read(dev->inner, data, length);
+
+	if(ret > 0)
+		append_input(dev, ret, data);
+
+	return ret;
+}
+
+static int record_write(ohmd_hid_device* base, const unsigned char* data, size_t length)
+{
+	recorded_device* dev = (recorded_device*)base;
+	int ret = ohmd_hid_write(dev->inner, data, length);
+
+	append(dev, CAPTURE_OUTPUT, CAPTURE_TO_DEVICE, ret, data, length);
+
+	return ret;
+}
+
+static int record_get_feature_report(ohmd_hid_device* base, unsigned char* data, size_t length)
+{
+	recorded_device* dev = (recorded_device*)base;
+	unsigned char report_id = data[0];
+	int ret = ohmd_hid_get_feature_report(dev->inner, data, length);
+
+	if(ret > 0)
+		append(dev, CAPTURE_GET_FEATURE, CAPTURE_TO_HOST, ret, data, OHMD_MIN((size_t)ret, length));
+	else
+		append(dev, CAPTURE_GET_FEATURE, CAPTURE_TO_HOST, ret, &report_id, 1);
+
+	return ret;
+}
+
+static int record_send_feature_report(ohmd_hid_device* base, const unsigned char* data, size_t length)
+{
+	recorded_device* dev = (recorded_device*)base;
+	int ret = ohmd_hid_send_feature_report(dev->inner, data, length);
+
+	append(dev, CAPTURE_SEND_FEATURE, CAPTURE_TO_DEVICE, ret, data, length);
+
+	return ret;
+}
+
+static int record_get_manufacturer_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	return ohmd_hid_get_manufacturer_string(((recorded_device*)base)->inner, string, maxlen);
+}
+
+static int record_get_product_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	return ohmd_hid_get_product_string(((recorded_device*)base)->inner, string, maxlen);
+}
+
+static int record_get_serial_number_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	return ohmd_hid_get_serial_number_string(((recorded_device*)base)->inner, string, maxlen);
+}
+
+static int record_get_indexed_string(ohmd_hid_device* base, int string_index, wchar_t* string, size_t maxlen)
+{
+	return ohmd_hid_get_indexed_string(((recorded_device*)base)->inner, string_index, string, maxlen);
+}
+
+static const wchar_t* record_error(ohmd_hid_device* base)
+{
+	return ohmd_hid_error(((recorded_device*)base)->inner);
+}
+
+static const ohmd_hid_transport record_transport = {
+	"record",
+
+	record_enumerate,
+	record_free_enumeration,
+	record_open_path,
+	record_exit,
+
+	record_close,
+	record_set_nonblocking,
+	record_read_timeout,
+	record_read,
+	record_write,
+	record_get_feature_report,
+	record_send_feature_report,
+
+	record_get_manufacturer_string,
+	record_get_product_string,
+	record_get_serial_number_string,
+	record_get_indexed_string,
+	record_error,
+};
+
+int ohmd_hid_record_start(ohmd_context* ctx, const char* filename)
+{
+	FILE* file = fopen(filename, "wb");
+	if(!file){
+		ohmd_set_error(ctx, "could not open %s for recording HID traffic", filename);
+		return -1;
+	}
+
+	unsigned char header[CAPTURE_FILE_HEADER_SIZE];
+	memcpy(header, CAPTURE_MAGIC, CAPTURE_MAGIC_SIZE);
+	capture_put_u32(header + CAPTURE_MAGIC_SIZE, CAPTURE_VERSION);
+
+	if(fwrite(header, 1, sizeof(header), file) != sizeof(header)){
+		ohmd_set_error(ctx, "could not write to %s", filename);
+		fclose(file);
+		return -1;
+	}
+
+	ohmd_hid_recorder* rec = ctx->hid_recorder;
+	if(!rec){
+		rec = ohmd_alloc(ctx, sizeof(ohmd_hid_recorder));
+		if(!rec){
+			fclose(file);
+			return -1;
+		}
+
+		rec->base = record_transport;
+		rec->ctx = ctx;
+		rec->lock = ohmd_create_mutex(ctx);
+		rec->write_lock = ohmd_create_mutex(ctx);
+		rec->buffer = rec->buffers[0];
+		rec->writer = ohmd_create_thread(ctx, writer_thread, rec);
+		ctx->hid_recorder = rec;
+	}
+
+	ohmd_hid_record_stop(ctx);
+
+	ohmd_lock_mutex(rec->lock);
+
+	rec->file = file;
+
+	// devices opened during an earlier recording continue in this one
+	for(recorded_device* dev = rec->devices; dev; dev = dev->next)
+		append_open_locked(rec, dev);
+
+	ohmd_unlock_mutex(rec->lock);
+
+	LOGI("recording HID traffic to %s", filename);
+
+	return 0;
+}
+
+void ohmd_hid_record_stop(ohmd_context* ctx)
+{
+	ohmd_hid_recorder* rec = ctx->hid_recorder;
+	if(!rec)
+		return;
+
+	ohmd_lock_mutex(rec->lock);
+
+	if(rec->file){
+		flush_locked(rec);
+		fclose(rec->file);
+		rec->file = NULL;
+	}
+
+	ohmd_unlock_mutex(rec->lock);
+}
+
+ohmd_hid_transport* ohmd_hid_recorder_transport(ohmd_context* ctx)
+{
+	return ctx->hid_recorder ? &ctx->hid_recorder->base : NULL;
+}
+
+void ohmd_hid_record_destroy(ohmd_context* ctx)
+{
+	ohmd_hid_recorder* rec = ctx->hid_recorder;
+	if(!rec)
+		return;
+
+	ohmd_hid_record_stop(ctx);
+
+	rec->quit = true;
+	ohmd_destroy_thread(rec->writer);
+	rec->writer = NULL;
+
+	// devices the application never closed keep their wrapper, don't leave them dangling
+	if(rec->devices){
+		LOGW("HID devices still open while destroying the recorder");
+		return;
+	}
+
+	ohmd_destroy_mutex(rec->write_lock);
+	ohmd_destroy_mutex(rec->lock);
+	free(rec);
+	ctx->hid_recorder = NULL;
+}
@@ -0,0 +1,661 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* HID Transport - Capture Replay */
+
+// Presents the devices of a capture file (see hid-capture.h) to the drivers
+// as if they were connected. The capture is memory mapped and indexed once,
+// then every opened device gets the recorded input reports of one recorded
+// open, in order, either with their original timing, as fast as the driver
+// reads them or stepwise under the control of the application. Feature
+// report reads are answered with the recorded response to the same report
+// id, searching forward from the last control transfer so repeated requests
+// get their responses in recorded order. Past the last input report of its
+// open a device reads as gone, like a disconnected one under hidapi.
+
+#include <string.h>
+
+#include "hid.h"
+#include "hid-capture.h"
+
+typedef struct ohmd_hid_replay ohmd_hid_replay;
+typedef struct replay_device replay_device;
+
+// the reports of one recorded open of a device, offsets into the capture
+typedef struct {
+	capture_device desc;
+	size_t* inputs;
+	int num_inputs, inputs_alloc;
+	size_t* control;
+	int num_control, control_alloc;
+	bool claimed;
+} replay_stream;
+
+struct ohmd_hid_replay {
+	ohmd_hid_transport base;
+	ohmd_context* ctx;
+	ohmd_mutex* lock;
+	ohmd_replay_mode mode;
+
+	const unsigned char* data;
+	size_t size;
+
+	replay_stream* streams;
+	int num_streams;
+
+	// paced replay maps the first input report of the capture to the time
+	// the drivers first read one
+	uint64_t first_input;
+	bool started;
+	uint64_t start_ns;
+
+	// stepped replay returns the input reports recorded up to this time to the devices stepped since they were
+	// opened. Until then a device reads freely, drivers read the responses to their configuration while opening.
+	volatile uint64_t released;
+
+	replay_device* devices;
+};
+
+struct replay_device {
+	ohmd_hid_device base;
+	ohmd_hid_replay* replay;
+	replay_stream* stream;
+	volatile int next_input;
+	int next_control;
+	bool nonblocking;
+	volatile bool stepped;
+	const wchar_t* error;
+	replay_device* next;
+};
+
+static const unsigned char* record_at(ohmd_hid_replay* replay, size_t offset, capture_record* rec)
+{
+	capture_read_record_header(replay->data + offset, rec);
+	return replay->data + offset + CAPTURE_RECORD_HEADER_SIZE;
+}
+
+static bool push_offset(size_t** list, int* count, int* alloc, size_t offset)
+{
+	if(*count == *alloc){
+		int new_alloc = *alloc ? *alloc * 2 : 256;
+		size_t* tmp = realloc(*list, new_alloc * sizeof(size_t));
+		if(!tmp)
+			return false;
+		*list = tmp;
+		*alloc = new_alloc;
+	}
+
+	(*list)[(*count)++] = offset;
+	return true;
+}
+
+static bool index_capture(ohmd_hid_replay* replay)
+{
+	// stream of each capture interface id, -1 when closed or unknown
+	int* interfaces = malloc(65536 * sizeof(int));
+	int streams_alloc = 0;
+	bool have_input = false;
+
+	if(!interfaces)
+		return false;
+
+	for(int i = 0; i < 65536; i++)
+		interfaces[i] = -1;
+
+	size_t pos = CAPTURE_FILE_HEADER_SIZE;
+
+	while(pos + CAPTURE_RECORD_HEADER_SIZE <= replay->size){
+		capture_record rec;
+		const unsigned char* payload = record_at(replay, pos, &rec);
+		size_t offset = pos;
+
+		if(rec.size > replay->size - pos - CAPTURE_RECORD_HEADER_SIZE){
+			LOGW("HID capture is truncated, replaying the first %lu bytes", (unsigned long)pos);
+			break;
+		}
+
+		pos += CAPTURE_RECORD_HEADER_SIZE + rec.size;
+
+		if(rec.type == CAPTURE_OPEN){
+			if(replay->num_streams == streams_alloc){
+				int new_alloc = streams_alloc ? streams_alloc * 2 : 8;
+				replay_stream* tmp = realloc(replay->streams, new_alloc * sizeof(replay_stream));
+				if(!tmp)
+					break;
+				replay->streams = tmp;
+				streams_alloc = new_alloc;
+			}
+
+			replay_stream* stream = &replay->streams[replay->num_streams];
+			memset(stream, 0, sizeof(replay_stream));
+
+			if(!capture_read_device(payload, rec.size, &stream->desc)){
+				LOGW("malformed device in HID capture at offset %lu", (unsigned long)offset);
+				continue;
+			}
+
+			interfaces[rec.interface] = replay->num_streams++;
+			continue;
+		}
+
+		int idx = interfaces[rec.interface];
+		if(idx < 0)
+			continue;
+
+		replay_stream* stream = &replay->streams[idx];
+		bool ok = true;
+
+		switch(rec.type){
+		case CAPTURE_CLOSE:
+			interfaces[rec.interface] = -1;
+			break;
+
+		case CAPTURE_INPUT:
+			ok = push_offset(&stream->inputs, &stream->num_inputs, &stream->inputs_alloc, offset);
+			if(!have_input || rec.timestamp < replay->first_input)
+				replay->first_input = rec.timestamp;
+			have_input = true;
+			break;
+
+		case CAPTURE_OUTPUT:
+		case CAPTURE_GET_FEATURE:
+		case CAPTURE_SEND_FEATURE:
+			if(rec.size > 0)
+				ok = push_offset(&stream->control, &stream->num_control, &stream->control_alloc, offset);
+			break;
+		}
+
+		if(!ok){
+			LOGE("could not allocate the HID capture index");
+			break;
+		}
+	}
+
+	free(interfaces);
+
+	return replay->num_streams > 0;
+}
+
+// UTF-8 from the capture to the wide strings hidapi returns
+static void copy_to_wstr(wchar_t* dst, size_t maxlen, const char* src)
+{
+	const unsigned char* s = (const unsigned char*)src;
+	size_t len = 0;
+
+	if(maxlen == 0)
+		return;
+
+	while(*s && len + 1 < maxlen){
+		uint32_t c = *s++;
+		int extra = c >= 0xf0 ? 3 : c >= 0xe0 ? 2 : c >= 0xc0 ? 1 : 0;
+
+		if(extra)
+			c &= 0x3f >> extra;
+
+		for(; extra > 0 && (*s & 0xc0) == 0x80; extra--)
+			c = (c << 6) | (*s++ & 0x3f);
+
+		dst[len++] = (wchar_t)c;
+	}
+
+	dst[len] = 0;
+}
+
+static char* dup_str(const char* src)
+{
+	size_t size = strlen(src) + 1;
+	char* dst = malloc(size);
+	if(dst)
+		memcpy(dst, src, size);
+	return dst;
+}
+
+static wchar_t* dup_wstr(const char* src)
+{
+	size_t maxlen = strlen(src) + 1;
+	wchar_t* dst = malloc(maxlen * sizeof(wchar_t));
+	if(dst)
+		copy_to_wstr(dst, maxlen, src);
+	return dst;
+}
+
+static ohmd_hid_device_info* replay_enumerate(ohmd_hid_transport* transport, unsigned short vendor_id, unsigned short product_id)
+{
+	ohmd_hid_replay* replay = (ohmd_hid_replay*)transport;
+	ohmd_hid_device_info* head = NULL;
+	ohmd_hid_device_info** tail = &head;
+
+	for(int i = 0; i < replay->num_streams; i++){
+		const capture_device* desc = &replay->streams[i].desc;
+		bool listed = false;
+
+		if((vendor_id && desc->vendor_id != vendor_id) || (product_id && desc->product_id != product_id))
+			continue;
+
+		// devices opened more than once show up once
+		for(ohmd_hid_device_info* cur = head; cur; cur = cur->next){
+			if(strcmp(cur->path, desc->path) == 0){
+				listed = true;
+				break;
+			}
+		}
+
+		if(listed)
+			continue;
+
+		ohmd_hid_device_info* info = calloc(1, sizeof(ohmd_hid_device_info));
+		if(!info)
+			break;
+
+		info->path = dup_str(desc->path);
+		info->vendor_id = desc->vendor_id;
+		info->product_id = desc->product_id;
+		info->serial_number = dup_wstr(desc->serial_number);
+		info->release_number = desc->release_number;
+		info->manufacturer_string = dup_wstr(desc->manufacturer);
+		info->product_string = dup_wstr(desc->product);
+		info->usage_page = desc->usage_page;
+		info->usage = desc->usage;
+		info->interface_number = desc->interface_number;
+
+		*tail = info;
+		tail = &info->next;
+	}
+
+	return head;
+}
+
+static void replay_free_enumeration(ohmd_hid_transport* transport, ohmd_hid_device_info* devs)
+{
+	while(devs){
+		ohmd_hid_device_info* next = devs->next;
+		free(devs->path);
+		free(devs->serial_number);
+		free(devs->manufacturer_string);
+		free(devs->product_string);
+		free(devs);
+		devs = next;
+	}
+}
+
+static ohmd_hid_device* replay_open_path(ohmd_hid_transport* transport, const char* path)
+{
+	ohmd_hid_replay* replay = (ohmd_hid_replay*)transport;
+	replay_stream* stream = NULL;
+
+	ohmd_lock_mutex(replay->lock);
+
+	// the next recorded open of the path, or the last one again once all were used
+	for(int i = 0; i < replay->num_streams; i++){
+		if(strcmp(replay->streams[i].desc.path, path) != 0)
+			continue;
+
+		stream = &replay->streams[i];
+		if(!stream->claimed)
+			break;
+	}
+
+	if(!stream){
+		ohmd_unlock_mutex(replay->lock);
+		return NULL;
+	}
+
+	replay_device* dev = ohmd_alloc(replay->ctx, sizeof(replay_device));
+	if(!dev){
+		ohmd_unlock_mutex(replay->lock);
+		return NULL;
+	}
+
+	stream->claimed = true;
+
+	dev->base.transport = transport;
+	dev->replay = replay;
+	dev->stream = stream;
+	dev->error = L"";
+	dev->next = replay->devices;
+	replay->devices = dev;
+
+	ohmd_unlock_mutex(replay->lock);
+
+	return &dev->base;
+}
+
+static void replay_close(ohmd_hid_device* base)
+{
+	replay_device* dev = (replay_device*)base;
+	ohmd_hid_replay* replay = dev->replay;
+
+	ohmd_lock_mutex(replay->lock);
+
+	for(replay_device** it = &replay->devices; *it; it = &(*it)->next){
+		if(*it == dev){
+			*it = dev->next;
+			break;
+		}
+	}
+
+	ohmd_unlock_mutex(replay->lock);
+
+	free(dev);
+}
+
+static int replay_set_nonblocking(ohmd_hid_device* base, int nonblock)
+{
+	((replay_device*)base)->nonblocking = nonblock != 0;
+	return 0;
+}
+
+// nanoseconds until a recorded input report is due, paced replay only
+static int64_t time_until(ohmd_hid_replay* replay, uint64_t timestamp)
+{
+	uint64_t now = ohmd_monotonic_ns();
+
+	if(!replay->started){
+		ohmd_lock_mutex(replay->lock);
+		if(!replay->started){
+			replay->start_ns = now;
+			replay->started = true;
+		}
+		ohmd_unlock_mutex(replay->lock);
+	}
+
+	return (int64_t)(replay->start_ns + (timestamp - replay->first_input)) - (int64_t)now;
+}
+
+static int replay_read_timeout(ohmd_hid_device* base, unsigned char* data, size_t length, int milliseconds)
+{
+	replay_device* dev = (replay_device*)base;
+	ohmd_hid_replay* replay = dev->replay;
+	replay_stream* stream = dev->stream;
+	bool paced = replay->mode == OHMD_REPLAY_PACED;
+
+	if(dev->next_input >= stream->num_inputs){
+		// the device went quiet, a blocking read would never return
+		if(milliseconds < 0){
+			dev->error = L"end of the capture";
+			return -1;
+		}
+		if(paced && milliseconds > 0)
+			ohmd_sleep(milliseconds / 1000.0);
+		return 0;
+	}
+
+	capture_record rec;
+	const unsigned char* payload = record_at(replay, stream->inputs[dev->next_input], &rec);
+
+	if(replay->mode == OHMD_REPLAY_STEPPED && dev->stepped){
+		// a blocking read waits for the application to step up to the report, as for a device that is still quiet
+		for(int waited_ms = 0; rec.timestamp > replay->released; waited_ms++){
+			if(milliseconds >= 0 && waited_ms >= milliseconds)
+				return 0;
+			ohmd_sleep(0.001);
+		}
+	}
+
+	if(paced){
+		int64_t wait_ns = time_until(replay, rec.timestamp);
+
+		if(wait_ns > 0){
+			if(milliseconds == 0)
+				return 0;
+
+			if(milliseconds > 0 && wait_ns > (int64_t)milliseconds * 1000000){
+				ohmd_sleep(milliseconds / 1000.0);
+				return 0;
+			}
+
+			ohmd_sleep(wait_ns / 1e9);
+		}
+	}
+
+	size_t size = OHMD_MIN((size_t)rec.size, length);
+	memcpy(data, payload, size);
+	dev->base.read_ns = rec.timestamp;
+	dev->next_input++;
+
+	return (int)size;
+}
+
+static int replay_read(ohmd_hid_device* base, unsigned char* data, size_t length)
+{
+	replay_device* dev = (replay_device*)base;
+	return replay_read_timeout(base, data, length, dev->nonblocking ? 0 : -1);
+}
+
+// the next recorded control transfer of a type for a report id, wrapping
+// around to the start of the stream
+static const unsigned char* find_control(replay_device* dev, capture_record_type type, unsigned char report_id, capture_record* rec)
+{
+	replay_stream* stream = dev->stream;
+
+	for(int n = 0; n < stream->num_control; n++){
+		int idx = (dev->next_control + n) % stream->num_control;
+		const unsigned char* payload = record_at(dev->replay, stream->control[idx], rec);
+
+		if(rec->type == type && payload[0] == report_id){
+			dev->next_control = idx + 1;
+			return payload;
+		}
+	}
+
+	return NULL;
+}
+
+static int replay_write(ohmd_hid_device* base, const unsigned char* data, size_t length)
+{
+	replay_device* dev = (replay_device*)base;
+	capture_record rec;
+
+	if(length > 0 && find_control(dev, CAPTURE_OUTPUT, data[0], &rec))
+		return rec.result;
+
+	return (int)length;
+}
+
+static int replay_get_feature_report(ohmd_hid_device* base, unsigned char* data, size_t length)
+{
+	replay_device* dev = (replay_device*)base;
+	capture_record rec;
+	const unsigned char* payload = find_control(dev, CAPTURE_GET_FEATURE, data[0], &rec);
+
+	if(!payload){
+		dev->error = L"feature report not in the capture";
+		return -1;
+	}
+
+	if(rec.result > 0)
+		memcpy(data, payload, OHMD_MIN((size_t)rec.size, length));
+
+	return rec.result;
+}
+
+static int replay_send_feature_report(ohmd_hid_device* base, const unsigned char* data, size_t length)
+{
+	replay_device* dev = (replay_device*)base;
+	capture_record rec;
+
+	if(length > 0 && find_control(dev, CAPTURE_SEND_FEATURE, data[0], &rec))
+		return rec.result;
+
+	return (int)length;
+}
+
+static int replay_get_manufacturer_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	copy_to_wstr(string, maxlen, ((replay_device*)base)->stream->desc.manufacturer);
+	return 0;
+}
+
+static int replay_get_product_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	copy_to_wstr(string, maxlen, ((replay_device*)base)->stream->desc.product);
+	return 0;
+}
+
+static int replay_get_serial_number_string(ohmd_hid_device* base, wchar_t* string, size_t maxlen)
+{
+	copy_to_wstr(string, maxlen, ((replay_device*)base)->stream->desc.serial_number);
+	return 0;
+}
+
+static int replay_get_indexed_string(ohmd_hid_device* base, int string_index, wchar_t* string, size_t maxlen)
+{
+	(void)base;
+	(void)string_index;
+	(void)string;
+	(void)maxlen;
+	return -1;
+}
+
+static const wchar_t* replay_error(ohmd_hid_device* base)
+{
+	return ((replay_device*)base)->error;
+}
+
+static const ohmd_hid_transport replay_transport = {
+	"replay",
+
+	replay_enumerate,
+	replay_free_enumeration,
+	replay_open_path,
+	NULL,
+
+	replay_close,
+	replay_set_nonblocking,
+	replay_read_timeout,
+	replay_read,
+	replay_write,
+	replay_get_feature_report,
+	replay_send_feature_report,
+
+	replay_get_manufacturer_string,
+	replay_get_product_string,
+	replay_get_serial_number_string,
+	replay_get_indexed_string,
+	replay_error,
+};
+
+static void free_replay(ohmd_hid_replay* replay)
+{
+	for(int i = 0; i < replay->num_streams; i++){
+		free(replay->streams[i].inputs);
+		free(replay->streams[i].control);
+	}
+
+	free(replay->streams);
+	ohmd_unmap_file(replay->data, replay->size);
+	ohmd_destroy_mutex(replay->lock);
+	free(replay);
+}
+
+int ohmd_hid_replay_start(ohmd_context* ctx, const char* filename, ohmd_replay_mode mode)
+{
+	if(ctx->hid_replay){
+		ohmd_set_error(ctx, "already replaying a HID capture");
+		return -1;
+	}
+
+	ohmd_hid_replay* replay = ohmd_alloc(ctx, sizeof(ohmd_hid_replay));
+	if(!replay)
+		return -1;
+
+	replay->base = replay_transport;
+	replay->ctx = ctx;
+	replay->lock = ohmd_create_mutex(ctx);
+	replay->mode = mode;
+	replay->data = ohmd_map_file(filename, &replay->size);
+
+	if(!replay->data || replay->size < CAPTURE_FILE_HEADER_SIZE ||
+	   memcmp(replay->data, CAPTURE_MAGIC, CAPTURE_MAGIC_SIZE) != 0 ||
+	   capture_get_u32(replay->data + CAPTURE_MAGIC_SIZE) != CAPTURE_VERSION){
+		ohmd_set_error(ctx, "%s is not a HID capture", filename);
+		free_replay(replay);
+		return -1;
+	}
+
+	if(!index_capture(replay)){
+		ohmd_set_error(ctx, "%s has no devices to replay", filename);
+		free_replay(replay);
+		return -1;
+	}
+
+	ctx->hid_replay = replay;
+	ctx->hid_transport = &replay->base;
+
+	LOGI("replaying %d HID devices from %s", replay->num_streams, filename);
+
+	return 0;
+}
+
+int ohmd_hid_replay_pending(ohmd_context* ctx)
+{
+	ohmd_hid_replay* replay = ctx->hid_replay;
+	int pending = 0;
+
+	if(!replay)
+		return -1;
+
+	ohmd_lock_mutex(replay->lock);
+
+	for(replay_device* dev = replay->devices; dev; dev = dev->next)
+		pending += dev->stream->num_inputs - dev->next_input;
+
+	ohmd_unlock_mutex(replay->lock);
+
+	return pending;
+}
+
+int64_t ohmd_hid_replay_step(ohmd_context* ctx)
+{
+	ohmd_hid_replay* replay = ctx->hid_replay;
+	bool pending = false;
+	uint64_t next = 0;
+
+	if(!replay || replay->mode != OHMD_REPLAY_STEPPED)
+		return -1;
+
+	ohmd_lock_mutex(replay->lock);
+
+	for(replay_device* dev = replay->devices; dev; dev = dev->next){
+		capture_record rec;
+
+		if(dev->next_input >= dev->stream->num_inputs)
+			continue;
+
+		record_at(replay, dev->stream->inputs[dev->next_input], &rec);
+		if(!pending || rec.timestamp < next)
+			next = rec.timestamp;
+		pending = true;
+	}
+
+	if(pending)
+		replay->released = next;
+
+	for(replay_device* dev = replay->devices; dev; dev = dev->next)
+		dev->stepped = true;
+
+	ohmd_unlock_mutex(replay->lock);
+
+	return pending ? (int64_t)next : -1;
+}
+
+void ohmd_hid_replay_destroy(ohmd_context* ctx)
+{
+	ohmd_hid_replay* replay = ctx->hid_replay;
+	if(!replay)
+		return;
+
+	// devices the drivers never closed still point into the mapping
+	if(replay->devices){
+		LOGW("HID devices still open while destroying the replay");
+		return;
+	}
+
+	if(ctx->hid_transport == &replay->base)
+		ctx->hid_transport = NULL;
+
+	free_replay(replay);
+	ctx->hid_replay = NULL;
+}
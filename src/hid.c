@@ -0,0 +1,155 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* HID Transport Dispatch */
+
+
+#include <string.h>
+#include "hid.h"
+
+ohmd_hid_transport* ohmd_hid_get_transport(ohmd_context* ctx)
+{
+	if(ctx->hid_recorder)
+		return ohmd_hid_recorder_transport(ctx);
+
+	return ohmd_hid_get_backend(ctx);
+}
+
+ohmd_hid_transport* ohmd_hid_get_backend(ohmd_context* ctx)
+{
+	if(ctx->hid_transport)
+		return ctx->hid_transport;
+
+#ifdef OHMD_HIDRAW
+	return &ohmd_hid_transport_hidraw;
+#else
+	return &ohmd_hid_transport_hidapi;
+#endif
+}
+
+ohmd_hid_device_info* ohmd_hid_enumerate(ohmd_context* ctx, unsigned short vendor_id, unsigned short product_id)
+{
+	ohmd_hid_transport* transport = ohmd_hid_get_transport(ctx);
+	return transport->enumerate(transport, vendor_id, product_id);
+}
+
+void ohmd_hid_free_enumeration(ohmd_context* ctx, ohmd_hid_device_info* devs)
+{
+	ohmd_hid_transport* transport = ohmd_hid_get_transport(ctx);
+	transport->free_enumeration(transport, devs);
+}
+
+ohmd_hid_device* ohmd_hid_open_path(ohmd_context* ctx, const char* path)
+{
+	ohmd_hid_transport* transport = ohmd_hid_get_transport(ctx);
+	return transport->open_path(transport, path);
+}
+
+void ohmd_hid_exit(ohmd_context* ctx)
+{
+	ohmd_hid_transport* transport = ohmd_hid_get_transport(ctx);
+	if(transport->exit)
+		transport->exit(transport);
+}
+
+void ohmd_hid_close(ohmd_hid_device* dev)
+{
+	if(dev)
+		dev->transport->close(dev);
+}
+
+int ohmd_hid_set_nonblocking(ohmd_hid_device* dev, int nonblock)
+{
+	return dev->transport->set_nonblocking(dev, nonblock);
+}
+
+int ohmd_hid_read_timeout(ohmd_hid_device* dev, unsigned char* data, size_t length, int milliseconds)
+{
+	return dev->transport->read_timeout(dev, data, length, milliseconds);
+}
+
+int ohmd_hid_read(ohmd_hid_device* dev, unsigned char* data, size_t length)
+{
+	return dev->transport->read(dev, data, length);
+}
+
+int ohmd_hid_write(ohmd_hid_device* dev, const unsigned char* data, size_t length)
+{
+	return dev->transport->write(dev, data, length);
+}
+
+int ohmd_hid_get_feature_report(ohmd_hid_device* dev, unsigned char* data, size_t length)
+{
+	return dev->transport->get_feature_report(dev, data, length);
+}
+
+int ohmd_hid_send_feature_report(ohmd_hid_device* dev, const unsigned char* data, size_t length)
+{
+	return dev->transport->send_feature_report(dev, data, length);
+}
+
+int ohmd_hid_get_manufacturer_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen)
+{
+	return dev->transport->get_manufacturer_string(dev, string, maxlen);
+}
+
+int ohmd_hid_get_product_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen)
+{
+	return dev->transport->get_product_string(dev, string, maxlen);
+}
+
+int ohmd_hid_get_serial_number_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen)
+{
+	return dev->transport->get_serial_number_string(dev, string, maxlen);
+}
+
+int ohmd_hid_get_indexed_string(ohmd_hid_device* dev, int string_index, wchar_t* string, size_t maxlen)
+{
+	return dev->transport->get_indexed_string(dev, string_index, string, maxlen);
+}
+
+const wchar_t* ohmd_hid_error(ohmd_hid_device* dev)
+{
+	return dev->transport->error(dev);
+}
+
+void ohmd_hid_copy_wstr(char* dst, size_t size, const wchar_t* src)
+{
+	size_t len = 0;
+
+	for(; src && *src; src++){
+		uint32_t c = (uint32_t)*src;
+		unsigned char out[4];
+		size_t n;
+
+		if(c < 0x80){
+			out[0] = c;
+			n = 1;
+		}else if(c < 0x800){
+			out[0] = 0xc0 | (c >> 6);
+			out[1] = 0x80 | (c & 0x3f);
+			n = 2;
+		}else if(c < 0x10000){
+			out[0] = 0xe0 | (c >> 12);
+			out[1] = 0x80 | ((c >> 6) & 0x3f);
+			out[2] = 0x80 | (c & 0x3f);
+			n = 3;
+		}else{
+			out[0] = 0xf0 | ((c >> 18) & 0x07);
+			out[1] = 0x80 | ((c >> 12) & 0x3f);
+			out[2] = 0x80 | ((c >> 6) & 0x3f);
+			out[3] = 0x80 | (c & 0x3f);
+			n = 4;
+		}
+
+		if(len + n >= size)
+			break;
+
+		memcpy(dst + len, out, n);
+		len += n;
+	}
+
+	dst[len] = 0;
+}
@@ -8,6 +8,115 @@
 #ifndef OPENHMD_HID_H
 #define OPENHMD_HID_H
 
+#include <stddef.h>
+#include <wchar.h>
+
+#include "openhmdi.h"
+
+/*
+ * Drivers talk to HID devices through a transport, a table of functions
+ * mirroring the hidapi calls they make. hidapi is the default transport
+ * (hidraw on Linux when built with OHMD_HIDRAW), another one can be set on
+ * the context (ohmd_context.hid_transport) to use a different backend or to
+ * observe and inject traffic without touching the drivers.
+ *
+ * The ohmd_hid_* functions take the same arguments and return the same values
+ * as their hidapi counterparts. Enumeration and opening pick the transport of
+ * the context, everything else goes to the transport the device was opened on.
+ */
+
+typedef struct ohmd_hid_transport ohmd_hid_transport;
+
+// Base of the transport specific device handles. Transports stamp every input
+// report they return with the host time it was read at (ohmd_monotonic_ns),
+// replayed reports keep the time they were recorded at.
+typedef struct {
+	ohmd_hid_transport* transport;
+	uint64_t read_ns;
+} ohmd_hid_device;
+
+typedef struct ohmd_hid_device_info {
+	char* path;
+	unsigned short vendor_id;
+	unsigned short product_id;
+	wchar_t* serial_number;
+	unsigned short release_number;
+	wchar_t* manufacturer_string;
+	wchar_t* product_string;
+	unsigned short usage_page;
+	unsigned short usage;
+	int interface_number;
+	struct ohmd_hid_device_info* next;
+} ohmd_hid_device_info;
+
+struct ohmd_hid_transport {
+	const char* name;
+
+	ohmd_hid_device_info* (*enumerate)(ohmd_hid_transport* transport, unsigned short vendor_id, unsigned short product_id);
+	void (*free_enumeration)(ohmd_hid_transport* transport, ohmd_hid_device_info* devs);
+	ohmd_hid_device* (*open_path)(ohmd_hid_transport* transport, const char* path);
+	void (*exit)(ohmd_hid_transport* transport);
+
+	void (*close)(ohmd_hid_device* dev);
+	int (*set_nonblocking)(ohmd_hid_device* dev, int nonblock);
+	int (*read_timeout)(ohmd_hid_device* dev, unsigned char* data, size_t length, int milliseconds);
+	int (*read)(ohmd_hid_device* dev, unsigned char* data, size_t length);
+	int (*write)(ohmd_hid_device* dev, const unsigned char* data, size_t length);
+	int (*get_feature_report)(ohmd_hid_device* dev, unsigned char* data, size_t length);
+	int (*send_feature_report)(ohmd_hid_device* dev, const unsigned char* data, size_t length);
+
+	int (*get_manufacturer_string)(ohmd_hid_device* dev, wchar_t* string, size_t maxlen);
+	int (*get_product_string)(ohmd_hid_device* dev, wchar_t* string, size_t maxlen);
+	int (*get_serial_number_string)(ohmd_hid_device* dev, wchar_t* string, size_t maxlen);
+	int (*get_indexed_string)(ohmd_hid_device* dev, int string_index, wchar_t* string, size_t maxlen);
+	const wchar_t* (*error)(ohmd_hid_device* dev);
+};
+
+extern ohmd_hid_transport ohmd_hid_transport_hidapi;
+extern ohmd_hid_transport ohmd_hid_transport_hidraw; // only built with OHMD_HIDRAW
+
+// The transport drivers use, the recorder while one exists, otherwise the backend.
+ohmd_hid_transport* ohmd_hid_get_transport(ohmd_context* ctx);
+// The transport talking to the devices, the build's default unless another one was set.
+ohmd_hid_transport* ohmd_hid_get_backend(ohmd_context* ctx);
+
+// Traffic recorder (hid-record.c), writes a capture file in the format of hid-capture.h.
+// Starting a recording while one is running switches to the new file.
+int ohmd_hid_record_start(ohmd_context* ctx, const char* filename);
+void ohmd_hid_record_stop(ohmd_context* ctx);
+void ohmd_hid_record_destroy(ohmd_context* ctx);
+ohmd_hid_transport* ohmd_hid_recorder_transport(ohmd_context* ctx);
+
+// Capture replay (hid-replay.c), becomes the backend of the context. Pending
+// counts the input reports the open devices haven't read yet, -1 if not replaying.
+// Step releases the next input reports of a stepped replay and returns their
+// capture timestamp, -1 once done.
+int ohmd_hid_replay_start(ohmd_context* ctx, const char* filename, ohmd_replay_mode mode);
+int ohmd_hid_replay_pending(ohmd_context* ctx);
+int64_t ohmd_hid_replay_step(ohmd_context* ctx);
+void ohmd_hid_replay_destroy(ohmd_context* ctx);
+
+ohmd_hid_device_info* ohmd_hid_enumerate(ohmd_context* ctx, unsigned short vendor_id, unsigned short product_id);
+void ohmd_hid_free_enumeration(ohmd_context* ctx, ohmd_hid_device_info* devs);
+ohmd_hid_device* ohmd_hid_open_path(ohmd_context* ctx, const char* path);
+void ohmd_hid_exit(ohmd_context* ctx);
+
+void ohmd_hid_close(ohmd_hid_device* dev);
+int ohmd_hid_set_nonblocking(ohmd_hid_device* dev, int nonblock);
+int ohmd_hid_read_timeout(ohmd_hid_device* dev, unsigned char* data, size_t length, int milliseconds);
+int ohmd_hid_read(ohmd_hid_device* dev, unsigned char* data, size_t length);
+int ohmd_hid_write(ohmd_hid_device* dev, const unsigned char* data, size_t length);
+int ohmd_hid_get_feature_report(ohmd_hid_device* dev, unsigned char* data, size_t length);
+int ohmd_hid_send_feature_report(ohmd_hid_device* dev, const unsigned char* data, size_t length);
+int ohmd_hid_get_manufacturer_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen);
+int ohmd_hid_get_product_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen);
+int ohmd_hid_get_serial_number_string(ohmd_hid_device* dev, wchar_t* string, size_t maxlen);
+int ohmd_hid_get_indexed_string(ohmd_hid_device* dev, int string_index, wchar_t* string, size_t maxlen);
+const wchar_t* ohmd_hid_error(ohmd_hid_device* dev);
+
+// Copies a string of the device info as UTF-8 into dst of size bytes, cut short if needed. NULL copies as empty.
+void ohmd_hid_copy_wstr(char* dst, size_t size, const wchar_t* src);
+
 static inline char* _hid_to_unix_path(char* path)
 {
 	char bus [5];
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* IMU Sample Ring Implementation */
+
+
+#include <string.h>
+#include "imu-ring.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#define ohmd_memory_barrier() MemoryBarrier()
+#else
+#define ohmd_memory_barrier() __sync_synchronize()
+#endif
+
+#define MASK (IMU_RING_SIZE - 1)
+
+// while the writer fills the slot of sample count, the one of count - IMU_RING_SIZE, this many before it are intact
+#define INTACT (IMU_RING_SIZE - 1)
+
+void oimu_ring_init(imu_ring* me)
+{
+	memset(me, 0, sizeof(imu_ring));
+}
+
+void oimu_ring_push(imu_ring* me, const ohmd_imu_sample* sample)
+{
+	uint32_t n = me->count;
+	me->entries[n & MASK] = *sample;
+
+	// the sample has to be complete before the reader can see it
+	ohmd_memory_barrier();
+	me->count = n + 1;
+}
+
+int oimu_ring_read(imu_ring* me, ohmd_imu_sample* out, int max)
+{
+	uint32_t count = me->count;
+	ohmd_memory_barrier();
+
+	uint32_t at = me->read_at;
+	if(count - at > INTACT)
+		at = count - INTACT;
+
+	uint32_t n = count - at;
+	if(max < 0)
+		max = 0;
+	if(n > (uint32_t)max)
+		n = (uint32_t)max;
+
+	for(uint32_t i = 0; i < n; i++)
+		out[i] = me->entries[(at + i) & MASK];
+
+	// the samples the writer has come around to since are dropped
+	ohmd_memory_barrier();
+	uint32_t now = me->count;
+	uint32_t lost = now - at > INTACT ? now - INTACT - at : 0;
+
+	if(lost >= n){
+		me->read_at = at + lost;
+		return 0;
+	}
+
+	if(lost)
+		memmove(out, out + lost, (n - lost) * sizeof(ohmd_imu_sample));
+
+	me->read_at = at + n;
+	return (int)(n - lost);
+}
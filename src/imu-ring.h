@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* IMU Sample Ring */
+
+/*
+ * The IMU samples of a device as the driver hands them to the sensor fusion,
+ * calibrated and stamped with host time, for applications that run their
+ * own filters (ohmd_device_read_imu_samples).
+ *
+ * A ring of IMU_RING_SIZE samples with a single writer, the thread fusing
+ * the device, and a single reader. Neither takes a lock and the writer never
+ * waits: a reader that falls behind by the size of the ring loses the oldest
+ * samples. The reader copies samples and then checks that the writer hasn't
+ * come around to them in the meantime, as in pose-history.h.
+ */
+
+#ifndef IMU_RING_H
+#define IMU_RING_H
+
+#include <stdint.h>
+
+#include "openhmd.h"
+
+#define IMU_RING_SIZE 1024 // must be a power of two, a second or more at the report rates of the drivers
+
+typedef struct {
+	ohmd_imu_sample entries[IMU_RING_SIZE];
+	volatile uint32_t count; // samples pushed, wraps around
+	uint32_t read_at;        // next sample of the reader, only touched by it
+} imu_ring;
+
+void oimu_ring_init(imu_ring* me);
+
+void oimu_ring_push(imu_ring* me, const ohmd_imu_sample* sample);
+
+// Copies up to max of the samples pushed since the last read, oldest first, and returns how many. Samples the writer
+// overwrote before they were read are skipped.
+int oimu_ring_read(imu_ring* me, ohmd_imu_sample* out, int max);
+
+#endif
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Fixed Point Math Implementation */
+
+#include "omath-fixed.h"
+
+#define PI_Q30 3373259426ll
+#define HALF_PI_Q30 1686629713ll
+#define TWO_PI_Q30 6746518852ll
+#define QUARTER_PI_Q30 843314857ll
+#define TAN_EIGHTH_PI_Q30 444750788ll
+
+// (a * b + c * d + ...) >> 30, rounded
+#define SUM_Q30(_s) ((int32_t)(((_s) + ((int64_t)1 << 29)) >> 30))
+
+uint32_t ofix_isqrt64(uint64_t x)
+{
+	if(x == 0)
+		return 0;
+
+	// the highest even bit at or below the top bit of x
+#if defined(__GNUC__)
+	uint64_t res = 0, bit = (uint64_t)1 << ((63 - __builtin_clzll(x)) & ~1);
+#else
+	uint64_t res = 0, bit = (uint64_t)1 << 62;
+	while(bit > x)
+		bit >>= 2;
+#endif
+
+	// without branches, which would be mispredicted half the time
+	while(bit){
+		uint64_t t = res + bit, take = (uint64_t)0 - (x >= t);
+		x -= t & take;
+		res = (res >> 1) + (bit & take);
+		bit >>= 2;
+	}
+
+	return (uint32_t)res;
+}
+
+void ofix_sincos(int64_t angle, int32_t* out_sin, int32_t* out_cos)
+{
+	// into [-pi, pi], then [-pi/2, pi/2] where the series converge quickly
+	int64_t a = angle % TWO_PI_Q30;
+	if(a > PI_Q30)
+		a -= TWO_PI_Q30;
+	else if(a < -PI_Q30)
+		a += TWO_PI_Q30;
+
+	int cos_sign = 1;
+	if(a > HALF_PI_Q30){
+		a = PI_Q30 - a;
+		cos_sign = -1;
+	}else if(a < -HALF_PI_Q30){
+		a = -PI_Q30 - a;
+		cos_sign = -1;
+	}
+
+	// Taylor series to x^13 and x^14 in Horner form, the error is below 1e-7 at pi/2
+	static const int32_t sin_div[] = { 156, 110, 72, 42, 20, 6 };
+	static const int32_t cos_div[] = { 182, 132, 90, 56, 30, 12, 2 };
+	// x² reaches 2.47, past int32 in Q30
+	int64_t x2 = (a * a + ((int64_t)1 << 29)) >> 30;
+	int64_t s = OFIX_ONE(30), c = OFIX_ONE(30);
+
+	for(int i = 0; i < 6; i++)
+		s = OFIX_ONE(30) - ((x2 * s + ((int64_t)1 << 29)) >> 30) / sin_div[i];
+	for(int i = 0; i < 7; i++)
+		c = OFIX_ONE(30) - ((x2 * c + ((int64_t)1 << 29)) >> 30) / cos_div[i];
+
+	*out_sin = (int32_t)((a * s + ((int64_t)1 << 29)) >> 30);
+	*out_cos = cos_sign * (int32_t)c;
+}
+
+// atan(t) in Q30 for t in [0, 1] in Q30
+static int64_t atan_unit(int64_t t)
+{
+	int64_t offset = 0;
+
+	// atan(t) = pi/4 + atan((t - 1) / (t + 1)), which is within +-tan(pi/8)
+	if(t > TAN_EIGHTH_PI_Q30){
+		t = (t - OFIX_ONE(30)) * OFIX_ONE(30) / (t + OFIX_ONE(30));
+		offset = QUARTER_PI_Q30;
+	}
+
+	// the series to t^19, the error is below 1e-9 at tan(pi/8)
+	int32_t u = (int32_t)t, u2 = ofix_mul(u, u, 30);
+	int32_t r = 0;
+
+	for(int k = 19; k >= 1; k -= 2)
+		r = OFIX_ONE(30) / k - ofix_mul(u2, r, 30);
+
+	return offset + ofix_mul(u, r, 30);
+}
+
+int32_t ofix_atan2(int32_t y, int32_t x)
+{
+	int64_t ax = x < 0 ? -(int64_t)x : x, ay = y < 0 ? -(int64_t)y : y;
+
+	if(ax == 0 && ay == 0)
+		return 0;
+
+	int64_t a = ay <= ax
+		? atan_unit(ay * OFIX_ONE(30) / ax)
+		: HALF_PI_Q30 - atan_unit(ax * OFIX_ONE(30) / ay);
+
+	if(x < 0)
+		a = PI_Q30 - a;
+	if(y < 0)
+		a = -a;
+
+	return (int32_t)((a + 1) >> 1);
+}
+
+int32_t ovec3x_get_length(const vec3x* me)
+{
+	return (int32_t)ofix_isqrt64((uint64_t)ovec3x_get_dot(me, me));
+}
+
+void ovec3x_normalize_me(vec3x* me)
+{
+	int32_t len = ovec3x_get_length(me);
+	if(len == 0)
+		return;
+
+	for(int i = 0; i < 3; i++)
+		me->arr[i] = (int32_t)((int64_t)me->arr[i] * OFIX_ONE(30) / len);
+}
+
+void ovec3x_from_vec3f(const vec3f* vec, int q, vec3x* out_vec)
+{
+	for(int i = 0; i < 3; i++)
+		out_vec->arr[i] = ofix_from_float(vec->arr[i], q);
+}
+
+void oquatx_mult(const quatx* me, const quatx* q, quatx* out_q)
+{
+	int64_t mx = me->x, my = me->y, mz = me->z, mw = me->w;
+
+	out_q->x = SUM_Q30(mw * q->x + mx * q->w + my * q->z - mz * q->y);
+	out_q->y = SUM_Q30(mw * q->y - mx * q->z + my * q->w + mz * q->x);
+	out_q->z = SUM_Q30(mw * q->z + mx * q->y - my * q->x + mz * q->w);
+	out_q->w = SUM_Q30(mw * q->w - mx * q->x - my * q->y - mz * q->z);
+}
+
+void oquatx_mult_me(quatx* me, const quatx* q)
+{
+	quatx tmp = *me;
+	oquatx_mult(&tmp, q, me);
+}
+
+void oquatx_normalize_me(quatx* me)
+{
+	uint64_t sq = 0;
+	for(int i = 0; i < 4; i++)
+		sq += (uint64_t)((int64_t)me->arr[i] * me->arr[i]);
+
+	int64_t len = ofix_isqrt64(sq);
+	if(len == 0)
+		return;
+
+	for(int i = 0; i < 4; i++)
+		me->arr[i] = (int32_t)((int64_t)me->arr[i] * OFIX_ONE(30) / len);
+}
+
+void oquatx_get_rotated(const quatx* me, const vec3x* vec, vec3x* out_vec)
+{
+	int64_t x = me->x, y = me->y, z = me->z, w = me->w;
+
+	// q v q*, as oquatf_get_rotated
+	quatx t = {{
+		SUM_Q30(vec->x * w + vec->z * y - vec->y * z),
+		SUM_Q30(vec->y * w + vec->x * z - vec->z * x),
+		SUM_Q30(vec->z * w + vec->y * x - vec->x * y),
+		SUM_Q30(vec->x * x + vec->y * y + vec->z * z)
+	}};
+
+	out_vec->x = SUM_Q30(w * t.x + x * t.w + y * t.z - z * t.y);
+	out_vec->y = SUM_Q30(w * t.y + y * t.w + z * t.x - x * t.z);
+	out_vec->z = SUM_Q30(w * t.z + z * t.w + x * t.y - y * t.x);
+}
+
+void oquatx_to_quatf(const quatx* me, quatf* out_q)
+{
+	for(int i = 0; i < 4; i++)
+		out_q->arr[i] = ofix_to_float(me->arr[i], 30);
+}
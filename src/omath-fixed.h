@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Fixed Point Math */
+
+/*
+ * Q format versions of the math the sensor fusion needs, for targets without
+ * a fast FPU. Values are int32_t with a fixed number of fraction bits, and
+ * products are taken in 64 bits. The formats used:
+ *
+ *   Q16  sensor readings, m/s² and rad/s, within ±2^14 so squares sum in 64 bits
+ *   Q29  angles in radians
+ *   Q30  quaternion components, unit vectors, sines and cosines
+ *   Q32  time steps in seconds, unsigned
+ *
+ * Functions that take vectors work on any format, the result is in the format
+ * of the input unless noted otherwise.
+ */
+
+#ifndef OMATH_FIXED_H
+#define OMATH_FIXED_H
+
+#include <stdint.h>
+
+#include "omath.h"
+
+#define OFIX_ONE(_q) ((int32_t)1 << (_q))
+// a constant, converted at compile time
+#define OFIX_CONST(_f, _q) ((int32_t)((_f) * (double)((int64_t)1 << (_q)) + ((_f) >= 0 ? 0.5 : -0.5)))
+
+typedef union {
+	struct {
+		int32_t x, y, z;
+	};
+	int32_t arr[3];
+} vec3x;
+
+typedef union {
+	struct {
+		int32_t x, y, z, w;
+	};
+	int32_t arr[4];
+} quatx;
+
+// a * b shifted right by shift bits, rounded to nearest
+static inline int32_t ofix_mul(int32_t a, int32_t b, int shift)
+{
+	return (int32_t)(((int64_t)a * b + ((int64_t)1 << (shift - 1))) >> shift);
+}
+
+// f in format q, saturated to ±2^30
+static inline int32_t ofix_from_float(float f, int q)
+{
+	float v = f * (float)((int64_t)1 << q);
+
+	if(!(v > -1073741823.0f))
+		return v != v ? 0 : -1073741823;
+	if(v > 1073741823.0f)
+		return 1073741823;
+
+	return (int32_t)(v < 0.0f ? v - 0.5f : v + 0.5f);
+}
+
+static inline float ofix_to_float(int32_t v, int q)
+{
+	return (float)v * (1.0f / (float)((int64_t)1 << q));
+}
+
+// floor(sqrt(x))
+uint32_t ofix_isqrt64(uint64_t x);
+// sine and cosine in Q30 of an angle in Q30, of any size
+void ofix_sincos(int64_t angle, int32_t* out_sin, int32_t* out_cos);
+// angle of (x, y) in Q29, y and x in the same format
+int32_t ofix_atan2(int32_t y, int32_t x);
+
+static inline int64_t ovec3x_get_dot(const vec3x* me, const vec3x* vec)
+{
+	return (int64_t)me->x * vec->x + (int64_t)me->y * vec->y + (int64_t)me->z * vec->z;
+}
+
+int32_t ovec3x_get_length(const vec3x* me);
+// scales me to unit length in Q30, leaves a zero vector alone
+void ovec3x_normalize_me(vec3x* me);
+void ovec3x_from_vec3f(const vec3f* vec, int q, vec3x* out_vec);
+
+// Q30 quaternions
+void oquatx_mult(const quatx* me, const quatx* q, quatx* out_q);
+void oquatx_mult_me(quatx* me, const quatx* q);
+void oquatx_normalize_me(quatx* me);
+void oquatx_get_rotated(const quatx* me, const vec3x* vec, vec3x* out_vec);
+void oquatx_to_quatf(const quatx* me, quatf* out_q);
+
+#endif
@@ -9,37 +9,13 @@
 
 
 #include <string.h>
+
+// emit the out of line definitions of the inline functions from omath.h
+#define OMATH_EXTERN
 #include "openhmdi.h"
 
 // vector
 
-float ovec3f_get_length(const vec3f* me)
-{
-	return sqrtf(POW2(me->x) + POW2(me->y) + POW2(me->z));
-}
-
-void ovec3f_normalize_me(vec3f* me)
-{
-	if(me->x == 0 && me->y == 0 && me->z == 0)
-		return;
-
-	float len = ovec3f_get_length(me);
-	me->x /= len;
-	me->y /= len;
-	me->z /= len;
-}
-
-void ovec3f_subtract(const vec3f* a, const vec3f* b, vec3f* out)
-{
-	for(int i = 0; i < 3; i++)
-		out->arr[i] = a->arr[i] - b->arr[i];
-}
-
-float ovec3f_get_dot(const vec3f* me, const vec3f* vec)
-{
-	return me->x * vec->x + me->y * vec->y + me->z * vec->z;
-}
-
 float ovec3f_get_angle(const vec3f* me, const vec3f* vec)
 {
 	float dot = ovec3f_get_dot(me, vec);
@@ -65,63 +41,6 @@ void oquatf_init_axis(quatf* me, const vec3f* vec, float angle)
 	me->w = cosf(angle / 2.0f);
 }
 
-void oquatf_get_rotated(const quatf* me, const vec3f* vec, vec3f* out_vec)
-{
-	quatf q = {{vec->x * me->w + vec->z * me->y - vec->y * me->z,
-	            vec->y * me->w + vec->x * me->z - vec->z * me->x,
-	            vec->z * me->w + vec->y * me->x - vec->x * me->y,
-	            vec->x * me->x + vec->y * me->y + vec->z * me->z}};
-
-	out_vec->x = me->w * q.x + me->x * q.w + me->y * q.z - me->z * q.y;
-	out_vec->y = me->w * q.y + me->y * q.w + me->z * q.x - me->x * q.z;
-	out_vec->z = me->w * q.z + me->z * q.w + me->x * q.y - me->y * q.x;
-}
-
-void oquatf_mult(const quatf* me, const quatf* q, quatf* out_q)
-{
-	out_q->x = me->w * q->x + me->x * q->w + me->y * q->z - me->z * q->y;
-	out_q->y = me->w * q->y - me->x * q->z + me->y * q->w + me->z * q->x;
-	out_q->z = me->w * q->z + me->x * q->y - me->y * q->x + me->z * q->w;
-	out_q->w = me->w * q->w - me->x * q->x - me->y * q->y - me->z * q->z;
-}
-
-void oquatf_mult_me(quatf* me, const quatf* q)
-{
-	quatf tmp = *me;
-	oquatf_mult(&tmp, q, me);
-}
-
-void oquatf_normalize_me(quatf* me)
-{
-	float len = oquatf_get_length(me);
-	me->x /= len;
-	me->y /= len;
-	me->z /= len;
-	me->w /= len;
-}
-
-float oquatf_get_length(const quatf* me)
-{
-	return sqrtf(me->x * me->x + me->y * me->y + me->z * me->z + me->w * me->w);
-}
-
-float oquatf_get_dot(const quatf* me, const quatf* q)
-{
-	return me->x * q->x + me->y * q->y + me->z * q->z + me->w * q->w;
-}
-
-void oquatf_inverse(quatf* me)
-{
-	float dot = oquatf_get_dot(me, me);
-
-	// conjugate
-	for(int i = 0; i < 3; i++)
-		me->arr[i] = -me->arr[i];
-	
-	for(int i = 0; i < 4; i++)
-		me->arr[i] /= dot;
-}
-
 void oquatf_diff(const quatf* me, const quatf* q, quatf* out_q)
 {
 	quatf inv = *me;
@@ -134,12 +53,12 @@ void oquatf_slerp (float fT, const quatf* rkP, const quatf* rkQ, bool shortestPa
 	float fCos =  oquatf_get_dot(rkP, rkQ);
 	quatf rkT;
 
-	// Do we need to invert rotation?
+	// Do we need to invert rotation? -q is the same rotation as q the other way around
 	if (fCos < 0.0f && shortestPath)
 	{
 		fCos = -fCos;
-		rkT = *rkQ;
-		oquatf_inverse(&rkT);
+		for (int i = 0; i < 4; i++)
+			rkT.arr[i] = -rkQ->arr[i];
 	}
 	else
 	{
@@ -334,6 +253,25 @@ void omat4x4f_init_translate(mat4x4f* me, float x, float y, float z)
 
 void omat4x4f_transpose(const mat4x4f* m, mat4x4f* o)
 {
+#if OMATH_SSE2
+	__m128 r0 = _mm_loadu_ps(m->m[0]), r1 = _mm_loadu_ps(m->m[1]);
+	__m128 r2 = _mm_loadu_ps(m->m[2]), r3 = _mm_loadu_ps(m->m[3]);
+
+	_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+	_mm_storeu_ps(o->m[0], r0);
+	_mm_storeu_ps(o->m[1], r1);
+	_mm_storeu_ps(o->m[2], r2);
+	_mm_storeu_ps(o->m[3], r3);
+#elif OMATH_NEON
+	// de-interleaving every fourth element yields the columns
+	float32x4x4_t c = vld4q_f32(m->arr);
+
+	vst1q_f32(o->m[0], c.val[0]);
+	vst1q_f32(o->m[1], c.val[1]);
+	vst1q_f32(o->m[2], c.val[2]);
+	vst1q_f32(o->m[3], c.val[3]);
+#else
 	o->m[0][0] = m->m[0][0];
 	o->m[1][0] = m->m[0][1];
 	o->m[2][0] = m->m[0][2];
@@ -353,10 +291,50 @@ void omat4x4f_transpose(const mat4x4f* m, mat4x4f* o)
 	o->m[1][3] = m->m[3][1];
 	o->m[2][3] = m->m[3][2];
 	o->m[3][3] = m->m[3][3];
+#endif
 }
 
 void omat4x4f_mult(const mat4x4f* l, const mat4x4f* r, mat4x4f *o)
 {
+	// every row of the product is the rows of r weighed by a row of l
+#if OMATH_AVX
+	// two rows of the product at a time
+	__m256 r0 = _mm256_broadcast_ps((const __m128*)r->m[0]), r1 = _mm256_broadcast_ps((const __m128*)r->m[1]);
+	__m256 r2 = _mm256_broadcast_ps((const __m128*)r->m[2]), r3 = _mm256_broadcast_ps((const __m128*)r->m[3]);
+
+	for(int i = 0; i < 4; i += 2){
+		__m256 a = _mm256_loadu_ps(l->m[i]);
+		__m256 sum = _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_permute_ps(a, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+		_mm256_storeu_ps(o->m[i], sum);
+	}
+#elif OMATH_SSE2
+	__m128 r0 = _mm_loadu_ps(r->m[0]), r1 = _mm_loadu_ps(r->m[1]);
+	__m128 r2 = _mm_loadu_ps(r->m[2]), r3 = _mm_loadu_ps(r->m[3]);
+
+	for(int i = 0; i < 4; i++){
+		__m128 a = _mm_loadu_ps(l->m[i]);
+		__m128 sum = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), r0);
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), r1));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), r2));
+		sum = _mm_add_ps(sum, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), r3));
+		_mm_storeu_ps(o->m[i], sum);
+	}
+#elif OMATH_NEON
+	float32x4_t r0 = vld1q_f32(r->m[0]), r1 = vld1q_f32(r->m[1]);
+	float32x4_t r2 = vld1q_f32(r->m[2]), r3 = vld1q_f32(r->m[3]);
+
+	for(int i = 0; i < 4; i++){
+		float32x4_t a = vld1q_f32(l->m[i]);
+		float32x4_t sum = vmulq_laneq_f32(r0, a, 0);
+		sum = vaddq_f32(sum, vmulq_laneq_f32(r1, a, 1));
+		sum = vaddq_f32(sum, vmulq_laneq_f32(r2, a, 2));
+		sum = vaddq_f32(sum, vmulq_laneq_f32(r3, a, 3));
+		vst1q_f32(o->m[i], sum);
+	}
+#else
 	for(int i = 0; i < 4; i++){
 		float a0 = l->m[i][0], a1 = l->m[i][1], a2 = l->m[i][2], a3 = l->m[i][3];
 		o->m[i][0] = a0 * r->m[0][0] + a1 * r->m[1][0] + a2 * r->m[2][0] + a3 * r->m[3][0];
@@ -364,33 +342,16 @@ void omat4x4f_mult(const mat4x4f* l, const mat4x4f* r, mat4x4f *o)
 		o->m[i][2] = a0 * r->m[0][2] + a1 * r->m[1][2] + a2 * r->m[2][2] + a3 * r->m[3][2];
 		o->m[i][3] = a0 * r->m[0][3] + a1 * r->m[1][3] + a2 * r->m[2][3] + a3 * r->m[3][3];
 	}
+#endif
 }
 
 
 // filter queue
 
-void ofq_init(filter_queue* me, int size)
+void ofq_init(filter_queue* me, vec3f* elems, int size)
 {
 	memset(me, 0, sizeof(filter_queue));
+	memset(elems, 0, sizeof(vec3f) * size);
 	me->size = size;
-}
-
-void ofq_add(filter_queue* me, const vec3f* vec)
-{
-	me->elems[me->at] = *vec;
-	me->at = ((me->at + 1) % me->size);
-}
-
-void ofq_get_mean(const filter_queue* me, vec3f* vec)
-{
-	vec->x = vec->y = vec->z = 0;
-	for(int i = 0; i < me->size; i++){
-		vec->x += me->elems[i].x;
-		vec->y += me->elems[i].y;
-		vec->z += me->elems[i].z;
-	}
-
-	vec->x /= (float)me->size;
-	vec->y /= (float)me->size;
-	vec->z /= (float)me->size;
+	me->elems = elems;
 }
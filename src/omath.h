@@ -12,6 +12,23 @@
 #define OMATH_H
 
 #include <math.h>
+#include <stdbool.h>
+
+// The hot kernels have SSE2 and NEON versions, picked at compile time. SSE2 is part of every
+// x86-64 target and NEON of every AArch64 one, so no runtime dispatch is needed; the 4x4
+// matrix product also has an AVX version for builds that target it (-mavx).
+// Define OMATH_NO_SIMD to build the scalar versions, e.g. to compare them in the benchmarks.
+#if !defined(OMATH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define OMATH_SSE2 1
+#include <emmintrin.h>
+#if defined(__AVX__)
+#define OMATH_AVX 1
+#include <immintrin.h>
+#endif
+#elif !defined(OMATH_NO_SIMD) && (defined(__aarch64__) || defined(_M_ARM64))
+#define OMATH_NEON 1
+#include <arm_neon.h>
+#endif
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -21,6 +38,15 @@
 #define RAD_TO_DEG(_r) ((_r) * 360.0f / (2.0f * (float)M_PI))
 #define DEG_TO_RAD(_d) ((_d) * (2.0f * (float)M_PI) / 360.0f)
 
+// The small functions called per sample by the fusion and the drivers are defined here so they
+// inline into their callers. omath.c defines OMATH_EXTERN to emit them once more with external
+// linkage, so the exported symbols stay.
+#ifdef OMATH_EXTERN
+#define OMATH_INLINE
+#else
+#define OMATH_INLINE static inline
+#endif
+
 
 // vector
 
@@ -31,11 +57,79 @@ typedef union {
 	float arr[3]; 
 } vec3f;
 
-void ovec3f_normalize_me(vec3f* me);
-float ovec3f_get_length(const vec3f* me);
-float ovec3f_get_angle(const vec3f* me, const vec3f* vec); 
-float ovec3f_get_dot(const vec3f* me, const vec3f* vec);
-void ovec3f_subtract(const vec3f* a, const vec3f* b, vec3f* out);
+float ovec3f_get_angle(const vec3f* me, const vec3f* vec);
+
+OMATH_INLINE float ovec3f_get_length(const vec3f* me)
+{
+	return sqrtf(POW2(me->x) + POW2(me->y) + POW2(me->z));
+}
+
+OMATH_INLINE void ovec3f_normalize_me(vec3f* me)
+{
+	if(me->x == 0 && me->y == 0 && me->z == 0)
+		return;
+
+	float len = ovec3f_get_length(me);
+	me->x /= len;
+	me->y /= len;
+	me->z /= len;
+}
+
+OMATH_INLINE void ovec3f_subtract(const vec3f* a, const vec3f* b, vec3f* out)
+{
+	for(int i = 0; i < 3; i++)
+		out->arr[i] = a->arr[i] - b->arr[i];
+}
+
+OMATH_INLINE float ovec3f_get_dot(const vec3f* me, const vec3f* vec)
+{
+	return me->x * vec->x + me->y * vec->y + me->z * vec->z;
+}
+
+#if OMATH_SSE2
+// x, y, z from a vec3f without reading past it, w = 0. Through __m64, which may alias the floats unlike double.
+static inline __m128 load_vec3f(const vec3f* v)
+{
+	__m128 xy = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)v->arr);
+	return _mm_movelh_ps(xy, _mm_load_ss(v->arr + 2));
+}
+
+static inline void store_vec3f(vec3f* v, __m128 a)
+{
+	_mm_storel_pi((__m64*)v->arr, a);
+	_mm_store_ss(v->arr + 2, _mm_movehl_ps(a, a));
+}
+
+// the sum of all lanes, in all lanes
+static inline __m128 hsum_ps(__m128 a)
+{
+	a = _mm_add_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_add_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+// a x b for the x, y, z lanes
+static inline __m128 cross_ps(__m128 a, __m128 b)
+{
+	__m128 a_yzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 b_yzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 c = _mm_sub_ps(_mm_mul_ps(a, b_yzx), _mm_mul_ps(a_yzx, b));
+	return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+}
+#endif
+
+#if OMATH_NEON
+// y, z, x, x
+static inline float32x4_t yzx_f32(float32x4_t a)
+{
+	return vcopyq_laneq_f32(vextq_f32(a, a, 1), 2, a, 0);
+}
+
+// a x b for the x, y, z lanes
+static inline float32x4_t cross_f32(float32x4_t a, float32x4_t b)
+{
+	return yzx_f32(vmlsq_f32(vmulq_f32(a, yzx_f32(b)), yzx_f32(a), b));
+}
+#endif
 
 
 // quaternion
@@ -49,17 +143,159 @@ typedef union {
 
 void oquatf_init_axis(quatf* me, const vec3f* vec, float angle);
 
-void oquatf_get_rotated(const quatf* me, const vec3f* vec, vec3f* out_vec);
-void oquatf_mult_me(quatf* me, const quatf* q);
-void oquatf_mult(const quatf* me, const quatf* q, quatf* out_q);
 void oquatf_diff(const quatf* me, const quatf* q, quatf* out_q);
-void oquatf_normalize_me(quatf* me);
-float oquatf_get_length(const quatf* me);
-float oquatf_get_dot(const quatf* me, const quatf* q);
-void oquatf_inverse(quatf* me);
+
+// spherical linear interpolation from p (fT = 0) to q (fT = 1)
+void oquatf_slerp(float fT, const quatf* rkP, const quatf* rkQ, bool shortestPath, quatf* out_q);
 
 void oquatf_get_mat4x4(const quatf* me, const vec3f* point, float mat[4][4]);
 
+OMATH_INLINE float oquatf_get_length(const quatf* me)
+{
+	return sqrtf(me->x * me->x + me->y * me->y + me->z * me->z + me->w * me->w);
+}
+
+OMATH_INLINE float oquatf_get_dot(const quatf* me, const quatf* q)
+{
+	return me->x * q->x + me->y * q->y + me->z * q->z + me->w * q->w;
+}
+
+OMATH_INLINE void oquatf_normalize_me(quatf* me)
+{
+#if OMATH_SSE2
+	__m128 q = _mm_loadu_ps(me->arr);
+	__m128 sq = _mm_mul_ps(q, q);
+	sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+	sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 0, 3, 2)));
+
+	_mm_storeu_ps(me->arr, _mm_div_ps(q, _mm_sqrt_ps(sq)));
+#elif OMATH_NEON
+	float32x4_t q = vld1q_f32(me->arr);
+	float32x4_t len = vdupq_n_f32(sqrtf(vaddvq_f32(vmulq_f32(q, q))));
+
+	vst1q_f32(me->arr, vdivq_f32(q, len));
+#else
+	float len = oquatf_get_length(me);
+	me->x /= len;
+	me->y /= len;
+	me->z /= len;
+	me->w /= len;
+#endif
+}
+
+OMATH_INLINE void oquatf_get_rotated(const quatf* me, const vec3f* vec, vec3f* out_vec)
+{
+	// q v q* expanded, u the vector part of the quaternion, which doesn't need to be of unit length:
+	// (w² - u.u) v + 2 (u.v) u + 2 w (u x v)
+#if OMATH_SSE2
+	__m128 q = _mm_loadu_ps(me->arr);
+	__m128 v = load_vec3f(vec);
+	__m128 conj = _mm_xor_ps(q, _mm_castsi128_ps(_mm_set_epi32(0, 0x80000000, 0x80000000, 0x80000000)));
+	__m128 w = _mm_shuffle_ps(q, q, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m128 ww_uu = hsum_ps(_mm_mul_ps(q, conj));
+	__m128 uv = hsum_ps(_mm_mul_ps(q, v)); // v.w is 0
+
+	__m128 r = _mm_mul_ps(ww_uu, v);
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_add_ps(uv, uv), q));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_add_ps(w, w), cross_ps(q, v)));
+
+	store_vec3f(out_vec, r);
+#elif OMATH_NEON
+	float32x4_t q = vld1q_f32(me->arr);
+	float32x4_t v = vcombine_f32(vld1_f32(vec->arr), vld1_dup_f32(vec->arr + 2));
+	v = vsetq_lane_f32(0.0f, v, 3);
+	float32x4_t conj = vsetq_lane_f32(vgetq_lane_f32(q, 3), vnegq_f32(q), 3);
+
+	float ww_uu = vaddvq_f32(vmulq_f32(q, conj));
+	float uv = vaddvq_f32(vmulq_f32(q, v));
+	float w = vgetq_lane_f32(q, 3);
+
+	float32x4_t r = vmulq_n_f32(v, ww_uu);
+	r = vmlaq_n_f32(r, q, 2.0f * uv);
+	r = vmlaq_n_f32(r, cross_f32(q, v), 2.0f * w);
+
+	vst1_f32(out_vec->arr, vget_low_f32(r));
+	vst1q_lane_f32(out_vec->arr + 2, r, 2);
+#else
+	quatf q = {{vec->x * me->w + vec->z * me->y - vec->y * me->z,
+	            vec->y * me->w + vec->x * me->z - vec->z * me->x,
+	            vec->z * me->w + vec->y * me->x - vec->x * me->y,
+	            vec->x * me->x + vec->y * me->y + vec->z * me->z}};
+
+	out_vec->x = me->w * q.x + me->x * q.w + me->y * q.z - me->z * q.y;
+	out_vec->y = me->w * q.y + me->y * q.w + me->z * q.x - me->x * q.z;
+	out_vec->z = me->w * q.z + me->z * q.w + me->x * q.y - me->y * q.x;
+#endif
+}
+
+OMATH_INLINE void oquatf_mult(const quatf* me, const quatf* q, quatf* out_q)
+{
+	// the terms of each component of me, summed in the order of the scalar version:
+	// w q + x (q.w, -q.z, q.y, -q.x) + y (q.z, q.w, -q.x, -q.y) + z (-q.y, q.x, q.w, -q.z)
+#if OMATH_SSE2
+	__m128 a = _mm_loadu_ps(me->arr);
+	__m128 b = _mm_loadu_ps(q->arr);
+
+	__m128 b_wzyx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3));
+	__m128 b_zwxy = _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2));
+	__m128 b_yxwz = _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1));
+
+	const __m128 sign_x = _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0x80000000, 0));
+	const __m128 sign_y = _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0x80000000, 0, 0));
+	const __m128 sign_z = _mm_castsi128_ps(_mm_set_epi32(0x80000000, 0, 0, 0x80000000));
+
+	__m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 3, 3)), b);
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 0, 0)), _mm_xor_ps(b_wzyx, sign_x)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)), _mm_xor_ps(b_zwxy, sign_y)));
+	r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2)), _mm_xor_ps(b_yxwz, sign_z)));
+
+	_mm_storeu_ps(out_q->arr, r);
+#elif OMATH_NEON
+	float32x4_t a = vld1q_f32(me->arr);
+	float32x4_t b = vld1q_f32(q->arr);
+
+	float32x4_t b_zwxy = vextq_f32(b, b, 2);
+	float32x4_t b_wzyx = vrev64q_f32(b_zwxy);
+	float32x4_t b_yxwz = vrev64q_f32(b);
+
+	static const float sign_x[4] = { 1.0f, -1.0f, 1.0f, -1.0f };
+	static const float sign_y[4] = { 1.0f, 1.0f, -1.0f, -1.0f };
+	static const float sign_z[4] = { -1.0f, 1.0f, 1.0f, -1.0f };
+
+	float32x4_t r = vmulq_laneq_f32(b, a, 3);
+	r = vaddq_f32(r, vmulq_laneq_f32(vmulq_f32(b_wzyx, vld1q_f32(sign_x)), a, 0));
+	r = vaddq_f32(r, vmulq_laneq_f32(vmulq_f32(b_zwxy, vld1q_f32(sign_y)), a, 1));
+	r = vaddq_f32(r, vmulq_laneq_f32(vmulq_f32(b_yxwz, vld1q_f32(sign_z)), a, 2));
+
+	vst1q_f32(out_q->arr, r);
+#else
+	out_q->x = me->w * q->x + me->x * q->w + me->y * q->z - me->z * q->y;
+	out_q->y = me->w * q->y - me->x * q->z + me->y * q->w + me->z * q->x;
+	out_q->z = me->w * q->z + me->x * q->y - me->y * q->x + me->z * q->w;
+	out_q->w = me->w * q->w - me->x * q->x - me->y * q->y - me->z * q->z;
+#endif
+}
+
+OMATH_INLINE void oquatf_mult_me(quatf* me, const quatf* q)
+{
+	quatf tmp = *me;
+	oquatf_mult(&tmp, q, me);
+}
+
+OMATH_INLINE void oquatf_inverse(quatf* me)
+{
+	float dot = oquatf_get_dot(me, me);
+
+	// conjugate
+	for(int i = 0; i < 3; i++)
+		me->arr[i] = -me->arr[i];
+	
+	for(int i = 0; i < 4; i++)
+		me->arr[i] /= dot;
+}
+
+
 // matrix
 
 typedef union {
@@ -76,16 +312,43 @@ void omat4x4f_mult(const mat4x4f* left, const mat4x4f* right, mat4x4f* out_mat);
 void omat4x4f_transpose(const mat4x4f* me, mat4x4f* out_mat);
 
 
-// filter queue
-#define FILTER_QUEUE_MAX_SIZE 256
-
+// filter queue, a moving average over the last size elements
+// the elements are stored by the owner of the queue, the sum is kept running and
+// recomputed every time the queue wraps around so float errors don't build up
 typedef struct {
 	int at, size;
-	vec3f elems[FILTER_QUEUE_MAX_SIZE];
+	vec3f sum;
+	vec3f* elems;
 } filter_queue;
 
-void ofq_init(filter_queue* me, int size);
-void ofq_add(filter_queue* me, const vec3f* vec);
-void ofq_get_mean(const filter_queue* me, vec3f* vec);
+void ofq_init(filter_queue* me, vec3f* elems, int size);
+
+OMATH_INLINE void ofq_add(filter_queue* me, const vec3f* vec)
+{
+	vec3f* elem = me->elems + me->at;
+
+	me->sum.x += vec->x - elem->x;
+	me->sum.y += vec->y - elem->y;
+	me->sum.z += vec->z - elem->z;
+	*elem = *vec;
+
+	if(++me->at == me->size){
+		me->at = 0;
+
+		me->sum.x = me->sum.y = me->sum.z = 0;
+		for(int i = 0; i < me->size; i++){
+			me->sum.x += me->elems[i].x;
+			me->sum.y += me->elems[i].y;
+			me->sum.z += me->elems[i].z;
+		}
+	}
+}
+
+OMATH_INLINE void ofq_get_mean(const filter_queue* me, vec3f* vec)
+{
+	vec->x = me->sum.x / (float)me->size;
+	vec->y = me->sum.y / (float)me->size;
+	vec->z = me->sum.z / (float)me->size;
+}
 
 #endif
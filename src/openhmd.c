@@ -10,6 +10,9 @@
 
 #include "openhmdi.h"
 #include "shaders.h"
+#if OHMD_HAVE_HID
+#include "hid.h"
+#endif
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -25,7 +28,7 @@ OHMD_APIENTRYDLL ohmd_context* OHMD_APIENTRY ohmd_ctx_create(void)
 		return NULL;
 	}
 
-	ohmd_monotonic_init(ctx);
+	ohmd_trace_env_start();
 
 #if DRIVER_OCULUS_RIFT
 	ctx->drivers[ctx->num_drivers++] = ohmd_create_oculus_rift_drv(ctx);
@@ -75,6 +78,16 @@ OHMD_APIENTRYDLL ohmd_context* OHMD_APIENTRY ohmd_ctx_create(void)
 
 	ctx->update_request_quit = false;
 
+#if OHMD_HAVE_HID
+	const char* record_file = getenv("OHMD_HID_RECORD");
+	if(record_file && record_file[0])
+		ohmd_hid_record_start(ctx, record_file);
+
+	const char* replay_file = getenv("OHMD_HID_REPLAY");
+	if(replay_file && replay_file[0])
+		ohmd_hid_replay_start(ctx, replay_file, OHMD_REPLAY_PACED);
+#endif
+
 	return ctx;
 }
 
@@ -95,19 +108,71 @@ OHMD_APIENTRYDLL void OHMD_APIENTRY ohmd_ctx_destroy(ohmd_context* ctx)
 		ohmd_destroy_mutex(ctx->update_mutex);
 	}
 
+#if OHMD_HAVE_HID
+	ohmd_hid_record_destroy(ctx);
+	ohmd_hid_replay_destroy(ctx);
+#endif
+
 	free(ctx);
+
+	ohmd_trace_env_finish();
+}
+
+// Takes what pose predictions need along with the pose, position is new and last_position what it was before
+static void update_prediction_state(ohmd_device* dev, const vec3f* last_position)
+{
+	fusion* f = dev->sensor_fusion;
+
+	dev->pose_ns = f->sample_ns;
+	ofusion_get_ang_vel(f, &dev->ang_vel);
+
+	// linear motion only for devices that report positions, the velocity from the step
+	// to the latest one, which goes stale when the position holds for long
+	bool moved = memcmp(last_position, &dev->position, sizeof(vec3f)) != 0;
+
+	if(moved && f->sample_ns > dev->position_ns){
+		if(dev->position_ns != 0){
+			float dt = (f->sample_ns - dev->position_ns) / 1000000000.0f;
+			for(int i = 0; i < 3; i++)
+				dev->velocity.arr[i] = (dev->position.arr[i] - last_position->arr[i]) / dt;
+		}
+		dev->position_ns = f->sample_ns;
+	}else if(f->sample_ns > dev->position_ns + 100000000){
+		dev->velocity = (vec3f){{0, 0, 0}};
+	}
+
+	if(dev->position_ns != 0)
+		ofusion_get_linear_accel(f, &dev->linear_accel);
+}
+
+// The frame of the world of the driver relative to that of the fusion, for the poses of the history. Drivers
+// return the orientation of the fusion as is or turned in the world frame.
+static void update_history_frame(ohmd_device* dev)
+{
+	quatf inv_orient = dev->sensor_fusion->orient;
+	oquatf_inverse(&inv_orient);
+	oquatf_mult(&dev->rotation, &inv_orient, &dev->history->frame);
+	oquatf_normalize_me(&dev->history->frame);
 }
 
 OHMD_APIENTRYDLL void OHMD_APIENTRY ohmd_ctx_update(ohmd_context* ctx)
 {
 	for(int i = 0; i < ctx->num_active_devices; i++){
 		ohmd_device* dev = ctx->active_devices[i];
-		if(!dev->settings.automatic_update && dev->update)
+		if(!dev->settings.automatic_update && dev->update){
+			OHMD_TRACE_BEGIN("update_device");
 			dev->update(dev);
+			OHMD_TRACE_END();
+		}
 
 		ohmd_lock_mutex(ctx->update_mutex);
+		vec3f last_position = dev->position;
 		dev->getf(dev, OHMD_POSITION_VECTOR, (float*)&dev->position);
 		dev->getf(dev, OHMD_ROTATION_QUAT, (float*)&dev->rotation);
+		if(dev->sensor_fusion)
+			update_prediction_state(dev, &last_position);
+		if(dev->history)
+			update_history_frame(dev);
 		ohmd_unlock_mutex(ctx->update_mutex);
 	}
 }
@@ -117,6 +182,59 @@ OHMD_APIENTRYDLL const char* OHMD_APIENTRY ohmd_ctx_get_error(ohmd_context* ctx)
 	return ctx->error_msg;
 }
 
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_ctx_record_hid(ohmd_context* ctx, const char* filename)
+{
+#if OHMD_HAVE_HID
+	if(!filename){
+		ohmd_hid_record_stop(ctx);
+		return OHMD_S_OK;
+	}
+
+	if(ohmd_hid_record_start(ctx, filename) != 0)
+		return OHMD_S_INVALID_PARAMETER;
+
+	return OHMD_S_OK;
+#else
+	return OHMD_S_UNSUPPORTED;
+#endif
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_ctx_replay_hid(ohmd_context* ctx, const char* filename, ohmd_replay_mode mode)
+{
+#if OHMD_HAVE_HID
+	if(!filename || (mode != OHMD_REPLAY_PACED && mode != OHMD_REPLAY_FAST && mode != OHMD_REPLAY_STEPPED))
+		return OHMD_S_INVALID_PARAMETER;
+
+	if(ctx->hid_replay)
+		return OHMD_S_INVALID_OPERATION;
+
+	if(ohmd_hid_replay_start(ctx, filename, mode) != 0)
+		return OHMD_S_INVALID_PARAMETER;
+
+	return OHMD_S_OK;
+#else
+	return OHMD_S_UNSUPPORTED;
+#endif
+}
+
+OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_ctx_replay_hid_pending(ohmd_context* ctx)
+{
+#if OHMD_HAVE_HID
+	return ohmd_hid_replay_pending(ctx);
+#else
+	return -1;
+#endif
+}
+
+OHMD_APIENTRYDLL int64_t OHMD_APIENTRY ohmd_ctx_replay_hid_step(ohmd_context* ctx)
+{
+#if OHMD_HAVE_HID
+	return ohmd_hid_replay_step(ctx);
+#else
+	return -1;
+#endif
+}
+
 OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_ctx_probe(ohmd_context* ctx)
 {
 	memset(&ctx->list, 0, sizeof(ohmd_device_list));
@@ -165,6 +283,8 @@ OHMD_APIENTRYDLL const char* OHMD_APIENTRY ohmd_list_gets(ohmd_context* ctx, int
 		return ctx->list.devices[index].product;
 	case OHMD_PATH:
 		return ctx->list.devices[index].path;
+	case OHMD_SERIAL:
+		return ctx->list.devices[index].serial;
 	default:
 		return NULL;
 	}
@@ -193,20 +313,30 @@ static unsigned int ohmd_update_thread(void* arg)
 {
 	ohmd_context* ctx = (ohmd_context*)arg;
 
+	OHMD_TRACE_THREAD_NAME("ohmd_update_thread");
+
 	while(!ctx->update_request_quit)
 	{
+		OHMD_TRACE_BEGIN("update_thread_iteration");
 		ohmd_lock_mutex(ctx->update_mutex);
 
 		for(int i = 0; i < ctx->num_active_devices; i++){
-			if(ctx->active_devices[i]->settings.automatic_update && ctx->active_devices[i]->update)
+			if(ctx->active_devices[i]->settings.automatic_update && ctx->active_devices[i]->update){
+				OHMD_TRACE_BEGIN("update_device");
 				ctx->active_devices[i]->update(ctx->active_devices[i]);
+				OHMD_TRACE_END();
+			}
 		}
 
+		ctx->update_thread_iterations++;
+
 		ohmd_unlock_mutex(ctx->update_mutex);
+		OHMD_TRACE_END();
 
 		ohmd_sleep(AUTOMATIC_UPDATE_SLEEP);
 	}
 
+	OHMD_TRACE_THREAD_EXIT();
 	return 0;
 }
 
@@ -235,9 +365,29 @@ OHMD_APIENTRYDLL ohmd_device* OHMD_APIENTRY ohmd_list_open_device_s(ohmd_context
 		}
 
 		device->rotation_correction.w = 1;
+		device->prediction_max_horizon_us = OHMD_DEFAULT_PREDICTION_HORIZON_US;
 
+		device->desc = *desc;
 		device->settings = *settings;
 
+		if(device->sensor_fusion && device->settings.fusion_backend != OHMD_FUSION_DEFAULT)
+			ofusion_set_backend(device->sensor_fusion, device->settings.fusion_backend);
+
+		// without it the device only lacks ohmd_device_get_pose_at
+		if(device->sensor_fusion && (device->history = ohmd_alloc(ctx, sizeof(pose_history)))){
+			opose_history_init(device->history);
+			device->history->position = &device->position;
+			device->sensor_fusion->history = device->history;
+		}
+
+		if(device->sensor_fusion && device->settings.imu_samples && (device->imu_samples = ohmd_alloc(ctx, sizeof(imu_ring)))){
+			oimu_ring_init(device->imu_samples);
+			device->sensor_fusion->imu_samples = device->imu_samples;
+		}
+
+		if(device->sensor_fusion)
+			device->sensor_fusion->skip_fusion = device->settings.skip_fusion;
+
 		device->ctx = ctx;
 		device->active_device_idx = ctx->num_active_devices;
 		ctx->active_devices[ctx->num_active_devices++] = device;
@@ -261,6 +411,9 @@ OHMD_APIENTRYDLL ohmd_device* OHMD_APIENTRY ohmd_list_open_device(ohmd_context*
 	ohmd_device_settings settings;
 
 	settings.automatic_update = true;
+	settings.fusion_backend = OHMD_FUSION_DEFAULT;
+	settings.imu_samples = false;
+	settings.skip_fusion = false;
 
 	return ohmd_list_open_device_s(ctx, index, &settings);
 }
@@ -275,7 +428,11 @@ OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_close_device(ohmd_device* device)
 	memmove(ctx->active_devices + idx, ctx->active_devices + idx + 1,
 		sizeof(ohmd_device*) * (ctx->num_active_devices - idx - 1));
 
+	pose_history* history = device->history;
+	imu_ring* imu_samples = device->imu_samples;
 	device->close(device);
+	free(history);
+	free(imu_samples);
 
 	ctx->num_active_devices--;
 
@@ -385,7 +542,9 @@ static int ohmd_device_getf_unp(ohmd_device* device, ohmd_float_value type, floa
 
 OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_device_getf(ohmd_device* device, ohmd_float_value type, float* out)
 {
+	OHMD_TRACE_BEGIN("getf_lock_wait");
 	ohmd_lock_mutex(device->ctx->update_mutex);
+	OHMD_TRACE_END();
 	int ret = ohmd_device_getf_unp(device, type, out);
 	ohmd_unlock_mutex(device->ctx->update_mutex);
 
@@ -415,6 +574,8 @@ static int ohmd_device_setf_unp(ohmd_device* device, ohmd_float_value type, cons
 			}
 
 			oquatf_diff(&q, (quatf*)in, &device->rotation_correction);
+			if(device->history)
+				device->history->correction = device->rotation_correction;
 			return OHMD_S_OK;
 		}
 	case OHMD_POSITION_VECTOR:
@@ -429,6 +590,8 @@ static int ohmd_device_setf_unp(ohmd_device* device, ohmd_float_value type, cons
 
 			for(int i = 0; i < 3; i++)
 				device->position_correction.arr[i] = in[i] - v.arr[i];
+			if(device->history)
+				device->history->position_correction = device->position_correction;
 
 			return OHMD_S_OK;
 		}
@@ -476,6 +639,10 @@ OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_device_geti(ohmd_device* device, ohmd_in
 			memcpy(out, device->properties.controls_hints, device->properties.control_count * sizeof(int));
 			return OHMD_S_OK;
 
+		case OHMD_PREDICTION_MAX_HORIZON_US:
+			*out = device->prediction_max_horizon_us;
+			return OHMD_S_OK;
+
 		default:
 				return OHMD_S_INVALID_PARAMETER;
 	}
@@ -484,6 +651,13 @@ OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_device_geti(ohmd_device* device, ohmd_in
 OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_device_seti(ohmd_device* device, ohmd_int_value type, const int* in)
 {
 	switch(type){
+	case OHMD_PREDICTION_MAX_HORIZON_US:
+		if(*in < 0)
+			return OHMD_S_INVALID_PARAMETER;
+
+		device->prediction_max_horizon_us = *in;
+		return OHMD_S_OK;
+
 	default:
 		return OHMD_S_INVALID_PARAMETER;
 	}
@@ -515,6 +689,151 @@ OHMD_APIENTRYDLL int OHMD_APIENTRY ohmd_device_set_data(ohmd_device* device, ohm
 	return ret;
 }
 
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_sample_time(ohmd_device* device, int64_t* out)
+{
+	if(!device->sensor_fusion)
+		return OHMD_S_UNSUPPORTED;
+
+	ohmd_lock_mutex(device->ctx->update_mutex);
+	*out = (int64_t)device->sensor_fusion->sample_ns;
+	ohmd_unlock_mutex(device->ctx->update_mutex);
+
+	return OHMD_S_OK;
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_predicted_pose(ohmd_device* device, int64_t target_ns, float* out_rotation, float* out_position)
+{
+	if(!device->sensor_fusion)
+		return OHMD_S_UNSUPPORTED;
+
+	ohmd_lock_mutex(device->ctx->update_mutex);
+
+	int64_t horizon_ns = target_ns - (int64_t)device->pose_ns;
+	int64_t max_ns = (int64_t)device->prediction_max_horizon_us * 1000;
+	if(device->pose_ns == 0)
+		horizon_ns = 0;
+	float dt = OHMD_MAX(-max_ns, OHMD_MIN(horizon_ns, max_ns)) / 1000000000.0f;
+
+	if(out_rotation){
+		// the angular velocity is in the body frame of the fusion, drivers only turn the frame of the
+		// world of the fusion, so the step goes between the rotation and the correction
+		quatf* rot = (quatf*)out_rotation;
+		*rot = device->rotation;
+
+		float ang_vel_length = ovec3f_get_length(&device->ang_vel);
+		if(ang_vel_length > 0.0001f){
+			quatf step;
+			oquatf_init_axis(&step, &device->ang_vel, ang_vel_length * dt);
+			oquatf_mult_me(rot, &step);
+		}
+
+		oquatf_mult_me(rot, &device->rotation_correction);
+	}
+
+	if(out_position){
+		for(int i = 0; i < 3; i++)
+			out_position[i] = device->position.arr[i] + device->position_correction.arr[i] +
+				device->velocity.arr[i] * dt + 0.5f * device->linear_accel.arr[i] * dt * dt;
+	}
+
+	ohmd_unlock_mutex(device->ctx->update_mutex);
+
+	return OHMD_S_OK;
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_pose_at(ohmd_device* device, int64_t time_ns, float* out_rotation, float* out_position)
+{
+	if(!device->history)
+		return OHMD_S_UNSUPPORTED;
+
+	// no lock, the history is safe to read while the update thread writes it
+	quatf rotation;
+	vec3f position;
+	uint64_t max_extrapolation_ns = (uint64_t)device->prediction_max_horizon_us * 1000;
+
+	if(time_ns < 0 || !opose_history_get_at(device->history, (uint64_t)time_ns, max_extrapolation_ns, &rotation, &position))
+		return OHMD_S_INVALID_PARAMETER;
+
+	if(out_rotation)
+		*(quatf*)out_rotation = rotation;
+	if(out_position)
+		*(vec3f*)out_position = position;
+
+	return OHMD_S_OK;
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_read_imu_samples(ohmd_device* device, ohmd_imu_sample* out, int max, int* out_count)
+{
+	if(!device->imu_samples)
+		return OHMD_S_UNSUPPORTED;
+
+	if(max < 0 || (max > 0 && !out))
+		return OHMD_S_INVALID_PARAMETER;
+
+	// no lock, the ring is safe to read while the update thread writes it
+	int count = oimu_ring_read(device->imu_samples, out, max);
+
+	if(out_count)
+		*out_count = count;
+
+	return OHMD_S_OK;
+}
+
+// The blobs of ohmd_device_get_fusion_state, with the device they were taken from
+typedef struct {
+	char driver[OHMD_STR_SIZE];
+	char product[OHMD_STR_SIZE];
+	char serial[OHMD_STR_SIZE];
+	fusion_state state;
+} fusion_state_blob;
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_get_fusion_state(ohmd_device* device, void* out, int* size)
+{
+	if(!device->sensor_fusion)
+		return OHMD_S_UNSUPPORTED;
+
+	if(!out || *size < (int)sizeof(fusion_state_blob)){
+		*size = sizeof(fusion_state_blob);
+		return out ? OHMD_S_INVALID_PARAMETER : OHMD_S_OK;
+	}
+
+	fusion_state_blob* blob = out;
+	memset(blob, 0, sizeof(fusion_state_blob));
+	strcpy(blob->driver, device->desc.driver);
+	strcpy(blob->product, device->desc.product);
+	strcpy(blob->serial, device->desc.serial);
+
+	ohmd_lock_mutex(device->ctx->update_mutex);
+	ofusion_save_state(device->sensor_fusion, &blob->state);
+	ohmd_unlock_mutex(device->ctx->update_mutex);
+
+	*size = sizeof(fusion_state_blob);
+
+	return OHMD_S_OK;
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_set_fusion_state(ohmd_device* device, const void* in, int size)
+{
+	if(!device->sensor_fusion)
+		return OHMD_S_UNSUPPORTED;
+
+	if(size != (int)sizeof(fusion_state_blob))
+		return OHMD_S_INVALID_PARAMETER;
+
+	// blobs from elsewhere might not be terminated
+	const fusion_state_blob* blob = in;
+	if(strncmp(blob->driver, device->desc.driver, OHMD_STR_SIZE) != 0 ||
+	   strncmp(blob->product, device->desc.product, OHMD_STR_SIZE) != 0 ||
+	   strncmp(blob->serial, device->desc.serial, OHMD_STR_SIZE) != 0)
+		return OHMD_S_INVALID_PARAMETER;
+
+	ohmd_lock_mutex(device->ctx->update_mutex);
+	bool restored = ofusion_restore_state(device->sensor_fusion, &blob->state);
+	ohmd_unlock_mutex(device->ctx->update_mutex);
+
+	return restored ? OHMD_S_OK : OHMD_S_INVALID_PARAMETER;
+}
+
 OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_settings_seti(ohmd_device_settings* settings, ohmd_int_settings key, const int* val)
 {
 	switch(key){
@@ -522,6 +841,21 @@ OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_device_settings_seti(ohmd_device
 		settings->automatic_update = val[0] == 0 ? false : true;
 		return OHMD_S_OK;
 
+	case OHMD_IDS_FUSION_BACKEND:
+		if(val[0] < OHMD_FUSION_DEFAULT || val[0] > OHMD_FUSION_ACCEL_ONLY)
+			return OHMD_S_INVALID_PARAMETER;
+
+		settings->fusion_backend = (ohmd_fusion_backend)val[0];
+		return OHMD_S_OK;
+
+	case OHMD_IDS_IMU_SAMPLES:
+		settings->imu_samples = val[0] == 0 ? false : true;
+		return OHMD_S_OK;
+
+	case OHMD_IDS_SENSOR_FUSION:
+		settings->skip_fusion = val[0] == 0 ? true : false;
+		return OHMD_S_OK;
+
 	default:
 		return OHMD_S_INVALID_PARAMETER;
 	}
@@ -598,23 +932,9 @@ void ohmd_set_universal_aberration_k(ohmd_device_properties* props, float r, flo
 	props->universal_aberration_k[2] = b;
 }
 
-uint64_t ohmd_monotonic_per_sec(ohmd_context* ctx)
+int64_t ohmd_get_time_ns(void)
 {
-	return ctx->monotonic_ticks_per_sec;
-}
-
-/*
- * Grabbed from druntime, good thing it's BOOST v1.0 as well.
- */
-uint64_t ohmd_monotonic_conv(uint64_t ticks, uint64_t srcTicksPerSecond, uint64_t dstTicksPerSecond)
-{
-	// This would be more straightforward with floating point arithmetic,
-	// but we avoid it here in order to avoid the rounding errors that that
-	// introduces. Also, by splitting out the units in this way, we're able
-	// to deal with much larger values before running into problems with
-	// integer overflow.
-	return ticks / srcTicksPerSecond * dstTicksPerSecond +
-		ticks % srcTicksPerSecond * dstTicksPerSecond / srcTicksPerSecond;
+	return (int64_t)ohmd_monotonic_ns();
 }
 
 void ohmd_get_version(int* out_major, int* out_minor, int* out_patch)
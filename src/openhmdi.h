@@ -18,16 +18,25 @@
 
 #include "openhmd.h"
 #include "omath.h"
+#include "fusion.h"
+#include "clocksync.h"
 #include "platform.h"
 #include "utils.h"
 
 #define OHMD_MAX_DEVICES 16
+#define OHMD_DEFAULT_PREDICTION_HORIZON_US 50000
 
 #define OHMD_MAX(_a, _b) ((_a) > (_b) ? (_a) : (_b))
 #define OHMD_MIN(_a, _b) ((_a) < (_b) ? (_a) : (_b))
 
 #define OHMD_STRINGIFY(_what) #_what
 
+// drivers talking to devices through the HID transports (hid.h)
+#if DRIVER_OCULUS_RIFT || DRIVER_OCULUS_RIFT_S || DRIVER_DEEPOON || DRIVER_HTC_VIVE || DRIVER_WMR || \
+	DRIVER_PSVR || DRIVER_NOLO || DRIVER_XGVR || DRIVER_VRTEK
+#define OHMD_HAVE_HID 1
+#endif
+
 #define OHMD_VERSION_MAJOR 0
 #define OHMD_VERSION_MINOR 3
 #define OHMD_VERSION_PATCH 0
@@ -39,6 +48,7 @@ typedef struct {
 	char vendor[OHMD_STR_SIZE];
 	char product[OHMD_STR_SIZE];
 	char path[OHMD_STR_SIZE];
+	char serial[OHMD_STR_SIZE]; // serial number of the device, empty if it has none
 	int revision;
 	int id;
 	ohmd_device_flags device_flags;
@@ -89,6 +99,9 @@ typedef struct {
 struct ohmd_device_settings
 {
 	bool automatic_update;
+	ohmd_fusion_backend fusion_backend;
+	bool imu_samples;
+	bool skip_fusion;
 };
 
 struct ohmd_device {
@@ -107,12 +120,26 @@ struct ohmd_device {
 
 	ohmd_context* ctx;
 
+	ohmd_device_desc desc; // the entry of the device list it was opened from
+
 	ohmd_device_settings settings;
 
 	int active_device_idx; // index into ohmd_device->active_devices[]
 
 	quatf rotation;
 	vec3f position;
+
+	fusion* sensor_fusion; // the fusion the pose comes from, NULL if the device has none
+	pose_history* history; // the recent poses of sensor_fusion, NULL if the device has none
+	imu_ring* imu_samples; // the samples sensor_fusion got, NULL unless OHMD_IDS_IMU_SAMPLES was set
+
+	// what ohmd_device_get_predicted_pose extrapolates rotation and position with, taken along with them
+	uint64_t pose_ns;      // sample time of rotation
+	vec3f ang_vel;         // rad/s in the frame of the fusion
+	vec3f linear_accel;    // m/s² in the world frame, without gravity
+	vec3f velocity;        // m/s, from the latest position steps, zero for devices without positional tracking
+	uint64_t position_ns;  // sample time of the latest position step, 0 before the first
+	int prediction_max_horizon_us;
 };
 
 
@@ -130,16 +157,20 @@ struct ohmd_context {
 
 	bool update_request_quit;
 
-	uint64_t monotonic_ticks_per_sec;
+	// completed update thread loops, lets benchmarks measure the achieved rate
+	volatile uint64_t update_thread_iterations;
+
+	// backend the drivers open HID devices with, NULL for the default (see hid.h)
+	struct ohmd_hid_transport* hid_transport;
+	// wraps the transport while recording HID traffic (see hid-record.c)
+	struct ohmd_hid_recorder* hid_recorder;
+	// serves a capture file as the transport (see hid-replay.c)
+	struct ohmd_hid_replay* hid_replay;
 
 	char error_msg[OHMD_STR_SIZE];
 };
 
 // helper functions
-void ohmd_monotonic_init(ohmd_context* ctx);
-uint64_t ohmd_monotonic_get(ohmd_context* ctx);
-uint64_t ohmd_monotonic_per_sec(ohmd_context* ctx);
-uint64_t ohmd_monotonic_conv(uint64_t ticks, uint64_t srcTicksPerSecond, uint64_t dstTicksPerSecond);
 void ohmd_set_default_device_properties(ohmd_device_properties* props);
 void ohmd_calc_default_proj_matrices(ohmd_device_properties* props);
 void ohmd_set_universal_distortion_k(ohmd_device_properties* props, float a, float b, float c, float d);
@@ -160,7 +191,7 @@ ohmd_driver* ohmd_create_external_drv(ohmd_context* ctx);
 ohmd_driver* ohmd_create_android_drv(ohmd_context* ctx);
 
 #include "log.h"
+#include "trace.h"
 #include "omath.h"
-#include "fusion.h"
 
 #endif
@@ -21,70 +21,36 @@
 #include <stdio.h>
 #include <pthread.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "platform.h"
 #include "openhmdi.h"
 
 // Use clock_gettime if the system implements posix realtime timers
-#ifndef CLOCK_MONOTONIC
-double ohmd_get_tick()
-{
-	struct timeval now;
-	gettimeofday(&now, NULL);
-	return (double)now.tv_sec * 1.0 + (double)now.tv_usec / 1000000.0;
-}
-#else
-double ohmd_get_tick()
-{
-	struct timespec now;
-	clock_gettime(CLOCK_MONOTONIC, &now);
-	return (double)now.tv_sec * 1.0 + (double)now.tv_nsec / 1000000000.0;
-}
-#endif
-
 #ifndef CLOCK_MONOTONIC
 
 static const uint64_t NUM_1_000_000 = 1000000;
 
-void ohmd_monotonic_init(ohmd_context* ctx)
-{
-	ctx->monotonic_ticks_per_sec = NUM_1_000_000;
-}
-
-uint64_t ohmd_monotonic_get(ohmd_context* ctx)
+uint64_t ohmd_monotonic_ns()
 {
 	struct timeval now;
 	gettimeofday(&now, NULL);
-	return now.tv_sec * NUM_1_000_000 + now.tv_usec;
+	return (now.tv_sec * NUM_1_000_000 + now.tv_usec) * 1000;
 }
 
 #else
 
 static const uint64_t NUM_1_000_000_000 = 1000000000;
 
-void ohmd_monotonic_init(ohmd_context* ctx)
-{
-		struct timespec ts;
-		if (clock_getres(CLOCK_MONOTONIC, &ts) !=  0) {
-			ctx->monotonic_ticks_per_sec = NUM_1_000_000_000;
-			return;
-		}
-
-		ctx->monotonic_ticks_per_sec =
-			ts.tv_nsec >= 1000 ?
-			NUM_1_000_000_000 :
-			NUM_1_000_000_000 / ts.tv_nsec;
-}
-
-uint64_t ohmd_monotonic_get(ohmd_context* ctx)
+uint64_t ohmd_monotonic_ns()
 {
 	struct timespec now;
 	clock_gettime(CLOCK_MONOTONIC, &now);
 
-	return ohmd_monotonic_conv(
-		now.tv_sec * NUM_1_000_000_000 + now.tv_nsec,
-		NUM_1_000_000_000,
-		ctx->monotonic_ticks_per_sec);
+	return now.tv_sec * NUM_1_000_000_000 + now.tv_nsec;
 }
 
 #endif
@@ -173,6 +139,34 @@ void ohmd_unlock_mutex(ohmd_mutex* mutex)
 		pthread_mutex_unlock((pthread_mutex_t*)mutex);
 }
 
+const void* ohmd_map_file(const char* path, size_t* size)
+{
+	int fd = open(path, O_RDONLY);
+	if(fd < 0)
+		return NULL;
+
+	struct stat st;
+	void* data = MAP_FAILED;
+
+	if(fstat(fd, &st) == 0 && st.st_size > 0)
+		data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// the mapping stays valid after closing the file
+	close(fd);
+
+	if(data == MAP_FAILED)
+		return NULL;
+
+	*size = st.st_size;
+	return data;
+}
+
+void ohmd_unmap_file(const void* data, size_t size)
+{
+	if(data)
+		munmap((void*)data, size);
+}
+
 /// Handling ovr service
 void ohmd_toggle_ovr_service(int state) //State is 0 for Disable, 1 for Enable
 {
@@ -18,32 +18,16 @@
 #include "platform.h"
 #include "openhmdi.h"
 
-double ohmd_get_tick()
+uint64_t ohmd_monotonic_ns()
 {
-	double high, low;
-	FILETIME filetime;
+	LARGE_INTEGER freq, count;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&count);
 
-	GetSystemTimeAsFileTime(&filetime);
+	uint64_t sec = count.QuadPart / freq.QuadPart;
+	uint64_t rem = count.QuadPart % freq.QuadPart;
 
-	high = filetime.dwHighDateTime;
-	low = filetime.dwLowDateTime;
-
-	return (high * 4294967296.0 + low) / 10000000;
-}
-
-static const uint64_t NUM_10_000_000 = 10000000;
-
-void ohmd_monotonic_init(ohmd_context* ctx)
-{
-	ctx->monotonic_ticks_per_sec = NUM_10_000_000;
-}
-
-uint64_t ohmd_monotonic_get(ohmd_context* ctx)
-{
-	FILETIME filetime;
-	GetSystemTimeAsFileTime(&filetime);
-
-	return ((uint64_t)filetime.dwHighDateTime << 32) | filetime.dwLowDateTime;
+	return sec * 1000000000 + rem * 1000000000 / freq.QuadPart;
 }
 
 // TODO higher resolution
@@ -121,6 +105,39 @@ void ohmd_unlock_mutex(ohmd_mutex* mutex)
 		ReleaseMutex(mutex->handle);
 }
 
+const void* ohmd_map_file(const char* path, size_t* size)
+{
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if(file == INVALID_HANDLE_VALUE)
+		return NULL;
+
+	LARGE_INTEGER file_size;
+	HANDLE mapping = NULL;
+	const void* data = NULL;
+
+	if(GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0)
+		mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+
+	if(mapping){
+		data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		// the view keeps the mapping alive
+		CloseHandle(mapping);
+	}
+
+	CloseHandle(file);
+
+	if(data)
+		*size = (size_t)file_size.QuadPart;
+
+	return data;
+}
+
+void ohmd_unmap_file(const void* data, size_t size)
+{
+	if(data)
+		UnmapViewOfFile(data);
+}
+
 int findEndPoint(char* path, int endpoint)
 {
 	char comp[8];
@@ -11,11 +11,15 @@
 #ifndef PLATFORM_H
 #define PLATFORM_H
 
+#include <stddef.h>
+
 #include "openhmd.h"
 
-double ohmd_get_tick();
 void ohmd_toggle_ovr_service(int state);
 
+/* Host monotonic time in nanoseconds, CLOCK_MONOTONIC where available. The time base of everything timed in the library. */
+uint64_t ohmd_monotonic_ns();
+
 typedef struct ohmd_thread ohmd_thread;
 typedef struct ohmd_mutex ohmd_mutex;
 
@@ -28,6 +32,11 @@ void ohmd_unlock_mutex(ohmd_mutex* mutex);
 ohmd_thread* ohmd_create_thread(ohmd_context* ctx, unsigned int (*routine)(void* arg), void* arg);
 void ohmd_destroy_thread(ohmd_thread* thread);
 
+/* Read only file mappings, NULL if the file can't be mapped (or is empty) */
+
+const void* ohmd_map_file(const char* path, size_t* size);
+void ohmd_unmap_file(const void* data, size_t size);
+
 /* String functions */
 
 int findEndPoint(char* path, int endpoint);
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Pose History Implementation */
+
+
+#include <string.h>
+#include "pose-history.h"
+
+#ifdef _MSC_VER
+#include <windows.h>
+#define ohmd_memory_barrier() MemoryBarrier()
+#else
+#define ohmd_memory_barrier() __sync_synchronize()
+#endif
+
+#define MASK (POSE_HISTORY_SIZE - 1)
+#define READ_TRIES 8
+
+void opose_history_init(pose_history* me)
+{
+	memset(me, 0, sizeof(pose_history));
+	me->frame.w = 1.0f;
+	me->correction.w = 1.0f;
+}
+
+void opose_history_push(pose_history* me, uint64_t sample_ns, const quatf* orient, const vec3f* ang_vel)
+{
+	uint32_t n = me->count;
+	pose_history_entry* e = me->entries + (n & MASK);
+
+	e->sample_ns = sample_ns;
+
+	quatf rotation;
+	oquatf_mult(&me->frame, orient, &rotation);
+	oquatf_mult(&rotation, &me->correction, &e->rotation);
+
+	// the body frame turned by the correction
+	quatf inv_correction = me->correction;
+	oquatf_inverse(&inv_correction);
+	oquatf_get_rotated(&inv_correction, ang_vel, &e->ang_vel);
+
+	e->position = me->position_correction;
+	if(me->position){
+		for(int i = 0; i < 3; i++)
+			e->position.arr[i] += me->position->arr[i];
+	}
+
+	// the entry has to be complete before readers can see it
+	ohmd_memory_barrier();
+	me->count = n + 1;
+}
+
+// Entry n is intact if the writer hadn't started on entry n + POSE_HISTORY_SIZE, in the same slot, by the
+// time it was copied. The writer starts on that one once count reaches it.
+static inline bool still_valid(const pose_history* me, uint32_t n)
+{
+	ohmd_memory_barrier();
+	return me->count - n < POSE_HISTORY_SIZE;
+}
+
+bool opose_history_get_at(const pose_history* me, uint64_t time_ns, uint64_t max_extrapolation_ns, quatf* out_rotation, vec3f* out_position)
+{
+	for(int tries = 0; tries < READ_TRIES; tries++){
+		uint32_t count = me->count;
+		ohmd_memory_barrier();
+
+		if(count == 0)
+			return false;
+
+		// the slot of the oldest entry is the next one written
+		uint32_t newest = count - 1;
+		uint32_t oldest = count > POSE_HISTORY_SIZE - 1 ? count - (POSE_HISTORY_SIZE - 1) : 0;
+
+		pose_history_entry a = me->entries[newest & MASK];
+
+		if(time_ns >= a.sample_ns){
+			if(!still_valid(me, newest))
+				continue;
+
+			uint64_t ahead_ns = time_ns - a.sample_ns;
+			float dt = (ahead_ns < max_extrapolation_ns ? ahead_ns : max_extrapolation_ns) / 1000000000.0f;
+			float ang_vel_length = ovec3f_get_length(&a.ang_vel);
+
+			*out_rotation = a.rotation;
+			if(ang_vel_length > 0.0001f && dt > 0.0f){
+				quatf step;
+				oquatf_init_axis(&step, &a.ang_vel, ang_vel_length * dt);
+				oquatf_mult_me(out_rotation, &step);
+			}
+			*out_position = a.position;
+
+			return true;
+		}
+
+		// the last entry at or before time_ns, entries are in time order
+		uint32_t lo = oldest, hi = newest;
+		while(lo < hi){
+			uint32_t mid = lo + (hi - lo + 1) / 2;
+			if(me->entries[mid & MASK].sample_ns <= time_ns)
+				lo = mid;
+			else
+				hi = mid - 1;
+		}
+
+		a = me->entries[lo & MASK];
+		pose_history_entry b = me->entries[(lo + 1) & MASK];
+
+		if(!still_valid(me, lo))
+			continue;
+
+		if(a.sample_ns > time_ns){
+			// older than the history, unless the search went astray on entries being overwritten
+			if(lo == oldest && me->count == count)
+				return false;
+			continue;
+		}
+		if(b.sample_ns < time_ns)
+			continue;
+
+		float t = b.sample_ns > a.sample_ns ? (float)(time_ns - a.sample_ns) / (float)(b.sample_ns - a.sample_ns) : 1.0f;
+
+		oquatf_slerp(t, &a.rotation, &b.rotation, true, out_rotation);
+		for(int i = 0; i < 3; i++)
+			out_position->arr[i] = a.position.arr[i] + (b.position.arr[i] - a.position.arr[i]) * t;
+
+		return true;
+	}
+
+	// the writer kept lapping the reader
+	return false;
+}
@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Pose History */
+
+/*
+ * The recent poses of a device, pushed after each fusion update, for
+ * looking up the pose at a past time (the start of rendering, the scanout of
+ * a frame) instead of only the latest one.
+ *
+ * A ring of POSE_HISTORY_SIZE entries with a single writer, the thread
+ * fusing the device. Readers take no lock: they copy entries and then check
+ * that the writer hasn't come around to them in the meantime, retrying if it
+ * has. A reader can't hold up the writer.
+ */
+
+#ifndef POSE_HISTORY_H
+#define POSE_HISTORY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "omath.h"
+
+#define POSE_HISTORY_SIZE 512 // must be a power of two, half a second or more at the report rates of the drivers
+
+typedef struct {
+	uint64_t sample_ns; // host time, see clocksync.h
+	quatf rotation;
+	vec3f ang_vel;      // rad/s, in the frame rotation turns about on the right
+	vec3f position;
+} pose_history_entry;
+
+typedef struct {
+	pose_history_entry entries[POSE_HISTORY_SIZE];
+	volatile uint32_t count; // entries pushed, wraps around
+
+	// how the orientations of the fusion map onto the poses of the device, set by the owner
+	// of the history: rotation = frame * orient * correction
+	quatf frame, correction;
+	const vec3f* position;   // read on each push, NULL for devices without positional tracking
+	vec3f position_correction;
+} pose_history;
+
+void opose_history_init(pose_history* me);
+
+// Adds the pose of a fusion update, orient and ang_vel (rad/s, body frame) as the fusion has them
+void opose_history_push(pose_history* me, uint64_t sample_ns, const quatf* orient, const vec3f* ang_vel);
+
+// The pose at time_ns, interpolated between the neighbouring entries. Past the newest entry the rotation
+// is extrapolated with its angular velocity by up to max_extrapolation_ns. Returns false when the
+// history is empty or time_ns is older than the oldest entry.
+bool opose_history_get_at(const pose_history* me, uint64_t time_ns, uint64_t max_extrapolation_ns, quatf* out_rotation, vec3f* out_position);
+
+#endif
@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Trace Point Recording and Chrome Trace Event Export */
+
+
+#include <string.h>
+#include "openhmdi.h"
+
+#ifdef OHMD_TRACE
+
+#ifdef _MSC_VER
+#include <windows.h>
+#include <intrin.h>
+#define OHMD_THREAD_LOCAL __declspec(thread)
+#define ohmd_atomic_cas(_p, _old, _new) (_InterlockedCompareExchange((volatile long*)(_p), (_new), (_old)) == (_old))
+#define ohmd_memory_barrier() MemoryBarrier()
+#else
+#define OHMD_THREAD_LOCAL __thread
+#define ohmd_atomic_cas(_p, _old, _new) __sync_bool_compare_and_swap((_p), (_old), (_new))
+#define ohmd_memory_barrier() __sync_synchronize()
+#endif
+
+#define TRACE_MAX_THREADS 16
+#define TRACE_EVENTS_PER_THREAD 16384 // must be a power of two
+#define TRACE_MAX_DEPTH 32
+
+typedef struct {
+	const char* name;
+	uint64_t start; // ns, ohmd_monotonic_ns() time base
+	uint64_t end;
+} trace_event;
+
+typedef struct {
+	volatile long owned; // 1 while a thread traces into the buffer
+	int tid;             // 0 until a thread first claimed the buffer
+	const char* thread_name;
+
+	// only touched by the owning thread
+	int generation;
+	int depth;
+	const char* stack_names[TRACE_MAX_DEPTH];
+	uint64_t stack_start[TRACE_MAX_DEPTH];
+
+	// total number of events written, the ring holds the last TRACE_EVENTS_PER_THREAD
+	volatile uint32_t head;
+	trace_event events[TRACE_EVENTS_PER_THREAD];
+} trace_buffer;
+
+volatile int ohmd_trace_active;
+
+static trace_buffer* trace_pool;
+static volatile int trace_generation;
+static char trace_env_file[OHMD_STR_SIZE];
+
+static OHMD_THREAD_LOCAL trace_buffer* thread_buffer;
+static OHMD_THREAD_LOCAL const char* thread_name;
+static OHMD_THREAD_LOCAL int thread_no_buffer; // the generation in which all buffers were taken, 0 if none
+
+static trace_buffer* get_thread_buffer()
+{
+	if(thread_buffer)
+		return thread_buffer;
+
+	// threads that found the pool full don't try again until tracing is switched on anew
+	if(thread_no_buffer == trace_generation)
+		return NULL;
+
+	// claim a free preallocated buffer, threads beyond the pool size are not traced
+	for(int i = 0; i < TRACE_MAX_THREADS; i++){
+		trace_buffer* buf = &trace_pool[i];
+		if(buf->owned || !ohmd_atomic_cas(&buf->owned, 0, 1))
+			continue;
+
+		buf->tid = i + 1;
+		buf->thread_name = thread_name;
+		buf->generation = trace_generation;
+
+		thread_buffer = buf;
+		return buf;
+	}
+
+	thread_no_buffer = trace_generation;
+	return NULL;
+}
+
+void ohmd_trace_begin(const char* name)
+{
+	trace_buffer* buf = get_thread_buffer();
+	if(!buf)
+		return;
+
+	// discard spans left open when tracing was switched off
+	if(buf->generation != trace_generation){
+		buf->generation = trace_generation;
+		buf->depth = 0;
+	}
+
+	if(buf->depth < TRACE_MAX_DEPTH){
+		buf->stack_names[buf->depth] = name;
+		buf->stack_start[buf->depth] = ohmd_monotonic_ns();
+	}
+
+	buf->depth++;
+}
+
+void ohmd_trace_end(void)
+{
+	trace_buffer* buf = thread_buffer;
+	if(!buf || buf->depth == 0 || buf->generation != trace_generation)
+		return;
+
+	buf->depth--;
+	if(buf->depth >= TRACE_MAX_DEPTH)
+		return;
+
+	trace_event* ev = &buf->events[buf->head & (TRACE_EVENTS_PER_THREAD - 1)];
+	ev->name = buf->stack_names[buf->depth];
+	ev->start = buf->stack_start[buf->depth];
+	ev->end = ohmd_monotonic_ns();
+
+	buf->head++;
+}
+
+void ohmd_trace_set_thread_name(const char* name)
+{
+	thread_name = name;
+	if(thread_buffer)
+		thread_buffer->thread_name = name;
+}
+
+void ohmd_trace_thread_exit(void)
+{
+	trace_buffer* buf = thread_buffer;
+	if(!buf)
+		return;
+
+	// the events stay for ohmd_trace_dump until the next thread claiming the buffer overwrites them
+	buf->depth = 0;
+	thread_buffer = NULL;
+
+	ohmd_memory_barrier();
+	buf->owned = 0;
+}
+
+void ohmd_trace_env_start(void)
+{
+	const char* file = getenv("OHMD_TRACE");
+	if(file == NULL || file[0] == '\0')
+		return;
+
+	snprintf(trace_env_file, OHMD_STR_SIZE, "%s", file);
+	ohmd_trace_enable(1);
+}
+
+void ohmd_trace_env_finish(void)
+{
+	if(trace_env_file[0] == '\0')
+		return;
+
+	if(ohmd_trace_dump(trace_env_file) != OHMD_S_OK)
+		LOGW("could not write trace to %s", trace_env_file);
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_trace_enable(int enable)
+{
+	if(enable && !trace_pool){
+		trace_pool = calloc(TRACE_MAX_THREADS, sizeof(trace_buffer));
+		if(!trace_pool){
+			LOGE("could not allocate trace buffers");
+			return OHMD_S_UNKNOWN_ERROR;
+		}
+	}
+
+	if(enable && !ohmd_trace_active)
+		trace_generation++;
+
+	ohmd_trace_active = enable ? 1 : 0;
+	return OHMD_S_OK;
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_trace_dump(const char* filename)
+{
+	FILE* f = fopen(filename, "w");
+	if(!f)
+		return OHMD_S_INVALID_PARAMETER;
+
+	fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+
+	bool first = true;
+
+	for(int i = 0; trace_pool && i < TRACE_MAX_THREADS; i++){
+		trace_buffer* buf = &trace_pool[i];
+		if(buf->tid == 0)
+			continue;
+
+		if(buf->thread_name){
+			fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+				first ? "" : ",\n", buf->tid, buf->thread_name);
+			first = false;
+		}
+
+		// Events may still be written while dumping; the ring is read from
+		// the oldest retained entry so only the very oldest ones can race.
+		uint32_t head = buf->head;
+		uint32_t count = OHMD_MIN(head, TRACE_EVENTS_PER_THREAD);
+
+		for(uint32_t j = head - count; j != head; j++){
+			trace_event* ev = &buf->events[j & (TRACE_EVENTS_PER_THREAD - 1)];
+
+			// timestamps are in microseconds on the ohmd_monotonic_ns() time base
+			// (CLOCK_MONOTONIC on POSIX) so they line up with application traces
+			fprintf(f, "%s{\"name\":\"%s\",\"cat\":\"ohmd\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				first ? "" : ",\n", ev->name, buf->tid, ev->start / 1000.0, (ev->end - ev->start) / 1000.0);
+			first = false;
+		}
+	}
+
+	fprintf(f, "\n]}\n");
+
+	int err = ferror(f);
+	fclose(f);
+
+	return err ? OHMD_S_UNKNOWN_ERROR : OHMD_S_OK;
+}
+
+#else
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_trace_enable(int enable)
+{
+	return OHMD_S_UNSUPPORTED;
+}
+
+OHMD_APIENTRYDLL ohmd_status OHMD_APIENTRY ohmd_trace_dump(const char* filename)
+{
+	return OHMD_S_UNSUPPORTED;
+}
+
+#endif
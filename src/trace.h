@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: BSL-1.0
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ */
+
+/* Trace Points */
+
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * Trace points are only compiled in when OHMD_TRACE is defined. Even then
+ * nothing is recorded until tracing is switched on with ohmd_trace_enable()
+ * (or the OHMD_TRACE environment variable), so an idle trace point costs a
+ * single load and branch.
+ *
+ * OHMD_TRACE_BEGIN/OHMD_TRACE_END must be paired on the same thread, names
+ * must be string literals (only the pointer is stored).
+ */
+
+#ifdef OHMD_TRACE
+
+extern volatile int ohmd_trace_active;
+
+void ohmd_trace_begin(const char* name);
+void ohmd_trace_end(void);
+void ohmd_trace_set_thread_name(const char* name);
+// Hands the trace buffer of the calling thread back to the pool, for threads that are about to end
+void ohmd_trace_thread_exit(void);
+
+void ohmd_trace_env_start(void);
+void ohmd_trace_env_finish(void);
+
+#define OHMD_TRACE_BEGIN(_name) do{ if(ohmd_trace_active) ohmd_trace_begin(_name); } while(0)
+#define OHMD_TRACE_END() do{ if(ohmd_trace_active) ohmd_trace_end(); } while(0)
+#define OHMD_TRACE_THREAD_NAME(_name) ohmd_trace_set_thread_name(_name)
+#define OHMD_TRACE_THREAD_EXIT() ohmd_trace_thread_exit()
+
+#else
+
+#define OHMD_TRACE_BEGIN(_name) do{} while(0)
+#define OHMD_TRACE_END() do{} while(0)
+#define OHMD_TRACE_THREAD_NAME(_name) do{} while(0)
+#define OHMD_TRACE_THREAD_EXIT() do{} while(0)
+
+#define ohmd_trace_env_start() do{} while(0)
+#define ohmd_trace_env_finish() do{} while(0)
+
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Internal Interface */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <math.h>
+
+#include "openhmdi.h"
+
+// A benchmark body runs the measured operation `iterations` times.
+typedef void (*bench_fn)(int iterations);
+
+// Runs fn repeatedly and prints the median and minimum time per operation.
+// Each timed run lasts at least BENCH_MIN_RUN_NS, and BENCH_RUNS runs are
+// taken so the median is stable enough to compare across commits.
+void bench_run(const char* name, bench_fn fn);
+
+uint64_t bench_now_ns(void);
+
+// False if the benchmark was filtered out on the command line.
+bool bench_enabled(const char* name);
+
+// Values written to keep the optimizer from dropping benchmark bodies.
+extern volatile float bench_sink;
+
+// Synthetic 1 kHz IMU stream (head turning and nodding, gravity plus noise).
+typedef struct {
+	float dt;
+	vec3f gyro, accel, mag;
+} bench_imu_sample;
+
+#define BENCH_IMU_SAMPLES 4096
+
+void bench_imu_generate(bench_imu_sample* samples, int count, unsigned int seed);
+float bench_randf(unsigned int* state); // uniform in [-1, 1]
+
+// Like bench_run, but also reports the rate in `unit`s per second, for
+// benchmarks where one operation is one report, sample or call.
+void bench_run_rate(const char* name, bench_fn fn, const char* unit);
+
+// A set of raw reports of the same size as they are read from a device.
+typedef struct {
+	const char* name;
+	int report_size;
+	int count;
+	const unsigned char* data;
+} bench_corpus;
+
+// Returns false if the report could not be decoded.
+typedef bool (*bench_decode_fn)(const unsigned char* buf, int size);
+
+// Checks that every report in the corpus decodes, then times decode over
+// the corpus and reports throughput in reports/s.
+void bench_run_decoder(const char* name, const bench_corpus* corpus, bench_decode_fn decode);
+
+extern const bench_corpus bench_corpus_rift_dk2;
+extern const bench_corpus bench_corpus_rift_radio;
+extern const bench_corpus bench_corpus_rift_s_hmd;
+extern const bench_corpus bench_corpus_rift_s_controller;
+extern const bench_corpus bench_corpus_vive;
+extern const bench_corpus bench_corpus_wmr;
+extern const bench_corpus bench_corpus_psvr;
+extern const bench_corpus bench_corpus_nolo;
+
+// omath benchmarks
+void bench_oquatf_mult(int iterations);
+void bench_oquatf_get_rotated(int iterations);
+void bench_oquatf_normalize_me(int iterations);
+void bench_omat4x4f_mult(int iterations);
+void bench_omat4x4f_transpose(int iterations);
+void bench_omat4x4f_init_look_at(int iterations);
+void bench_ofq_add(int iterations);
+void bench_ofq_get_mean(int iterations);
+
+// fusion benchmarks
+void bench_ofusion_update(int iterations);
+// per sample, in batches of 1, 2 and 4 samples (Rift S and Vive send 3, PSVR 2, WMR 4)
+void bench_ofusion_update_batch_1(int iterations);
+void bench_ofusion_update_batch_2(int iterations);
+void bench_ofusion_update_batch_4(int iterations);
+// per sample for each backend, in reports of 3 samples
+void bench_ofusion_complementary(int iterations);
+void bench_ofusion_mahony(int iterations);
+void bench_ofusion_madgwick(int iterations);
+// the same in fixed point
+void bench_ofusion_fixed_complementary(int iterations);
+void bench_ofusion_fixed_mahony(int iterations);
+void bench_ofusion_fixed_madgwick(int iterations);
+// per sample of one of many trackers fused with Mahony, a fusion struct each against one fusion_group
+void bench_ofusion_trackers_4(int iterations);
+void bench_ofusion_trackers_64(int iterations);
+void bench_ofusion_trackers_256(int iterations);
+void bench_ofusion_group_4(int iterations);
+void bench_ofusion_group_64(int iterations);
+void bench_ofusion_group_256(int iterations);
+// time until the tilt error of each backend stays low and its error afterwards,
+// on synthetic motion with a gyro bias and a known true orientation
+void bench_fusion_convergence(void);
+
+// getf/setf from several threads against the automatic update thread
+void bench_contention(void);
+
+// driver decoder benchmarks, one function per driver
+void bench_decode_rift(void);
+void bench_decode_rift_s(void);
+void bench_decode_vive(void);
+void bench_decode_wmr(void);
+void bench_decode_psvr(void);
+void bench_decode_nolo(void);
+
+#endif
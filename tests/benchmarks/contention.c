@@ -0,0 +1,220 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - API Contention */
+
+// Several threads (render, input, network...) call ohmd_device_getf/setf on
+// the null devices while the automatic update thread runs, measuring API
+// throughput, per call latency and the rate the update loop still achieves.
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include <string.h>
+#include "bench.h"
+
+#define CONTENTION_MAX_THREADS 16
+#define CONTENTION_RUN_NS 1000000000ull // 1 s per thread count
+#define CONTENTION_MAX_DEVICES 8
+
+// latency histogram, 16 linear sub buckets per power of two
+#define LAT_SUB_BITS 4
+#define LAT_SUB (1 << LAT_SUB_BITS)
+#define LAT_BUCKETS (48 * LAT_SUB)
+
+typedef struct {
+	ohmd_device** devices;
+	int num_devices;
+	int index;
+
+	uint64_t calls;
+	uint64_t max_latency;
+	uint64_t latency[LAT_BUCKETS];
+} contention_thread;
+
+static volatile int contention_start, contention_stop;
+
+static int lat_bucket(uint64_t ns)
+{
+	if(ns < LAT_SUB)
+		return (int)ns;
+
+	int msb = 0;
+	while(ns >> (msb + 1))
+		msb++;
+
+	int bucket = (msb - LAT_SUB_BITS + 1) * LAT_SUB + (int)((ns >> (msb - LAT_SUB_BITS)) & (LAT_SUB - 1));
+	return bucket < LAT_BUCKETS ? bucket : LAT_BUCKETS - 1;
+}
+
+static uint64_t lat_bucket_value(int bucket)
+{
+	if(bucket < LAT_SUB)
+		return bucket;
+
+	int shift = bucket / LAT_SUB - 1;
+	return (uint64_t)(LAT_SUB + bucket % LAT_SUB) << shift;
+}
+
+static uint64_t lat_percentile(const uint64_t* hist, uint64_t total, double pct)
+{
+	uint64_t target = (uint64_t)(total * pct / 100.0), seen = 0;
+
+	for(int i = 0; i < LAT_BUCKETS; i++){
+		seen += hist[i];
+		if(seen > target)
+			return lat_bucket_value(i);
+	}
+
+	return lat_bucket_value(LAT_BUCKETS - 1);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI contention_worker(LPVOID arg)
+#else
+static void* contention_worker(void* arg)
+#endif
+{
+	contention_thread* t = (contention_thread*)arg;
+	unsigned int seed = 0x9e3779b9u * (t->index + 1);
+	float out[16];
+
+	while(!contention_start)
+		;
+
+	while(!contention_stop){
+		ohmd_device* dev = t->devices[t->calls % t->num_devices];
+		int op = (int)(t->calls & 15);
+
+		uint64_t start = bench_now_ns();
+		if(op == 15){
+			// an occasional setting change, like an IPD slider
+			float ipd = 0.063f + 0.001f * bench_randf(&seed);
+			ohmd_device_setf(dev, OHMD_EYE_IPD, &ipd);
+		}else if(op & 1){
+			ohmd_device_getf(dev, OHMD_POSITION_VECTOR, out);
+		}else{
+			ohmd_device_getf(dev, OHMD_ROTATION_QUAT, out);
+		}
+		uint64_t elapsed = bench_now_ns() - start;
+
+		t->latency[lat_bucket(elapsed)]++;
+		if(elapsed > t->max_latency)
+			t->max_latency = elapsed;
+		t->calls++;
+	}
+
+	bench_sink = out[0];
+
+	return 0;
+}
+
+static void run_contention(ohmd_context* ctx, ohmd_device** devices, int num_devices, int num_threads)
+{
+	static contention_thread threads[CONTENTION_MAX_THREADS];
+#ifdef _WIN32
+	HANDLE handles[CONTENTION_MAX_THREADS];
+#else
+	pthread_t handles[CONTENTION_MAX_THREADS];
+#endif
+
+	memset(threads, 0, sizeof(threads));
+	contention_start = contention_stop = 0;
+
+	for(int i = 0; i < num_threads; i++){
+		threads[i].devices = devices;
+		threads[i].num_devices = num_devices;
+		threads[i].index = i;
+#ifdef _WIN32
+		handles[i] = CreateThread(NULL, 0, contention_worker, &threads[i], 0, NULL);
+#else
+		pthread_create(&handles[i], NULL, contention_worker, &threads[i]);
+#endif
+	}
+
+	uint64_t iterations_start = ctx->update_thread_iterations;
+	uint64_t start = bench_now_ns();
+	contention_start = 1;
+
+	while(bench_now_ns() - start < CONTENTION_RUN_NS)
+		ohmd_sleep(0.01);
+
+	contention_stop = 1;
+	uint64_t elapsed = bench_now_ns() - start;
+	uint64_t iterations = ctx->update_thread_iterations - iterations_start;
+
+	static uint64_t hist[LAT_BUCKETS];
+	uint64_t calls = 0, max_latency = 0;
+	memset(hist, 0, sizeof(hist));
+
+	for(int i = 0; i < num_threads; i++){
+#ifdef _WIN32
+		WaitForSingleObject(handles[i], INFINITE);
+		CloseHandle(handles[i]);
+#else
+		pthread_join(handles[i], NULL);
+#endif
+		calls += threads[i].calls;
+		max_latency = OHMD_MAX(max_latency, threads[i].max_latency);
+		for(int j = 0; j < LAT_BUCKETS; j++)
+			hist[j] += threads[i].latency[j];
+	}
+
+	double seconds = elapsed / 1e9;
+	char name[64];
+	snprintf(name, sizeof(name), "getf/setf, %d thread%s", num_threads, num_threads == 1 ? "" : "s");
+
+	printf("   %-40s %12.0f calls/s   p50 %llu ns, p99 %llu ns, p99.9 %llu ns, max %llu ns   update loop %.0f Hz\n",
+		name, calls / seconds,
+		(unsigned long long)lat_percentile(hist, calls, 50.0),
+		(unsigned long long)lat_percentile(hist, calls, 99.0),
+		(unsigned long long)lat_percentile(hist, calls, 99.9),
+		(unsigned long long)max_latency,
+		iterations / seconds);
+}
+
+void bench_contention(void)
+{
+	if(!bench_enabled("contention"))
+		return;
+
+	ohmd_context* ctx = ohmd_ctx_create();
+	int num = ohmd_ctx_probe(ctx);
+
+	ohmd_device_settings* settings = ohmd_device_settings_create(ctx);
+	int auto_update = 1;
+	ohmd_device_settings_seti(settings, OHMD_IDS_AUTOMATIC_UPDATE, &auto_update);
+
+	ohmd_device* devices[CONTENTION_MAX_DEVICES];
+	int num_devices = 0;
+
+	for(int i = 0; i < num && num_devices < CONTENTION_MAX_DEVICES; i++){
+		int flags = 0;
+		ohmd_list_geti(ctx, i, OHMD_DEVICE_FLAGS, &flags);
+
+		if(flags & OHMD_DEVICE_FLAGS_NULL_DEVICE){
+			ohmd_device* dev = ohmd_list_open_device_s(ctx, i, settings);
+			if(dev)
+				devices[num_devices++] = dev;
+		}
+	}
+
+	ohmd_device_settings_destroy(settings);
+
+	if(num_devices == 0){
+		printf("   contention: could not open any null devices\n");
+		ohmd_ctx_destroy(ctx);
+		return;
+	}
+
+	for(int threads = 1; threads <= 8; threads *= 2)
+		run_contention(ctx, devices, num_devices, threads);
+
+	ohmd_ctx_destroy(ctx);
+}
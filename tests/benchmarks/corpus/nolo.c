@@ -0,0 +1,400 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Decoder Corpus - NOLO CV1 Tracker Reports */
+
+// Synthesised from a 1 kHz head motion trace (turning, nodding, gravity and sensor noise),
+// encrypted with the firmware key exactly as they come off the wire (firmware >= 2.0).
+
+#include "../bench.h"
+
+static const unsigned char reports[64][64] = {
+	{
+		0x10, 0x95, 0xbf, 0x4b, 0x84, 0x60, 0xfb, 0x7e, 0x68, 0x41, 0x5d, 0xdd, 0xeb, 0x1f, 0xe3, 0xfc,
+		0x03, 0x63, 0xac, 0xa4, 0xe4, 0x90, 0x05, 0x65, 0x59, 0x45, 0x45, 0xb5, 0x3c, 0xa6, 0x15, 0x91,
+		0xe8, 0x2d, 0xd5, 0x78, 0xcc, 0x7c, 0x1b, 0x5d, 0x52, 0x6f, 0x7f, 0x9a, 0xd5, 0x24, 0x50, 0xf1,
+		0xe7, 0x07, 0x70, 0x8f, 0xb1, 0x2b, 0xf6, 0x8a, 0xa1, 0x91, 0x24, 0x9f, 0xe7, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xa1, 0xc2, 0x3c, 0x45, 0x4b, 0xbd, 0x4e, 0x84, 0xc4, 0x6e, 0xcc, 0x91, 0x77, 0x48, 0xf7,
+		0xd6, 0xef, 0xee, 0x2f, 0xa7, 0xac, 0xb5, 0x4b, 0xb4, 0x9a, 0x5c, 0x76, 0xe7, 0xe4, 0x93, 0x5b,
+		0x2b, 0xad, 0x0f, 0xc2, 0x7e, 0x59, 0x4c, 0xe9, 0xc6, 0xe7, 0xbb, 0x13, 0x42, 0x48, 0x3e, 0x18,
+		0x8f, 0x00, 0xde, 0x11, 0x2d, 0xfa, 0xc0, 0x51, 0x2b, 0x47, 0x6e, 0x79, 0x1a, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xac, 0xc1, 0x7e, 0x7d, 0x7e, 0xda, 0xaa, 0xbe, 0x65, 0xeb, 0x2e, 0xd8, 0xf1, 0x55, 0x85,
+		0x0b, 0x0a, 0x50, 0x75, 0x0c, 0x8b, 0xe4, 0x2e, 0x35, 0xab, 0x9d, 0xb3, 0x12, 0x0a, 0x36, 0x2b,
+		0x34, 0xf6, 0x28, 0x5c, 0xe3, 0x53, 0xe8, 0xfe, 0xcd, 0xfb, 0x62, 0x09, 0x1e, 0x40, 0x76, 0x2e,
+		0xcf, 0x31, 0x46, 0x68, 0x35, 0x0c, 0x36, 0xde, 0x49, 0x0f, 0x6c, 0x00, 0x1a, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xcf, 0x9d, 0x21, 0x69, 0x21, 0x0f, 0x95, 0x49, 0x23, 0x9a, 0x09, 0x62, 0x40, 0x3b, 0x0c,
+		0x19, 0x7e, 0xaf, 0xa5, 0x95, 0x14, 0xa0, 0x5f, 0xde, 0x17, 0x63, 0xce, 0x65, 0xa6, 0x7b, 0xfb,
+		0xf5, 0xf7, 0xaf, 0x4f, 0x00, 0x44, 0x52, 0x2f, 0x41, 0x5f, 0xb3, 0x9a, 0x72, 0xe7, 0xa4, 0x80,
+		0x90, 0x35, 0x4e, 0xc6, 0xb4, 0x3c, 0x10, 0x4d, 0x5d, 0xbc, 0x27, 0x94, 0xd4, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xf9, 0x0f, 0xc4, 0xc9, 0xf0, 0x98, 0x2d, 0xfb, 0x8d, 0xc6, 0xba, 0xd9, 0xea, 0x27, 0xdb,
+		0xb8, 0x15, 0x25, 0x98, 0xb6, 0x07, 0x14, 0x96, 0x47, 0x8e, 0x0d, 0x02, 0x8c, 0x8b, 0xdf, 0x81,
+		0xb4, 0x5e, 0x5a, 0xcd, 0x39, 0x37, 0xf2, 0xc5, 0x13, 0x10, 0xbb, 0x52, 0xe2, 0xc7, 0xa5, 0x6a,
+		0x4f, 0x80, 0xd0, 0x29, 0x6a, 0xfb, 0x64, 0x55, 0x94, 0x00, 0x14, 0x42, 0xda, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x15, 0x52, 0x67, 0x9f, 0x75, 0xb8, 0xa2, 0xe5, 0x0d, 0xc5, 0xb9, 0x6d, 0xff, 0x0b, 0x4c,
+		0x93, 0x14, 0x3f, 0x05, 0xe4, 0xeb, 0xc6, 0x83, 0xcf, 0xe9, 0x21, 0xd8, 0x5c, 0x9a, 0x99, 0x9f,
+		0x7b, 0x83, 0xd5, 0xc9, 0xe0, 0xda, 0xe4, 0x81, 0x1b, 0x91, 0x8c, 0x07, 0x52, 0x7d, 0x65, 0x67,
+		0x81, 0x3e, 0x22, 0x6b, 0xeb, 0x32, 0x84, 0x38, 0xe6, 0x0c, 0x31, 0x2d, 0xf0, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x29, 0x6a, 0x93, 0x7b, 0x28, 0xd5, 0xd9, 0xbe, 0x62, 0x0e, 0xc8, 0x36, 0xc7, 0x52, 0x6d,
+		0xfa, 0x7f, 0xc4, 0x7a, 0x50, 0xb5, 0xa2, 0xea, 0x4d, 0x2f, 0xfc, 0xed, 0xef, 0xd2, 0x6e, 0x8c,
+		0x12, 0x16, 0xaf, 0x16, 0x1f, 0xf0, 0xc9, 0xb8, 0x36, 0x18, 0x88, 0xcb, 0x94, 0xae, 0x92, 0x29,
+		0xd1, 0xab, 0x5c, 0x66, 0x1c, 0xe9, 0xee, 0xad, 0x3c, 0xbb, 0x62, 0x48, 0x1c, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x03, 0x2e, 0xd2, 0x65, 0x8f, 0x08, 0x2f, 0x06, 0x4a, 0x39, 0x89, 0xf9, 0x25, 0xc5, 0xec,
+		0x25, 0xba, 0x6b, 0xab, 0x11, 0xaa, 0xae, 0xfb, 0xd1, 0xc7, 0x6f, 0xec, 0xd6, 0x4f, 0x61, 0x23,
+		0xe6, 0x12, 0xc9, 0x8d, 0x63, 0x32, 0xcb, 0xa7, 0x21, 0x91, 0x0b, 0x15, 0x94, 0x27, 0x7a, 0xa2,
+		0x5a, 0xfc, 0x08, 0x37, 0x8b, 0xa2, 0xf0, 0xba, 0x58, 0xe9, 0x77, 0x67, 0xbf, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xb0, 0x25, 0x60, 0xe9, 0x27, 0x5f, 0x6f, 0x66, 0x51, 0x75, 0x13, 0x20, 0x32, 0x8b, 0x72,
+		0x87, 0x1b, 0xb4, 0xcf, 0x81, 0xc6, 0x74, 0xfa, 0xbd, 0x82, 0x3f, 0x5e, 0x45, 0x4a, 0xb5, 0xd3,
+		0x7d, 0x77, 0x67, 0x2e, 0x27, 0xf4, 0xb1, 0x38, 0xab, 0xcd, 0xfb, 0x2a, 0x3d, 0xc4, 0xda, 0xc1,
+		0x4c, 0xab, 0x27, 0xc1, 0xc1, 0x32, 0x1f, 0x9d, 0x7b, 0xc2, 0x61, 0x82, 0x88, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xd2, 0x57, 0x50, 0x5a, 0x28, 0x0a, 0xc6, 0x80, 0xde, 0x9f, 0xb3, 0xc9, 0xeb, 0xe6, 0x7a,
+		0x48, 0x24, 0x36, 0xaa, 0x2f, 0x99, 0xe9, 0x99, 0x19, 0xd8, 0xba, 0x14, 0x69, 0x4d, 0x4d, 0x61,
+		0x3e, 0xbe, 0x37, 0x44, 0xa7, 0x90, 0x4a, 0xe3, 0xa3, 0xa1, 0x51, 0x88, 0xcb, 0xbf, 0xae, 0x34,
+		0x28, 0x48, 0xfd, 0xec, 0x0a, 0x36, 0xa2, 0x37, 0x42, 0x7e, 0x12, 0x20, 0x35, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x70, 0x43, 0xfb, 0xa1, 0xe4, 0x42, 0x7e, 0x02, 0x2d, 0x97, 0x67, 0x16, 0x02, 0x95, 0x32,
+		0x10, 0x26, 0x2c, 0xe0, 0x24, 0x5e, 0x14, 0xf7, 0xd4, 0x01, 0x68, 0x52, 0x8a, 0x43, 0x5c, 0x5b,
+		0x27, 0xa0, 0xe2, 0xbd, 0xd1, 0xae, 0xb0, 0x86, 0x44, 0x68, 0xf8, 0x60, 0x6a, 0xf9, 0xc3, 0x9a,
+		0xc0, 0xe5, 0xa5, 0x61, 0xd5, 0x1c, 0xb6, 0x2d, 0x27, 0x0b, 0x2c, 0xfb, 0x57, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x6a, 0xb1, 0x8a, 0x8c, 0xce, 0xb2, 0x54, 0x1f, 0x18, 0x7d, 0x84, 0x6d, 0x52, 0x37, 0xeb,
+		0xaa, 0x7a, 0x2c, 0x1c, 0xcf, 0xd9, 0xfe, 0x0c, 0x37, 0xce, 0xce, 0x43, 0xc6, 0x1e, 0xaa, 0xb5,
+		0x46, 0x0d, 0x53, 0x42, 0x3c, 0x45, 0x0f, 0x90, 0x37, 0x13, 0x28, 0xfb, 0xcf, 0x8b, 0xa7, 0x56,
+		0x80, 0x06, 0x8d, 0xa1, 0xf8, 0x13, 0x49, 0x49, 0x1f, 0xe3, 0x40, 0xed, 0x20, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x57, 0x91, 0x45, 0x58, 0x4a, 0xd5, 0x33, 0x16, 0xcb, 0x1d, 0x08, 0x35, 0x6d, 0xaf, 0x65,
+		0x9d, 0x80, 0x58, 0x22, 0x1b, 0xc8, 0xc2, 0x10, 0x92, 0x5c, 0x87, 0xfa, 0x39, 0xee, 0x04, 0xca,
+		0xf0, 0x4c, 0xb7, 0x37, 0x39, 0x97, 0x12, 0x15, 0x7d, 0x73, 0x2e, 0xbb, 0x21, 0xb4, 0xdf, 0xc8,
+		0x17, 0x3d, 0x61, 0xab, 0x24, 0xa6, 0xbe, 0xcc, 0x20, 0xfd, 0xae, 0xf8, 0xa2, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x8a, 0xb0, 0x6c, 0xb9, 0x02, 0xdd, 0xd0, 0x73, 0x2e, 0x62, 0xb5, 0x8a, 0x80, 0xb4, 0x8d,
+		0x61, 0x33, 0xbb, 0x04, 0xd1, 0xb8, 0x66, 0x17, 0x3a, 0x55, 0x04, 0xc5, 0x8e, 0x0c, 0x76, 0xf7,
+		0xe8, 0x45, 0x13, 0xd5, 0x89, 0x5c, 0x24, 0xe1, 0x83, 0xcc, 0x46, 0x94, 0x8c, 0x3d, 0xad, 0xd7,
+		0xe0, 0x5b, 0x93, 0x84, 0x68, 0x73, 0x6c, 0x3f, 0x70, 0x73, 0x8d, 0xf7, 0x39, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x3a, 0x35, 0xcd, 0xde, 0x49, 0xb7, 0x3b, 0x13, 0x17, 0xec, 0xae, 0x26, 0x62, 0xe7, 0x10,
+		0xce, 0x25, 0x56, 0x2d, 0x03, 0x3d, 0x34, 0x92, 0xdb, 0x24, 0xd0, 0x6e, 0xbb, 0x16, 0x30, 0x76,
+		0xe0, 0xbf, 0xe1, 0xed, 0xe4, 0x47, 0x08, 0x08, 0x30, 0x28, 0xe7, 0xc4, 0xc6, 0xb7, 0xe3, 0x68,
+		0x2a, 0x66, 0x06, 0xfc, 0xaa, 0x2a, 0xfe, 0xe0, 0xa7, 0xee, 0xa1, 0xd8, 0x91, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x07, 0xf6, 0x47, 0xf8, 0x62, 0x82, 0x60, 0xc0, 0xc8, 0x8b, 0x18, 0xd2, 0xdc, 0x7d, 0x1a,
+		0xbb, 0xb4, 0x71, 0xa7, 0x2f, 0xc9, 0x50, 0x66, 0x02, 0x73, 0x0b, 0xd9, 0x95, 0x7f, 0xf8, 0xab,
+		0xca, 0xcd, 0x43, 0xcb, 0x25, 0x0c, 0xf7, 0xe2, 0xba, 0x45, 0x4f, 0x96, 0xae, 0x30, 0x2d, 0xce,
+		0x18, 0xdc, 0xd1, 0x15, 0xe4, 0x82, 0xc2, 0x44, 0x58, 0x7e, 0xeb, 0xbe, 0xc4, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x40, 0x08, 0x8b, 0x12, 0xd2, 0x7d, 0x53, 0x28, 0xb5, 0x28, 0x6b, 0x50, 0xb3, 0x81, 0xe0,
+		0x2e, 0x25, 0x6d, 0x55, 0xcc, 0x3b, 0x61, 0x05, 0xbe, 0x6c, 0x8c, 0x1f, 0x72, 0x7c, 0xfb, 0xf7,
+		0x5d, 0xd9, 0xea, 0xa0, 0x9c, 0x00, 0xb9, 0xbf, 0x0d, 0xf4, 0x8e, 0x36, 0x11, 0xb5, 0xfb, 0x87,
+		0xbe, 0x93, 0x0f, 0xdf, 0xa4, 0x73, 0xc0, 0xe9, 0x9c, 0xfc, 0x7d, 0xe1, 0x76, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xcf, 0xcb, 0xfd, 0x29, 0xde, 0xc5, 0x3e, 0x97, 0x24, 0x53, 0xec, 0x72, 0x76, 0x92, 0x33,
+		0x1b, 0x2e, 0x38, 0x75, 0xe9, 0x8e, 0xc2, 0x44, 0x40, 0xf8, 0xb6, 0x35, 0x1b, 0x34, 0x44, 0x74,
+		0xa3, 0xef, 0xd0, 0x18, 0x7d, 0xeb, 0xc4, 0x60, 0xeb, 0xac, 0x3c, 0xb9, 0x26, 0xe0, 0x6e, 0x63,
+		0xe9, 0x11, 0xfa, 0xcb, 0x91, 0xae, 0xeb, 0x6a, 0xed, 0xd6, 0xa3, 0x78, 0x34, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x4e, 0x82, 0xfe, 0xb5, 0x0f, 0xa4, 0xb1, 0x84, 0x19, 0x1c, 0x6b, 0x3d, 0x39, 0x8c, 0x72,
+		0x24, 0xec, 0x23, 0x62, 0x19, 0xbc, 0xb8, 0x8d, 0x7e, 0x1e, 0xdf, 0x60, 0x3e, 0xf2, 0x9f, 0x90,
+		0x26, 0x4c, 0x14, 0x23, 0xdb, 0x10, 0x86, 0x0d, 0x9e, 0xf0, 0xec, 0x16, 0x5e, 0xb4, 0x56, 0x50,
+		0x3e, 0xcf, 0x39, 0xc7, 0x28, 0x76, 0xc1, 0xf2, 0x49, 0x9c, 0x22, 0x92, 0x89, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x54, 0x3d, 0x30, 0xe5, 0x0f, 0x6f, 0x86, 0x5c, 0xe9, 0x5c, 0xea, 0x6f, 0xcf, 0xa2, 0x25,
+		0x01, 0x33, 0xbb, 0x4d, 0x5c, 0x56, 0x49, 0x8a, 0x9d, 0x4e, 0x1d, 0xc8, 0xbe, 0x63, 0xd7, 0x72,
+		0x31, 0x13, 0x40, 0xcf, 0x49, 0x83, 0x75, 0x08, 0x10, 0xa2, 0x61, 0x13, 0x70, 0x8f, 0x4e, 0x2a,
+		0xf4, 0x24, 0x48, 0x61, 0xcc, 0x30, 0x39, 0x41, 0x1f, 0x60, 0x7d, 0x60, 0xf3, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xed, 0xc2, 0xc8, 0xec, 0xce, 0x52, 0x6d, 0x6e, 0x99, 0xcf, 0xbd, 0x64, 0xbb, 0xa4, 0x9e,
+		0xc3, 0xef, 0x37, 0x67, 0xba, 0x3e, 0x4e, 0x7b, 0xb7, 0x48, 0x34, 0xae, 0xd8, 0x6d, 0x9f, 0x56,
+		0x09, 0xae, 0x2d, 0x6c, 0x5f, 0xf5, 0x51, 0x42, 0x63, 0xe0, 0x40, 0x93, 0xc3, 0x43, 0xc8, 0x38,
+		0x8c, 0xb6, 0x3a, 0xab, 0xf0, 0x83, 0x21, 0xce, 0x9a, 0xa1, 0x80, 0x4c, 0x74, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x42, 0x37, 0x39, 0x6b, 0x0b, 0x18, 0xa3, 0xf2, 0x6a, 0xaa, 0xda, 0xa5, 0xbd, 0x72, 0xe8,
+		0xf2, 0x6f, 0x23, 0xfd, 0xf2, 0xd8, 0x1d, 0xfc, 0x01, 0x18, 0x28, 0x1b, 0xf8, 0x1a, 0x45, 0x84,
+		0xaf, 0x60, 0x0e, 0x15, 0xd2, 0xbf, 0x71, 0x4d, 0x6f, 0xb6, 0xa3, 0x28, 0xfa, 0xed, 0x4a, 0x61,
+		0xa7, 0x75, 0xe8, 0x70, 0xaf, 0x30, 0xa0, 0x8f, 0x46, 0xb0, 0xf1, 0x0c, 0xf7, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x60, 0xd4, 0x98, 0x06, 0x5d, 0xb4, 0xc6, 0xc8, 0x9d, 0xf4, 0x50, 0x80, 0xe7, 0xe1, 0x0f,
+		0xe8, 0x95, 0x1b, 0xfc, 0x01, 0xaa, 0xa3, 0x30, 0x63, 0x75, 0x15, 0x64, 0x28, 0xa2, 0xcc, 0x6b,
+		0x9c, 0x5c, 0x73, 0xf7, 0x99, 0x40, 0x54, 0x1d, 0xd4, 0x1c, 0x66, 0x98, 0x7b, 0xf8, 0x5e, 0xaa,
+		0xa9, 0xc4, 0x14, 0x6b, 0x90, 0xff, 0x8b, 0xac, 0xcb, 0xbe, 0xca, 0x31, 0x54, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x98, 0x42, 0x1a, 0x7e, 0x47, 0x0d, 0x59, 0x4a, 0x86, 0x6a, 0x3a, 0x77, 0xb0, 0xe6, 0x21,
+		0x8c, 0xcb, 0xfe, 0xe8, 0x8c, 0x4d, 0x31, 0x2d, 0x78, 0x4e, 0x59, 0x3d, 0x5f, 0xb4, 0x3c, 0xcc,
+		0x85, 0xfd, 0x64, 0x68, 0xd6, 0x6e, 0x4c, 0xb8, 0xe2, 0x1d, 0xf7, 0x2f, 0x10, 0xc6, 0x83, 0xc8,
+		0x56, 0x7f, 0x70, 0x1b, 0x94, 0xd1, 0xf1, 0x16, 0x4e, 0xc6, 0x88, 0x26, 0x8e, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x4d, 0xb9, 0x72, 0xde, 0xf6, 0x59, 0x43, 0x85, 0xc8, 0x5c, 0x32, 0x0d, 0xbf, 0x02, 0xb4,
+		0x0a, 0x19, 0x90, 0x1b, 0xcc, 0xc8, 0x2d, 0xfd, 0x38, 0xd9, 0xb5, 0x48, 0xed, 0x0c, 0x0e, 0x19,
+		0x97, 0xec, 0x79, 0x55, 0x81, 0x99, 0x1b, 0x40, 0xfc, 0x45, 0xfd, 0xca, 0x87, 0xf8, 0xae, 0xca,
+		0x78, 0xa6, 0xbd, 0x11, 0x24, 0x50, 0xc5, 0xac, 0xd6, 0x86, 0xd1, 0xec, 0x20, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x07, 0x77, 0x85, 0x13, 0xa2, 0x91, 0xc8, 0x83, 0xde, 0x10, 0x4f, 0x53, 0xa7, 0xe7, 0x1d,
+		0x97, 0xfa, 0xf4, 0x18, 0x00, 0xf6, 0x5a, 0xc6, 0x95, 0x15, 0xe3, 0x93, 0x2b, 0x53, 0xaf, 0x97,
+		0xbe, 0xe1, 0x8f, 0x18, 0xa6, 0x83, 0xe6, 0xfe, 0xdf, 0x1a, 0x1b, 0xc9, 0x2c, 0x5e, 0xba, 0xa7,
+		0x1f, 0xc2, 0xd7, 0x6b, 0x09, 0xc2, 0xcc, 0xb9, 0x77, 0x5b, 0x1a, 0x40, 0x8e, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x1f, 0x33, 0xee, 0x54, 0x8c, 0x67, 0xd6, 0x64, 0x5d, 0x1b, 0x8a, 0x24, 0x75, 0xdb, 0x3f,
+		0xbe, 0x39, 0xbf, 0xdd, 0x74, 0xa4, 0x88, 0xf7, 0x9d, 0x64, 0xbf, 0x9e, 0xfb, 0x7a, 0x61, 0x01,
+		0xeb, 0x51, 0xe6, 0x51, 0xc5, 0x98, 0x51, 0xa9, 0x0e, 0x88, 0xd2, 0xc0, 0x35, 0x1b, 0x8b, 0x3e,
+		0x69, 0xe8, 0xc2, 0xa6, 0x32, 0x57, 0xb7, 0x33, 0xa7, 0xee, 0x5a, 0x3f, 0xf0, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x05, 0xa6, 0x98, 0x4b, 0x7a, 0x3a, 0xcf, 0x2c, 0x30, 0xee, 0x82, 0x76, 0x8d, 0x48, 0x88,
+		0xda, 0x76, 0x79, 0x8e, 0xa7, 0x3b, 0xc2, 0x47, 0x6d, 0x3f, 0xff, 0x81, 0x3d, 0xc0, 0xcb, 0x23,
+		0x79, 0x89, 0x12, 0x30, 0x34, 0x9a, 0x67, 0x22, 0xae, 0x99, 0xe2, 0xfd, 0xdd, 0xde, 0xec, 0x7c,
+		0xf5, 0x19, 0x02, 0xd8, 0x65, 0x42, 0xde, 0xdc, 0xe7, 0x45, 0x89, 0x8c, 0x86, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x8b, 0x1e, 0xe3, 0xd3, 0xe8, 0x85, 0x62, 0xa7, 0xf3, 0xbb, 0xf7, 0xef, 0xb5, 0xb4, 0x24,
+		0x9c, 0x86, 0x4b, 0x80, 0xf3, 0x46, 0x76, 0xad, 0x4e, 0x45, 0xca, 0x53, 0xf5, 0x2d, 0x73, 0xed,
+		0xf5, 0x44, 0x7f, 0xa4, 0xec, 0xdc, 0xfe, 0xd1, 0x36, 0xa0, 0x92, 0xf0, 0x79, 0x03, 0x7e, 0x8d,
+		0xce, 0x37, 0x83, 0xf9, 0x5d, 0xb1, 0x11, 0x60, 0x32, 0xb9, 0xf0, 0xfa, 0xfb, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xba, 0xee, 0x8a, 0xb7, 0x61, 0x78, 0x1c, 0xa6, 0xcb, 0x42, 0xde, 0x58, 0x14, 0x79, 0x66,
+		0x68, 0x5c, 0xe0, 0x58, 0x49, 0xe0, 0x19, 0xba, 0x06, 0x47, 0x73, 0x17, 0xd7, 0x7e, 0xfe, 0x78,
+		0xce, 0x7f, 0x90, 0xea, 0xa5, 0xc6, 0x79, 0x94, 0xa2, 0xc3, 0xff, 0x98, 0x0f, 0x50, 0x17, 0x51,
+		0xb2, 0xba, 0xfc, 0x91, 0xaf, 0xa8, 0x69, 0x80, 0xc7, 0x41, 0x24, 0x11, 0xe3, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xb8, 0x85, 0x96, 0xb4, 0x03, 0x3e, 0x6e, 0xed, 0x2f, 0x57, 0xf2, 0x51, 0x21, 0xb2, 0xae,
+		0x20, 0x30, 0x06, 0xad, 0xbc, 0x28, 0xbe, 0x17, 0xed, 0x98, 0xd4, 0xc9, 0xb4, 0x9d, 0x4f, 0x20,
+		0xc9, 0x7b, 0xc4, 0xcc, 0x55, 0x94, 0xef, 0xe2, 0x9d, 0x5f, 0x9f, 0xf1, 0x4a, 0xb7, 0x77, 0xa2,
+		0xc2, 0xd1, 0x5f, 0x81, 0xd8, 0xa3, 0xc9, 0xd8, 0x83, 0x9d, 0x89, 0x73, 0xd8, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x6b, 0x28, 0x42, 0x6e, 0xf4, 0xa9, 0x50, 0x96, 0xc5, 0x19, 0x73, 0x67, 0x10, 0x30, 0xe6,
+		0xd0, 0x90, 0x04, 0x12, 0xf0, 0x8f, 0xd8, 0x29, 0x47, 0x43, 0xdc, 0x89, 0xbf, 0xb9, 0xdb, 0xb8,
+		0xb2, 0x55, 0x95, 0x7e, 0x71, 0xea, 0x40, 0x0b, 0x46, 0xeb, 0x1f, 0x3b, 0xf7, 0x8a, 0xcd, 0x5c,
+		0x2b, 0x89, 0xd1, 0xcf, 0xc1, 0x15, 0x70, 0xd2, 0x2d, 0xb6, 0xf9, 0xc0, 0x13, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x47, 0x5c, 0x97, 0xc9, 0x1b, 0xa2, 0x5e, 0x82, 0x01, 0x7e, 0xa2, 0x79, 0x01, 0x98, 0x31,
+		0xcb, 0xc6, 0xe5, 0xea, 0x7c, 0x80, 0x8d, 0x4c, 0xb7, 0xe3, 0x5e, 0x2b, 0x73, 0x3b, 0x62, 0xde,
+		0x32, 0x4c, 0xb3, 0x0c, 0x0f, 0xf7, 0xfa, 0xc7, 0x65, 0xce, 0xbf, 0xdb, 0xad, 0xe4, 0x2a, 0x68,
+		0xa4, 0x1c, 0xd7, 0x6e, 0x60, 0x1b, 0x32, 0x2a, 0xdd, 0x92, 0x57, 0x0d, 0xad, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xc9, 0x2c, 0xa1, 0x7a, 0x1c, 0x5d, 0x87, 0x3a, 0xa2, 0x81, 0xd2, 0xd5, 0x63, 0x77, 0x39,
+		0x7f, 0x47, 0xcb, 0x03, 0x35, 0xe7, 0x80, 0x40, 0x77, 0xdb, 0x3f, 0x54, 0x2c, 0xe2, 0x5e, 0x3d,
+		0x00, 0x83, 0xb4, 0xe2, 0x0a, 0xb0, 0xcc, 0x37, 0xe9, 0x04, 0x5a, 0xbf, 0x9c, 0xc3, 0xe9, 0x8e,
+		0xbf, 0x6c, 0x66, 0x1b, 0xf4, 0xb0, 0x15, 0x52, 0x2e, 0xdf, 0x8b, 0xa0, 0x73, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x77, 0x79, 0xa4, 0xd2, 0xcd, 0x71, 0x73, 0x80, 0x94, 0x5f, 0xe7, 0xc3, 0xd1, 0x7a, 0xab,
+		0xaa, 0x2e, 0x45, 0xb1, 0xfe, 0x61, 0x2b, 0x8a, 0x79, 0x23, 0x7b, 0x0d, 0x89, 0x42, 0x1e, 0x3a,
+		0x87, 0x3d, 0xae, 0x6e, 0x28, 0x39, 0x13, 0x9d, 0x08, 0x3e, 0x31, 0xf3, 0xc4, 0xe7, 0x43, 0x33,
+		0xe4, 0x09, 0x85, 0x7c, 0x82, 0x0d, 0xb0, 0xc0, 0x3e, 0xdf, 0x88, 0x72, 0x4f, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x82, 0x4b, 0x01, 0x86, 0x1b, 0x5f, 0x56, 0xed, 0x79, 0x51, 0x27, 0xa4, 0xf9, 0xa5, 0x85,
+		0x91, 0x9e, 0xa9, 0x4e, 0x80, 0xad, 0xec, 0xd8, 0x53, 0x66, 0x55, 0xf5, 0x5e, 0x30, 0x44, 0x06,
+		0x96, 0xf6, 0x78, 0x74, 0x3d, 0xb5, 0x18, 0x78, 0x73, 0x7b, 0x4c, 0x10, 0x9a, 0xf3, 0x83, 0x02,
+		0x9d, 0x40, 0xea, 0xf1, 0x79, 0x3b, 0x12, 0x85, 0xff, 0x19, 0xc7, 0x50, 0x88, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xca, 0x01, 0x22, 0x3e, 0xe8, 0x0c, 0x59, 0xeb, 0x1c, 0xd6, 0xf6, 0xc5, 0x87, 0xe0, 0xc8,
+		0x9e, 0xcc, 0x56, 0x8d, 0xca, 0x32, 0x05, 0x6f, 0xe9, 0x60, 0x42, 0x37, 0x22, 0x97, 0x9c, 0xda,
+		0xc0, 0x92, 0x3e, 0xd9, 0x4f, 0xf1, 0xd6, 0x27, 0x5f, 0x61, 0xd5, 0xf2, 0x5f, 0x19, 0x13, 0xc4,
+		0xb1, 0xfe, 0xbc, 0x88, 0x54, 0x90, 0x31, 0x17, 0x84, 0x1b, 0x32, 0xbd, 0xb2, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x32, 0xf8, 0xcb, 0x2f, 0xd8, 0xdf, 0x76, 0x78, 0xa4, 0x37, 0x5c, 0xd7, 0xb3, 0xaa, 0x9f,
+		0xc2, 0x82, 0xf5, 0xdc, 0x91, 0xea, 0x1f, 0x51, 0x9d, 0x98, 0x0c, 0x38, 0x3d, 0x3b, 0xa2, 0x66,
+		0x23, 0xd6, 0x2d, 0xa3, 0xb2, 0x94, 0xa4, 0xb2, 0x72, 0x37, 0x67, 0x0d, 0x6f, 0xda, 0x46, 0xa4,
+		0xc5, 0x38, 0x9e, 0x5f, 0x38, 0xd2, 0x5c, 0xdd, 0x54, 0xc7, 0xdc, 0x38, 0x91, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x49, 0x0d, 0xc3, 0xf1, 0x16, 0xc6, 0xe2, 0x91, 0x2a, 0x0e, 0xad, 0xa6, 0x4b, 0x69, 0x08,
+		0x3a, 0xe4, 0x7d, 0xaf, 0x7e, 0xdc, 0x5a, 0x7d, 0x03, 0x04, 0x91, 0xed, 0xe3, 0xf1, 0x28, 0x84,
+		0x72, 0xbf, 0xb2, 0x46, 0x2b, 0x11, 0x21, 0x12, 0x38, 0x6e, 0xa9, 0xc8, 0x8d, 0x8f, 0xb5, 0x97,
+		0x06, 0x63, 0x80, 0xc4, 0x4a, 0x34, 0xc2, 0x04, 0xe1, 0xab, 0x7f, 0x49, 0x27, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xed, 0x91, 0x69, 0xec, 0xae, 0x25, 0x26, 0xd7, 0xb3, 0x78, 0x72, 0xf1, 0x2d, 0xde, 0x04,
+		0x8c, 0xc3, 0x27, 0xce, 0xe2, 0x71, 0x69, 0xd6, 0xf9, 0xa1, 0xe1, 0x80, 0x62, 0x41, 0x21, 0x8b,
+		0x8f, 0xd7, 0x56, 0xdf, 0x1e, 0x9d, 0x73, 0xa0, 0x3b, 0xec, 0x10, 0x01, 0x64, 0xfe, 0xf0, 0x90,
+		0xa8, 0x73, 0xd2, 0xba, 0x30, 0x11, 0xc3, 0x2e, 0x1c, 0x75, 0x68, 0xa0, 0x6f, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xf8, 0x4e, 0x75, 0xf7, 0xad, 0x33, 0x43, 0xe9, 0x28, 0x12, 0xcf, 0x50, 0x9a, 0x8c, 0x07,
+		0xc8, 0x01, 0xef, 0x1f, 0xa8, 0xdb, 0x23, 0x2d, 0xc8, 0x2f, 0xa3, 0xd6, 0xcd, 0x03, 0x5f, 0x11,
+		0x90, 0x44, 0xc8, 0x49, 0x4b, 0xef, 0xd3, 0x53, 0xe1, 0xe3, 0xa0, 0x29, 0x36, 0x92, 0x00, 0xb4,
+		0x7b, 0x4a, 0x60, 0x7e, 0x39, 0x0e, 0x8c, 0xf6, 0x05, 0xea, 0x56, 0x46, 0x8f, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xcd, 0xf0, 0x0c, 0xa1, 0x95, 0xdc, 0xb2, 0xb1, 0xda, 0x5b, 0x3f, 0x6c, 0x7f, 0x2f, 0x8e,
+		0x08, 0xd9, 0x76, 0xa2, 0x3a, 0x45, 0x7a, 0x9b, 0x0e, 0x3a, 0x5d, 0x09, 0xd9, 0x78, 0x0f, 0x47,
+		0x78, 0x9c, 0x5f, 0x99, 0xea, 0xb3, 0x99, 0x6f, 0x6c, 0xb8, 0x7b, 0xab, 0x0a, 0xd9, 0x9d, 0x3b,
+		0x9c, 0x7a, 0xa7, 0x3a, 0x22, 0x74, 0x9c, 0x98, 0xcd, 0xda, 0x7f, 0x43, 0xab, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x88, 0x6f, 0x35, 0x86, 0x12, 0x5f, 0x8c, 0x45, 0xae, 0x4a, 0x5e, 0xac, 0x5c, 0x5f, 0xbd,
+		0x45, 0x10, 0x26, 0xa1, 0xa9, 0x82, 0xec, 0x2f, 0x6b, 0x5f, 0xa4, 0xb4, 0x17, 0xd7, 0x46, 0xd6,
+		0xc0, 0xa5, 0xf9, 0x7a, 0x4e, 0x60, 0x82, 0x41, 0xa2, 0xca, 0x76, 0x84, 0x95, 0x99, 0x54, 0x0e,
+		0x55, 0x4a, 0x09, 0x43, 0x84, 0x31, 0xe0, 0x85, 0x90, 0xaa, 0xa6, 0x6e, 0xca, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xee, 0x7d, 0xa2, 0x44, 0x83, 0xe4, 0x9d, 0x84, 0xe5, 0xa9, 0x7b, 0x81, 0x46, 0xea, 0x2b,
+		0xc4, 0xc4, 0xba, 0xc1, 0x99, 0x16, 0xf8, 0xfa, 0xb5, 0x81, 0x2a, 0x51, 0xc0, 0x1b, 0x48, 0x94,
+		0x9b, 0x96, 0x1f, 0x61, 0x45, 0x82, 0xb2, 0x29, 0xd4, 0xc3, 0x55, 0x6f, 0xcb, 0xa8, 0xd4, 0x61,
+		0x81, 0x4a, 0x2b, 0xaf, 0x62, 0x6c, 0xa1, 0x44, 0x75, 0x9f, 0x55, 0xc5, 0x72, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x7c, 0xac, 0x98, 0x3c, 0x31, 0x8c, 0x4b, 0x68, 0xdf, 0x38, 0x9f, 0x0a, 0x8d, 0xe0, 0x25,
+		0xaa, 0xbf, 0x94, 0xbc, 0xf9, 0x7d, 0xf9, 0x86, 0x67, 0x37, 0xd6, 0x7a, 0x87, 0x54, 0x18, 0x3b,
+		0x32, 0x75, 0xb9, 0xb0, 0x56, 0x0c, 0xc7, 0x50, 0x11, 0xf3, 0xd0, 0x7e, 0xe3, 0x7c, 0x10, 0x20,
+		0x65, 0x00, 0x45, 0xc0, 0x32, 0x41, 0x26, 0x16, 0x4d, 0x3e, 0xc3, 0x28, 0xfd, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xfe, 0x30, 0xc5, 0x90, 0x9f, 0x62, 0x82, 0x54, 0xe0, 0xa4, 0xf7, 0x35, 0x4c, 0x49, 0xca,
+		0x75, 0x0b, 0x25, 0x9f, 0xe1, 0x9d, 0x9a, 0x78, 0x86, 0x6e, 0xeb, 0x95, 0x77, 0xd7, 0x26, 0x81,
+		0xca, 0x64, 0xa9, 0x6f, 0x1a, 0xb6, 0x4f, 0xe9, 0x74, 0xcc, 0x43, 0x21, 0x80, 0x88, 0x7c, 0xe4,
+		0x11, 0xdd, 0x63, 0x17, 0xa7, 0xfe, 0x2d, 0xc1, 0x05, 0xb6, 0xd3, 0x74, 0xea, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x74, 0xd2, 0x14, 0x2b, 0x74, 0xe1, 0x08, 0x52, 0x7c, 0xf0, 0xa7, 0x2c, 0x3a, 0x73, 0xcb,
+		0x76, 0x8d, 0x47, 0x00, 0x0d, 0x84, 0xcf, 0x37, 0xa5, 0xfe, 0xc0, 0x2b, 0xe9, 0x83, 0x47, 0xcd,
+		0x3e, 0x87, 0xef, 0xb5, 0x19, 0xc9, 0x24, 0x5e, 0x54, 0xca, 0xa6, 0x14, 0x3f, 0x2f, 0x87, 0xe7,
+		0xf1, 0x0f, 0x42, 0xf7, 0x22, 0x56, 0x04, 0x2e, 0x5f, 0xf4, 0x7d, 0xd5, 0xca, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x3b, 0x2b, 0xac, 0xb5, 0x6b, 0xec, 0x4d, 0xec, 0x65, 0x09, 0xe3, 0xd4, 0x22, 0x59, 0x69,
+		0x9f, 0xfb, 0xb4, 0x21, 0x59, 0xed, 0x0b, 0x7e, 0xa5, 0xdd, 0xf8, 0x1c, 0x8e, 0x09, 0xac, 0x1f,
+		0x32, 0xff, 0x6a, 0x05, 0x4e, 0xf8, 0x6e, 0x1d, 0xee, 0x1a, 0x1b, 0x30, 0x20, 0xb2, 0x0d, 0x13,
+		0x13, 0x03, 0x67, 0x6b, 0x2f, 0x09, 0x15, 0x10, 0x60, 0x9e, 0xc1, 0x2c, 0x97, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x42, 0xd8, 0x08, 0x2e, 0x0b, 0x4b, 0xda, 0x51, 0xde, 0xdf, 0x4f, 0x2a, 0xd0, 0x5d, 0x17,
+		0xd7, 0x96, 0xa0, 0x19, 0x9b, 0x4f, 0xe1, 0x99, 0x26, 0xa8, 0x91, 0x6c, 0x78, 0xaa, 0x4a, 0x35,
+		0x35, 0xff, 0x80, 0xeb, 0x5f, 0x4d, 0x34, 0xe7, 0xce, 0x87, 0xb6, 0x51, 0x85, 0xbb, 0x69, 0x2b,
+		0xf4, 0xc8, 0x47, 0x82, 0x43, 0xe5, 0xbb, 0xbe, 0x92, 0x28, 0xa5, 0x41, 0x39, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x8f, 0x65, 0xd3, 0xee, 0x5e, 0x16, 0x30, 0x9d, 0xd3, 0xf6, 0x8d, 0xad, 0x37, 0xd8, 0xdd,
+		0xcd, 0xc1, 0xfe, 0xad, 0x2d, 0xaf, 0x7b, 0x0e, 0xae, 0x31, 0x2e, 0x19, 0x0c, 0x8f, 0xc4, 0xf5,
+		0x97, 0x7e, 0x64, 0xea, 0x89, 0xf4, 0x27, 0xf3, 0xf4, 0xf8, 0x06, 0x8a, 0x6c, 0x29, 0x5a, 0x76,
+		0x0e, 0xd8, 0x85, 0xf8, 0xc3, 0xf8, 0x7c, 0x43, 0xb1, 0x65, 0x88, 0xb0, 0x56, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x42, 0x35, 0x5d, 0x1a, 0x88, 0xab, 0xcd, 0xa6, 0x81, 0x99, 0x1c, 0xe4, 0xc8, 0x21, 0x75,
+		0x62, 0xeb, 0xe8, 0x8e, 0xae, 0x05, 0x13, 0x2a, 0xad, 0x6f, 0x2b, 0x06, 0x36, 0xaf, 0x89, 0xef,
+		0x11, 0xab, 0x17, 0xf0, 0xda, 0xa8, 0x3b, 0xad, 0x03, 0x85, 0x01, 0xbb, 0x04, 0xe3, 0x18, 0x8d,
+		0x36, 0xd7, 0xfb, 0x29, 0x30, 0x8d, 0x72, 0xbf, 0x87, 0xfe, 0xc5, 0x86, 0x61, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xb3, 0x02, 0x3a, 0xa2, 0x06, 0x67, 0x3b, 0xf7, 0x9f, 0x93, 0x32, 0x9f, 0xc4, 0xf3, 0xed,
+		0xf8, 0x88, 0x84, 0x91, 0xb9, 0x83, 0x82, 0xec, 0x9f, 0xb1, 0x9a, 0xc9, 0x5c, 0x81, 0x53, 0x0e,
+		0xb6, 0xfe, 0x6f, 0x31, 0x24, 0x89, 0x43, 0x83, 0x2d, 0xbd, 0x9d, 0x47, 0xea, 0x5b, 0x63, 0x02,
+		0xf4, 0xfb, 0xf6, 0x99, 0x91, 0x18, 0x9b, 0x47, 0xa5, 0x64, 0xa7, 0x86, 0x78, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xb8, 0xf5, 0x88, 0x18, 0x71, 0x70, 0xc1, 0x9e, 0x2e, 0x0d, 0x7b, 0x82, 0xd8, 0x0b, 0x0d,
+		0x47, 0xc4, 0x4c, 0x48, 0x47, 0x83, 0x3f, 0x30, 0xf0, 0xb2, 0x52, 0xae, 0x15, 0x06, 0xf3, 0xd9,
+		0x3c, 0x4b, 0xbb, 0x36, 0x6e, 0x67, 0x82, 0x0c, 0x8f, 0x49, 0xb0, 0x83, 0x9a, 0xbb, 0x1f, 0x5e,
+		0x26, 0xfa, 0xcb, 0x99, 0x68, 0x21, 0xff, 0xab, 0x7e, 0x50, 0xc0, 0x4d, 0x18, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xe8, 0x7f, 0x38, 0xb0, 0x56, 0x19, 0x82, 0xcc, 0xad, 0x62, 0xc8, 0x53, 0xb0, 0x62, 0x77,
+		0x48, 0x15, 0x71, 0x2d, 0xd8, 0x8e, 0x50, 0xe3, 0xa7, 0xff, 0xa6, 0x55, 0xee, 0xa7, 0x02, 0x0a,
+		0x0a, 0xa7, 0x51, 0xd8, 0xe3, 0xe3, 0x52, 0x7a, 0xd3, 0x56, 0x8c, 0x2b, 0x5d, 0xfa, 0xed, 0x26,
+		0xd3, 0x15, 0x6a, 0x47, 0xa3, 0x6b, 0x5d, 0xca, 0xfe, 0x1b, 0xf5, 0xcd, 0xf5, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xb5, 0x30, 0xf4, 0x52, 0x20, 0x54, 0x5a, 0x2c, 0xd8, 0xc3, 0x3b, 0x5e, 0x5e, 0xdf, 0x8f,
+		0x28, 0xe6, 0x0e, 0x3d, 0xae, 0xcb, 0x88, 0x9f, 0x2d, 0x7f, 0xf0, 0x17, 0xf4, 0xaf, 0xfc, 0x8c,
+		0x1c, 0x4f, 0xe1, 0xc4, 0x5e, 0xd1, 0xdb, 0x1b, 0x7a, 0x3a, 0x5f, 0xcb, 0x95, 0xd2, 0xf1, 0x7e,
+		0x57, 0x5c, 0x10, 0xc6, 0x0a, 0xec, 0x5c, 0xff, 0xf0, 0xda, 0xab, 0x65, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xd3, 0x47, 0x62, 0x3d, 0xe8, 0xd5, 0x82, 0x89, 0x64, 0x9c, 0x74, 0x0b, 0x5e, 0xd3, 0x6c,
+		0x14, 0xa4, 0x24, 0x1e, 0x72, 0x1f, 0xfa, 0x08, 0x8d, 0x87, 0x41, 0x76, 0x90, 0xf3, 0x52, 0x3b,
+		0xdc, 0x25, 0x17, 0xfc, 0xc9, 0x90, 0xfd, 0x66, 0x76, 0x7e, 0x72, 0x6d, 0x1e, 0xa7, 0xf6, 0x05,
+		0xf4, 0x71, 0x1f, 0x22, 0xcb, 0xa1, 0x17, 0x39, 0xcd, 0x95, 0x96, 0x78, 0xe2, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x49, 0x48, 0x99, 0xd5, 0xc9, 0xb0, 0xd2, 0x79, 0x0a, 0x35, 0xec, 0x53, 0xaa, 0x91, 0x6e,
+		0x23, 0xfe, 0x79, 0x51, 0x6a, 0x57, 0xd1, 0x21, 0x1f, 0x7f, 0x86, 0xc1, 0xf3, 0x22, 0x0f, 0xe0,
+		0xab, 0x0a, 0xda, 0x5c, 0x5e, 0x0e, 0x38, 0xd1, 0x7a, 0x3d, 0xa0, 0x7b, 0x86, 0x03, 0x8b, 0xd8,
+		0xf2, 0x53, 0x9e, 0xa3, 0x6e, 0x5f, 0x70, 0x7c, 0xa2, 0x4a, 0x0c, 0xb2, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x25, 0xd8, 0x72, 0x43, 0xd5, 0x2a, 0xc9, 0xc8, 0x5a, 0x17, 0x34, 0x65, 0x41, 0xe5, 0x30,
+		0xc2, 0xce, 0x6c, 0x74, 0x9e, 0x68, 0xf4, 0x2d, 0x08, 0x4f, 0x50, 0xcb, 0x4b, 0x08, 0x8d, 0x66,
+		0xc6, 0x96, 0xd2, 0x31, 0x27, 0x28, 0x68, 0x88, 0x15, 0x4d, 0x93, 0x57, 0xa6, 0xad, 0x6b, 0x40,
+		0x92, 0x72, 0x2b, 0x13, 0x7a, 0x14, 0x47, 0xdf, 0x6d, 0x7b, 0x54, 0xb2, 0x7d, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x22, 0xfc, 0x66, 0xf6, 0x7b, 0xfe, 0xd4, 0xd0, 0x79, 0xc8, 0xd1, 0xa2, 0x01, 0x52, 0xdd,
+		0x5b, 0xaf, 0x84, 0x69, 0x22, 0x3e, 0x43, 0xc3, 0x00, 0x9e, 0xca, 0x3b, 0x78, 0xc9, 0xbf, 0x1b,
+		0x09, 0x9c, 0x59, 0x62, 0x0b, 0x6f, 0xcb, 0x95, 0x6c, 0x1c, 0x8f, 0x2d, 0x21, 0xe6, 0x68, 0xca,
+		0x2f, 0xaf, 0xb9, 0x0a, 0x46, 0xc0, 0x3b, 0x2a, 0xea, 0xfe, 0x85, 0xca, 0xc6, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xf5, 0x74, 0x92, 0x3d, 0x7d, 0xb8, 0xa0, 0xba, 0xa4, 0xc9, 0x45, 0x0c, 0xd1, 0xcf, 0xa4,
+		0x7f, 0x03, 0xa4, 0x7c, 0xff, 0xdc, 0x36, 0xe1, 0x83, 0xf2, 0x13, 0xb7, 0x24, 0xe8, 0x36, 0x4f,
+		0xd6, 0xd2, 0xaa, 0x1a, 0x00, 0xd0, 0x07, 0xb2, 0x52, 0x97, 0xa1, 0x4e, 0xc6, 0x8a, 0xb9, 0xfc,
+		0x3e, 0xc8, 0x0d, 0x22, 0x0c, 0x1d, 0xfc, 0x57, 0x1f, 0xb5, 0xbf, 0xce, 0xd4, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0x93, 0x49, 0xa6, 0xbb, 0x1e, 0xb3, 0x50, 0x4f, 0x24, 0x02, 0x63, 0xd9, 0x93, 0xbc, 0x39,
+		0x2f, 0x28, 0x5a, 0x52, 0x6b, 0x99, 0x08, 0xe5, 0x63, 0x8c, 0x15, 0xa5, 0xd8, 0x89, 0xd7, 0x83,
+		0xbc, 0x16, 0x4c, 0x52, 0x4e, 0x7c, 0xf3, 0x3a, 0xe0, 0xf1, 0x75, 0x8c, 0x55, 0x43, 0x5c, 0x67,
+		0xec, 0x64, 0x41, 0x3d, 0x46, 0x55, 0xa6, 0x99, 0xbb, 0xc2, 0x81, 0x8e, 0x67, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0xb4, 0x8a, 0x01, 0xdd, 0xde, 0x90, 0xe8, 0x2c, 0x3f, 0x4a, 0x61, 0x11, 0xf5, 0x68, 0xf3,
+		0xfc, 0xa3, 0x49, 0x78, 0x2c, 0xd0, 0x15, 0x95, 0x19, 0xb7, 0x9e, 0xba, 0xee, 0xfc, 0x07, 0x6e,
+		0xea, 0x7c, 0x14, 0x31, 0x63, 0x17, 0xd8, 0x19, 0xa1, 0x43, 0x66, 0xb2, 0x49, 0xb4, 0xdb, 0x73,
+		0x0b, 0x06, 0xfc, 0xe8, 0x54, 0xa8, 0xe7, 0xe7, 0x6b, 0x04, 0x40, 0x73, 0x10, 0x00, 0x00, 0x00,
+	},
+	{
+		0x10, 0xc0, 0xf8, 0xd3, 0x3e, 0x17, 0xaf, 0x47, 0xd2, 0xf6, 0x18, 0xd3, 0x83, 0x91, 0xb8, 0xfb,
+		0xe2, 0x96, 0x8a, 0xe1, 0x8f, 0x98, 0xf9, 0x70, 0xd6, 0x77, 0xa1, 0xf7, 0xc5, 0xb5, 0x49, 0x9e,
+		0xec, 0x76, 0xd8, 0x3c, 0x7b, 0x2e, 0xe7, 0x7a, 0x54, 0x13, 0xd5, 0xd9, 0x4a, 0xe9, 0xe4, 0x0b,
+		0x26, 0xf3, 0xa9, 0x75, 0x65, 0xb5, 0x82, 0xa3, 0x98, 0x47, 0x02, 0x16, 0x4f, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x4a, 0xcb, 0xc4, 0xaf, 0x43, 0xe1, 0x46, 0x71, 0x00, 0xcd, 0xc3, 0x13, 0x42, 0x3c, 0x7d,
+		0xe7, 0x7c, 0x45, 0xb3, 0x4a, 0x3a, 0x7b, 0xd8, 0xc6, 0x98, 0x22, 0x27, 0x11, 0xfc, 0x49, 0x57,
+		0xd8, 0x58, 0x2b, 0x9e, 0x5f, 0x53, 0x9b, 0xee, 0xc6, 0xcd, 0x27, 0xf8, 0xc5, 0x01, 0xcd, 0x13,
+		0x5d, 0x3c, 0x80, 0xeb, 0x3c, 0x12, 0xbf, 0xc2, 0x68, 0x4c, 0xd5, 0x02, 0xa8, 0x00, 0x00, 0x00,
+	},
+};
+
+const bench_corpus bench_corpus_nolo = { "nolo", 64, 64, &reports[0][0] };
@@ -0,0 +1,400 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Decoder Corpus - Sony PSVR Sensor Reports */
+
+// Synthesised from a 1 kHz head motion trace (turning, nodding, gravity and sensor noise),
+// two samples per report.
+
+#include "../bench.h"
+
+static const unsigned char reports[64][64] = {
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x42, 0x0f, 0x00, 0xfe, 0xff, 0xfc, 0xff, 0x03, 0x00, 0xf1, 0xff, 0xde, 0x1f, 0x9e, 0xff,
+		0x28, 0x46, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf7, 0xff, 0x02, 0x00, 0x18, 0x20, 0x2b, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x4a, 0x0f, 0x00, 0x10, 0x00, 0x06, 0x00, 0x00, 0x00, 0xff, 0xff, 0x10, 0x20, 0xff, 0xff,
+		0xf8, 0x4d, 0x0f, 0x00, 0x05, 0x00, 0x0c, 0x00, 0xfb, 0xff, 0x21, 0x00, 0xfd, 0x1f, 0xce, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xe0, 0x51, 0x0f, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xd2, 0x1f, 0x04, 0x00,
+		0xc8, 0x55, 0x0f, 0x00, 0x11, 0x00, 0x14, 0x00, 0x01, 0x00, 0xe0, 0xff, 0x07, 0x20, 0xfa, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xb0, 0x59, 0x0f, 0x00, 0x1d, 0x00, 0x18, 0x00, 0xfa, 0xff, 0xf1, 0xff, 0x1d, 0x20, 0x17, 0x00,
+		0x98, 0x5d, 0x0f, 0x00, 0x22, 0x00, 0x1d, 0x00, 0xfb, 0xff, 0x1e, 0x00, 0x34, 0x20, 0x12, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x61, 0x0f, 0x00, 0x24, 0x00, 0x20, 0x00, 0x03, 0x00, 0x3a, 0x00, 0x1c, 0x20, 0x00, 0x00,
+		0x68, 0x65, 0x0f, 0x00, 0x26, 0x00, 0x28, 0x00, 0xfb, 0xff, 0x2a, 0x00, 0xff, 0x1f, 0x09, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x50, 0x69, 0x0f, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x05, 0x00, 0x2e, 0x00, 0xff, 0x1f, 0x1c, 0x00,
+		0x38, 0x6d, 0x0f, 0x00, 0x2b, 0x00, 0x34, 0x00, 0xff, 0xff, 0x06, 0x00, 0x0e, 0x20, 0xec, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x71, 0x0f, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x0b, 0x00, 0xe6, 0x1f, 0xf0, 0xff,
+		0x08, 0x75, 0x0f, 0x00, 0x3b, 0x00, 0x31, 0x00, 0xff, 0xff, 0x03, 0x00, 0x3d, 0x20, 0x49, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xf0, 0x78, 0x0f, 0x00, 0x40, 0x00, 0x3c, 0x00, 0xfc, 0xff, 0x13, 0x00, 0x11, 0x20, 0xed, 0xff,
+		0xd8, 0x7c, 0x0f, 0x00, 0x4c, 0x00, 0x43, 0x00, 0x02, 0x00, 0xac, 0xff, 0xda, 0x1f, 0x4e, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xc0, 0x80, 0x0f, 0x00, 0x46, 0x00, 0x49, 0x00, 0xff, 0xff, 0xd5, 0xff, 0xf9, 0x1f, 0x05, 0x00,
+		0xa8, 0x84, 0x0f, 0x00, 0x52, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x63, 0x00, 0x38, 0x20, 0xca, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x88, 0x0f, 0x00, 0x56, 0x00, 0x51, 0x00, 0x07, 0x00, 0xf6, 0xff, 0x2b, 0x20, 0xd8, 0xff,
+		0x78, 0x8c, 0x0f, 0x00, 0x5d, 0x00, 0x58, 0x00, 0x03, 0x00, 0x3d, 0x00, 0x0b, 0x20, 0x0b, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x90, 0x0f, 0x00, 0x5a, 0x00, 0x52, 0x00, 0xfc, 0xff, 0x02, 0x00, 0x0e, 0x20, 0xcf, 0xff,
+		0x48, 0x94, 0x0f, 0x00, 0x60, 0x00, 0x62, 0x00, 0x08, 0x00, 0x2e, 0x00, 0xc7, 0x1f, 0x1d, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x98, 0x0f, 0x00, 0x5e, 0x00, 0x62, 0x00, 0x03, 0x00, 0x54, 0x00, 0xe8, 0x1f, 0x01, 0x00,
+		0x18, 0x9c, 0x0f, 0x00, 0x63, 0x00, 0x66, 0x00, 0xfc, 0xff, 0xe0, 0xff, 0xfb, 0x1f, 0xdf, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xa0, 0x0f, 0x00, 0x67, 0x00, 0x66, 0x00, 0x02, 0x00, 0xe2, 0xff, 0xf3, 0x1f, 0xe0, 0xff,
+		0xe8, 0xa3, 0x0f, 0x00, 0x71, 0x00, 0x71, 0x00, 0x01, 0x00, 0xc9, 0xff, 0x31, 0x20, 0x1a, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xd0, 0xa7, 0x0f, 0x00, 0x71, 0x00, 0x78, 0x00, 0xfe, 0xff, 0xc0, 0xff, 0xee, 0x1f, 0xfc, 0xff,
+		0xb8, 0xab, 0x0f, 0x00, 0x84, 0x00, 0x76, 0x00, 0x02, 0x00, 0x26, 0x00, 0x24, 0x20, 0x1f, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xa0, 0xaf, 0x0f, 0x00, 0x7b, 0x00, 0x75, 0x00, 0x05, 0x00, 0xf7, 0xff, 0xd4, 0x1f, 0x38, 0x00,
+		0x88, 0xb3, 0x0f, 0x00, 0x85, 0x00, 0x84, 0x00, 0x0a, 0x00, 0xff, 0xff, 0xfc, 0x1f, 0x17, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0xb7, 0x0f, 0x00, 0x8b, 0x00, 0x8c, 0x00, 0x03, 0x00, 0x11, 0x00, 0xab, 0x1f, 0x04, 0x00,
+		0x58, 0xbb, 0x0f, 0x00, 0x8f, 0x00, 0x82, 0x00, 0x02, 0x00, 0x0b, 0x00, 0xfe, 0x1f, 0x30, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0xbf, 0x0f, 0x00, 0x8e, 0x00, 0x91, 0x00, 0x07, 0x00, 0xbf, 0xff, 0xf9, 0x1f, 0x22, 0x00,
+		0x28, 0xc3, 0x0f, 0x00, 0x93, 0x00, 0x98, 0x00, 0x01, 0x00, 0x06, 0x00, 0xed, 0x1f, 0x55, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xc7, 0x0f, 0x00, 0x96, 0x00, 0x9a, 0x00, 0x07, 0x00, 0xbf, 0xff, 0xbf, 0x1f, 0xe3, 0xff,
+		0xf8, 0xca, 0x0f, 0x00, 0xa5, 0x00, 0x8f, 0x00, 0x06, 0x00, 0x2f, 0x00, 0xee, 0x1f, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xe0, 0xce, 0x0f, 0x00, 0x9f, 0x00, 0x99, 0x00, 0x04, 0x00, 0x11, 0x00, 0x39, 0x20, 0x5d, 0x00,
+		0xc8, 0xd2, 0x0f, 0x00, 0xab, 0x00, 0xa4, 0x00, 0x0a, 0x00, 0x05, 0x00, 0x0c, 0x20, 0xdd, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xb0, 0xd6, 0x0f, 0x00, 0xad, 0x00, 0xa2, 0x00, 0x04, 0x00, 0xd6, 0xff, 0xf2, 0x1f, 0x1f, 0x00,
+		0x98, 0xda, 0x0f, 0x00, 0xaf, 0x00, 0xb0, 0x00, 0x02, 0x00, 0xfe, 0xff, 0xe5, 0x1f, 0x34, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xde, 0x0f, 0x00, 0xac, 0x00, 0xb3, 0x00, 0x03, 0x00, 0xf6, 0xff, 0xf3, 0x1f, 0x23, 0x00,
+		0x68, 0xe2, 0x0f, 0x00, 0xb8, 0x00, 0xb6, 0x00, 0x07, 0x00, 0xf6, 0xff, 0xf5, 0x1f, 0x55, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x50, 0xe6, 0x0f, 0x00, 0xc5, 0x00, 0xc3, 0x00, 0x06, 0x00, 0x41, 0x00, 0xed, 0x1f, 0x0d, 0x00,
+		0x38, 0xea, 0x0f, 0x00, 0xc5, 0x00, 0xbf, 0x00, 0x09, 0x00, 0x3c, 0x00, 0xf4, 0x1f, 0x13, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xee, 0x0f, 0x00, 0xc6, 0x00, 0xbd, 0x00, 0x0c, 0x00, 0xf4, 0xff, 0xe0, 0x1f, 0x11, 0x00,
+		0x08, 0xf2, 0x0f, 0x00, 0xc9, 0x00, 0xc1, 0x00, 0x04, 0x00, 0x5d, 0x00, 0x07, 0x20, 0xf2, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xf0, 0xf5, 0x0f, 0x00, 0xd3, 0x00, 0xca, 0x00, 0x04, 0x00, 0xa2, 0xff, 0xf4, 0x1f, 0x3a, 0x00,
+		0xd8, 0xf9, 0x0f, 0x00, 0xd3, 0x00, 0xcf, 0x00, 0xff, 0xff, 0xfc, 0xff, 0xef, 0x1f, 0x46, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xc0, 0xfd, 0x0f, 0x00, 0xdb, 0x00, 0xd8, 0x00, 0x08, 0x00, 0xd5, 0xff, 0x07, 0x20, 0x21, 0x00,
+		0xa8, 0x01, 0x10, 0x00, 0xdf, 0x00, 0xd9, 0x00, 0x08, 0x00, 0x23, 0x00, 0x30, 0x20, 0xf5, 0xff,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x05, 0x10, 0x00, 0xe6, 0x00, 0xe8, 0x00, 0x08, 0x00, 0xbf, 0xff, 0xf1, 0x1f, 0x2c, 0x00,
+		0x78, 0x09, 0x10, 0x00, 0xd7, 0x00, 0xe6, 0x00, 0x05, 0x00, 0xfd, 0xff, 0xed, 0x1f, 0x15, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x0d, 0x10, 0x00, 0xec, 0x00, 0xdf, 0x00, 0x0c, 0x00, 0xee, 0xff, 0x22, 0x20, 0x42, 0x00,
+		0x48, 0x11, 0x10, 0x00, 0xea, 0x00, 0xf3, 0x00, 0xf9, 0xff, 0x6e, 0x00, 0xc2, 0x1f, 0x7d, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x15, 0x10, 0x00, 0xf0, 0x00, 0xef, 0x00, 0x09, 0x00, 0xe6, 0xff, 0xf5, 0x1f, 0x0f, 0x00,
+		0x18, 0x19, 0x10, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0x09, 0x00, 0x0f, 0x00, 0xfb, 0x1f, 0x61, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x1d, 0x10, 0x00, 0xfe, 0x00, 0xf8, 0x00, 0x01, 0x00, 0xc7, 0xff, 0x06, 0x20, 0x18, 0x00,
+		0xe8, 0x20, 0x10, 0x00, 0x03, 0x01, 0xfa, 0x00, 0x0a, 0x00, 0x01, 0x00, 0xc8, 0x1f, 0x24, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xd0, 0x24, 0x10, 0x00, 0x00, 0x01, 0x03, 0x01, 0x0b, 0x00, 0x12, 0x00, 0xfd, 0x1f, 0x12, 0x00,
+		0xb8, 0x28, 0x10, 0x00, 0x04, 0x01, 0xff, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0xd7, 0x1f, 0x60, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xa0, 0x2c, 0x10, 0x00, 0x07, 0x01, 0x13, 0x01, 0x0c, 0x00, 0x45, 0x00, 0xef, 0x1f, 0x27, 0x00,
+		0x88, 0x30, 0x10, 0x00, 0x09, 0x01, 0x0c, 0x01, 0x06, 0x00, 0xbd, 0xff, 0x1f, 0x20, 0x38, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x34, 0x10, 0x00, 0x15, 0x01, 0x09, 0x01, 0x0d, 0x00, 0xce, 0xff, 0x14, 0x20, 0x2b, 0x00,
+		0x58, 0x38, 0x10, 0x00, 0x12, 0x01, 0x13, 0x01, 0x00, 0x00, 0xf4, 0xff, 0x49, 0x20, 0x5a, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x3c, 0x10, 0x00, 0x0f, 0x01, 0x16, 0x01, 0x01, 0x00, 0xff, 0xff, 0x17, 0x20, 0x4b, 0x00,
+		0x28, 0x40, 0x10, 0x00, 0x1f, 0x01, 0x23, 0x01, 0xf9, 0xff, 0x62, 0x00, 0xdb, 0x1f, 0x3e, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0x44, 0x10, 0x00, 0x29, 0x01, 0x24, 0x01, 0x06, 0x00, 0xbd, 0xff, 0xc0, 0x1f, 0x61, 0x00,
+		0xf8, 0x47, 0x10, 0x00, 0x1f, 0x01, 0x27, 0x01, 0x0a, 0x00, 0x20, 0x00, 0xdf, 0x1f, 0x71, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xe0, 0x4b, 0x10, 0x00, 0x2a, 0x01, 0x2d, 0x01, 0x07, 0x00, 0x22, 0x00, 0xc5, 0x1f, 0x62, 0x00,
+		0xc8, 0x4f, 0x10, 0x00, 0x35, 0x01, 0x2c, 0x01, 0x0a, 0x00, 0xe4, 0xff, 0xc9, 0x1f, 0x45, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xb0, 0x53, 0x10, 0x00, 0x36, 0x01, 0x2d, 0x01, 0x04, 0x00, 0xf1, 0xff, 0xe6, 0x1f, 0x36, 0x00,
+		0x98, 0x57, 0x10, 0x00, 0x38, 0x01, 0x38, 0x01, 0x10, 0x00, 0xe3, 0xff, 0xc2, 0x1f, 0x2d, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x5b, 0x10, 0x00, 0x33, 0x01, 0x45, 0x01, 0x07, 0x00, 0x38, 0x00, 0x16, 0x20, 0xfc, 0xff,
+		0x68, 0x5f, 0x10, 0x00, 0x42, 0x01, 0x3f, 0x01, 0x11, 0x00, 0xd1, 0xff, 0xca, 0x1f, 0x7b, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x50, 0x63, 0x10, 0x00, 0x3f, 0x01, 0x40, 0x01, 0x00, 0x00, 0x30, 0x00, 0xf0, 0x1f, 0x66, 0x00,
+		0x38, 0x67, 0x10, 0x00, 0x4a, 0x01, 0x49, 0x01, 0x0e, 0x00, 0x55, 0x00, 0x00, 0x20, 0x45, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0x6b, 0x10, 0x00, 0x4a, 0x01, 0x46, 0x01, 0x16, 0x00, 0x17, 0x00, 0x47, 0x20, 0x2d, 0x00,
+		0x08, 0x6f, 0x10, 0x00, 0x4a, 0x01, 0x57, 0x01, 0x03, 0x00, 0x19, 0x00, 0x25, 0x20, 0xbf, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xf0, 0x72, 0x10, 0x00, 0x4a, 0x01, 0x53, 0x01, 0x0a, 0x00, 0xe4, 0xff, 0x48, 0x20, 0x60, 0x00,
+		0xd8, 0x76, 0x10, 0x00, 0x50, 0x01, 0x56, 0x01, 0x09, 0x00, 0x28, 0x00, 0xb7, 0x1f, 0x35, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xc0, 0x7a, 0x10, 0x00, 0x53, 0x01, 0x65, 0x01, 0x08, 0x00, 0xf8, 0xff, 0x15, 0x20, 0xc5, 0x00,
+		0xa8, 0x7e, 0x10, 0x00, 0x5d, 0x01, 0x6d, 0x01, 0x05, 0x00, 0xcc, 0xff, 0x13, 0x20, 0x4f, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0x82, 0x10, 0x00, 0x66, 0x01, 0x6a, 0x01, 0x03, 0x00, 0xf7, 0xff, 0xd6, 0x1f, 0x62, 0x00,
+		0x78, 0x86, 0x10, 0x00, 0x66, 0x01, 0x70, 0x01, 0x0b, 0x00, 0x00, 0x00, 0xe5, 0x1f, 0x73, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x8a, 0x10, 0x00, 0x60, 0x01, 0x73, 0x01, 0x0c, 0x00, 0xe6, 0xff, 0xe2, 0x1f, 0x32, 0x00,
+		0x48, 0x8e, 0x10, 0x00, 0x6d, 0x01, 0x69, 0x01, 0x0b, 0x00, 0x49, 0x00, 0xeb, 0x1f, 0x93, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x92, 0x10, 0x00, 0x69, 0x01, 0x74, 0x01, 0x16, 0x00, 0x17, 0x00, 0x59, 0x20, 0x98, 0x00,
+		0x18, 0x96, 0x10, 0x00, 0x6d, 0x01, 0x80, 0x01, 0x12, 0x00, 0xfd, 0xff, 0xf0, 0x1f, 0xc4, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x9a, 0x10, 0x00, 0x6f, 0x01, 0x7c, 0x01, 0x12, 0x00, 0x1a, 0x00, 0x04, 0x20, 0x49, 0x00,
+		0xe8, 0x9d, 0x10, 0x00, 0x7b, 0x01, 0x7d, 0x01, 0x0a, 0x00, 0x53, 0x00, 0x3e, 0x20, 0xab, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xd0, 0xa1, 0x10, 0x00, 0x7c, 0x01, 0x8b, 0x01, 0x04, 0x00, 0xd7, 0xff, 0xdb, 0x1f, 0xb1, 0x00,
+		0xb8, 0xa5, 0x10, 0x00, 0x7a, 0x01, 0x90, 0x01, 0x0b, 0x00, 0x14, 0x00, 0x01, 0x20, 0x95, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xa0, 0xa9, 0x10, 0x00, 0x7e, 0x01, 0x91, 0x01, 0x14, 0x00, 0xf0, 0xff, 0xda, 0x1f, 0xde, 0x00,
+		0x88, 0xad, 0x10, 0x00, 0x82, 0x01, 0x9a, 0x01, 0x0f, 0x00, 0xdf, 0xff, 0xcd, 0x1f, 0xa7, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0xb1, 0x10, 0x00, 0x84, 0x01, 0x9b, 0x01, 0x0d, 0x00, 0x10, 0x00, 0x0e, 0x20, 0x6c, 0x00,
+		0x58, 0xb5, 0x10, 0x00, 0x8a, 0x01, 0x9a, 0x01, 0x0c, 0x00, 0x37, 0x00, 0xf6, 0x1f, 0x7a, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0xb9, 0x10, 0x00, 0x8f, 0x01, 0xa1, 0x01, 0x09, 0x00, 0x03, 0x00, 0x11, 0x20, 0x8b, 0x00,
+		0x28, 0xbd, 0x10, 0x00, 0x93, 0x01, 0xa0, 0x01, 0x0b, 0x00, 0xef, 0xff, 0xdf, 0x1f, 0xaa, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x10, 0xc1, 0x10, 0x00, 0x95, 0x01, 0xad, 0x01, 0x09, 0x00, 0xff, 0xff, 0x1c, 0x20, 0xd1, 0x00,
+		0xf8, 0xc4, 0x10, 0x00, 0x95, 0x01, 0xa6, 0x01, 0x08, 0x00, 0xe4, 0xff, 0xd2, 0x1f, 0xd5, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xe0, 0xc8, 0x10, 0x00, 0x9d, 0x01, 0xab, 0x01, 0x10, 0x00, 0xfb, 0xff, 0xdb, 0x1f, 0xb1, 0x00,
+		0xc8, 0xcc, 0x10, 0x00, 0x9f, 0x01, 0xb6, 0x01, 0x09, 0x00, 0x04, 0x00, 0xf5, 0x1f, 0xd3, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xb0, 0xd0, 0x10, 0x00, 0xa2, 0x01, 0xb8, 0x01, 0x0f, 0x00, 0x0e, 0x00, 0x0d, 0x20, 0xc6, 0x00,
+		0x98, 0xd4, 0x10, 0x00, 0xa7, 0x01, 0xc6, 0x01, 0x0a, 0x00, 0x5c, 0x00, 0xd2, 0x1f, 0xfe, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0xd8, 0x10, 0x00, 0xad, 0x01, 0xc9, 0x01, 0x07, 0x00, 0x0f, 0x00, 0xfc, 0x1f, 0xd1, 0x00,
+		0x68, 0xdc, 0x10, 0x00, 0xa7, 0x01, 0xcf, 0x01, 0x06, 0x00, 0xe6, 0xff, 0xe9, 0x1f, 0xa8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x50, 0xe0, 0x10, 0x00, 0xb5, 0x01, 0xcb, 0x01, 0x0a, 0x00, 0x39, 0x00, 0xdf, 0x1f, 0xae, 0x00,
+		0x38, 0xe4, 0x10, 0x00, 0xb5, 0x01, 0xd3, 0x01, 0x0d, 0x00, 0xe3, 0xff, 0xcd, 0x1f, 0xec, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x20, 0xe8, 0x10, 0x00, 0xb2, 0x01, 0xd4, 0x01, 0x16, 0x00, 0xe4, 0xff, 0xff, 0x1f, 0xd7, 0x00,
+		0x08, 0xec, 0x10, 0x00, 0xb7, 0x01, 0xd5, 0x01, 0x0f, 0x00, 0xe8, 0xff, 0x0d, 0x20, 0xb4, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xf0, 0xef, 0x10, 0x00, 0xba, 0x01, 0xe0, 0x01, 0x09, 0x00, 0xd9, 0xff, 0xf9, 0x1f, 0x7a, 0x00,
+		0xd8, 0xf3, 0x10, 0x00, 0xbe, 0x01, 0xe7, 0x01, 0x10, 0x00, 0xee, 0xff, 0x0a, 0x20, 0xe2, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xc0, 0xf7, 0x10, 0x00, 0xbb, 0x01, 0xe7, 0x01, 0x01, 0x00, 0x02, 0x00, 0xea, 0x1f, 0xe0, 0x00,
+		0xa8, 0xfb, 0x10, 0x00, 0xbe, 0x01, 0xea, 0x01, 0x04, 0x00, 0x29, 0x00, 0xcb, 0x1f, 0xe8, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x90, 0xff, 0x10, 0x00, 0xbe, 0x01, 0xe8, 0x01, 0x05, 0x00, 0xe6, 0xff, 0xa9, 0x1f, 0x39, 0x01,
+		0x78, 0x03, 0x11, 0x00, 0xc5, 0x01, 0xfa, 0x01, 0x0d, 0x00, 0xe5, 0xff, 0x20, 0x20, 0xb2, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x60, 0x07, 0x11, 0x00, 0xc9, 0x01, 0xf8, 0x01, 0x0b, 0x00, 0x44, 0x00, 0xfa, 0x1f, 0xea, 0x00,
+		0x48, 0x0b, 0x11, 0x00, 0xcf, 0x01, 0xf9, 0x01, 0x0c, 0x00, 0x0f, 0x00, 0x0d, 0x20, 0x05, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x0f, 0x11, 0x00, 0xd4, 0x01, 0xfe, 0x01, 0x0a, 0x00, 0x04, 0x00, 0xba, 0x1f, 0xf4, 0x00,
+		0x18, 0x13, 0x11, 0x00, 0xce, 0x01, 0x03, 0x02, 0x14, 0x00, 0x1c, 0x00, 0x4b, 0x20, 0xff, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x17, 0x11, 0x00, 0xd6, 0x01, 0x02, 0x02, 0x0e, 0x00, 0x25, 0x00, 0xc4, 0x1f, 0x0d, 0x01,
+		0xe8, 0x1a, 0x11, 0x00, 0xca, 0x01, 0x0c, 0x02, 0x09, 0x00, 0x1b, 0x00, 0xf6, 0x1f, 0x1b, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xd0, 0x1e, 0x11, 0x00, 0xe2, 0x01, 0x12, 0x02, 0x08, 0x00, 0xf2, 0xff, 0x0e, 0x20, 0x05, 0x01,
+		0xb8, 0x22, 0x11, 0x00, 0xd7, 0x01, 0x12, 0x02, 0x0d, 0x00, 0xca, 0xff, 0x08, 0x20, 0x0a, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xa0, 0x26, 0x11, 0x00, 0xe0, 0x01, 0x16, 0x02, 0x0d, 0x00, 0xce, 0xff, 0x4a, 0x20, 0x37, 0x01,
+		0x88, 0x2a, 0x11, 0x00, 0xe5, 0x01, 0x1b, 0x02, 0x16, 0x00, 0xe1, 0xff, 0x23, 0x20, 0x0f, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
+	},
+	{
+		0x00, 0x00, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x70, 0x2e, 0x11, 0x00, 0xdd, 0x01, 0x20, 0x02, 0x0d, 0x00, 0x3f, 0x00, 0xfc, 0x1f, 0x59, 0x01,
+		0x58, 0x32, 0x11, 0x00, 0xe5, 0x01, 0x24, 0x02, 0x14, 0x00, 0x0c, 0x00, 0x03, 0x20, 0x36, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+	},
+};
+
+const bench_corpus bench_corpus_psvr = { "psvr", 64, 64, &reports[0][0] };
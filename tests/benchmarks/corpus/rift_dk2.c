@@ -0,0 +1,400 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Decoder Corpus - Oculus Rift DK2/CV1 Tracker Sensor Reports */
+
+// Synthesised from a 1 kHz head motion trace (turning, nodding, gravity and sensor noise),
+// two samples per report with 21 bit packed accel/gyro as sent by the HMD.
+
+#include "../bench.h"
+
+static const unsigned char reports[64][64] = {
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x0c, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x0d, 0xf8, 0x5f,
+		0xc1, 0x40, 0x02, 0x56, 0x00, 0x02, 0x8f, 0xff, 0xf7, 0xff, 0xff, 0xc4, 0xff, 0xfa, 0x18, 0x5f,
+		0x70, 0x3f, 0xf9, 0xdc, 0xff, 0xfe, 0xc8, 0x00, 0x20, 0xbf, 0xff, 0xf4, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x02, 0x00, 0x81, 0x0c, 0x10, 0x4a, 0x0f, 0x00, 0x00, 0x15, 0x60, 0x5f,
+		0xdb, 0x00, 0x00, 0x88, 0x00, 0x03, 0xa0, 0x00, 0x08, 0x7f, 0xff, 0xa4, 0x00, 0x0f, 0xf0, 0x5f,
+		0x3c, 0x00, 0x05, 0x94, 0x00, 0x02, 0x60, 0x00, 0x07, 0x80, 0x00, 0x2e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x04, 0x00, 0x82, 0x0c, 0xe0, 0x51, 0x0f, 0x00, 0xff, 0xf6, 0x30, 0x60,
+		0x29, 0x7f, 0xfe, 0xfa, 0x00, 0x01, 0x80, 0x00, 0x21, 0x7f, 0xff, 0xfa, 0x00, 0x02, 0xa0, 0x5f,
+		0xe9, 0x3f, 0xfb, 0x7c, 0x00, 0x08, 0x88, 0x00, 0x33, 0x3f, 0xff, 0xd8, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x06, 0x00, 0x83, 0x0c, 0xb0, 0x59, 0x0f, 0x00, 0xff, 0xe0, 0x98, 0x60,
+		0x1b, 0xff, 0xfd, 0x3c, 0x00, 0x09, 0x68, 0x00, 0x5c, 0xc0, 0x00, 0x2a, 0xff, 0xf2, 0x98, 0x5f,
+		0xcc, 0xff, 0xfe, 0x84, 0x00, 0x0a, 0xb0, 0x00, 0x64, 0x40, 0x00, 0x54, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x08, 0x00, 0x84, 0x0c, 0x80, 0x61, 0x0f, 0x00, 0x00, 0x12, 0x10, 0x60,
+		0x11, 0xff, 0xfe, 0xe0, 0x00, 0x09, 0xd8, 0x00, 0x69, 0x40, 0x00, 0x38, 0xff, 0xed, 0xa0, 0x5f,
+		0xdf, 0x3f, 0xfd, 0xdc, 0x00, 0x0c, 0x48, 0x00, 0x7c, 0x7f, 0xff, 0xdc, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x0a, 0x00, 0x85, 0x0c, 0x50, 0x69, 0x0f, 0x00, 0xff, 0xfc, 0x98, 0x5f,
+		0x66, 0x00, 0x00, 0x60, 0x00, 0x0f, 0xc8, 0x00, 0x6b, 0xc0, 0x00, 0x0e, 0xff, 0xea, 0xa0, 0x60,
+		0x1f, 0xff, 0xfa, 0xa0, 0x00, 0x12, 0x10, 0x00, 0x8e, 0x80, 0x00, 0x6a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x86, 0x0c, 0x20, 0x71, 0x0f, 0x00, 0xff, 0xf6, 0x90, 0x60,
+		0x80, 0xff, 0xfe, 0xaa, 0x00, 0x10, 0x18, 0x00, 0x83, 0x00, 0x00, 0x56, 0xff, 0xf2, 0x10, 0x5f,
+		0x7f, 0x40, 0x02, 0x1c, 0x00, 0x11, 0x18, 0x00, 0x9c, 0xc0, 0x00, 0x4a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x06, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x0e, 0x00, 0x80, 0x0c, 0xf0, 0x78, 0x0f, 0x00, 0x00, 0x03, 0xc8, 0x5f,
+		0xbe, 0x80, 0x00, 0x78, 0x00, 0x15, 0xb0, 0x00, 0xbc, 0xc0, 0x00, 0xbc, 0x00, 0x08, 0x10, 0x60,
+		0x6b, 0x7f, 0xfd, 0x64, 0x00, 0x16, 0x18, 0x00, 0xa6, 0x80, 0x00, 0xc6, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x07, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x10, 0x00, 0x81, 0x0c, 0xc0, 0x80, 0x0f, 0x00, 0x00, 0x04, 0x70, 0x5f,
+		0xbc, 0xff, 0xfd, 0xde, 0x00, 0x17, 0x30, 0x00, 0xb7, 0x80, 0x00, 0xbe, 0xff, 0xfa, 0x38, 0x60,
+		0x25, 0x00, 0x07, 0xfa, 0x00, 0x19, 0xe0, 0x00, 0xb0, 0xff, 0xff, 0x88, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x08, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x12, 0x00, 0x82, 0x0c, 0x90, 0x88, 0x0f, 0x00, 0x00, 0x0a, 0x80, 0x5f,
+		0xa4, 0x00, 0x00, 0x0a, 0x00, 0x1b, 0x80, 0x00, 0xc4, 0x80, 0x01, 0x5e, 0xff, 0xff, 0x58, 0x5f,
+		0xfb, 0x40, 0x04, 0x68, 0x00, 0x1d, 0x68, 0x00, 0xdc, 0x00, 0x00, 0x28, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x09, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x14, 0x00, 0x83, 0x0c, 0x60, 0x90, 0x0f, 0x00, 0xff, 0xf8, 0x30, 0x5f,
+		0xe3, 0xc0, 0x00, 0x38, 0x00, 0x1e, 0x88, 0x00, 0xe9, 0x80, 0x00, 0x12, 0xff, 0xe6, 0xd0, 0x5f,
+		0x62, 0x3f, 0xff, 0x44, 0x00, 0x21, 0x68, 0x01, 0x04, 0x00, 0x00, 0x5a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x16, 0x00, 0x84, 0x0c, 0x30, 0x98, 0x0f, 0x00, 0x00, 0x0d, 0x88, 0x60,
+		0x8e, 0x80, 0x08, 0xb0, 0x00, 0x1e, 0x60, 0x01, 0x0c, 0x40, 0x00, 0x18, 0xff, 0xe9, 0x38, 0x5e,
+		0xe4, 0xff, 0xfe, 0x46, 0x00, 0x25, 0x48, 0x01, 0x19, 0x80, 0x00, 0x28, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x01, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x18, 0x00, 0x85, 0x0c, 0x00, 0xa0, 0x0f, 0x00, 0xff, 0xd8, 0x00, 0x60,
+		0x26, 0xc0, 0x03, 0x28, 0x00, 0x25, 0xa8, 0x01, 0x14, 0x00, 0x00, 0x38, 0xff, 0xe9, 0x78, 0x5e,
+		0xd8, 0xc0, 0x05, 0xb4, 0x00, 0x25, 0xe8, 0x01, 0x31, 0xff, 0xff, 0xee, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x02, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x1a, 0x00, 0x86, 0x0c, 0xd0, 0xa7, 0x0f, 0x00, 0xff, 0xed, 0xe8, 0x5f,
+		0x7b, 0x40, 0x04, 0x08, 0x00, 0x27, 0xd0, 0x01, 0x2d, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x38, 0x60,
+		0x08, 0xc0, 0x00, 0x8a, 0x00, 0x29, 0x28, 0x01, 0x3b, 0x80, 0x00, 0xf2, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x1c, 0x00, 0x80, 0x0c, 0xa0, 0xaf, 0x0f, 0x00, 0x00, 0x00, 0xb8, 0x5f,
+		0xea, 0x80, 0x08, 0x2a, 0x00, 0x2a, 0x78, 0x01, 0x42, 0xff, 0xff, 0xe4, 0x00, 0x0b, 0xb8, 0x60,
+		0x22, 0x40, 0x01, 0x24, 0x00, 0x2e, 0x20, 0x01, 0x4e, 0x40, 0x00, 0x7e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x1e, 0x00, 0x81, 0x0c, 0x70, 0xb7, 0x0f, 0x00, 0x00, 0x20, 0x48, 0x60,
+		0x9c, 0xc0, 0x06, 0xe2, 0x00, 0x2d, 0x98, 0x01, 0x78, 0x80, 0x00, 0x4a, 0xff, 0xed, 0xf0, 0x5f,
+		0x6c, 0xbf, 0xfc, 0x1c, 0x00, 0x2e, 0xd8, 0x01, 0x77, 0x00, 0x00, 0x00, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x00, 0x00, 0x40, 0x42, 0x0f, 0x00, 0x00, 0x05, 0x00, 0x00, 0x9e, 0x43, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x20, 0x00, 0x82, 0x0c, 0x40, 0xbf, 0x0f, 0x00, 0x00, 0x10, 0x40, 0x60,
+		0xf7, 0xff, 0xff, 0x68, 0x00, 0x30, 0x18, 0x01, 0x6e, 0x40, 0x00, 0x2c, 0xff, 0xfa, 0x20, 0x60,
+		0x5f, 0x80, 0x00, 0xf2, 0x00, 0x31, 0xf8, 0x01, 0x73, 0x40, 0x00, 0x8a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x06, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x22, 0x00, 0x83, 0x0c, 0x10, 0xc7, 0x0f, 0x00, 0x00, 0x0b, 0x18, 0x60,
+		0x55, 0x00, 0x05, 0x48, 0x00, 0x35, 0x08, 0x01, 0x86, 0x7f, 0xff, 0xfa, 0x00, 0x23, 0xd0, 0x5f,
+		0xfb, 0xc0, 0x08, 0x62, 0x00, 0x36, 0xb8, 0x01, 0xa2, 0x40, 0x00, 0xf4, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x07, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x24, 0x00, 0x84, 0x0c, 0xe0, 0xce, 0x0f, 0x00, 0xff, 0xf3, 0x10, 0x5f,
+		0xef, 0x40, 0x03, 0xda, 0x00, 0x37, 0x48, 0x01, 0xa1, 0x7f, 0xff, 0xfe, 0x00, 0x22, 0x38, 0x60,
+		0x10, 0xbf, 0xfe, 0x4e, 0x00, 0x39, 0x58, 0x01, 0xbc, 0xc0, 0x00, 0x5e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x08, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x26, 0x00, 0x85, 0x0c, 0xb0, 0xd6, 0x0f, 0x00, 0x00, 0x04, 0x38, 0x5f,
+		0xbd, 0x80, 0x06, 0xb6, 0x00, 0x39, 0xb8, 0x01, 0xbf, 0x80, 0x01, 0x22, 0xff, 0xeb, 0x78, 0x5f,
+		0xa9, 0x7f, 0xf8, 0x84, 0x00, 0x3a, 0x40, 0x01, 0xd5, 0x40, 0x00, 0x7e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x09, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x28, 0x00, 0x86, 0x0c, 0x80, 0xde, 0x0f, 0x00, 0xff, 0xf5, 0xf8, 0x5f,
+		0xe7, 0xc0, 0x03, 0x8a, 0x00, 0x3b, 0xd8, 0x01, 0xbe, 0x40, 0x00, 0x44, 0xff, 0xf2, 0xf0, 0x5f,
+		0x2d, 0x40, 0x06, 0x54, 0x00, 0x3c, 0x88, 0x01, 0xdd, 0xc0, 0x00, 0x7e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x2a, 0x00, 0x80, 0x0c, 0x50, 0xe6, 0x0f, 0x00, 0x00, 0x18, 0x50, 0x5f,
+		0xf0, 0x40, 0x01, 0xfc, 0x00, 0x3e, 0x80, 0x01, 0xe1, 0xc0, 0x00, 0x0c, 0xff, 0xf0, 0xd0, 0x60,
+		0x0f, 0x80, 0x06, 0x6c, 0x00, 0x3e, 0xc0, 0x02, 0x05, 0xc0, 0x00, 0x52, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x01, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x2c, 0x00, 0x81, 0x0c, 0x20, 0xee, 0x0f, 0x00, 0xff, 0xfe, 0x08, 0x60,
+		0x50, 0x00, 0x04, 0x64, 0x00, 0x3f, 0xe8, 0x01, 0xfe, 0xc0, 0x00, 0xb2, 0x00, 0x0b, 0xd0, 0x5f,
+		0xed, 0x80, 0x0d, 0x10, 0x00, 0x42, 0x20, 0x02, 0x0b, 0x40, 0x00, 0x16, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x02, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x2e, 0x00, 0x82, 0x0c, 0xf0, 0xf5, 0x0f, 0x00, 0xff, 0xfb, 0x48, 0x5f,
+		0x33, 0x40, 0x04, 0xf2, 0x00, 0x44, 0xf0, 0x02, 0x24, 0x80, 0x00, 0xf8, 0x00, 0x0c, 0xd8, 0x5f,
+		0x49, 0x00, 0x03, 0x5a, 0x00, 0x48, 0x38, 0x02, 0x25, 0x00, 0x00, 0xea, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x03, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x30, 0x00, 0x83, 0x0c, 0xc0, 0xfd, 0x0f, 0x00, 0xff, 0xf5, 0xc8, 0x5f,
+		0xb6, 0x00, 0x00, 0xa0, 0x00, 0x47, 0xc8, 0x02, 0x40, 0x00, 0x00, 0x2a, 0x00, 0x1a, 0xd0, 0x60,
+		0x90, 0x40, 0x04, 0x5e, 0x00, 0x47, 0x58, 0x02, 0x3a, 0x00, 0x00, 0xb2, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x04, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x32, 0x00, 0x84, 0x0c, 0x90, 0x05, 0x10, 0x00, 0x00, 0x04, 0x90, 0x60,
+		0x3b, 0xff, 0xff, 0xb6, 0x00, 0x4c, 0x98, 0x02, 0x45, 0xc0, 0x00, 0x2c, 0x00, 0x00, 0x20, 0x60,
+		0x9a, 0x00, 0x07, 0x94, 0x00, 0x4b, 0xf8, 0x02, 0x6e, 0x40, 0x00, 0x8a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x05, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x34, 0x00, 0x85, 0x0c, 0x60, 0x0d, 0x10, 0x00, 0xff, 0xfb, 0x30, 0x60,
+		0x2f, 0x40, 0x09, 0x18, 0x00, 0x4c, 0xd8, 0x02, 0x66, 0x7f, 0xff, 0xd2, 0x00, 0x0f, 0x48, 0x60,
+		0x18, 0x80, 0x0a, 0x72, 0x00, 0x50, 0x00, 0x02, 0x63, 0xff, 0xff, 0xcc, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x06, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x36, 0x00, 0x86, 0x0c, 0x30, 0x15, 0x10, 0x00, 0x00, 0x14, 0x18, 0x60,
+		0x3b, 0x80, 0x09, 0x64, 0x00, 0x4e, 0x48, 0x02, 0x70, 0xc0, 0x00, 0x18, 0x00, 0x20, 0x30, 0x60,
+		0x08, 0x40, 0x0a, 0x88, 0x00, 0x53, 0x10, 0x02, 0x8c, 0x40, 0x00, 0xc0, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x07, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x38, 0x00, 0x80, 0x0c, 0x00, 0x1d, 0x10, 0x00, 0xff, 0xfe, 0x20, 0x5f,
+		0xb0, 0x40, 0x03, 0x42, 0x00, 0x53, 0xb8, 0x02, 0x9a, 0x40, 0x00, 0x22, 0xff, 0xee, 0x40, 0x5f,
+		0xb8, 0x40, 0x07, 0x44, 0x00, 0x53, 0x98, 0x02, 0x9a, 0x80, 0x00, 0x6a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x08, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x3a, 0x00, 0x81, 0x0c, 0xd0, 0x24, 0x10, 0x00, 0xff, 0xfe, 0xe0, 0x5f,
+		0xe3, 0x00, 0x03, 0xe6, 0x00, 0x56, 0x10, 0x02, 0x99, 0x40, 0x00, 0x3e, 0xff, 0xfc, 0x98, 0x5f,
+		0xf3, 0x40, 0x06, 0xcc, 0x00, 0x57, 0x70, 0x02, 0xb6, 0xc0, 0x00, 0xc6, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x09, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x3c, 0x00, 0x82, 0x0c, 0xa0, 0x2c, 0x10, 0x00, 0xff, 0xf4, 0x40, 0x5f,
+		0xe0, 0xc0, 0x0b, 0x10, 0x00, 0x5a, 0x30, 0x02, 0xbb, 0x00, 0x00, 0x7a, 0xff, 0xf1, 0xa8, 0x5f,
+		0xf2, 0x40, 0x04, 0x72, 0x00, 0x59, 0x80, 0x02, 0xd9, 0x3f, 0xff, 0xf8, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x3e, 0x00, 0x83, 0x0c, 0x70, 0x34, 0x10, 0x00, 0x00, 0x18, 0xf0, 0x60,
+		0x5a, 0x00, 0x08, 0xee, 0x00, 0x5a, 0x50, 0x02, 0xd5, 0x00, 0x01, 0x30, 0x00, 0x07, 0x70, 0x60,
+		0x40, 0x80, 0x00, 0xc4, 0x00, 0x5d, 0x60, 0x02, 0xe3, 0x00, 0x00, 0x6e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x01, 0x00, 0x5a, 0x83, 0x0f, 0x00, 0x01, 0x01, 0x01, 0x00, 0xb8, 0x84, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x40, 0x00, 0x84, 0x0c, 0x40, 0x3c, 0x10, 0x00, 0x00, 0x0f, 0x40, 0x5f,
+		0xfc, 0x00, 0x06, 0x92, 0x00, 0x5b, 0x10, 0x02, 0xd7, 0x80, 0x00, 0x64, 0x00, 0x0e, 0x28, 0x60,
+		0xab, 0x00, 0x07, 0x10, 0x00, 0x5c, 0x68, 0x02, 0xf0, 0x80, 0x00, 0x52, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x02, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x42, 0x00, 0x85, 0x0c, 0x10, 0x44, 0x10, 0x00, 0xff, 0xf2, 0x80, 0x60,
+		0xc8, 0x40, 0x07, 0x76, 0x00, 0x5f, 0xe0, 0x03, 0x0d, 0x00, 0x00, 0x50, 0x00, 0x08, 0x48, 0x5f,
+		0x7f, 0x00, 0x06, 0xa0, 0x00, 0x63, 0x30, 0x02, 0xfd, 0x00, 0x00, 0x70, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x03, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x44, 0x00, 0x86, 0x0c, 0xe0, 0x4b, 0x10, 0x00, 0xff, 0xe4, 0x50, 0x5f,
+		0xa2, 0x80, 0x03, 0xba, 0x00, 0x64, 0x28, 0x03, 0x16, 0xc0, 0x00, 0x98, 0x00, 0x00, 0x10, 0x60,
+		0x55, 0x00, 0x06, 0x82, 0x00, 0x63, 0x98, 0x03, 0x22, 0xc0, 0x00, 0x3e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x04, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x46, 0x00, 0x80, 0x0c, 0xb0, 0x53, 0x10, 0x00, 0xff, 0xe5, 0x90, 0x5e,
+		0xd7, 0x80, 0x07, 0xe8, 0x00, 0x69, 0x60, 0x03, 0x32, 0xc0, 0x00, 0x3e, 0xff, 0xf9, 0xd8, 0x60,
+		0x8d, 0x00, 0x09, 0x22, 0x00, 0x67, 0xd0, 0x03, 0x46, 0xc0, 0x00, 0x96, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x05, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x48, 0x00, 0x81, 0x0c, 0x80, 0x5b, 0x10, 0x00, 0xff, 0xed, 0xd8, 0x5f,
+		0xbe, 0x00, 0x0e, 0x10, 0x00, 0x66, 0x28, 0x03, 0x53, 0xc0, 0x00, 0x12, 0x00, 0x07, 0xa0, 0x5f,
+		0xd4, 0x80, 0x0f, 0xf4, 0x00, 0x66, 0xf8, 0x03, 0x46, 0x80, 0x00, 0xda, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x06, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x4a, 0x00, 0x82, 0x0c, 0x50, 0x63, 0x10, 0x00, 0xff, 0xf6, 0x90, 0x5f,
+		0xd5, 0x80, 0x0a, 0xba, 0x00, 0x68, 0xa8, 0x03, 0x3b, 0xff, 0xff, 0xc8, 0x00, 0x0d, 0x98, 0x5f,
+		0xa6, 0x00, 0x07, 0xd4, 0x00, 0x6d, 0x80, 0x03, 0x61, 0x00, 0x00, 0xf6, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x07, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x4c, 0x00, 0x83, 0x0c, 0x20, 0x6b, 0x10, 0x00, 0x00, 0x01, 0x98, 0x5f,
+		0x1d, 0x80, 0x0d, 0xa4, 0x00, 0x6b, 0x10, 0x03, 0x8a, 0xc0, 0x00, 0x56, 0x00, 0x24, 0x60, 0x60,
+		0x3a, 0x00, 0x0c, 0x40, 0x00, 0x6b, 0x88, 0x03, 0x7e, 0x40, 0x00, 0x7e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x08, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x4e, 0x00, 0x84, 0x0c, 0xf0, 0x72, 0x10, 0x00, 0x00, 0x16, 0x30, 0x60,
+		0x00, 0x00, 0x09, 0xf4, 0x00, 0x70, 0x80, 0x03, 0x96, 0x00, 0x00, 0xb0, 0x00, 0x19, 0x58, 0x5f,
+		0x4c, 0xc0, 0x0d, 0xc6, 0x00, 0x71, 0x00, 0x03, 0x95, 0x80, 0x00, 0x44, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x09, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x50, 0x00, 0x85, 0x0c, 0xc0, 0x7a, 0x10, 0x00, 0x00, 0x29, 0xe8, 0x5f,
+		0xb7, 0x00, 0x14, 0x3a, 0x00, 0x70, 0x78, 0x03, 0xa5, 0xff, 0xff, 0xf4, 0x00, 0x05, 0xf8, 0x5e,
+		0xf9, 0x00, 0x0a, 0x66, 0x00, 0x75, 0xc8, 0x03, 0xa6, 0xc0, 0x00, 0x16, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x00, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x52, 0x00, 0x86, 0x0c, 0x90, 0x82, 0x10, 0x00, 0x00, 0x05, 0x58, 0x5f,
+		0xba, 0xc0, 0x0a, 0xaa, 0x00, 0x75, 0xa8, 0x03, 0xbc, 0x80, 0x00, 0xa8, 0x00, 0x15, 0x18, 0x5f,
+		0x1e, 0x00, 0x0d, 0xd6, 0x00, 0x75, 0x08, 0x03, 0xca, 0x00, 0x01, 0x62, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x01, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x54, 0x00, 0x80, 0x0c, 0x60, 0x8a, 0x10, 0x00, 0x00, 0x01, 0xf8, 0x60,
+		0x18, 0x40, 0x09, 0x78, 0x00, 0x78, 0x80, 0x03, 0xc1, 0xc0, 0x00, 0xde, 0x00, 0x10, 0x40, 0x5e,
+		0xfe, 0x80, 0x11, 0x84, 0x00, 0x77, 0xa0, 0x03, 0xde, 0x40, 0x00, 0xc4, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x02, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x56, 0x00, 0x81, 0x0c, 0x30, 0x92, 0x10, 0x00, 0xff, 0xe6, 0x90, 0x5f,
+		0xfd, 0x00, 0x0b, 0xca, 0x00, 0x78, 0x58, 0x03, 0xe6, 0x40, 0x00, 0x70, 0x00, 0x16, 0x30, 0x60,
+		0x06, 0x80, 0x0c, 0x2c, 0x00, 0x7a, 0x48, 0x04, 0x09, 0x00, 0x00, 0x10, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x03, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x58, 0x00, 0x82, 0x0c, 0x00, 0x9a, 0x10, 0x00, 0x00, 0x0e, 0x60, 0x5f,
+		0x92, 0xc0, 0x0b, 0xd6, 0x00, 0x7b, 0x70, 0x04, 0x02, 0x80, 0x00, 0x7c, 0xff, 0xff, 0xf8, 0x5f,
+		0x2d, 0x00, 0x16, 0xa8, 0x00, 0x7e, 0xb8, 0x03, 0xf7, 0x80, 0x00, 0xb0, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x04, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x5a, 0x00, 0x83, 0x0c, 0xd0, 0xa1, 0x10, 0x00, 0x00, 0x05, 0xd8, 0x60,
+		0x08, 0xc0, 0x0d, 0x2a, 0x00, 0x7d, 0x48, 0x04, 0x0c, 0x40, 0x00, 0xfe, 0x00, 0x07, 0xe8, 0x60,
+		0x5a, 0x00, 0x0f, 0x6c, 0x00, 0x7f, 0x98, 0x04, 0x20, 0x80, 0x00, 0x6a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x05, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x5c, 0x00, 0x84, 0x0c, 0xa0, 0xa9, 0x10, 0x00, 0x00, 0x0a, 0x58, 0x60,
+		0xbc, 0x00, 0x13, 0x0a, 0x00, 0x83, 0x18, 0x04, 0x26, 0xc0, 0x00, 0x78, 0x00, 0x0e, 0xb8, 0x5f,
+		0x76, 0x80, 0x0a, 0x26, 0x00, 0x82, 0x00, 0x04, 0x36, 0x40, 0x00, 0xf0, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x06, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x5e, 0x00, 0x85, 0x0c, 0x70, 0xb1, 0x10, 0x00, 0x00, 0x02, 0xe0, 0x5f,
+		0xf1, 0xc0, 0x11, 0x0e, 0x00, 0x81, 0x30, 0x04, 0x52, 0xc0, 0x00, 0x30, 0x00, 0x08, 0x48, 0x60,
+		0xa9, 0x40, 0x0e, 0xc6, 0x00, 0x83, 0x08, 0x04, 0x52, 0x00, 0x01, 0x5a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x02, 0x00, 0x74, 0xc4, 0x0f, 0x00, 0x02, 0x07, 0x02, 0x00, 0xd2, 0xc5, 0x0f, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x60, 0x00, 0x86, 0x0c, 0x40, 0xb9, 0x10, 0x00, 0xff, 0xf2, 0xc0, 0x5f,
+		0xc0, 0xc0, 0x0d, 0x6e, 0x00, 0x81, 0x88, 0x04, 0x5d, 0x40, 0x00, 0xd2, 0xff, 0xff, 0x40, 0x60,
+		0x0e, 0x40, 0x14, 0x2c, 0x00, 0x83, 0x78, 0x04, 0x55, 0x00, 0x01, 0x86, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x08, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x62, 0x00, 0x80, 0x0c, 0x10, 0xc1, 0x10, 0x00, 0x00, 0x16, 0x40, 0x60,
+		0xa3, 0x80, 0x11, 0x1e, 0x00, 0x85, 0x60, 0x04, 0x6c, 0x40, 0x01, 0x54, 0xff, 0xf6, 0xd0, 0x5f,
+		0x91, 0x00, 0x0a, 0x70, 0x00, 0x85, 0xf8, 0x04, 0x85, 0x40, 0x01, 0x3a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x09, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x64, 0x00, 0x81, 0x0c, 0xe0, 0xc8, 0x10, 0x00, 0xff, 0xf5, 0x28, 0x5f,
+		0xbe, 0xc0, 0x14, 0x40, 0x00, 0x88, 0x48, 0x04, 0x7d, 0x00, 0x01, 0x18, 0xff, 0xe1, 0x08, 0x5e,
+		0xb6, 0x00, 0x16, 0x84, 0x00, 0x8b, 0x78, 0x04, 0x95, 0xc0, 0x01, 0x1a, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x00, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x66, 0x00, 0x82, 0x0c, 0xb0, 0xd0, 0x10, 0x00, 0xff, 0xfa, 0xf0, 0x5f,
+		0x6a, 0x40, 0x15, 0x44, 0x00, 0x8a, 0xc8, 0x04, 0x9c, 0x80, 0x00, 0x46, 0xff, 0xf4, 0xe8, 0x5f,
+		0xf8, 0x00, 0x08, 0x66, 0x00, 0x8e, 0x90, 0x04, 0x9d, 0x80, 0x00, 0xec, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x01, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x68, 0x00, 0x83, 0x0c, 0x80, 0xd8, 0x10, 0x00, 0x00, 0x05, 0x68, 0x60,
+		0xe2, 0x40, 0x14, 0x64, 0x00, 0x8c, 0xe8, 0x04, 0xa7, 0xc0, 0x01, 0x3a, 0x00, 0x11, 0x00, 0x5f,
+		0x65, 0x40, 0x0d, 0x18, 0x00, 0x8d, 0x78, 0x04, 0xc8, 0x80, 0x01, 0x16, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x02, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x6a, 0x00, 0x84, 0x0c, 0x50, 0xe0, 0x10, 0x00, 0x00, 0x0f, 0x68, 0x5f,
+		0xf8, 0x00, 0x0d, 0x90, 0x00, 0x8e, 0x20, 0x04, 0xc2, 0x40, 0x00, 0x86, 0xff, 0xf7, 0xa8, 0x60,
+		0x10, 0x80, 0x17, 0x0e, 0x00, 0x8c, 0xf0, 0x04, 0xd5, 0x40, 0x01, 0x58, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x03, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x6c, 0x00, 0x85, 0x0c, 0x20, 0xe8, 0x10, 0x00, 0x00, 0x01, 0x58, 0x5f,
+		0xd9, 0x40, 0x19, 0xbc, 0x00, 0x8f, 0xb8, 0x04, 0xe2, 0xc0, 0x00, 0x5a, 0xff, 0xec, 0x48, 0x5f,
+		0xa8, 0x80, 0x13, 0xf2, 0x00, 0x95, 0x68, 0x04, 0xed, 0xc0, 0x00, 0xca, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x04, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x6e, 0x00, 0x86, 0x0c, 0xf0, 0xef, 0x10, 0x00, 0x00, 0x01, 0x98, 0x5f,
+		0xbe, 0xc0, 0x11, 0x1c, 0x00, 0x91, 0x90, 0x04, 0xe4, 0x80, 0x00, 0x86, 0xff, 0xf3, 0x58, 0x5f,
+		0xb9, 0x80, 0x18, 0xf6, 0x00, 0x92, 0xa0, 0x04, 0xfd, 0x00, 0x00, 0xea, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x05, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x70, 0x00, 0x80, 0x0c, 0xc0, 0xf7, 0x10, 0x00, 0x00, 0x0d, 0x38, 0x5e,
+		0xca, 0x40, 0x0c, 0x30, 0x00, 0x93, 0xe8, 0x04, 0xeb, 0xc0, 0x00, 0xe0, 0x00, 0x15, 0x90, 0x60,
+		0x41, 0xc0, 0x16, 0xc8, 0x00, 0x93, 0x28, 0x05, 0x08, 0xc0, 0x01, 0x64, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x06, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x72, 0x00, 0x81, 0x0c, 0x90, 0xff, 0x10, 0x00, 0x00, 0x1b, 0x28, 0x5f,
+		0xb6, 0xc0, 0x14, 0x88, 0x00, 0x97, 0xf8, 0x05, 0x0b, 0x80, 0x00, 0x92, 0xff, 0xee, 0xc8, 0x5f,
+		0xb5, 0x80, 0x16, 0xf8, 0x00, 0x98, 0x68, 0x05, 0x29, 0x80, 0x00, 0xe2, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x07, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x74, 0x00, 0x82, 0x0c, 0x60, 0x07, 0x11, 0x00, 0xff, 0xf3, 0x10, 0x5f,
+		0x9f, 0x00, 0x19, 0x98, 0x00, 0x9a, 0x78, 0x05, 0x4b, 0x40, 0x01, 0x3e, 0x00, 0x01, 0x28, 0x5f,
+		0xe3, 0xc0, 0x19, 0x54, 0x00, 0x99, 0xa8, 0x05, 0x4d, 0x00, 0x01, 0x68, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x08, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x76, 0x00, 0x83, 0x0c, 0x30, 0x0f, 0x11, 0x00, 0xff, 0xf7, 0x48, 0x5f,
+		0x52, 0x00, 0x16, 0xd2, 0x00, 0x98, 0x40, 0x05, 0x3b, 0x00, 0x01, 0x90, 0x00, 0x08, 0xc8, 0x5f,
+		0x32, 0x40, 0x19, 0x6a, 0x00, 0x9d, 0xa8, 0x05, 0x4a, 0xc0, 0x01, 0x16, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x09, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x78, 0x00, 0x84, 0x0c, 0x00, 0x17, 0x11, 0x00, 0x00, 0x07, 0x68, 0x5f,
+		0x90, 0x80, 0x1a, 0x82, 0x00, 0x9d, 0x38, 0x05, 0x5e, 0x00, 0x00, 0xe6, 0xff, 0xf9, 0xb0, 0x5e,
+		0x4e, 0xc0, 0x1a, 0xfa, 0x00, 0x9c, 0x28, 0x05, 0x84, 0x40, 0x00, 0xe2, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x00, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x7a, 0x00, 0x85, 0x0c, 0xd0, 0x1e, 0x11, 0x00, 0xff, 0xfe, 0xf8, 0x5f,
+		0xa4, 0x40, 0x16, 0x6a, 0x00, 0x9e, 0x68, 0x05, 0x78, 0xc0, 0x00, 0x98, 0xff, 0xf4, 0xa0, 0x5f,
+		0xd9, 0x80, 0x18, 0x06, 0x00, 0x9e, 0x60, 0x05, 0x76, 0x40, 0x01, 0x0e, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x01, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x7c, 0x00, 0x86, 0x0c, 0xa0, 0x26, 0x11, 0x00, 0x00, 0x10, 0x20, 0x5f,
+		0x5e, 0xc0, 0x15, 0xbc, 0x00, 0x9f, 0x68, 0x05, 0x8a, 0x80, 0x01, 0x5a, 0xff, 0xef, 0x08, 0x5f,
+		0xf7, 0x40, 0x17, 0xf2, 0x00, 0xa3, 0xa0, 0x05, 0x9a, 0xc0, 0x00, 0xd6, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x02, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+	{
+		0x0b, 0x00, 0x00, 0x02, 0x7e, 0x00, 0x80, 0x0c, 0x70, 0x2e, 0x11, 0x00, 0xff, 0xfd, 0x80, 0x5f,
+		0xba, 0x40, 0x18, 0xb8, 0x00, 0x9e, 0x48, 0x05, 0x8c, 0xc0, 0x00, 0xea, 0xff, 0xf7, 0xa0, 0x5f,
+		0x9c, 0x00, 0x1e, 0x2a, 0x00, 0xa1, 0x58, 0x05, 0xb2, 0xc0, 0x00, 0xfa, 0xb0, 0x04, 0xac, 0xfe,
+		0xa2, 0x08, 0x03, 0x00, 0x8e, 0x05, 0x10, 0x00, 0x03, 0x03, 0x03, 0x00, 0xec, 0x06, 0x10, 0x00,
+	},
+};
+
+const bench_corpus bench_corpus_rift_dk2 = { "rift_dk2", 64, 64, &reports[0][0] };
@@ -0,0 +1,400 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Decoder Corpus - Oculus Rift Radio Reports */
+
+// Synthesised from a 1 kHz head motion trace (turning, nodding, gravity and sensor noise),
+// each report carrying a left and a right Touch controller message.
+
+#include "../bench.h"
+
+static const unsigned char reports[64][64] = {
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x20, 0xa1, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x08, 0x05, 0x00,
+		0x02, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x00, 0x00, 0x4a, 0x80, 0x7f, 0x04, 0x58, 0x02, 0x1c,
+		0x00, 0x03, 0x08, 0xa5, 0x07, 0x00, 0xf6, 0xff, 0xf4, 0x07, 0xf0, 0xff, 0x00, 0x00, 0x0a, 0x00,
+		0x05, 0x00, 0x01, 0x00, 0x00, 0x4a, 0x80, 0x7f, 0x04, 0x58, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xf0, 0xa8, 0x07, 0x00, 0x07, 0x00, 0xf3, 0x07, 0x01, 0x00,
+		0x04, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x4a, 0x80, 0x7f, 0x04, 0x59, 0x02, 0x1c,
+		0x00, 0x03, 0xd8, 0xac, 0x07, 0x00, 0x08, 0x00, 0xec, 0x07, 0x0c, 0x00, 0x0a, 0x00, 0x0e, 0x00,
+		0x01, 0x00, 0x01, 0x01, 0x03, 0x4a, 0x80, 0x7f, 0x04, 0x59, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xc0, 0xb0, 0x07, 0x00, 0x0a, 0x00, 0xfc, 0x07, 0xf8, 0xff,
+		0x09, 0x00, 0x12, 0x00, 0x02, 0x00, 0x00, 0x02, 0x06, 0x4a, 0x80, 0x7f, 0x04, 0x5a, 0x02, 0x1c,
+		0x00, 0x03, 0xa8, 0xb4, 0x07, 0x00, 0x0a, 0x00, 0xe5, 0x07, 0x08, 0x00, 0x20, 0x00, 0x0f, 0x00,
+		0xfe, 0xff, 0x00, 0x02, 0x06, 0x4a, 0x80, 0x7f, 0x04, 0x5a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x90, 0xb8, 0x07, 0x00, 0x0a, 0x00, 0x05, 0x08, 0x08, 0x00,
+		0x19, 0x00, 0x22, 0x00, 0xfb, 0xff, 0x00, 0x03, 0x09, 0x4a, 0x80, 0x7f, 0x04, 0x5b, 0x02, 0x1c,
+		0x00, 0x03, 0x78, 0xbc, 0x07, 0x00, 0xeb, 0xff, 0xfc, 0x07, 0x08, 0x00, 0x1e, 0x00, 0x1b, 0x00,
+		0x03, 0x00, 0x00, 0x03, 0x09, 0x4a, 0x80, 0x7f, 0x04, 0x5b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x60, 0xc0, 0x07, 0x00, 0xfb, 0xff, 0x08, 0x08, 0x07, 0x00,
+		0x22, 0x00, 0x2a, 0x00, 0x03, 0x00, 0x00, 0x04, 0x0c, 0x4a, 0x80, 0x7f, 0x04, 0x5c, 0x02, 0x1c,
+		0x00, 0x03, 0x48, 0xc4, 0x07, 0x00, 0xfe, 0xff, 0xfd, 0x07, 0x18, 0x00, 0x28, 0x00, 0x22, 0x00,
+		0x08, 0x00, 0x00, 0x04, 0x0c, 0x4a, 0x80, 0x7f, 0x04, 0x5c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x30, 0xc8, 0x07, 0x00, 0x05, 0x00, 0x0e, 0x08, 0xfd, 0xff,
+		0x35, 0x00, 0x2d, 0x00, 0x05, 0x00, 0x00, 0x05, 0x0f, 0x4a, 0x80, 0x7f, 0x04, 0x5d, 0x02, 0x1c,
+		0x00, 0x03, 0x18, 0xcc, 0x07, 0x00, 0x06, 0x00, 0x0c, 0x08, 0xf7, 0xff, 0x2e, 0x00, 0x33, 0x00,
+		0x05, 0x00, 0x00, 0x05, 0x0f, 0x4a, 0x80, 0x7f, 0x04, 0x5d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x00, 0xd0, 0x07, 0x00, 0x0a, 0x00, 0xf5, 0x07, 0x1b, 0x00,
+		0x35, 0x00, 0x3a, 0x00, 0x0b, 0x00, 0x00, 0x06, 0x12, 0x4a, 0x80, 0x7f, 0x04, 0x5e, 0x02, 0x1c,
+		0x00, 0x03, 0xe8, 0xd3, 0x07, 0x00, 0x08, 0x00, 0xe6, 0x07, 0x0a, 0x00, 0x37, 0x00, 0x3f, 0x00,
+		0x04, 0x00, 0x00, 0x06, 0x12, 0x4a, 0x80, 0x7f, 0x04, 0x5e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xd0, 0xd7, 0x07, 0x00, 0xfb, 0xff, 0x0e, 0x08, 0x0c, 0x00,
+		0x40, 0x00, 0x46, 0x00, 0x07, 0x00, 0x00, 0x07, 0x15, 0x4a, 0x80, 0x7f, 0x04, 0x5f, 0x02, 0x1c,
+		0x00, 0x03, 0xb8, 0xdb, 0x07, 0x00, 0x01, 0x00, 0x0b, 0x08, 0xe5, 0xff, 0x42, 0x00, 0x42, 0x00,
+		0xff, 0xff, 0x00, 0x07, 0x15, 0x4a, 0x80, 0x7f, 0x04, 0x5f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xa0, 0xdf, 0x07, 0x00, 0x05, 0x00, 0xf6, 0x07, 0xf6, 0xff,
+		0x57, 0x00, 0x4b, 0x00, 0x08, 0x00, 0x01, 0x08, 0x18, 0x4a, 0x80, 0x7f, 0x04, 0x60, 0x02, 0x1c,
+		0x00, 0x03, 0x88, 0xe3, 0x07, 0x00, 0xff, 0xff, 0xf6, 0x07, 0x0c, 0x00, 0x57, 0x00, 0x4a, 0x00,
+		0x09, 0x00, 0x01, 0x08, 0x18, 0x4a, 0x80, 0x7f, 0x04, 0x60, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x70, 0xe7, 0x07, 0x00, 0x0d, 0x00, 0x02, 0x08, 0xfe, 0xff,
+		0x56, 0x00, 0x4c, 0x00, 0x08, 0x00, 0x01, 0x09, 0x1b, 0x4a, 0x80, 0x7f, 0x04, 0x61, 0x02, 0x1c,
+		0x00, 0x03, 0x58, 0xeb, 0x07, 0x00, 0x0f, 0x00, 0x06, 0x08, 0x09, 0x00, 0x59, 0x00, 0x54, 0x00,
+		0x07, 0x00, 0x01, 0x09, 0x1b, 0x4a, 0x80, 0x7f, 0x04, 0x61, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x40, 0xef, 0x07, 0x00, 0xf9, 0xff, 0xf3, 0x07, 0x06, 0x00,
+		0x5b, 0x00, 0x5d, 0x00, 0x01, 0x00, 0x00, 0x0a, 0x1e, 0x4a, 0x80, 0x7f, 0x04, 0x62, 0x02, 0x1c,
+		0x00, 0x03, 0x28, 0xf3, 0x07, 0x00, 0x09, 0x00, 0x08, 0x08, 0x08, 0x00, 0x5d, 0x00, 0x61, 0x00,
+		0x0f, 0x00, 0x00, 0x0a, 0x1e, 0x4a, 0x80, 0x7f, 0x04, 0x62, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x10, 0xf7, 0x07, 0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0x00,
+		0x69, 0x00, 0x58, 0x00, 0xfd, 0xff, 0x00, 0x0b, 0x21, 0x4a, 0x80, 0x7f, 0x04, 0x63, 0x02, 0x1c,
+		0x00, 0x03, 0xf8, 0xfa, 0x07, 0x00, 0x10, 0x00, 0xfb, 0x07, 0xf7, 0xff, 0x71, 0x00, 0x6c, 0x00,
+		0x00, 0x00, 0x00, 0x0b, 0x21, 0x4a, 0x80, 0x7f, 0x04, 0x63, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xe0, 0xfe, 0x07, 0x00, 0xf5, 0xff, 0xfa, 0x07, 0xff, 0xff,
+		0x6e, 0x00, 0x63, 0x00, 0x01, 0x00, 0x00, 0x0c, 0x24, 0x4a, 0x80, 0x7f, 0x04, 0x64, 0x02, 0x1c,
+		0x00, 0x03, 0xc8, 0x02, 0x08, 0x00, 0xfd, 0xff, 0x0a, 0x08, 0xff, 0xff, 0x72, 0x00, 0x6f, 0x00,
+		0x0f, 0x00, 0x00, 0x0c, 0x24, 0x4a, 0x80, 0x7f, 0x04, 0x64, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xb0, 0x06, 0x08, 0x00, 0x01, 0x00, 0x12, 0x08, 0x04, 0x00,
+		0x73, 0x00, 0x72, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x27, 0x4a, 0x80, 0x7f, 0x04, 0x65, 0x02, 0x1c,
+		0x00, 0x03, 0x98, 0x0a, 0x08, 0x00, 0xf4, 0xff, 0xe6, 0x07, 0x0d, 0x00, 0x78, 0x00, 0x6d, 0x00,
+		0x03, 0x00, 0x00, 0x0d, 0x27, 0x4a, 0x80, 0x7f, 0x04, 0x65, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x80, 0x0e, 0x08, 0x00, 0x06, 0x00, 0x04, 0x08, 0x19, 0x00,
+		0x83, 0x00, 0x79, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x2a, 0x4a, 0x80, 0x7f, 0x04, 0x66, 0x02, 0x1c,
+		0x00, 0x03, 0x68, 0x12, 0x08, 0x00, 0x06, 0x00, 0x05, 0x08, 0x0d, 0x00, 0x8b, 0x00, 0x80, 0x00,
+		0xfd, 0xff, 0x00, 0x0e, 0x2a, 0x4a, 0x80, 0x7f, 0x04, 0x66, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x50, 0x16, 0x08, 0x00, 0x06, 0x00, 0xfc, 0x07, 0x03, 0x00,
+		0x87, 0x00, 0x81, 0x00, 0x06, 0x00, 0x00, 0x0f, 0x2d, 0x4a, 0x80, 0x7f, 0x04, 0x67, 0x02, 0x1c,
+		0x00, 0x03, 0x38, 0x1a, 0x08, 0x00, 0x07, 0x00, 0x16, 0x08, 0x17, 0x00, 0x92, 0x00, 0x8a, 0x00,
+		0x02, 0x00, 0x00, 0x0f, 0x2d, 0x4a, 0x80, 0x7f, 0x04, 0x67, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x20, 0x1e, 0x08, 0x00, 0xfe, 0xff, 0xf7, 0x07, 0xff, 0xff,
+		0x91, 0x00, 0x91, 0x00, 0x06, 0x00, 0x01, 0x10, 0x30, 0x4a, 0x80, 0x7f, 0x04, 0x68, 0x02, 0x1c,
+		0x00, 0x03, 0x08, 0x22, 0x08, 0x00, 0x05, 0x00, 0x06, 0x08, 0x07, 0x00, 0x96, 0x00, 0x94, 0x00,
+		0x09, 0x00, 0x01, 0x10, 0x30, 0x4a, 0x80, 0x7f, 0x04, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xf0, 0x25, 0x08, 0x00, 0xea, 0xff, 0xfa, 0x07, 0x04, 0x00,
+		0xa4, 0x00, 0x96, 0x00, 0x03, 0x00, 0x01, 0x11, 0x33, 0x4a, 0x80, 0x7f, 0x04, 0x69, 0x02, 0x1c,
+		0x00, 0x03, 0xd8, 0x29, 0x08, 0x00, 0x02, 0x00, 0xe6, 0x07, 0xfd, 0xff, 0x9b, 0x00, 0x9c, 0x00,
+		0xfd, 0xff, 0x01, 0x11, 0x33, 0x4a, 0x80, 0x7f, 0x04, 0x69, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xc0, 0x2d, 0x08, 0x00, 0xf2, 0xff, 0xfd, 0x07, 0x18, 0x00,
+		0xa7, 0x00, 0xa5, 0x00, 0x02, 0x00, 0x00, 0x12, 0x36, 0x4a, 0x80, 0x7f, 0x04, 0x6a, 0x02, 0x1c,
+		0x00, 0x03, 0xa8, 0x31, 0x08, 0x00, 0x0f, 0x00, 0xff, 0x07, 0x04, 0x00, 0xa2, 0x00, 0x9f, 0x00,
+		0x01, 0x00, 0x00, 0x12, 0x36, 0x4a, 0x80, 0x7f, 0x04, 0x6a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x90, 0x35, 0x08, 0x00, 0x01, 0x00, 0x03, 0x08, 0x0e, 0x00,
+		0xa8, 0x00, 0xae, 0x00, 0x0c, 0x00, 0x00, 0x13, 0x39, 0x4a, 0x80, 0x7f, 0x04, 0x6b, 0x02, 0x1c,
+		0x00, 0x03, 0x78, 0x39, 0x08, 0x00, 0x02, 0x00, 0x06, 0x08, 0x0a, 0x00, 0xb3, 0x00, 0xb1, 0x00,
+		0x06, 0x00, 0x00, 0x13, 0x39, 0x4a, 0x80, 0x7f, 0x04, 0x6b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x60, 0x3d, 0x08, 0x00, 0xed, 0xff, 0xef, 0x07, 0x02, 0x00,
+		0xb6, 0x00, 0xad, 0x00, 0x02, 0x00, 0x00, 0x14, 0x3c, 0x4a, 0x80, 0x7f, 0x04, 0x6c, 0x02, 0x1c,
+		0x00, 0x03, 0x48, 0x41, 0x08, 0x00, 0xff, 0xff, 0xf8, 0x07, 0x10, 0x00, 0xc0, 0x00, 0xb8, 0x00,
+		0x02, 0x00, 0x00, 0x14, 0x3c, 0x4a, 0x80, 0x7f, 0x04, 0x6c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x30, 0x45, 0x08, 0x00, 0xe9, 0xff, 0xfd, 0x07, 0x0a, 0x00,
+		0xbb, 0x00, 0xb8, 0x00, 0x03, 0x00, 0x00, 0x15, 0x3f, 0x4a, 0x80, 0x7f, 0x04, 0x6d, 0x02, 0x1c,
+		0x00, 0x03, 0x18, 0x49, 0x08, 0x00, 0x06, 0x00, 0x00, 0x08, 0x05, 0x00, 0xbe, 0x00, 0xc2, 0x00,
+		0x0a, 0x00, 0x00, 0x15, 0x3f, 0x4a, 0x80, 0x7f, 0x04, 0x6d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x00, 0x4d, 0x08, 0x00, 0x01, 0x00, 0xea, 0x07, 0x09, 0x00,
+		0xc9, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x16, 0x42, 0x4a, 0x80, 0x7f, 0x04, 0x6e, 0x02, 0x1c,
+		0x00, 0x03, 0xe8, 0x50, 0x08, 0x00, 0xf8, 0xff, 0x02, 0x08, 0x0f, 0x00, 0xc4, 0x00, 0xc5, 0x00,
+		0x07, 0x00, 0x00, 0x16, 0x42, 0x4a, 0x80, 0x7f, 0x04, 0x6e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xd0, 0x54, 0x08, 0x00, 0xff, 0xff, 0xfc, 0x07, 0xfd, 0xff,
+		0xce, 0x00, 0xca, 0x00, 0x07, 0x00, 0x00, 0x17, 0x45, 0x4a, 0x80, 0x7f, 0x04, 0x6f, 0x02, 0x1c,
+		0x00, 0x03, 0xb8, 0x58, 0x08, 0x00, 0xfa, 0xff, 0x0b, 0x08, 0x23, 0x00, 0xcf, 0x00, 0xd4, 0x00,
+		0x0b, 0x00, 0x00, 0x17, 0x45, 0x4a, 0x80, 0x7f, 0x04, 0x6f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xa0, 0x5c, 0x08, 0x00, 0xfe, 0xff, 0xf4, 0x07, 0x02, 0x00,
+		0xd7, 0x00, 0xd5, 0x00, 0xfe, 0xff, 0x01, 0x18, 0x48, 0x4a, 0x80, 0x7f, 0x04, 0x70, 0x02, 0x1c,
+		0x00, 0x03, 0x88, 0x60, 0x08, 0x00, 0x0c, 0x00, 0xfd, 0x07, 0x19, 0x00, 0xdd, 0x00, 0xda, 0x00,
+		0x00, 0x00, 0x01, 0x18, 0x48, 0x4a, 0x80, 0x7f, 0x04, 0x70, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x70, 0x64, 0x08, 0x00, 0x01, 0x00, 0x02, 0x08, 0x0b, 0x00,
+		0xe5, 0x00, 0xde, 0x00, 0x0c, 0x00, 0x01, 0x19, 0x4b, 0x4a, 0x80, 0x7f, 0x04, 0x71, 0x02, 0x1c,
+		0x00, 0x03, 0x58, 0x68, 0x08, 0x00, 0x08, 0x00, 0xf2, 0x07, 0x0b, 0x00, 0xeb, 0x00, 0xde, 0x00,
+		0x0b, 0x00, 0x01, 0x19, 0x4b, 0x4a, 0x80, 0x7f, 0x04, 0x71, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x40, 0x6c, 0x08, 0x00, 0xfb, 0xff, 0x0b, 0x08, 0x0c, 0x00,
+		0xe7, 0x00, 0xe5, 0x00, 0x0c, 0x00, 0x00, 0x1a, 0x4e, 0x4a, 0x80, 0x7f, 0x04, 0x72, 0x02, 0x1c,
+		0x00, 0x03, 0x28, 0x70, 0x08, 0x00, 0x01, 0x00, 0xfa, 0x07, 0x03, 0x00, 0xed, 0x00, 0xe9, 0x00,
+		0x09, 0x00, 0x00, 0x1a, 0x4e, 0x4a, 0x80, 0x7f, 0x04, 0x72, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x10, 0x74, 0x08, 0x00, 0x0c, 0x00, 0x12, 0x08, 0x15, 0x00,
+		0xef, 0x00, 0xf0, 0x00, 0x04, 0x00, 0x00, 0x1b, 0x51, 0x4a, 0x80, 0x7f, 0x04, 0x73, 0x02, 0x1c,
+		0x00, 0x03, 0xf8, 0x77, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x04, 0x00, 0xf5, 0x00, 0xf2, 0x00,
+		0x05, 0x00, 0x00, 0x1b, 0x51, 0x4a, 0x80, 0x7f, 0x04, 0x73, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xe0, 0x7b, 0x08, 0x00, 0x02, 0x00, 0x04, 0x08, 0x16, 0x00,
+		0xf7, 0x00, 0xf4, 0x00, 0x0b, 0x00, 0x00, 0x1c, 0x54, 0x4a, 0x80, 0x7f, 0x04, 0x74, 0x02, 0x1c,
+		0x00, 0x03, 0xc8, 0x7f, 0x08, 0x00, 0x05, 0x00, 0xf6, 0x07, 0x0e, 0x00, 0xf9, 0x00, 0xf6, 0x00,
+		0x0c, 0x00, 0x00, 0x1c, 0x54, 0x4a, 0x80, 0x7f, 0x04, 0x74, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xb0, 0x83, 0x08, 0x00, 0xfa, 0xff, 0xf4, 0x07, 0x07, 0x00,
+		0xf8, 0x00, 0x02, 0x01, 0x01, 0x00, 0x00, 0x1d, 0x57, 0x4a, 0x80, 0x7f, 0x04, 0x75, 0x02, 0x1c,
+		0x00, 0x03, 0x98, 0x87, 0x08, 0x00, 0x09, 0x00, 0x08, 0x08, 0x14, 0x00, 0x05, 0x01, 0x01, 0x01,
+		0x07, 0x00, 0x00, 0x1d, 0x57, 0x4a, 0x80, 0x7f, 0x04, 0x75, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x80, 0x8b, 0x08, 0x00, 0xfb, 0xff, 0xf5, 0x07, 0x10, 0x00,
+		0x0c, 0x01, 0x0b, 0x01, 0x0d, 0x00, 0x00, 0x1e, 0x5a, 0x4a, 0x80, 0x7f, 0x04, 0x76, 0x02, 0x1c,
+		0x00, 0x03, 0x68, 0x8f, 0x08, 0x00, 0xf6, 0xff, 0xfd, 0x07, 0x1c, 0x00, 0x0d, 0x01, 0x0a, 0x01,
+		0x00, 0x00, 0x00, 0x1e, 0x5a, 0x4a, 0x80, 0x7f, 0x04, 0x76, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x50, 0x93, 0x08, 0x00, 0x15, 0x00, 0x17, 0x08, 0x1d, 0x00,
+		0x10, 0x01, 0x0c, 0x01, 0x07, 0x00, 0x00, 0x1f, 0x5d, 0x4a, 0x80, 0x7f, 0x04, 0x77, 0x02, 0x1c,
+		0x00, 0x03, 0x38, 0x97, 0x08, 0x00, 0xec, 0xff, 0xf5, 0x07, 0x1c, 0x00, 0x1b, 0x01, 0x16, 0x01,
+		0x0c, 0x00, 0x00, 0x1f, 0x5d, 0x4a, 0x80, 0x7f, 0x04, 0x77, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x20, 0x9b, 0x08, 0x00, 0x0a, 0x00, 0x03, 0x08, 0x07, 0x00,
+		0x17, 0x01, 0x14, 0x01, 0x01, 0x00, 0x01, 0x20, 0x60, 0x4a, 0x80, 0x7f, 0x04, 0x78, 0x02, 0x1c,
+		0x00, 0x03, 0x08, 0x9f, 0x08, 0x00, 0x05, 0x00, 0x06, 0x08, 0x0e, 0x00, 0x20, 0x01, 0x20, 0x01,
+		0x07, 0x00, 0x01, 0x20, 0x60, 0x4a, 0x80, 0x7f, 0x04, 0x78, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xf0, 0xa2, 0x08, 0x00, 0x09, 0x00, 0x0b, 0x08, 0x0f, 0x00,
+		0x1d, 0x01, 0x21, 0x01, 0x0d, 0x00, 0x01, 0x21, 0x63, 0x4a, 0x80, 0x7f, 0x04, 0x79, 0x02, 0x1c,
+		0x00, 0x03, 0xd8, 0xa6, 0x08, 0x00, 0x02, 0x00, 0x03, 0x08, 0x1a, 0x00, 0x29, 0x01, 0x2d, 0x01,
+		0x0c, 0x00, 0x01, 0x21, 0x63, 0x4a, 0x80, 0x7f, 0x04, 0x79, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xc0, 0xaa, 0x08, 0x00, 0xf9, 0xff, 0xf4, 0x07, 0x38, 0x00,
+		0x29, 0x01, 0x24, 0x01, 0x09, 0x00, 0x00, 0x22, 0x66, 0x4a, 0x80, 0x7f, 0x04, 0x7a, 0x02, 0x1c,
+		0x00, 0x03, 0xa8, 0xae, 0x08, 0x00, 0x05, 0x00, 0xf9, 0x07, 0x15, 0x00, 0x2f, 0x01, 0x2c, 0x01,
+		0x11, 0x00, 0x00, 0x22, 0x66, 0x4a, 0x80, 0x7f, 0x04, 0x7a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x90, 0xb2, 0x08, 0x00, 0x08, 0x00, 0x0e, 0x08, 0x19, 0x00,
+		0x30, 0x01, 0x35, 0x01, 0x04, 0x00, 0x00, 0x23, 0x69, 0x4a, 0x80, 0x7f, 0x04, 0x7b, 0x02, 0x1c,
+		0x00, 0x03, 0x78, 0xb6, 0x08, 0x00, 0x18, 0x00, 0x13, 0x08, 0x08, 0x00, 0x35, 0x01, 0x3b, 0x01,
+		0x04, 0x00, 0x00, 0x23, 0x69, 0x4a, 0x80, 0x7f, 0x04, 0x7b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x60, 0xba, 0x08, 0x00, 0xf8, 0xff, 0xfc, 0x07, 0x28, 0x00,
+		0x38, 0x01, 0x40, 0x01, 0x0d, 0x00, 0x00, 0x24, 0x6c, 0x4a, 0x80, 0x7f, 0x04, 0x7c, 0x02, 0x1c,
+		0x00, 0x03, 0x48, 0xbe, 0x08, 0x00, 0x0a, 0x00, 0xf7, 0x07, 0x03, 0x00, 0x41, 0x01, 0x43, 0x01,
+		0x09, 0x00, 0x00, 0x24, 0x6c, 0x4a, 0x80, 0x7f, 0x04, 0x7c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x30, 0xc2, 0x08, 0x00, 0xf7, 0xff, 0xfc, 0x07, 0x1d, 0x00,
+		0x43, 0x01, 0x46, 0x01, 0x08, 0x00, 0x00, 0x25, 0x6f, 0x4a, 0x80, 0x7f, 0x04, 0x7d, 0x02, 0x1c,
+		0x00, 0x03, 0x18, 0xc6, 0x08, 0x00, 0xfe, 0xff, 0xfc, 0x07, 0x1d, 0x00, 0x43, 0x01, 0x42, 0x01,
+		0x04, 0x00, 0x00, 0x25, 0x6f, 0x4a, 0x80, 0x7f, 0x04, 0x7d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x00, 0xca, 0x08, 0x00, 0x0b, 0x00, 0xf6, 0x07, 0x22, 0x00,
+		0x3e, 0x01, 0x53, 0x01, 0x04, 0x00, 0x00, 0x26, 0x72, 0x4a, 0x80, 0x7f, 0x04, 0x7e, 0x02, 0x1c,
+		0x00, 0x03, 0xe8, 0xcd, 0x08, 0x00, 0xf6, 0xff, 0x04, 0x08, 0x19, 0x00, 0x4d, 0x01, 0x55, 0x01,
+		0x02, 0x00, 0x00, 0x26, 0x72, 0x4a, 0x80, 0x7f, 0x04, 0x7e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xd0, 0xd1, 0x08, 0x00, 0x08, 0x00, 0x00, 0x08, 0x1e, 0x00,
+		0x50, 0x01, 0x53, 0x01, 0x08, 0x00, 0x00, 0x27, 0x75, 0x4a, 0x80, 0x7f, 0x04, 0x7f, 0x02, 0x1c,
+		0x00, 0x03, 0xb8, 0xd5, 0x08, 0x00, 0x05, 0x00, 0x15, 0x08, 0x1c, 0x00, 0x53, 0x01, 0x55, 0x01,
+		0x0d, 0x00, 0x00, 0x27, 0x75, 0x4a, 0x80, 0x7f, 0x04, 0x7f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xa0, 0xd9, 0x08, 0x00, 0x01, 0x00, 0xf0, 0x07, 0x22, 0x00,
+		0x4e, 0x01, 0x60, 0x01, 0x0f, 0x00, 0x01, 0x28, 0x78, 0x4a, 0x80, 0x7f, 0x04, 0x80, 0x02, 0x1c,
+		0x00, 0x03, 0x88, 0xdd, 0x08, 0x00, 0xf5, 0xff, 0xef, 0x07, 0x28, 0x00, 0x5f, 0x01, 0x61, 0x01,
+		0x05, 0x00, 0x01, 0x28, 0x78, 0x4a, 0x80, 0x7f, 0x04, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x70, 0xe1, 0x08, 0x00, 0xfb, 0xff, 0x0a, 0x08, 0x24, 0x00,
+		0x5a, 0x01, 0x6c, 0x01, 0x12, 0x00, 0x01, 0x29, 0x7b, 0x4a, 0x80, 0x7f, 0x04, 0x81, 0x02, 0x1c,
+		0x00, 0x03, 0x58, 0xe5, 0x08, 0x00, 0xf7, 0xff, 0x00, 0x08, 0x17, 0x00, 0x64, 0x01, 0x6e, 0x01,
+		0x06, 0x00, 0x01, 0x29, 0x7b, 0x4a, 0x80, 0x7f, 0x04, 0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x40, 0xe9, 0x08, 0x00, 0x0b, 0x00, 0xf6, 0x07, 0x1c, 0x00,
+		0x65, 0x01, 0x68, 0x01, 0x0f, 0x00, 0x00, 0x2a, 0x7e, 0x4a, 0x80, 0x7f, 0x04, 0x82, 0x02, 0x1c,
+		0x00, 0x03, 0x28, 0xed, 0x08, 0x00, 0x05, 0x00, 0x06, 0x08, 0x32, 0x00, 0x69, 0x01, 0x76, 0x01,
+		0x03, 0x00, 0x00, 0x2a, 0x7e, 0x4a, 0x80, 0x7f, 0x04, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x10, 0xf1, 0x08, 0x00, 0xff, 0xff, 0x08, 0x08, 0x20, 0x00,
+		0x67, 0x01, 0x77, 0x01, 0x08, 0x00, 0x00, 0x2b, 0x81, 0x4a, 0x80, 0x7f, 0x04, 0x83, 0x02, 0x1c,
+		0x00, 0x03, 0xf8, 0xf4, 0x08, 0x00, 0x0c, 0x00, 0xf7, 0x07, 0x26, 0x00, 0x6d, 0x01, 0x84, 0x01,
+		0x0b, 0x00, 0x00, 0x2b, 0x81, 0x4a, 0x80, 0x7f, 0x04, 0x83, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xe0, 0xf8, 0x08, 0x00, 0x04, 0x00, 0xfd, 0x07, 0x10, 0x00,
+		0x70, 0x01, 0x86, 0x01, 0x04, 0x00, 0x00, 0x2c, 0x84, 0x4a, 0x80, 0x7f, 0x04, 0x84, 0x02, 0x1c,
+		0x00, 0x03, 0xc8, 0xfc, 0x08, 0x00, 0xf4, 0xff, 0xf7, 0x07, 0x1a, 0x00, 0x6d, 0x01, 0x82, 0x01,
+		0x09, 0x00, 0x00, 0x2c, 0x84, 0x4a, 0x80, 0x7f, 0x04, 0x84, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xb0, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x0d, 0x08, 0x23, 0x00,
+		0x81, 0x01, 0x8c, 0x01, 0x0c, 0x00, 0x00, 0x2d, 0x87, 0x4a, 0x80, 0x7f, 0x04, 0x85, 0x02, 0x1c,
+		0x00, 0x03, 0x98, 0x04, 0x09, 0x00, 0xf2, 0xff, 0x14, 0x08, 0x31, 0x00, 0x7d, 0x01, 0x8f, 0x01,
+		0x0a, 0x00, 0x00, 0x2d, 0x87, 0x4a, 0x80, 0x7f, 0x04, 0x85, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x80, 0x08, 0x09, 0x00, 0xed, 0xff, 0x02, 0x08, 0x1d, 0x00,
+		0x7e, 0x01, 0x98, 0x01, 0x12, 0x00, 0x00, 0x2e, 0x8a, 0x4a, 0x80, 0x7f, 0x04, 0x86, 0x02, 0x1c,
+		0x00, 0x03, 0x68, 0x0c, 0x09, 0x00, 0xfe, 0xff, 0xfb, 0x07, 0x24, 0x00, 0x82, 0x01, 0x9d, 0x01,
+		0x0c, 0x00, 0x00, 0x2e, 0x8a, 0x4a, 0x80, 0x7f, 0x04, 0x86, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x50, 0x10, 0x09, 0x00, 0x14, 0x00, 0x00, 0x08, 0x1c, 0x00,
+		0x81, 0x01, 0x99, 0x01, 0x05, 0x00, 0x00, 0x2f, 0x8d, 0x4a, 0x80, 0x7f, 0x04, 0x87, 0x02, 0x1c,
+		0x00, 0x03, 0x38, 0x14, 0x09, 0x00, 0x07, 0x00, 0x06, 0x08, 0x30, 0x00, 0x83, 0x01, 0xa0, 0x01,
+		0x0b, 0x00, 0x00, 0x2f, 0x8d, 0x4a, 0x80, 0x7f, 0x04, 0x87, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x20, 0x18, 0x09, 0x00, 0x05, 0x00, 0x1a, 0x08, 0x34, 0x00,
+		0x8c, 0x01, 0x99, 0x01, 0x12, 0x00, 0x01, 0x30, 0x90, 0x4a, 0x80, 0x7f, 0x04, 0x88, 0x02, 0x1c,
+		0x00, 0x03, 0x08, 0x1c, 0x09, 0x00, 0x00, 0x00, 0xf6, 0x07, 0x2d, 0x00, 0x92, 0x01, 0xac, 0x01,
+		0x10, 0x00, 0x01, 0x30, 0x90, 0x4a, 0x80, 0x7f, 0x04, 0x88, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xf0, 0x1f, 0x09, 0x00, 0x01, 0x00, 0xef, 0x07, 0x29, 0x00,
+		0x97, 0x01, 0xad, 0x01, 0x0e, 0x00, 0x01, 0x31, 0x93, 0x4a, 0x80, 0x7f, 0x04, 0x89, 0x02, 0x1c,
+		0x00, 0x03, 0xd8, 0x23, 0x09, 0x00, 0xf9, 0xff, 0x07, 0x08, 0x32, 0x00, 0x9a, 0x01, 0xaf, 0x01,
+		0x06, 0x00, 0x01, 0x31, 0x93, 0x4a, 0x80, 0x7f, 0x04, 0x89, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xc0, 0x27, 0x09, 0x00, 0x14, 0x00, 0x05, 0x08, 0x3b, 0x00,
+		0xa4, 0x01, 0xb5, 0x01, 0x08, 0x00, 0x00, 0x32, 0x96, 0x4a, 0x80, 0x7f, 0x04, 0x8a, 0x02, 0x1c,
+		0x00, 0x03, 0xa8, 0x2b, 0x09, 0x00, 0xf9, 0xff, 0x08, 0x08, 0x27, 0x00, 0xa1, 0x01, 0xaf, 0x01,
+		0x09, 0x00, 0x00, 0x32, 0x96, 0x4a, 0x80, 0x7f, 0x04, 0x8a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x90, 0x2f, 0x09, 0x00, 0xfa, 0xff, 0x00, 0x08, 0x19, 0x00,
+		0x9e, 0x01, 0xb8, 0x01, 0x0d, 0x00, 0x00, 0x33, 0x99, 0x4a, 0x80, 0x7f, 0x04, 0x8b, 0x02, 0x1c,
+		0x00, 0x03, 0x78, 0x33, 0x09, 0x00, 0xef, 0xff, 0xf9, 0x07, 0x3f, 0x00, 0xa7, 0x01, 0xc2, 0x01,
+		0x09, 0x00, 0x00, 0x33, 0x99, 0x4a, 0x80, 0x7f, 0x04, 0x8b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x60, 0x37, 0x09, 0x00, 0x0a, 0x00, 0x0b, 0x08, 0x1a, 0x00,
+		0xac, 0x01, 0xbd, 0x01, 0x0b, 0x00, 0x00, 0x34, 0x9c, 0x4a, 0x80, 0x7f, 0x04, 0x8c, 0x02, 0x1c,
+		0x00, 0x03, 0x48, 0x3b, 0x09, 0x00, 0xf5, 0xff, 0x04, 0x08, 0x43, 0x00, 0xa3, 0x01, 0xc5, 0x01,
+		0x0e, 0x00, 0x00, 0x34, 0x9c, 0x4a, 0x80, 0x7f, 0x04, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x30, 0x3f, 0x09, 0x00, 0xf0, 0xff, 0x12, 0x08, 0x48, 0x00,
+		0xab, 0x01, 0xcb, 0x01, 0x14, 0x00, 0x00, 0x35, 0x9f, 0x4a, 0x80, 0x7f, 0x04, 0x8d, 0x02, 0x1c,
+		0x00, 0x03, 0x18, 0x43, 0x09, 0x00, 0xf5, 0xff, 0x0d, 0x08, 0x44, 0x00, 0xaa, 0x01, 0xd2, 0x01,
+		0x0e, 0x00, 0x00, 0x35, 0x9f, 0x4a, 0x80, 0x7f, 0x04, 0x8d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x00, 0x47, 0x09, 0x00, 0xff, 0xff, 0xee, 0x07, 0x30, 0x00,
+		0xb0, 0x01, 0xcd, 0x01, 0x0d, 0x00, 0x00, 0x36, 0xa2, 0x4a, 0x80, 0x7f, 0x04, 0x8e, 0x02, 0x1c,
+		0x00, 0x03, 0xe8, 0x4a, 0x09, 0x00, 0x00, 0x00, 0x07, 0x08, 0x46, 0x00, 0xb0, 0x01, 0xe0, 0x01,
+		0x12, 0x00, 0x00, 0x36, 0xa2, 0x4a, 0x80, 0x7f, 0x04, 0x8e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xd0, 0x4e, 0x09, 0x00, 0xfa, 0xff, 0xf1, 0x07, 0x35, 0x00,
+		0xbf, 0x01, 0xd6, 0x01, 0x09, 0x00, 0x00, 0x37, 0xa5, 0x4a, 0x80, 0x7f, 0x04, 0x8f, 0x02, 0x1c,
+		0x00, 0x03, 0xb8, 0x52, 0x09, 0x00, 0x02, 0x00, 0xff, 0x07, 0x4e, 0x00, 0xc1, 0x01, 0xe3, 0x01,
+		0x0c, 0x00, 0x00, 0x37, 0xa5, 0x4a, 0x80, 0x7f, 0x04, 0x8f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xa0, 0x56, 0x09, 0x00, 0xf6, 0xff, 0x08, 0x08, 0x3c, 0x00,
+		0xbe, 0x01, 0xe1, 0x01, 0x0c, 0x00, 0x01, 0x38, 0xa8, 0x4a, 0x80, 0x7f, 0x04, 0x90, 0x02, 0x1c,
+		0x00, 0x03, 0x88, 0x5a, 0x09, 0x00, 0x0f, 0x00, 0xf2, 0x07, 0x2b, 0x00, 0xbd, 0x01, 0xe5, 0x01,
+		0x0b, 0x00, 0x01, 0x38, 0xa8, 0x4a, 0x80, 0x7f, 0x04, 0x90, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x70, 0x5e, 0x09, 0x00, 0x0b, 0x00, 0x0a, 0x08, 0x4c, 0x00,
+		0xc3, 0x01, 0xf2, 0x01, 0x0a, 0x00, 0x01, 0x39, 0xab, 0x4a, 0x80, 0x7f, 0x04, 0x91, 0x02, 0x1c,
+		0x00, 0x03, 0x58, 0x62, 0x09, 0x00, 0x01, 0x00, 0x07, 0x08, 0x31, 0x00, 0xbe, 0x01, 0xf9, 0x01,
+		0x0b, 0x00, 0x01, 0x39, 0xab, 0x4a, 0x80, 0x7f, 0x04, 0x91, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x40, 0x66, 0x09, 0x00, 0xf2, 0xff, 0x0b, 0x08, 0x42, 0x00,
+		0xc7, 0x01, 0xfa, 0x01, 0x0d, 0x00, 0x00, 0x3a, 0xae, 0x4a, 0x80, 0x7f, 0x04, 0x92, 0x02, 0x1c,
+		0x00, 0x03, 0x28, 0x6a, 0x09, 0x00, 0xf5, 0xff, 0xf3, 0x07, 0x54, 0x00, 0xce, 0x01, 0xf3, 0x01,
+		0x0c, 0x00, 0x00, 0x3a, 0xae, 0x4a, 0x80, 0x7f, 0x04, 0x92, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x10, 0x6e, 0x09, 0x00, 0x01, 0x00, 0xf1, 0x07, 0x41, 0x00,
+		0xce, 0x01, 0x02, 0x02, 0x0d, 0x00, 0x00, 0x3b, 0xb1, 0x4a, 0x80, 0x7f, 0x04, 0x93, 0x02, 0x1c,
+		0x00, 0x03, 0xf8, 0x71, 0x09, 0x00, 0x03, 0x00, 0x00, 0x08, 0x3f, 0x00, 0xce, 0x01, 0xfb, 0x01,
+		0x09, 0x00, 0x00, 0x3b, 0xb1, 0x4a, 0x80, 0x7f, 0x04, 0x93, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xe0, 0x75, 0x09, 0x00, 0x08, 0x00, 0x0a, 0x08, 0x3c, 0x00,
+		0xcc, 0x01, 0xfa, 0x01, 0x08, 0x00, 0x00, 0x3c, 0xb4, 0x4a, 0x80, 0x7f, 0x04, 0x94, 0x02, 0x1c,
+		0x00, 0x03, 0xc8, 0x79, 0x09, 0x00, 0x06, 0x00, 0x01, 0x08, 0x40, 0x00, 0xd7, 0x01, 0x07, 0x02,
+		0x09, 0x00, 0x00, 0x3c, 0xb4, 0x4a, 0x80, 0x7f, 0x04, 0x94, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0xb0, 0x7d, 0x09, 0x00, 0x06, 0x00, 0x15, 0x08, 0x47, 0x00,
+		0xdc, 0x01, 0x14, 0x02, 0x0d, 0x00, 0x00, 0x3d, 0xb7, 0x4a, 0x80, 0x7f, 0x04, 0x95, 0x02, 0x1c,
+		0x00, 0x03, 0x98, 0x81, 0x09, 0x00, 0x08, 0x00, 0x0b, 0x08, 0x4a, 0x00, 0xdd, 0x01, 0x1d, 0x02,
+		0x0a, 0x00, 0x00, 0x3d, 0xb7, 0x4a, 0x80, 0x7f, 0x04, 0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x80, 0x85, 0x09, 0x00, 0x0e, 0x00, 0x13, 0x08, 0x51, 0x00,
+		0xe4, 0x01, 0x13, 0x02, 0x09, 0x00, 0x00, 0x3e, 0xba, 0x4a, 0x80, 0x7f, 0x04, 0x96, 0x02, 0x1c,
+		0x00, 0x03, 0x68, 0x89, 0x09, 0x00, 0xf7, 0xff, 0xf6, 0x07, 0x51, 0x00, 0xe9, 0x01, 0x1a, 0x02,
+		0x0b, 0x00, 0x00, 0x3e, 0xba, 0x4a, 0x80, 0x7f, 0x04, 0x96, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x0c, 0x00, 0x00, 0x1c, 0x00, 0x02, 0x50, 0x8d, 0x09, 0x00, 0xf2, 0xff, 0x04, 0x08, 0x4f, 0x00,
+		0xe4, 0x01, 0x1d, 0x02, 0x06, 0x00, 0x00, 0x3f, 0xbd, 0x4a, 0x80, 0x7f, 0x04, 0x97, 0x02, 0x1c,
+		0x00, 0x03, 0x38, 0x91, 0x09, 0x00, 0xf2, 0xff, 0xf2, 0x07, 0x30, 0x00, 0xed, 0x01, 0x21, 0x02,
+		0x10, 0x00, 0x00, 0x3f, 0xbd, 0x4a, 0x80, 0x7f, 0x04, 0x97, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+};
+
+const bench_corpus bench_corpus_rift_radio = { "rift_radio", 64, 64, &reports[0][0] };
@@ -0,0 +1,400 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Decoder Corpus - Oculus Rift S Controller Reports */
+
+// Synthesised from a 1 kHz head motion trace (turning, nodding, gravity and sensor noise),
+// with IMU, button, trigger/grip, joystick and capsense blocks.
+
+#include "../bench.h"
+
+static const unsigned char reports[64][62] = {
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x04, 0x00, 0x00, 0x00, 0x91, 0x60,
+		0xae, 0x0a, 0x00, 0x34, 0x12, 0x11, 0x00, 0xf1, 0x07, 0x05, 0x00, 0x01, 0x00, 0xfb, 0xff, 0x01,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x00, 0x00, 0x10, 0x22, 0x08, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x30,
+		0xb6, 0x0a, 0x00, 0x35, 0x12, 0xf4, 0xff, 0xf4, 0x07, 0xf1, 0xff, 0x09, 0x00, 0x03, 0x00, 0x05,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x01, 0x05, 0x10, 0x22, 0x09, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00,
+		0xbe, 0x0a, 0x00, 0x36, 0x12, 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x10, 0x00, 0x0c, 0x00, 0xfe,
+		0xff, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x02, 0x0a, 0x10, 0x22, 0x0a, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xd0,
+		0xc5, 0x0a, 0x00, 0x37, 0x12, 0x0d, 0x00, 0xe6, 0x07, 0x09, 0x00, 0x1a, 0x00, 0x1f, 0x00, 0x01,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x03, 0x0f, 0x10, 0x22, 0x0b, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xa0,
+		0xcd, 0x0a, 0x00, 0x38, 0x12, 0x07, 0x00, 0x05, 0x08, 0xfa, 0xff, 0x23, 0x00, 0x28, 0x00, 0x04,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x04, 0x14, 0x10, 0x22, 0x0c, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x70,
+		0xd5, 0x0a, 0x00, 0x39, 0x12, 0xf6, 0xff, 0x01, 0x08, 0xf9, 0xff, 0x2b, 0x00, 0x32, 0x00, 0xff,
+		0xff, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x05, 0x19, 0x10, 0x22, 0x0d, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x40,
+		0xdd, 0x0a, 0x00, 0x3a, 0x12, 0x0b, 0x00, 0x0a, 0x08, 0xfd, 0xff, 0x3b, 0x00, 0x2d, 0x00, 0x09,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x06, 0x1e, 0x10, 0x22, 0x0e, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x10,
+		0xe5, 0x0a, 0x00, 0x3b, 0x12, 0xff, 0xff, 0x0a, 0x08, 0x05, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x00,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x07, 0x23, 0x10, 0x22, 0x0f, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xe0,
+		0xec, 0x0a, 0x00, 0x3c, 0x12, 0xf5, 0xff, 0xfa, 0x07, 0xf3, 0xff, 0x50, 0x00, 0x47, 0x00, 0x04,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x08, 0x28, 0x10, 0x22, 0x10, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xb0,
+		0xf4, 0x0a, 0x00, 0x3d, 0x12, 0xed, 0xff, 0x01, 0x08, 0xef, 0xff, 0x52, 0x00, 0x4d, 0x00, 0xff,
+		0xff, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x09, 0x2d, 0x10, 0x22, 0x11, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x80,
+		0xfc, 0x0a, 0x00, 0x3e, 0x12, 0xf3, 0xff, 0xfb, 0x07, 0xf4, 0xff, 0x5e, 0x00, 0x4f, 0x00, 0x00,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x0a, 0x32, 0x10, 0x22, 0x12, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x50,
+		0x04, 0x0b, 0x00, 0x3f, 0x12, 0x02, 0x00, 0x02, 0x08, 0x0d, 0x00, 0x63, 0x00, 0x65, 0x00, 0x06,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x0b, 0x37, 0x10, 0x22, 0x13, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x20,
+		0x0c, 0x0b, 0x00, 0x40, 0x12, 0xf6, 0xff, 0xfc, 0x07, 0xf8, 0xff, 0x6e, 0x00, 0x6a, 0x00, 0x0b,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x0c, 0x3c, 0x10, 0x22, 0x14, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf0,
+		0x13, 0x0b, 0x00, 0x41, 0x12, 0xfb, 0xff, 0x07, 0x08, 0xf8, 0xff, 0x78, 0x00, 0x72, 0x00, 0xfd,
+		0xff, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x0d, 0x41, 0x10, 0x22, 0x15, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xc0,
+		0x1b, 0x0b, 0x00, 0x42, 0x12, 0x09, 0x00, 0x02, 0x08, 0x03, 0x00, 0x80, 0x00, 0x79, 0x00, 0x01,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x0e, 0x46, 0x10, 0x22, 0x16, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x90,
+		0x23, 0x0b, 0x00, 0x43, 0x12, 0x06, 0x00, 0xf8, 0x07, 0x06, 0x00, 0x8d, 0x00, 0x85, 0x00, 0xf6,
+		0xff, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x0f, 0x4b, 0x10, 0x22, 0x17, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x04, 0x00, 0x00, 0x00, 0x91, 0x60,
+		0x2b, 0x0b, 0x00, 0x44, 0x12, 0xf5, 0xff, 0xf3, 0x07, 0x0b, 0x00, 0x8b, 0x00, 0x90, 0x00, 0x04,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x10, 0x50, 0x10, 0x22, 0x18, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x30,
+		0x33, 0x0b, 0x00, 0x45, 0x12, 0x08, 0x00, 0x03, 0x08, 0x0b, 0x00, 0x9d, 0x00, 0x9a, 0x00, 0x04,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x11, 0x55, 0x10, 0x22, 0x19, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00,
+		0x3b, 0x0b, 0x00, 0x46, 0x12, 0x07, 0x00, 0xf9, 0x07, 0x06, 0x00, 0x9f, 0x00, 0x9e, 0x00, 0xff,
+		0xff, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x12, 0x5a, 0x10, 0x22, 0x1a, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xd0,
+		0x42, 0x0b, 0x00, 0x47, 0x12, 0xf6, 0xff, 0xff, 0x07, 0x02, 0x00, 0xa7, 0x00, 0xa5, 0x00, 0x02,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x13, 0x5f, 0x10, 0x22, 0x1b, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xa0,
+		0x4a, 0x0b, 0x00, 0x48, 0x12, 0xfc, 0xff, 0x11, 0x08, 0x12, 0x00, 0xb3, 0x00, 0xb5, 0x00, 0xfb,
+		0xff, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x14, 0x64, 0x10, 0x22, 0x1c, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x70,
+		0x52, 0x0b, 0x00, 0x49, 0x12, 0x11, 0x00, 0x03, 0x08, 0x05, 0x00, 0xc6, 0x00, 0xbc, 0x00, 0x08,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x15, 0x69, 0x10, 0x22, 0x1d, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x40,
+		0x5a, 0x0b, 0x00, 0x4a, 0x12, 0x0d, 0x00, 0xe9, 0x07, 0x0f, 0x00, 0xca, 0x00, 0xc9, 0x00, 0x07,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x16, 0x6e, 0x10, 0x22, 0x1e, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x10,
+		0x62, 0x0b, 0x00, 0x4b, 0x12, 0x0f, 0x00, 0x06, 0x08, 0xfb, 0xff, 0xce, 0x00, 0xcc, 0x00, 0x01,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x17, 0x73, 0x10, 0x22, 0x1f, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xe0,
+		0x69, 0x0b, 0x00, 0x4c, 0x12, 0xfb, 0xff, 0x04, 0x08, 0x04, 0x00, 0xd3, 0x00, 0xda, 0x00, 0x06,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x18, 0x78, 0x10, 0x22, 0x20, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xb0,
+		0x71, 0x0b, 0x00, 0x4d, 0x12, 0xfe, 0xff, 0x0c, 0x08, 0x06, 0x00, 0xe0, 0x00, 0xe4, 0x00, 0x06,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x19, 0x7d, 0x10, 0x22, 0x21, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x80,
+		0x79, 0x0b, 0x00, 0x4e, 0x12, 0x05, 0x00, 0xfe, 0x07, 0x0b, 0x00, 0xe9, 0x00, 0xe4, 0x00, 0x08,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x1a, 0x82, 0x10, 0x22, 0x22, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x50,
+		0x81, 0x0b, 0x00, 0x4f, 0x12, 0xfd, 0xff, 0x03, 0x08, 0x09, 0x00, 0xf6, 0x00, 0xee, 0x00, 0x04,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x1b, 0x87, 0x10, 0x22, 0x23, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x20,
+		0x89, 0x0b, 0x00, 0x50, 0x12, 0xf2, 0xff, 0x0b, 0x08, 0x15, 0x00, 0xff, 0x00, 0xf7, 0x00, 0xfe,
+		0xff, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x1c, 0x8c, 0x10, 0x22, 0x24, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf0,
+		0x90, 0x0b, 0x00, 0x51, 0x12, 0x06, 0x00, 0xfa, 0x07, 0x16, 0x00, 0x05, 0x01, 0xfd, 0x00, 0x02,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x1d, 0x91, 0x10, 0x22, 0x25, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xc0,
+		0x98, 0x0b, 0x00, 0x52, 0x12, 0x0b, 0x00, 0xf1, 0x07, 0x13, 0x00, 0x05, 0x01, 0x0b, 0x01, 0x06,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x1e, 0x96, 0x10, 0x22, 0x26, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x90,
+		0xa0, 0x0b, 0x00, 0x53, 0x12, 0xff, 0xff, 0x14, 0x08, 0x0d, 0x00, 0x18, 0x01, 0x01, 0x01, 0x00,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x1f, 0x9b, 0x10, 0x22, 0x27, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x04, 0x00, 0x00, 0x00, 0x91, 0x60,
+		0xa8, 0x0b, 0x00, 0x54, 0x12, 0x00, 0x00, 0x0a, 0x08, 0x0e, 0x00, 0x23, 0x01, 0x15, 0x01, 0x09,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x20, 0xa0, 0x10, 0x22, 0x28, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x30,
+		0xb0, 0x0b, 0x00, 0x55, 0x12, 0xf2, 0xff, 0x09, 0x08, 0x15, 0x00, 0x23, 0x01, 0x26, 0x01, 0xff,
+		0xff, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x21, 0xa5, 0x10, 0x22, 0x29, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00,
+		0xb8, 0x0b, 0x00, 0x56, 0x12, 0x05, 0x00, 0x02, 0x08, 0x0e, 0x00, 0x1f, 0x01, 0x2d, 0x01, 0x02,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x22, 0xaa, 0x10, 0x22, 0x2a, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xd0,
+		0xbf, 0x0b, 0x00, 0x57, 0x12, 0xf4, 0xff, 0x00, 0x08, 0x18, 0x00, 0x31, 0x01, 0x30, 0x01, 0x0a,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x23, 0xaf, 0x10, 0x22, 0x2b, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xa0,
+		0xc7, 0x0b, 0x00, 0x58, 0x12, 0xfc, 0xff, 0x0a, 0x08, 0x05, 0x00, 0x3e, 0x01, 0x41, 0x01, 0x07,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x24, 0xb4, 0x10, 0x22, 0x2c, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x70,
+		0xcf, 0x0b, 0x00, 0x59, 0x12, 0x08, 0x00, 0xf3, 0x07, 0x17, 0x00, 0x3f, 0x01, 0x44, 0x01, 0x05,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x25, 0xb9, 0x10, 0x22, 0x2d, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x40,
+		0xd7, 0x0b, 0x00, 0x5a, 0x12, 0x03, 0x00, 0xff, 0x07, 0x15, 0x00, 0x3b, 0x01, 0x44, 0x01, 0x13,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x26, 0xbe, 0x10, 0x22, 0x2e, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x10,
+		0xdf, 0x0b, 0x00, 0x5b, 0x12, 0x09, 0x00, 0x11, 0x08, 0x07, 0x00, 0x4f, 0x01, 0x57, 0x01, 0x05,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x27, 0xc3, 0x10, 0x22, 0x2f, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xe0,
+		0xe6, 0x0b, 0x00, 0x5c, 0x12, 0x02, 0x00, 0x03, 0x08, 0x0e, 0x00, 0x58, 0x01, 0x66, 0x01, 0x06,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x28, 0xc8, 0x10, 0x22, 0x30, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xb0,
+		0xee, 0x0b, 0x00, 0x5d, 0x12, 0x00, 0x00, 0xf9, 0x07, 0x15, 0x00, 0x68, 0x01, 0x6a, 0x01, 0x10,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x29, 0xcd, 0x10, 0x22, 0x31, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x80,
+		0xf6, 0x0b, 0x00, 0x5e, 0x12, 0x00, 0x00, 0xeb, 0x07, 0x2b, 0x00, 0x65, 0x01, 0x69, 0x01, 0x05,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x2a, 0xd2, 0x10, 0x22, 0x32, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x50,
+		0xfe, 0x0b, 0x00, 0x5f, 0x12, 0x09, 0x00, 0xe9, 0x07, 0x15, 0x00, 0x6a, 0x01, 0x7d, 0x01, 0x0f,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x2b, 0xd7, 0x10, 0x22, 0x33, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x20,
+		0x06, 0x0c, 0x00, 0x60, 0x12, 0xf4, 0xff, 0x19, 0x08, 0x19, 0x00, 0x6c, 0x01, 0x7f, 0x01, 0x0b,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x2c, 0xdc, 0x10, 0x22, 0x34, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf0,
+		0x0d, 0x0c, 0x00, 0x61, 0x12, 0x04, 0x00, 0xff, 0x07, 0x21, 0x00, 0x77, 0x01, 0x8d, 0x01, 0x0a,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x2d, 0xe1, 0x10, 0x22, 0x35, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xc0,
+		0x15, 0x0c, 0x00, 0x62, 0x12, 0x08, 0x00, 0x05, 0x08, 0x2b, 0x00, 0x82, 0x01, 0x93, 0x01, 0x10,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x2e, 0xe6, 0x10, 0x22, 0x36, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x90,
+		0x1d, 0x0c, 0x00, 0x63, 0x12, 0xf0, 0xff, 0x13, 0x08, 0x18, 0x00, 0x8c, 0x01, 0x99, 0x01, 0x0b,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x2f, 0xeb, 0x10, 0x22, 0x37, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x04, 0x00, 0x00, 0x00, 0x91, 0x60,
+		0x25, 0x0c, 0x00, 0x64, 0x12, 0x08, 0x00, 0xf3, 0x07, 0x27, 0x00, 0x94, 0x01, 0xaa, 0x01, 0x0c,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x30, 0xf0, 0x10, 0x22, 0x38, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x30,
+		0x2d, 0x0c, 0x00, 0x65, 0x12, 0xfa, 0xff, 0x0d, 0x08, 0x37, 0x00, 0x92, 0x01, 0xad, 0x01, 0x0c,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x31, 0xf5, 0x10, 0x22, 0x39, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00,
+		0x35, 0x0c, 0x00, 0x66, 0x12, 0x09, 0x00, 0xf0, 0x07, 0x1d, 0x00, 0x98, 0x01, 0xb2, 0x01, 0x12,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x32, 0xfa, 0x10, 0x22, 0x3a, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xd0,
+		0x3c, 0x0c, 0x00, 0x67, 0x12, 0x0c, 0x00, 0xfe, 0x07, 0x3c, 0x00, 0x97, 0x01, 0xc3, 0x01, 0x13,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x33, 0xff, 0x10, 0x22, 0x3b, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xa0,
+		0x44, 0x0c, 0x00, 0x68, 0x12, 0xfd, 0xff, 0x03, 0x08, 0x22, 0x00, 0xa8, 0x01, 0xc4, 0x01, 0x05,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x34, 0x04, 0x10, 0x22, 0x3c, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x70,
+		0x4c, 0x0c, 0x00, 0x69, 0x12, 0x02, 0x00, 0x08, 0x08, 0x38, 0x00, 0xaf, 0x01, 0xcc, 0x01, 0x10,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x35, 0x09, 0x10, 0x22, 0x3d, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x40,
+		0x54, 0x0c, 0x00, 0x6a, 0x12, 0xfa, 0xff, 0xf0, 0x07, 0x3f, 0x00, 0xb4, 0x01, 0xd0, 0x01, 0x03,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x36, 0x0e, 0x10, 0x22, 0x3e, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x10,
+		0x5c, 0x0c, 0x00, 0x6b, 0x12, 0x0b, 0x00, 0x01, 0x08, 0x3f, 0x00, 0xb3, 0x01, 0xde, 0x01, 0x0e,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x37, 0x13, 0x10, 0x22, 0x3f, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xe0,
+		0x63, 0x0c, 0x00, 0x6c, 0x12, 0x07, 0x00, 0xf6, 0x07, 0x37, 0x00, 0xbe, 0x01, 0xe8, 0x01, 0x06,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x38, 0x18, 0x10, 0x22, 0x40, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xb0,
+		0x6b, 0x0c, 0x00, 0x6d, 0x12, 0x03, 0x00, 0xf4, 0x07, 0x3a, 0x00, 0xc3, 0x01, 0xe8, 0x01, 0x0e,
+		0x00, 0x0c, 0x01, 0x0d, 0x11, 0x1b, 0x39, 0x1d, 0x10, 0x22, 0x41, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x80,
+		0x73, 0x0c, 0x00, 0x6e, 0x12, 0x08, 0x00, 0x00, 0x08, 0x42, 0x00, 0xc9, 0x01, 0xf7, 0x01, 0x13,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x3a, 0x22, 0x10, 0x22, 0x42, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x50,
+		0x7b, 0x0c, 0x00, 0x6f, 0x12, 0x03, 0x00, 0xf1, 0x07, 0x3f, 0x00, 0xd3, 0x01, 0xf9, 0x01, 0x10,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x3b, 0x27, 0x10, 0x22, 0x43, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x20,
+		0x83, 0x0c, 0x00, 0x70, 0x12, 0x04, 0x00, 0xfc, 0x07, 0x3f, 0x00, 0xd7, 0x01, 0x09, 0x02, 0x15,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x3c, 0x2c, 0x10, 0x22, 0x44, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xf0,
+		0x8a, 0x0c, 0x00, 0x71, 0x12, 0xff, 0xff, 0xfa, 0x07, 0x36, 0x00, 0xd7, 0x01, 0x11, 0x02, 0x0f,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x3d, 0x31, 0x10, 0x22, 0x45, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0xc0,
+		0x92, 0x0c, 0x00, 0x72, 0x12, 0x0d, 0x00, 0x04, 0x08, 0x53, 0x00, 0xe1, 0x01, 0x0e, 0x02, 0x0a,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x3e, 0x36, 0x10, 0x22, 0x46, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x67, 0x55, 0x1b, 0xe8, 0xd0, 0xc3, 0xa9, 0x26, 0x1f, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x91, 0x90,
+		0x9a, 0x0c, 0x00, 0x73, 0x12, 0x03, 0x00, 0xf3, 0x07, 0x4a, 0x00, 0xe3, 0x01, 0x1a, 0x02, 0x11,
+		0x00, 0x0c, 0x00, 0x0d, 0x11, 0x1b, 0x3f, 0x3b, 0x10, 0x22, 0x47, 0x80, 0x08, 0x80, 0x27, 0x0a,
+		0x0c, 0xc8, 0x28, 0x08, 0x28, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+};
+
+const bench_corpus bench_corpus_rift_s_controller = { "rift_s_controller", 62, 64, &reports[0][0] };
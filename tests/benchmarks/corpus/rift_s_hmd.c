@@ -0,0 +1,400 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Decoder Corpus - Oculus Rift S HMD IMU Reports */
+
+// Synthesised from a 1 kHz head motion trace (turning, nodding, gravity and sensor noise),
+// three IMU samples per report.
+
+#include "../bench.h"
+
+static const unsigned char reports[64][64] = {
+	{
+		0x65, 0x00, 0x01, 0x40, 0x42, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0x01, 0x08, 0x06, 0x00, 0xfd, 0xff,
+		0xfc, 0xff, 0xfc, 0xff, 0xf0, 0x0a, 0x01, 0x02, 0x00, 0x04, 0x08, 0x05, 0x00, 0xfc, 0xff, 0x04,
+		0x00, 0x06, 0x00, 0xf0, 0x0a, 0x02, 0x0b, 0x00, 0xfb, 0x07, 0x12, 0x00, 0x06, 0x00, 0x15, 0x00,
+		0xfd, 0xff, 0xf0, 0x0a, 0x80, 0x00, 0x30, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xf8, 0x4d, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0e, 0x08, 0xfe, 0xff, 0x15, 0x00,
+		0x0a, 0x00, 0x02, 0x00, 0xf1, 0x0a, 0x01, 0xf9, 0xff, 0xfa, 0x07, 0xee, 0xff, 0x14, 0x00, 0x0f,
+		0x00, 0x02, 0x00, 0xf1, 0x0a, 0x02, 0xfd, 0xff, 0xff, 0x07, 0x0c, 0x00, 0x14, 0x00, 0x16, 0x00,
+		0xfc, 0xff, 0xf1, 0x0a, 0x80, 0x00, 0x30, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xb0, 0x59, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0xf5, 0x07, 0xfd, 0xff, 0x18, 0x00,
+		0x12, 0x00, 0xfb, 0xff, 0xf2, 0x0a, 0x01, 0x02, 0x00, 0xf6, 0x07, 0x03, 0x00, 0x25, 0x00, 0x22,
+		0x00, 0x04, 0x00, 0xf2, 0x0a, 0x02, 0xf9, 0xff, 0xfa, 0x07, 0xfa, 0xff, 0x2d, 0x00, 0x25, 0x00,
+		0x0a, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x30, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x68, 0x65, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x08, 0x08, 0x00, 0x00, 0x29, 0x00,
+		0x2e, 0x00, 0xff, 0xff, 0xf3, 0x0a, 0x01, 0x06, 0x00, 0x0b, 0x08, 0xfb, 0xff, 0x29, 0x00, 0x30,
+		0x00, 0xf9, 0xff, 0xf3, 0x0a, 0x02, 0x0d, 0x00, 0x09, 0x08, 0x06, 0x00, 0x38, 0x00, 0x37, 0x00,
+		0x04, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0x30, 0x1b, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x20, 0x71, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0xef, 0x07, 0x01, 0x00, 0x34, 0x00,
+		0x37, 0x00, 0x05, 0x00, 0xf4, 0x0a, 0x01, 0x01, 0x00, 0xf7, 0x07, 0x0a, 0x00, 0x41, 0x00, 0x37,
+		0x00, 0xfe, 0xff, 0xf4, 0x0a, 0x02, 0xf1, 0xff, 0x01, 0x08, 0xf4, 0xff, 0x44, 0x00, 0x41, 0x00,
+		0x06, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0x04, 0x4c, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xd8, 0x7c, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xf9, 0x07, 0x0c, 0x00, 0x4e, 0x00,
+		0x41, 0x00, 0x08, 0x00, 0xf0, 0x0a, 0x01, 0x02, 0x00, 0xf1, 0x07, 0xfb, 0xff, 0x4b, 0x00, 0x4b,
+		0x00, 0x07, 0x00, 0xf0, 0x0a, 0x02, 0x0b, 0x00, 0xfe, 0x07, 0x09, 0x00, 0x4c, 0x00, 0x52, 0x00,
+		0x03, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0x04, 0x4c, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x90, 0x88, 0x0f, 0x00, 0x00, 0xf4, 0xff, 0xf9, 0x07, 0x17, 0x00, 0x56, 0x00,
+		0x54, 0x00, 0x03, 0x00, 0xf1, 0x0a, 0x01, 0x06, 0x00, 0xf9, 0x07, 0x02, 0x00, 0x4a, 0x00, 0x54,
+		0x00, 0x08, 0x00, 0xf1, 0x0a, 0x02, 0x04, 0x00, 0xfe, 0x07, 0xfe, 0xff, 0x51, 0x00, 0x5a, 0x00,
+		0xff, 0xff, 0xf1, 0x0a, 0x80, 0x00, 0x04, 0x4c, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x48, 0x94, 0x0f, 0x00, 0x00, 0xf4, 0xff, 0xf5, 0x07, 0x0c, 0x00, 0x6e, 0x00,
+		0x5c, 0x00, 0xfc, 0xff, 0xf2, 0x0a, 0x01, 0xef, 0xff, 0x02, 0x08, 0x04, 0x00, 0x62, 0x00, 0x65,
+		0x00, 0x01, 0x00, 0xf2, 0x0a, 0x02, 0x09, 0x00, 0x01, 0x08, 0x0d, 0x00, 0x74, 0x00, 0x63, 0x00,
+		0x05, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x04, 0x4c, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x00, 0xa0, 0x0f, 0x00, 0x00, 0x0d, 0x00, 0x1d, 0x08, 0x11, 0x00, 0x6e, 0x00,
+		0x64, 0x00, 0x05, 0x00, 0xf3, 0x0a, 0x01, 0x01, 0x00, 0xfc, 0x07, 0x02, 0x00, 0x6e, 0x00, 0x67,
+		0x00, 0x02, 0x00, 0xf3, 0x0a, 0x02, 0xf3, 0xff, 0xf1, 0x07, 0x01, 0x00, 0x73, 0x00, 0x74, 0x00,
+		0xfe, 0xff, 0xf3, 0x0a, 0x80, 0x00, 0xd8, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xb8, 0xab, 0x0f, 0x00, 0x00, 0xf9, 0xff, 0x0f, 0x08, 0xfc, 0xff, 0x7c, 0x00,
+		0x75, 0x00, 0x02, 0x00, 0xf4, 0x0a, 0x01, 0xf7, 0xff, 0x01, 0x08, 0xfe, 0xff, 0x85, 0x00, 0x82,
+		0x00, 0xff, 0xff, 0xf4, 0x0a, 0x02, 0xed, 0xff, 0x08, 0x08, 0x12, 0x00, 0x82, 0x00, 0x78, 0x00,
+		0x04, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0xd8, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x70, 0xb7, 0x0f, 0x00, 0x00, 0xfd, 0xff, 0xf8, 0x07, 0xf0, 0xff, 0x8b, 0x00,
+		0x85, 0x00, 0x03, 0x00, 0xf0, 0x0a, 0x01, 0x03, 0x00, 0xeb, 0x07, 0x02, 0x00, 0x8c, 0x00, 0x8a,
+		0x00, 0x04, 0x00, 0xf0, 0x0a, 0x02, 0xee, 0xff, 0x06, 0x08, 0xfe, 0xff, 0x8a, 0x00, 0x8c, 0x00,
+		0x0a, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0xd8, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x28, 0xc3, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x0a, 0x08, 0x0e, 0x00, 0x8f, 0x00,
+		0x91, 0x00, 0x0a, 0x00, 0xf1, 0x0a, 0x01, 0xf9, 0xff, 0x11, 0x08, 0x05, 0x00, 0xa1, 0x00, 0x97,
+		0x00, 0x06, 0x00, 0xf1, 0x0a, 0x02, 0xfd, 0xff, 0x0e, 0x08, 0x05, 0x00, 0x9a, 0x00, 0x9b, 0x00,
+		0x06, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0xd8, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xe0, 0xce, 0x0f, 0x00, 0x00, 0x0e, 0x00, 0x05, 0x08, 0x10, 0x00, 0xa5, 0x00,
+		0xa0, 0x00, 0x07, 0x00, 0xf2, 0x0a, 0x01, 0xee, 0xff, 0xfb, 0x07, 0x05, 0x00, 0xa3, 0x00, 0xa3,
+		0x00, 0x02, 0x00, 0xf2, 0x0a, 0x02, 0xe5, 0xff, 0x04, 0x08, 0x0b, 0x00, 0xae, 0x00, 0xa6, 0x00,
+		0x15, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0xac, 0xad, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x98, 0xda, 0x0f, 0x00, 0x00, 0x12, 0x00, 0x00, 0x08, 0xf1, 0xff, 0xae, 0x00,
+		0xac, 0x00, 0x10, 0x00, 0xf3, 0x0a, 0x01, 0xfa, 0xff, 0x0d, 0x08, 0x15, 0x00, 0xbe, 0x00, 0xb7,
+		0x00, 0x0b, 0x00, 0xf3, 0x0a, 0x02, 0x0f, 0x00, 0xfe, 0x07, 0x01, 0x00, 0xb6, 0x00, 0xba, 0x00,
+		0x06, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0xac, 0xad, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x50, 0xe6, 0x0f, 0x00, 0x00, 0xf8, 0xff, 0xf5, 0x07, 0x06, 0x00, 0xbf, 0x00,
+		0xb4, 0x00, 0x03, 0x00, 0xf4, 0x0a, 0x01, 0xf5, 0xff, 0x04, 0x08, 0x10, 0x00, 0xc2, 0x00, 0xbb,
+		0x00, 0x06, 0x00, 0xf4, 0x0a, 0x02, 0x0f, 0x00, 0xfb, 0x07, 0x10, 0x00, 0xc4, 0x00, 0xc1, 0x00,
+		0x03, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0xac, 0xad, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x08, 0xf2, 0x0f, 0x00, 0x00, 0xf2, 0xff, 0xf4, 0x07, 0x13, 0x00, 0xca, 0x00,
+		0xc7, 0x00, 0x09, 0x00, 0xf0, 0x0a, 0x01, 0x06, 0x00, 0xe9, 0x07, 0xeb, 0xff, 0xcd, 0x00, 0xd0,
+		0x00, 0x0b, 0x00, 0xf0, 0x0a, 0x02, 0xef, 0xff, 0xff, 0x07, 0x0d, 0x00, 0xcd, 0x00, 0xcc, 0x00,
+		0x0b, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0xac, 0xad, 0x0f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xc0, 0xfd, 0x0f, 0x00, 0x00, 0xf9, 0xff, 0x03, 0x08, 0x0d, 0x00, 0xd3, 0x00,
+		0xd0, 0x00, 0x06, 0x00, 0xf1, 0x0a, 0x01, 0x13, 0x00, 0x06, 0x08, 0x13, 0x00, 0xd5, 0x00, 0xd6,
+		0x00, 0x0e, 0x00, 0xf1, 0x0a, 0x02, 0x03, 0x00, 0xfa, 0x07, 0x28, 0x00, 0xdc, 0x00, 0xe0, 0x00,
+		0x05, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0x80, 0xde, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x78, 0x09, 0x10, 0x00, 0x00, 0xf5, 0xff, 0x10, 0x08, 0x18, 0x00, 0xe2, 0x00,
+		0xe9, 0x00, 0x03, 0x00, 0xf2, 0x0a, 0x01, 0xf7, 0xff, 0xf8, 0x07, 0x0a, 0x00, 0xee, 0x00, 0xe9,
+		0x00, 0xff, 0xff, 0xf2, 0x0a, 0x02, 0x10, 0x00, 0xfe, 0x07, 0xfd, 0xff, 0xe9, 0x00, 0xea, 0x00,
+		0x0b, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x80, 0xde, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x30, 0x15, 0x10, 0x00, 0x00, 0xf3, 0xff, 0xfc, 0x07, 0x15, 0x00, 0xee, 0x00,
+		0xed, 0x00, 0x07, 0x00, 0xf3, 0x0a, 0x01, 0xff, 0xff, 0x05, 0x08, 0x15, 0x00, 0xf6, 0x00, 0xf1,
+		0x00, 0x05, 0x00, 0xf3, 0x0a, 0x02, 0x0b, 0x00, 0x02, 0x08, 0x01, 0x00, 0xfb, 0x00, 0xfe, 0x00,
+		0x05, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0x80, 0xde, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xe8, 0x20, 0x10, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x08, 0x0f, 0x00, 0x00, 0x01,
+		0x01, 0x01, 0x0a, 0x00, 0xf4, 0x0a, 0x01, 0x1a, 0x00, 0x09, 0x08, 0x07, 0x00, 0x01, 0x01, 0xff,
+		0x00, 0x09, 0x00, 0xf4, 0x0a, 0x02, 0x08, 0x00, 0xf5, 0x07, 0x03, 0x00, 0x04, 0x01, 0x03, 0x01,
+		0x0a, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0x80, 0xde, 0x0f, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xa0, 0x2c, 0x10, 0x00, 0x00, 0x07, 0x00, 0x06, 0x08, 0x00, 0x00, 0x02, 0x01,
+		0x03, 0x01, 0x02, 0x00, 0xf0, 0x0a, 0x01, 0xf3, 0xff, 0x07, 0x08, 0x18, 0x00, 0x09, 0x01, 0x08,
+		0x01, 0x02, 0x00, 0xf0, 0x0a, 0x02, 0xf9, 0xff, 0xf9, 0x07, 0x03, 0x00, 0x15, 0x01, 0x12, 0x01,
+		0x03, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0x54, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x58, 0x38, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x08, 0x10, 0x00, 0x17, 0x01,
+		0x1c, 0x01, 0xfe, 0xff, 0xf1, 0x0a, 0x01, 0x05, 0x00, 0x03, 0x08, 0x15, 0x00, 0x24, 0x01, 0x15,
+		0x01, 0x07, 0x00, 0xf1, 0x0a, 0x02, 0x03, 0x00, 0x04, 0x08, 0x12, 0x00, 0x1d, 0x01, 0x1b, 0x01,
+		0xff, 0xff, 0xf1, 0x0a, 0x80, 0x00, 0x54, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x10, 0x44, 0x10, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x07, 0x1b, 0x00, 0x20, 0x01,
+		0x22, 0x01, 0x0f, 0x00, 0xf2, 0x0a, 0x01, 0x0f, 0x00, 0x08, 0x08, 0x15, 0x00, 0x28, 0x01, 0x26,
+		0x01, 0x0d, 0x00, 0xf2, 0x0a, 0x02, 0x0d, 0x00, 0x06, 0x08, 0x15, 0x00, 0x2e, 0x01, 0x23, 0x01,
+		0x07, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x54, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xc8, 0x4f, 0x10, 0x00, 0x00, 0x09, 0x00, 0xfd, 0x07, 0x23, 0x00, 0x38, 0x01,
+		0x2e, 0x01, 0x12, 0x00, 0xf3, 0x0a, 0x01, 0xf2, 0xff, 0x04, 0x08, 0x1b, 0x00, 0x32, 0x01, 0x2d,
+		0x01, 0x11, 0x00, 0xf3, 0x0a, 0x02, 0x01, 0x00, 0x0a, 0x08, 0x0e, 0x00, 0x34, 0x01, 0x33, 0x01,
+		0x0b, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0x54, 0x0f, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x80, 0x5b, 0x10, 0x00, 0x00, 0xfb, 0xff, 0xfb, 0x07, 0x19, 0x00, 0x39, 0x01,
+		0x3f, 0x01, 0x0c, 0x00, 0xf4, 0x0a, 0x01, 0xed, 0xff, 0xff, 0x07, 0x1b, 0x00, 0x3f, 0x01, 0x38,
+		0x01, 0x0a, 0x00, 0xf4, 0x0a, 0x02, 0x07, 0x00, 0x03, 0x08, 0x14, 0x00, 0x41, 0x01, 0x47, 0x01,
+		0x06, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0x28, 0x40, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x38, 0x67, 0x10, 0x00, 0x00, 0x01, 0x00, 0xfb, 0x07, 0x1a, 0x00, 0x41, 0x01,
+		0x4c, 0x01, 0x09, 0x00, 0xf0, 0x0a, 0x01, 0x00, 0x00, 0xe8, 0x07, 0x34, 0x00, 0x49, 0x01, 0x4a,
+		0x01, 0x03, 0x00, 0xf0, 0x0a, 0x02, 0xfc, 0xff, 0xfc, 0x07, 0x2a, 0x00, 0x4c, 0x01, 0x50, 0x01,
+		0x0b, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0x28, 0x40, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xf0, 0x72, 0x10, 0x00, 0x00, 0xfb, 0xff, 0xe6, 0x07, 0x0f, 0x00, 0x4b, 0x01,
+		0x59, 0x01, 0x0c, 0x00, 0xf1, 0x0a, 0x01, 0xf5, 0xff, 0x02, 0x08, 0x06, 0x00, 0x50, 0x01, 0x4f,
+		0x01, 0x0d, 0x00, 0xf1, 0x0a, 0x02, 0x0e, 0x00, 0xf8, 0x07, 0x1b, 0x00, 0x56, 0x01, 0x5d, 0x01,
+		0x05, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0x28, 0x40, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xa8, 0x7e, 0x10, 0x00, 0x00, 0xfe, 0xff, 0x05, 0x08, 0x2a, 0x00, 0x5c, 0x01,
+		0x62, 0x01, 0x11, 0x00, 0xf2, 0x0a, 0x01, 0x0e, 0x00, 0x02, 0x08, 0x24, 0x00, 0x5a, 0x01, 0x6f,
+		0x01, 0x08, 0x00, 0xf2, 0x0a, 0x02, 0x02, 0x00, 0xec, 0x07, 0x1e, 0x00, 0x5d, 0x01, 0x68, 0x01,
+		0x07, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x28, 0x40, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x60, 0x8a, 0x10, 0x00, 0x00, 0xff, 0xff, 0xf9, 0x07, 0x28, 0x00, 0x5e, 0x01,
+		0x73, 0x01, 0x06, 0x00, 0xf3, 0x0a, 0x01, 0xfd, 0xff, 0xfd, 0x07, 0x28, 0x00, 0x63, 0x01, 0x75,
+		0x01, 0x0a, 0x00, 0xf3, 0x0a, 0x02, 0x11, 0x00, 0x01, 0x08, 0x2d, 0x00, 0x64, 0x01, 0x77, 0x01,
+		0x05, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0xfc, 0x70, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x18, 0x96, 0x10, 0x00, 0x00, 0xfa, 0xff, 0xfc, 0x07, 0x24, 0x00, 0x6b, 0x01,
+		0x78, 0x01, 0x0a, 0x00, 0xf4, 0x0a, 0x01, 0x07, 0x00, 0x0c, 0x08, 0x1f, 0x00, 0x72, 0x01, 0x7c,
+		0x01, 0x0a, 0x00, 0xf4, 0x0a, 0x02, 0xf4, 0xff, 0x13, 0x08, 0x24, 0x00, 0x72, 0x01, 0x85, 0x01,
+		0x08, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0xfc, 0x70, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xd0, 0xa1, 0x10, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x08, 0x2a, 0x00, 0x73, 0x01,
+		0x8a, 0x01, 0x06, 0x00, 0xf0, 0x0a, 0x01, 0xfc, 0xff, 0x14, 0x08, 0x2a, 0x00, 0x80, 0x01, 0x8d,
+		0x01, 0x08, 0x00, 0xf0, 0x0a, 0x02, 0xfa, 0xff, 0xf5, 0x07, 0x24, 0x00, 0x7b, 0x01, 0x8d, 0x01,
+		0x0b, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0xfc, 0x70, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x88, 0xad, 0x10, 0x00, 0x00, 0xe4, 0xff, 0x05, 0x08, 0x39, 0x00, 0x86, 0x01,
+		0x9b, 0x01, 0x0b, 0x00, 0xf1, 0x0a, 0x01, 0xf5, 0xff, 0x01, 0x08, 0x42, 0x00, 0x82, 0x01, 0x98,
+		0x01, 0x09, 0x00, 0xf1, 0x0a, 0x02, 0x0d, 0x00, 0xf4, 0x07, 0x2b, 0x00, 0x81, 0x01, 0x95, 0x01,
+		0x0b, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0xfc, 0x70, 0x10, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x40, 0xb9, 0x10, 0x00, 0x00, 0xf6, 0xff, 0xfd, 0x07, 0x25, 0x00, 0x8f, 0x01,
+		0xa3, 0x01, 0x0c, 0x00, 0xf2, 0x0a, 0x01, 0xed, 0xff, 0xf7, 0x07, 0x3a, 0x00, 0x91, 0x01, 0xac,
+		0x01, 0x06, 0x00, 0xf2, 0x0a, 0x02, 0xfb, 0xff, 0x01, 0x08, 0x2c, 0x00, 0x9e, 0x01, 0xae, 0x01,
+		0x09, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0xd0, 0xa1, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xf8, 0xc4, 0x10, 0x00, 0x00, 0xf5, 0xff, 0x09, 0x08, 0x35, 0x00, 0x98, 0x01,
+		0xad, 0x01, 0x09, 0x00, 0xf3, 0x0a, 0x01, 0xfb, 0xff, 0xfd, 0x07, 0x30, 0x00, 0x9b, 0x01, 0xb5,
+		0x01, 0x0c, 0x00, 0xf3, 0x0a, 0x02, 0x04, 0x00, 0x0a, 0x08, 0x29, 0x00, 0x9f, 0x01, 0xbf, 0x01,
+		0x10, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0xd0, 0xa1, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xb0, 0xd0, 0x10, 0x00, 0x00, 0x0c, 0x00, 0xec, 0x07, 0x3a, 0x00, 0x9d, 0x01,
+		0xb8, 0x01, 0x0b, 0x00, 0xf4, 0x0a, 0x01, 0x16, 0x00, 0x0a, 0x08, 0x3e, 0x00, 0xa4, 0x01, 0xbb,
+		0x01, 0x0b, 0x00, 0xf4, 0x0a, 0x02, 0x07, 0x00, 0x00, 0x08, 0x2e, 0x00, 0xa8, 0x01, 0xc6, 0x01,
+		0x0e, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0xd0, 0xa1, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x68, 0xdc, 0x10, 0x00, 0x00, 0xfa, 0xff, 0xfc, 0x07, 0x36, 0x00, 0xa9, 0x01,
+		0xc4, 0x01, 0x0e, 0x00, 0xf0, 0x0a, 0x01, 0x1d, 0x00, 0x0e, 0x08, 0x2e, 0x00, 0xb5, 0x01, 0xc3,
+		0x01, 0x0d, 0x00, 0xf0, 0x0a, 0x02, 0xfa, 0xff, 0xfb, 0x07, 0x40, 0x00, 0xb1, 0x01, 0xd9, 0x01,
+		0x09, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0xd0, 0xa1, 0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x20, 0xe8, 0x10, 0x00, 0x00, 0x0d, 0x00, 0xfb, 0x07, 0x3f, 0x00, 0xad, 0x01,
+		0xd7, 0x01, 0x0c, 0x00, 0xf1, 0x0a, 0x01, 0x0b, 0x00, 0x04, 0x08, 0x33, 0x00, 0xb4, 0x01, 0xd7,
+		0x01, 0x0f, 0x00, 0xf1, 0x0a, 0x02, 0xf6, 0xff, 0x09, 0x08, 0x26, 0x00, 0xb6, 0x01, 0xd8, 0x01,
+		0x0e, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0xa4, 0xd2, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xd8, 0xf3, 0x10, 0x00, 0x00, 0x02, 0x00, 0xff, 0x07, 0x3b, 0x00, 0xbe, 0x01,
+		0xdc, 0x01, 0x10, 0x00, 0xf2, 0x0a, 0x01, 0x08, 0x00, 0x03, 0x08, 0x31, 0x00, 0xc0, 0x01, 0xee,
+		0x01, 0x07, 0x00, 0xf2, 0x0a, 0x02, 0x04, 0x00, 0x01, 0x08, 0x3b, 0x00, 0xc0, 0x01, 0xee, 0x01,
+		0x0d, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0xa4, 0xd2, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x90, 0xff, 0x10, 0x00, 0x00, 0x15, 0x00, 0x07, 0x08, 0x34, 0x00, 0xc3, 0x01,
+		0xeb, 0x01, 0x0e, 0x00, 0xf3, 0x0a, 0x01, 0x14, 0x00, 0xff, 0x07, 0x4b, 0x00, 0xc3, 0x01, 0xf4,
+		0x01, 0x06, 0x00, 0xf3, 0x0a, 0x02, 0x05, 0x00, 0xfa, 0x07, 0x3f, 0x00, 0xc4, 0x01, 0xf2, 0x01,
+		0x16, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0xa4, 0xd2, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x48, 0x0b, 0x11, 0x00, 0x00, 0xfa, 0xff, 0xf8, 0x07, 0x57, 0x00, 0xd0, 0x01,
+		0x00, 0x02, 0x08, 0x00, 0xf4, 0x0a, 0x01, 0x00, 0x00, 0xf6, 0x07, 0x42, 0x00, 0xd2, 0x01, 0x00,
+		0x02, 0x0b, 0x00, 0xf4, 0x0a, 0x02, 0xf9, 0xff, 0x04, 0x08, 0x45, 0x00, 0xd2, 0x01, 0xfe, 0x01,
+		0x15, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0xa4, 0xd2, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x00, 0x17, 0x11, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x08, 0x47, 0x00, 0xd5, 0x01,
+		0x03, 0x02, 0x0c, 0x00, 0xf0, 0x0a, 0x01, 0xf9, 0xff, 0x00, 0x08, 0x44, 0x00, 0xdb, 0x01, 0x0a,
+		0x02, 0x0a, 0x00, 0xf0, 0x0a, 0x02, 0x0d, 0x00, 0xf8, 0x07, 0x2d, 0x00, 0xda, 0x01, 0x05, 0x02,
+		0x0e, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0x78, 0x03, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xb8, 0x22, 0x11, 0x00, 0x00, 0xf4, 0xff, 0xfe, 0x07, 0x4c, 0x00, 0xdd, 0x01,
+		0x14, 0x02, 0x0a, 0x00, 0xf1, 0x0a, 0x01, 0x08, 0x00, 0x0c, 0x08, 0x42, 0x00, 0xdc, 0x01, 0x19,
+		0x02, 0x13, 0x00, 0xf1, 0x0a, 0x02, 0x07, 0x00, 0x04, 0x08, 0x4d, 0x00, 0xd9, 0x01, 0x12, 0x02,
+		0x08, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0x78, 0x03, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x70, 0x2e, 0x11, 0x00, 0x00, 0x05, 0x00, 0xed, 0x07, 0x4d, 0x00, 0xe0, 0x01,
+		0x1c, 0x02, 0x0a, 0x00, 0xf2, 0x0a, 0x01, 0xfa, 0xff, 0x0f, 0x08, 0x42, 0x00, 0xe7, 0x01, 0x2a,
+		0x02, 0x13, 0x00, 0xf2, 0x0a, 0x02, 0x0e, 0x00, 0xf1, 0x07, 0x44, 0x00, 0xeb, 0x01, 0x28, 0x02,
+		0x11, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x78, 0x03, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x28, 0x3a, 0x11, 0x00, 0x00, 0x0e, 0x00, 0xed, 0x07, 0x5c, 0x00, 0xe6, 0x01,
+		0x24, 0x02, 0x14, 0x00, 0xf3, 0x0a, 0x01, 0xfa, 0xff, 0x21, 0x08, 0x4d, 0x00, 0xf3, 0x01, 0x2d,
+		0x02, 0x13, 0x00, 0xf3, 0x0a, 0x02, 0xff, 0xff, 0xff, 0x07, 0x4f, 0x00, 0xf8, 0x01, 0x32, 0x02,
+		0x0b, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0x78, 0x03, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xe0, 0x45, 0x11, 0x00, 0x00, 0x16, 0x00, 0xfe, 0x07, 0x43, 0x00, 0xf4, 0x01,
+		0x37, 0x02, 0x12, 0x00, 0xf4, 0x0a, 0x01, 0xfd, 0xff, 0xf4, 0x07, 0x4e, 0x00, 0xf4, 0x01, 0x3e,
+		0x02, 0x12, 0x00, 0xf4, 0x0a, 0x02, 0x07, 0x00, 0xee, 0x07, 0x59, 0x00, 0xef, 0x01, 0x41, 0x02,
+		0x0b, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0x4c, 0x34, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x98, 0x51, 0x11, 0x00, 0x00, 0xf3, 0xff, 0xe5, 0x07, 0x54, 0x00, 0xf9, 0x01,
+		0x48, 0x02, 0x11, 0x00, 0xf0, 0x0a, 0x01, 0x09, 0x00, 0xef, 0x07, 0x59, 0x00, 0xfc, 0x01, 0x50,
+		0x02, 0x14, 0x00, 0xf0, 0x0a, 0x02, 0xfd, 0xff, 0x07, 0x08, 0x66, 0x00, 0xfb, 0x01, 0x4c, 0x02,
+		0x11, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0x4c, 0x34, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x50, 0x5d, 0x11, 0x00, 0x00, 0x08, 0x00, 0x06, 0x08, 0x59, 0x00, 0xfe, 0x01,
+		0x56, 0x02, 0x1a, 0x00, 0xf1, 0x0a, 0x01, 0xff, 0xff, 0x06, 0x08, 0x44, 0x00, 0x00, 0x02, 0x50,
+		0x02, 0x16, 0x00, 0xf1, 0x0a, 0x02, 0xfe, 0xff, 0x05, 0x08, 0x5b, 0x00, 0x05, 0x02, 0x5b, 0x02,
+		0x10, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0x4c, 0x34, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x08, 0x69, 0x11, 0x00, 0x00, 0xf6, 0xff, 0xec, 0x07, 0x53, 0x00, 0xfc, 0x01,
+		0x56, 0x02, 0x11, 0x00, 0xf2, 0x0a, 0x01, 0x10, 0x00, 0xfe, 0x07, 0x66, 0x00, 0x08, 0x02, 0x65,
+		0x02, 0x11, 0x00, 0xf2, 0x0a, 0x02, 0xee, 0xff, 0x0f, 0x08, 0x61, 0x00, 0x07, 0x02, 0x63, 0x02,
+		0x13, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x4c, 0x34, 0x11, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xc0, 0x74, 0x11, 0x00, 0x00, 0xf4, 0xff, 0xf5, 0x07, 0x60, 0x00, 0x0b, 0x02,
+		0x66, 0x02, 0x12, 0x00, 0xf3, 0x0a, 0x01, 0x04, 0x00, 0xfa, 0x07, 0x61, 0x00, 0x0d, 0x02, 0x6d,
+		0x02, 0x0f, 0x00, 0xf3, 0x0a, 0x02, 0x07, 0x00, 0x10, 0x08, 0x5c, 0x00, 0x0c, 0x02, 0x72, 0x02,
+		0x13, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0x20, 0x65, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x78, 0x80, 0x11, 0x00, 0x00, 0x03, 0x00, 0xec, 0x07, 0x57, 0x00, 0x0d, 0x02,
+		0x6e, 0x02, 0x0d, 0x00, 0xf4, 0x0a, 0x01, 0x06, 0x00, 0x08, 0x08, 0x62, 0x00, 0x0e, 0x02, 0x7a,
+		0x02, 0x13, 0x00, 0xf4, 0x0a, 0x02, 0x07, 0x00, 0x06, 0x08, 0x5b, 0x00, 0x15, 0x02, 0x7f, 0x02,
+		0x11, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0x20, 0x65, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x30, 0x8c, 0x11, 0x00, 0x00, 0xfe, 0xff, 0xfd, 0x07, 0x5a, 0x00, 0x0c, 0x02,
+		0x7f, 0x02, 0x18, 0x00, 0xf0, 0x0a, 0x01, 0xf7, 0xff, 0xe3, 0x07, 0x60, 0x00, 0x15, 0x02, 0x8e,
+		0x02, 0x10, 0x00, 0xf0, 0x0a, 0x02, 0xfe, 0xff, 0x04, 0x08, 0x57, 0x00, 0x0b, 0x02, 0x88, 0x02,
+		0x16, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0x20, 0x65, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xe8, 0x97, 0x11, 0x00, 0x00, 0x05, 0x00, 0xfd, 0x07, 0x67, 0x00, 0x0d, 0x02,
+		0x87, 0x02, 0x0f, 0x00, 0xf1, 0x0a, 0x01, 0x0e, 0x00, 0xf8, 0x07, 0x6b, 0x00, 0x17, 0x02, 0x87,
+		0x02, 0x17, 0x00, 0xf1, 0x0a, 0x02, 0xf0, 0xff, 0xee, 0x07, 0x51, 0x00, 0x20, 0x02, 0x91, 0x02,
+		0x15, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0x20, 0x65, 0x11, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xa0, 0xa3, 0x11, 0x00, 0x00, 0xfa, 0xff, 0x02, 0x08, 0x66, 0x00, 0x22, 0x02,
+		0x98, 0x02, 0x10, 0x00, 0xf2, 0x0a, 0x01, 0xfb, 0xff, 0x05, 0x08, 0x76, 0x00, 0x1a, 0x02, 0x9e,
+		0x02, 0x1b, 0x00, 0xf2, 0x0a, 0x02, 0xfb, 0xff, 0x06, 0x08, 0x73, 0x00, 0x19, 0x02, 0xa9, 0x02,
+		0x1a, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0xf4, 0x95, 0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x58, 0xaf, 0x11, 0x00, 0x00, 0xfa, 0xff, 0x09, 0x08, 0x67, 0x00, 0x1b, 0x02,
+		0xa3, 0x02, 0x0a, 0x00, 0xf3, 0x0a, 0x01, 0xf5, 0xff, 0xf6, 0x07, 0x5e, 0x00, 0x1e, 0x02, 0xa2,
+		0x02, 0x12, 0x00, 0xf3, 0x0a, 0x02, 0xf3, 0xff, 0xfc, 0x07, 0x6e, 0x00, 0x24, 0x02, 0xaa, 0x02,
+		0x11, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0xf4, 0x95, 0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x10, 0xbb, 0x11, 0x00, 0x00, 0xff, 0xff, 0xf3, 0x07, 0x78, 0x00, 0x26, 0x02,
+		0xb3, 0x02, 0x10, 0x00, 0xf4, 0x0a, 0x01, 0x02, 0x00, 0xf7, 0x07, 0x83, 0x00, 0x26, 0x02, 0xb8,
+		0x02, 0x16, 0x00, 0xf4, 0x0a, 0x02, 0xeb, 0xff, 0xfd, 0x07, 0x67, 0x00, 0x28, 0x02, 0xba, 0x02,
+		0x16, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0xf4, 0x95, 0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xc8, 0xc6, 0x11, 0x00, 0x00, 0x0b, 0x00, 0xf7, 0x07, 0x80, 0x00, 0x20, 0x02,
+		0xbb, 0x02, 0x1c, 0x00, 0xf0, 0x0a, 0x01, 0xf6, 0xff, 0xfb, 0x07, 0x80, 0x00, 0x28, 0x02, 0xc2,
+		0x02, 0x1a, 0x00, 0xf0, 0x0a, 0x02, 0x01, 0x00, 0xe8, 0x07, 0x6d, 0x00, 0x26, 0x02, 0xbf, 0x02,
+		0x12, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0xf4, 0x95, 0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x80, 0xd2, 0x11, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x07, 0x68, 0x00, 0x22, 0x02,
+		0xc9, 0x02, 0x0f, 0x00, 0xf1, 0x0a, 0x01, 0xff, 0xff, 0xfd, 0x07, 0x79, 0x00, 0x2b, 0x02, 0xcb,
+		0x02, 0x1a, 0x00, 0xf1, 0x0a, 0x02, 0xfd, 0xff, 0xfd, 0x07, 0x93, 0x00, 0x2b, 0x02, 0xcc, 0x02,
+		0x11, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0xc8, 0xc6, 0x11, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x38, 0xde, 0x11, 0x00, 0x00, 0xf6, 0xff, 0xf3, 0x07, 0x73, 0x00, 0x32, 0x02,
+		0xd4, 0x02, 0x18, 0x00, 0xf2, 0x0a, 0x01, 0xf5, 0xff, 0xfe, 0x07, 0x7c, 0x00, 0x31, 0x02, 0xd6,
+		0x02, 0x10, 0x00, 0xf2, 0x0a, 0x02, 0x02, 0x00, 0xff, 0x07, 0x7b, 0x00, 0x2e, 0x02, 0xd5, 0x02,
+		0x22, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0xc8, 0xc6, 0x11, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xf0, 0xe9, 0x11, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x07, 0x7b, 0x00, 0x2a, 0x02,
+		0xdc, 0x02, 0x17, 0x00, 0xf3, 0x0a, 0x01, 0xfd, 0xff, 0x05, 0x08, 0x87, 0x00, 0x2e, 0x02, 0xde,
+		0x02, 0x14, 0x00, 0xf3, 0x0a, 0x02, 0x0b, 0x00, 0xec, 0x07, 0x89, 0x00, 0x30, 0x02, 0xe7, 0x02,
+		0x17, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0xc8, 0xc6, 0x11, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xa8, 0xf5, 0x11, 0x00, 0x00, 0xfc, 0xff, 0xf4, 0x07, 0x77, 0x00, 0x31, 0x02,
+		0xe9, 0x02, 0x13, 0x00, 0xf4, 0x0a, 0x01, 0xfa, 0xff, 0xfb, 0x07, 0x8a, 0x00, 0x32, 0x02, 0xe6,
+		0x02, 0x16, 0x00, 0xf4, 0x0a, 0x02, 0x04, 0x00, 0x03, 0x08, 0x89, 0x00, 0x31, 0x02, 0xf2, 0x02,
+		0x1a, 0x00, 0xf4, 0x0a, 0x80, 0x00, 0xc8, 0xc6, 0x11, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x60, 0x01, 0x12, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x07, 0x85, 0x00, 0x30, 0x02,
+		0xf3, 0x02, 0x13, 0x00, 0xf0, 0x0a, 0x01, 0x0d, 0x00, 0x01, 0x08, 0x94, 0x00, 0x34, 0x02, 0xfc,
+		0x02, 0x17, 0x00, 0xf0, 0x0a, 0x02, 0xfe, 0xff, 0xfb, 0x07, 0x84, 0x00, 0x37, 0x02, 0xed, 0x02,
+		0x10, 0x00, 0xf0, 0x0a, 0x80, 0x00, 0x9c, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x18, 0x0d, 0x12, 0x00, 0x00, 0x11, 0x00, 0xe8, 0x07, 0x92, 0x00, 0x31, 0x02,
+		0xfb, 0x02, 0x15, 0x00, 0xf1, 0x0a, 0x01, 0xf5, 0xff, 0xf3, 0x07, 0x8b, 0x00, 0x31, 0x02, 0xfe,
+		0x02, 0x0a, 0x00, 0xf1, 0x0a, 0x02, 0xec, 0xff, 0xfb, 0x07, 0x7f, 0x00, 0x33, 0x02, 0x05, 0x03,
+		0x1a, 0x00, 0xf1, 0x0a, 0x80, 0x00, 0x9c, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0xd0, 0x18, 0x12, 0x00, 0x00, 0xf7, 0xff, 0xeb, 0x07, 0x8d, 0x00, 0x31, 0x02,
+		0x0f, 0x03, 0x15, 0x00, 0xf2, 0x0a, 0x01, 0xef, 0xff, 0x03, 0x08, 0x98, 0x00, 0x2b, 0x02, 0x0c,
+		0x03, 0x1a, 0x00, 0xf2, 0x0a, 0x02, 0x00, 0x00, 0xfd, 0x07, 0x88, 0x00, 0x30, 0x02, 0x0f, 0x03,
+		0x1d, 0x00, 0xf2, 0x0a, 0x80, 0x00, 0x9c, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	},
+	{
+		0x65, 0x00, 0x01, 0x88, 0x24, 0x12, 0x00, 0x00, 0xf7, 0xff, 0xf3, 0x07, 0x8e, 0x00, 0x32, 0x02,
+		0x17, 0x03, 0x1a, 0x00, 0xf3, 0x0a, 0x01, 0xfe, 0xff, 0xf0, 0x07, 0x9f, 0x00, 0x33, 0x02, 0x1a,
+		0x03, 0x16, 0x00, 0xf3, 0x0a, 0x02, 0xfc, 0xff, 0xfc, 0x07, 0xab, 0x00, 0x31, 0x02, 0x1d, 0x03,
+		0x1c, 0x00, 0xf3, 0x0a, 0x80, 0x00, 0x9c, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+	},
+};
+
+const bench_corpus bench_corpus_rift_s_hmd = { "rift_s_hmd", 64, 64, &reports[0][0] };
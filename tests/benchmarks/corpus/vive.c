@@ -0,0 +1,400 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Decoder Corpus - HTC Vive Headset IMU Reports */
+
+// Synthesised from a 1 kHz head motion trace (turning, nodding, gravity and sensor noise),
+// three samples per report as read from the lighthouse FPGA interface.
+
+#include "../bench.h"
+
+static const unsigned char reports[64][52] = {
+	{
+		0x20, 0xd7, 0xff, 0x02, 0x20, 0xcc, 0xff, 0x03, 0x00, 0xf9, 0xff, 0xfd, 0xff, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x1e, 0x00, 0xfe, 0x1f, 0x36, 0x00, 0x03, 0x00, 0x02, 0x00, 0x10, 0x00, 0x80, 0xbb,
+		0x00, 0x00, 0x01, 0xc6, 0xff, 0xdb, 0x1f, 0x13, 0x00, 0x01, 0x00, 0x04, 0x00, 0xf8, 0xff, 0x00,
+		0x77, 0x01, 0x00, 0x02,
+	},
+	{
+		0x20, 0x05, 0x00, 0x07, 0x20, 0x31, 0x00, 0x18, 0x00, 0x0b, 0x00, 0xf7, 0xff, 0x80, 0x32, 0x02,
+		0x00, 0x03, 0x22, 0x00, 0xe3, 0x1f, 0x9b, 0xff, 0x16, 0x00, 0x18, 0x00, 0xf9, 0xff, 0x00, 0xee,
+		0x02, 0x00, 0x04, 0x02, 0x00, 0xe5, 0x1f, 0x3d, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x00, 0x00, 0x80,
+		0xa9, 0x03, 0x00, 0x05,
+	},
+	{
+		0x20, 0x15, 0x00, 0xe1, 0x1f, 0xba, 0xff, 0x15, 0x00, 0x13, 0x00, 0x02, 0x00, 0x00, 0x65, 0x04,
+		0x00, 0x06, 0x38, 0x00, 0x53, 0x20, 0x2d, 0x00, 0x26, 0x00, 0x23, 0x00, 0xfb, 0xff, 0x80, 0x20,
+		0x05, 0x00, 0x07, 0x48, 0x00, 0x24, 0x20, 0x61, 0x00, 0x2c, 0x00, 0x22, 0x00, 0x06, 0x00, 0x00,
+		0xdc, 0x05, 0x00, 0x08,
+	},
+	{
+		0x20, 0x16, 0x00, 0x22, 0x20, 0x40, 0x00, 0x30, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x80, 0x97, 0x06,
+		0x00, 0x09, 0xf1, 0xff, 0xec, 0x1f, 0xb7, 0xff, 0x28, 0x00, 0x25, 0x00, 0x07, 0x00, 0x00, 0x53,
+		0x07, 0x00, 0x0a, 0x09, 0x00, 0x4c, 0x20, 0x02, 0x00, 0x32, 0x00, 0x2e, 0x00, 0x06, 0x00, 0x80,
+		0x0e, 0x08, 0x00, 0x0b,
+	},
+	{
+		0x20, 0xc9, 0xff, 0x10, 0x20, 0xee, 0xff, 0x38, 0x00, 0x37, 0x00, 0xff, 0xff, 0x00, 0xca, 0x08,
+		0x00, 0x0c, 0xfc, 0xff, 0x1a, 0x20, 0xe6, 0xff, 0x39, 0x00, 0x2f, 0x00, 0x01, 0x00, 0x80, 0x85,
+		0x09, 0x00, 0x0d, 0xd5, 0xff, 0x11, 0x20, 0xce, 0xff, 0x42, 0x00, 0x40, 0x00, 0xff, 0xff, 0x00,
+		0x41, 0x0a, 0x00, 0x0e,
+	},
+	{
+		0x20, 0x0d, 0x00, 0xfc, 0x1f, 0xd6, 0xff, 0x40, 0x00, 0x43, 0x00, 0x01, 0x00, 0x80, 0xfc, 0x0a,
+		0x00, 0x0f, 0x07, 0x00, 0x0f, 0x20, 0xdf, 0xff, 0x57, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0xb8,
+		0x0b, 0x00, 0x10, 0xe5, 0xff, 0xc9, 0x1f, 0x0d, 0x00, 0x47, 0x00, 0x45, 0x00, 0xfc, 0xff, 0x80,
+		0x73, 0x0c, 0x00, 0x11,
+	},
+	{
+		0x20, 0x1a, 0x00, 0x1c, 0x20, 0x78, 0x00, 0x5e, 0x00, 0x57, 0x00, 0x08, 0x00, 0x00, 0x2f, 0x0d,
+		0x00, 0x12, 0x15, 0x00, 0xc9, 0x1f, 0x3c, 0x00, 0x56, 0x00, 0x52, 0x00, 0x00, 0x00, 0x80, 0xea,
+		0x0d, 0x00, 0x13, 0x13, 0x00, 0xf3, 0x1f, 0x27, 0x00, 0x6e, 0x00, 0x53, 0x00, 0x08, 0x00, 0x00,
+		0xa6, 0x0e, 0x00, 0x14,
+	},
+	{
+		0x20, 0x59, 0x00, 0x5f, 0x20, 0x13, 0x00, 0x65, 0x00, 0x54, 0x00, 0xfe, 0xff, 0x80, 0x61, 0x0f,
+		0x00, 0x15, 0xb7, 0xff, 0x0b, 0x20, 0x02, 0x00, 0x63, 0x00, 0x60, 0x00, 0xfe, 0xff, 0x00, 0x1d,
+		0x10, 0x00, 0x16, 0x5e, 0x00, 0xed, 0x1f, 0xe0, 0xff, 0x62, 0x00, 0x6a, 0x00, 0x01, 0x00, 0x80,
+		0xd8, 0x10, 0x00, 0x17,
+	},
+	{
+		0x20, 0xff, 0xff, 0xcc, 0x1f, 0x3f, 0x00, 0x69, 0x00, 0x6a, 0x00, 0xfe, 0xff, 0x00, 0x94, 0x11,
+		0x00, 0x18, 0x21, 0x00, 0x0b, 0x20, 0x24, 0x00, 0x76, 0x00, 0x72, 0x00, 0x04, 0x00, 0x80, 0x4f,
+		0x12, 0x00, 0x19, 0x15, 0x00, 0x19, 0x20, 0xe0, 0xff, 0x70, 0x00, 0x77, 0x00, 0x01, 0x00, 0x00,
+		0x0b, 0x13, 0x00, 0x1a,
+	},
+	{
+		0x20, 0xd8, 0xff, 0x04, 0x20, 0xeb, 0xff, 0x76, 0x00, 0x77, 0x00, 0x06, 0x00, 0x80, 0xc6, 0x13,
+		0x00, 0x1b, 0xf7, 0xff, 0x21, 0x20, 0x13, 0x00, 0x84, 0x00, 0x7c, 0x00, 0x06, 0x00, 0x00, 0x82,
+		0x14, 0x00, 0x1c, 0x11, 0x00, 0xbc, 0x1f, 0x0f, 0x00, 0x7c, 0x00, 0x76, 0x00, 0x03, 0x00, 0x80,
+		0x3d, 0x15, 0x00, 0x1d,
+	},
+	{
+		0x20, 0xbc, 0xff, 0x03, 0x20, 0x26, 0x00, 0x8b, 0x00, 0x7f, 0x00, 0x0b, 0x00, 0x00, 0xf9, 0x15,
+		0x00, 0x1e, 0xda, 0xff, 0xb0, 0x1f, 0xbe, 0xff, 0x8c, 0x00, 0x84, 0x00, 0x03, 0x00, 0x80, 0xb4,
+		0x16, 0x00, 0x1f, 0xd6, 0xff, 0xf8, 0x1f, 0xc1, 0xff, 0x94, 0x00, 0x8b, 0x00, 0x07, 0x00, 0x00,
+		0x70, 0x17, 0x00, 0x20,
+	},
+	{
+		0x20, 0x27, 0x00, 0x27, 0x20, 0xf3, 0xff, 0x93, 0x00, 0x91, 0x00, 0x03, 0x00, 0x80, 0x2b, 0x18,
+		0x00, 0x21, 0xc6, 0xff, 0x10, 0x20, 0x17, 0x00, 0x99, 0x00, 0x9c, 0x00, 0x03, 0x00, 0x00, 0xe7,
+		0x18, 0x00, 0x22, 0xd7, 0xff, 0xea, 0x1f, 0x43, 0x00, 0xa2, 0x00, 0x9d, 0x00, 0x06, 0x00, 0x80,
+		0xa2, 0x19, 0x00, 0x23,
+	},
+	{
+		0x20, 0x16, 0x00, 0x05, 0x20, 0xe2, 0xff, 0xa1, 0x00, 0x9c, 0x00, 0x01, 0x00, 0x00, 0x5e, 0x1a,
+		0x00, 0x24, 0xd3, 0xff, 0xf5, 0x1f, 0x4e, 0x00, 0xa3, 0x00, 0xa7, 0x00, 0x0a, 0x00, 0x80, 0x19,
+		0x1b, 0x00, 0x25, 0xa7, 0xff, 0x16, 0x20, 0x37, 0x00, 0xa7, 0x00, 0xa9, 0x00, 0x05, 0x00, 0x00,
+		0xd5, 0x1b, 0x00, 0x26,
+	},
+	{
+		0x20, 0xd0, 0xff, 0xa6, 0x1f, 0x0a, 0x00, 0xaa, 0x00, 0xb6, 0x00, 0xff, 0xff, 0x80, 0x90, 0x1c,
+		0x00, 0x27, 0x15, 0x00, 0xd0, 0x1f, 0x22, 0x00, 0xbb, 0x00, 0xb4, 0x00, 0x0b, 0x00, 0x00, 0x4c,
+		0x1d, 0x00, 0x28, 0xe2, 0xff, 0x36, 0x20, 0xeb, 0xff, 0xb9, 0x00, 0xba, 0x00, 0x02, 0x00, 0x80,
+		0x07, 0x1e, 0x00, 0x29,
+	},
+	{
+		0x20, 0x0d, 0x00, 0x0c, 0x20, 0x5d, 0x00, 0xbe, 0x00, 0xb8, 0x00, 0x07, 0x00, 0x00, 0xc3, 0x1e,
+		0x00, 0x2a, 0x0b, 0x00, 0xfb, 0x1f, 0x15, 0x00, 0xbe, 0x00, 0xba, 0x00, 0x0f, 0x00, 0x80, 0x7e,
+		0x1f, 0x00, 0x2b, 0xa2, 0xff, 0x32, 0x20, 0x0b, 0x00, 0xc2, 0x00, 0xc7, 0x00, 0x02, 0x00, 0x00,
+		0x3a, 0x20, 0x00, 0x2c,
+	},
+	{
+		0x20, 0x70, 0x00, 0x00, 0x20, 0x22, 0x00, 0xc5, 0x00, 0xcf, 0x00, 0x07, 0x00, 0x80, 0xf5, 0x20,
+		0x00, 0x2d, 0xdf, 0xff, 0x13, 0x20, 0x30, 0x00, 0xd5, 0x00, 0xbf, 0x00, 0x09, 0x00, 0x00, 0xb1,
+		0x21, 0x00, 0x2e, 0xd4, 0xff, 0xe4, 0x1f, 0x07, 0x00, 0xd7, 0x00, 0xcd, 0x00, 0x02, 0x00, 0x80,
+		0x6c, 0x22, 0x00, 0x2f,
+	},
+	{
+		0x20, 0xf6, 0xff, 0x25, 0x20, 0x39, 0x00, 0xd9, 0x00, 0xdc, 0x00, 0x02, 0x00, 0x00, 0x28, 0x23,
+		0x00, 0x30, 0xc1, 0xff, 0x23, 0x20, 0x48, 0x00, 0xd6, 0x00, 0xde, 0x00, 0x00, 0x00, 0x80, 0xe3,
+		0x23, 0x00, 0x31, 0x1b, 0x00, 0x08, 0x20, 0x25, 0x00, 0xe1, 0x00, 0xd3, 0x00, 0x08, 0x00, 0x00,
+		0x9f, 0x24, 0x00, 0x32,
+	},
+	{
+		0x20, 0xf0, 0xff, 0x25, 0x20, 0x56, 0x00, 0xe6, 0x00, 0xe0, 0x00, 0x0a, 0x00, 0x80, 0x5a, 0x25,
+		0x00, 0x33, 0xd8, 0xff, 0xdb, 0x1f, 0x24, 0x00, 0xe0, 0x00, 0xe4, 0x00, 0x08, 0x00, 0x00, 0x16,
+		0x26, 0x00, 0x34, 0xef, 0xff, 0x08, 0x20, 0x06, 0x00, 0xef, 0x00, 0xee, 0x00, 0x08, 0x00, 0x80,
+		0xd1, 0x26, 0x00, 0x35,
+	},
+	{
+		0x20, 0xe2, 0xff, 0xee, 0x1f, 0x2a, 0x00, 0xf4, 0x00, 0xea, 0x00, 0x04, 0x00, 0x00, 0x8d, 0x27,
+		0x00, 0x36, 0x1d, 0x00, 0x02, 0x20, 0x34, 0x00, 0xf9, 0x00, 0xf3, 0x00, 0x03, 0x00, 0x80, 0x48,
+		0x28, 0x00, 0x37, 0x08, 0x00, 0xf9, 0x1f, 0x11, 0x00, 0xff, 0x00, 0xed, 0x00, 0x04, 0x00, 0x00,
+		0x04, 0x29, 0x00, 0x38,
+	},
+	{
+		0x20, 0x2f, 0x00, 0xf9, 0x1f, 0x1a, 0x00, 0xfe, 0x00, 0xf9, 0x00, 0x05, 0x00, 0x80, 0xbf, 0x29,
+		0x00, 0x39, 0xf7, 0xff, 0x0a, 0x20, 0x67, 0x00, 0x01, 0x01, 0xfe, 0x00, 0x0c, 0x00, 0x00, 0x7b,
+		0x2a, 0x00, 0x3a, 0x16, 0x00, 0x15, 0x20, 0x8e, 0x00, 0x04, 0x01, 0x05, 0x01, 0x06, 0x00, 0x80,
+		0x36, 0x2b, 0x00, 0x3b,
+	},
+	{
+		0x20, 0x42, 0x00, 0x12, 0x20, 0x70, 0x00, 0x0f, 0x01, 0x07, 0x01, 0xf9, 0xff, 0x00, 0xf2, 0x2b,
+		0x00, 0x3c, 0xe3, 0xff, 0x1b, 0x20, 0x69, 0x00, 0x08, 0x01, 0x0d, 0x01, 0x0a, 0x00, 0x80, 0xad,
+		0x2c, 0x00, 0x3d, 0xd7, 0xff, 0x1d, 0x20, 0x7b, 0x00, 0x19, 0x01, 0x0d, 0x01, 0x09, 0x00, 0x00,
+		0x69, 0x2d, 0x00, 0x3e,
+	},
+	{
+		0x20, 0x3f, 0x00, 0xfd, 0x1f, 0x71, 0x00, 0x17, 0x01, 0x17, 0x01, 0x08, 0x00, 0x80, 0x24, 0x2e,
+		0x00, 0x3f, 0xd6, 0xff, 0xc1, 0x1f, 0x47, 0x00, 0x17, 0x01, 0x16, 0x01, 0x08, 0x00, 0x00, 0xe0,
+		0x2e, 0x00, 0x40, 0x46, 0x00, 0x25, 0x20, 0x83, 0x00, 0x20, 0x01, 0x21, 0x01, 0x08, 0x00, 0x80,
+		0x9b, 0x2f, 0x00, 0x41,
+	},
+	{
+		0x20, 0xe0, 0xff, 0x56, 0x20, 0x7d, 0x00, 0x1e, 0x01, 0x1f, 0x01, 0x0a, 0x00, 0x00, 0x57, 0x30,
+		0x00, 0x42, 0xd3, 0xff, 0x38, 0x20, 0x12, 0x00, 0x23, 0x01, 0x26, 0x01, 0x0d, 0x00, 0x80, 0x12,
+		0x31, 0x00, 0x43, 0x27, 0x00, 0xab, 0x1f, 0x0c, 0x00, 0x2c, 0x01, 0x31, 0x01, 0x06, 0x00, 0x00,
+		0xce, 0x31, 0x00, 0x44,
+	},
+	{
+		0x20, 0x10, 0x00, 0x1d, 0x20, 0x83, 0x00, 0x2c, 0x01, 0x33, 0x01, 0x07, 0x00, 0x80, 0x89, 0x32,
+		0x00, 0x45, 0x2e, 0x00, 0x19, 0x20, 0xaa, 0x00, 0x33, 0x01, 0x34, 0x01, 0x01, 0x00, 0x00, 0x45,
+		0x33, 0x00, 0x46, 0x2b, 0x00, 0xca, 0x1f, 0x84, 0x00, 0x34, 0x01, 0x36, 0x01, 0x02, 0x00, 0x80,
+		0x00, 0x34, 0x00, 0x47,
+	},
+	{
+		0x20, 0xf2, 0xff, 0x25, 0x20, 0x2b, 0x00, 0x30, 0x01, 0x39, 0x01, 0x0b, 0x00, 0x00, 0xbc, 0x34,
+		0x00, 0x48, 0xfd, 0xff, 0xea, 0x1f, 0x84, 0x00, 0x3d, 0x01, 0x43, 0x01, 0x06, 0x00, 0x80, 0x77,
+		0x35, 0x00, 0x49, 0x5e, 0x00, 0xfa, 0x1f, 0x48, 0x00, 0x41, 0x01, 0x41, 0x01, 0x03, 0x00, 0x00,
+		0x33, 0x36, 0x00, 0x4a,
+	},
+	{
+		0x20, 0x15, 0x00, 0xef, 0x1f, 0x6c, 0x00, 0x3a, 0x01, 0x46, 0x01, 0x03, 0x00, 0x80, 0xee, 0x36,
+		0x00, 0x4b, 0x11, 0x00, 0x3a, 0x20, 0x7b, 0x00, 0x48, 0x01, 0x40, 0x01, 0xff, 0xff, 0x00, 0xaa,
+		0x37, 0x00, 0x4c, 0x33, 0x00, 0xbc, 0x1f, 0x5e, 0x00, 0x4a, 0x01, 0x53, 0x01, 0x09, 0x00, 0x80,
+		0x65, 0x38, 0x00, 0x4d,
+	},
+	{
+		0x20, 0x1c, 0x00, 0x21, 0x20, 0x8f, 0x00, 0x50, 0x01, 0x52, 0x01, 0x02, 0x00, 0x00, 0x21, 0x39,
+		0x00, 0x4e, 0xab, 0xff, 0x4f, 0x20, 0x6b, 0x00, 0x54, 0x01, 0x5a, 0x01, 0x12, 0x00, 0x80, 0xdc,
+		0x39, 0x00, 0x4f, 0x34, 0x00, 0xe1, 0x1f, 0x3c, 0x00, 0x56, 0x01, 0x63, 0x01, 0x12, 0x00, 0x00,
+		0x98, 0x3a, 0x00, 0x50,
+	},
+	{
+		0x20, 0x3d, 0x00, 0xf0, 0x1f, 0xb0, 0x00, 0x5e, 0x01, 0x5d, 0x01, 0x0c, 0x00, 0x80, 0x53, 0x3b,
+		0x00, 0x51, 0x03, 0x00, 0x28, 0x20, 0x62, 0x00, 0x5b, 0x01, 0x69, 0x01, 0x0f, 0x00, 0x00, 0x0f,
+		0x3c, 0x00, 0x52, 0x13, 0x00, 0xfb, 0x1f, 0x68, 0x00, 0x62, 0x01, 0x6c, 0x01, 0x10, 0x00, 0x80,
+		0xca, 0x3c, 0x00, 0x53,
+	},
+	{
+		0x20, 0x08, 0x00, 0x08, 0x20, 0x7e, 0x00, 0x65, 0x01, 0x77, 0x01, 0x09, 0x00, 0x00, 0x86, 0x3d,
+		0x00, 0x54, 0xe1, 0xff, 0x11, 0x20, 0xbd, 0x00, 0x5f, 0x01, 0x70, 0x01, 0x0b, 0x00, 0x80, 0x41,
+		0x3e, 0x00, 0x55, 0x44, 0x00, 0x31, 0x20, 0x97, 0x00, 0x71, 0x01, 0x67, 0x01, 0x0d, 0x00, 0x00,
+		0xfd, 0x3e, 0x00, 0x56,
+	},
+	{
+		0x20, 0xae, 0xff, 0x0d, 0x20, 0x58, 0x00, 0x72, 0x01, 0x79, 0x01, 0x0e, 0x00, 0x80, 0xb8, 0x3f,
+		0x00, 0x57, 0x20, 0x00, 0xff, 0x1f, 0xc3, 0x00, 0x70, 0x01, 0x84, 0x01, 0x07, 0x00, 0x00, 0x74,
+		0x40, 0x00, 0x58, 0xe5, 0xff, 0x2b, 0x20, 0x96, 0x00, 0x72, 0x01, 0x84, 0x01, 0x0e, 0x00, 0x80,
+		0x2f, 0x41, 0x00, 0x59,
+	},
+	{
+		0x20, 0x0e, 0x00, 0xbb, 0x1f, 0x3d, 0x00, 0x7c, 0x01, 0x87, 0x01, 0x0f, 0x00, 0x00, 0xeb, 0x41,
+		0x00, 0x5a, 0x34, 0x00, 0x20, 0x20, 0xb8, 0x00, 0x78, 0x01, 0x88, 0x01, 0x06, 0x00, 0x80, 0xa6,
+		0x42, 0x00, 0x5b, 0x10, 0x00, 0xa5, 0x1f, 0x99, 0x00, 0x82, 0x01, 0x9d, 0x01, 0x0a, 0x00, 0x00,
+		0x62, 0x43, 0x00, 0x5c,
+	},
+	{
+		0x20, 0xf4, 0xff, 0xdb, 0x1f, 0x8b, 0x00, 0x84, 0x01, 0x9c, 0x01, 0x0a, 0x00, 0x80, 0x1d, 0x44,
+		0x00, 0x5d, 0x00, 0x00, 0x25, 0x20, 0xbe, 0x00, 0x8e, 0x01, 0x98, 0x01, 0x0c, 0x00, 0x00, 0xd9,
+		0x44, 0x00, 0x5e, 0xfa, 0xff, 0xe3, 0x1f, 0x89, 0x00, 0x93, 0x01, 0x9d, 0x01, 0x0c, 0x00, 0x80,
+		0x94, 0x45, 0x00, 0x5f,
+	},
+	{
+		0x20, 0x0c, 0x00, 0x42, 0x20, 0x88, 0x00, 0x8c, 0x01, 0xa2, 0x01, 0x12, 0x00, 0x00, 0x50, 0x46,
+		0x00, 0x60, 0x31, 0x00, 0x2a, 0x20, 0xdd, 0x00, 0x8d, 0x01, 0xa1, 0x01, 0x13, 0x00, 0x80, 0x0b,
+		0x47, 0x00, 0x61, 0x1e, 0x00, 0x18, 0x20, 0x85, 0x00, 0x8d, 0x01, 0xb5, 0x01, 0x0c, 0x00, 0x00,
+		0xc7, 0x47, 0x00, 0x62,
+	},
+	{
+		0x20, 0xf7, 0xff, 0x25, 0x20, 0xba, 0x00, 0xa1, 0x01, 0xae, 0x01, 0x07, 0x00, 0x80, 0x82, 0x48,
+		0x00, 0x63, 0xeb, 0xff, 0xbe, 0x1f, 0xc4, 0x00, 0x9b, 0x01, 0xb7, 0x01, 0x0a, 0x00, 0x00, 0x3e,
+		0x49, 0x00, 0x64, 0x1c, 0x00, 0xd8, 0x1f, 0x53, 0x00, 0xa6, 0x01, 0xb7, 0x01, 0x0d, 0x00, 0x80,
+		0xf9, 0x49, 0x00, 0x65,
+	},
+	{
+		0x20, 0x1d, 0x00, 0xe9, 0x1f, 0xe3, 0x00, 0x93, 0x01, 0xbb, 0x01, 0x0b, 0x00, 0x00, 0xb5, 0x4a,
+		0x00, 0x66, 0xdd, 0xff, 0xb9, 0x1f, 0x1b, 0x01, 0xac, 0x01, 0xbe, 0x01, 0x08, 0x00, 0x80, 0x70,
+		0x4b, 0x00, 0x67, 0x63, 0x00, 0x3b, 0x20, 0xda, 0x00, 0xab, 0x01, 0xca, 0x01, 0x0e, 0x00, 0x00,
+		0x2c, 0x4c, 0x00, 0x68,
+	},
+	{
+		0x20, 0xd9, 0xff, 0xd6, 0x1f, 0xad, 0x00, 0xa9, 0x01, 0xc2, 0x01, 0x0d, 0x00, 0x80, 0xe7, 0x4c,
+		0x00, 0x69, 0x17, 0x00, 0x10, 0x20, 0xe5, 0x00, 0xa3, 0x01, 0xcb, 0x01, 0x0e, 0x00, 0x00, 0xa3,
+		0x4d, 0x00, 0x6a, 0xf5, 0xff, 0x21, 0x20, 0xf3, 0x00, 0xb2, 0x01, 0xd6, 0x01, 0x10, 0x00, 0x80,
+		0x5e, 0x4e, 0x00, 0x6b,
+	},
+	{
+		0x20, 0x45, 0x00, 0xdd, 0x1f, 0x1b, 0x01, 0xb7, 0x01, 0xd8, 0x01, 0x0c, 0x00, 0x00, 0x1a, 0x4f,
+		0x00, 0x6c, 0x3c, 0x00, 0x03, 0x20, 0xa9, 0x00, 0xb2, 0x01, 0xde, 0x01, 0x04, 0x00, 0x80, 0xd5,
+		0x4f, 0x00, 0x6d, 0x18, 0x00, 0x35, 0x20, 0x06, 0x01, 0xb5, 0x01, 0xdc, 0x01, 0x0e, 0x00, 0x00,
+		0x91, 0x50, 0x00, 0x6e,
+	},
+	{
+		0x20, 0x46, 0x00, 0x0e, 0x20, 0xb7, 0x00, 0xbc, 0x01, 0xe4, 0x01, 0x0f, 0x00, 0x80, 0x4c, 0x51,
+		0x00, 0x6f, 0xf2, 0xff, 0xe7, 0x1f, 0xe4, 0x00, 0xba, 0x01, 0xe2, 0x01, 0x0f, 0x00, 0x00, 0x08,
+		0x52, 0x00, 0x70, 0x33, 0x00, 0xfc, 0x1f, 0x11, 0x01, 0xc2, 0x01, 0xe5, 0x01, 0x0e, 0x00, 0x80,
+		0xc3, 0x52, 0x00, 0x71,
+	},
+	{
+		0x20, 0x34, 0x00, 0xc0, 0x1f, 0x10, 0x01, 0xcb, 0x01, 0xf0, 0x01, 0x11, 0x00, 0x00, 0x7f, 0x53,
+		0x00, 0x72, 0x1f, 0x00, 0xf1, 0x1f, 0xd5, 0x00, 0xc0, 0x01, 0xfa, 0x01, 0x05, 0x00, 0x80, 0x3a,
+		0x54, 0x00, 0x73, 0xb7, 0xff, 0x3a, 0x20, 0xe3, 0x00, 0xc6, 0x01, 0xf4, 0x01, 0x0a, 0x00, 0x00,
+		0xf6, 0x54, 0x00, 0x74,
+	},
+	{
+		0x20, 0x10, 0x00, 0x0e, 0x20, 0x11, 0x01, 0xc9, 0x01, 0xf2, 0x01, 0x0e, 0x00, 0x80, 0xb1, 0x55,
+		0x00, 0x75, 0x1a, 0x00, 0x16, 0x20, 0x4a, 0x01, 0xd7, 0x01, 0xfb, 0x01, 0x12, 0x00, 0x00, 0x6d,
+		0x56, 0x00, 0x76, 0xee, 0xff, 0x07, 0x20, 0xf3, 0x00, 0xde, 0x01, 0x06, 0x02, 0x0b, 0x00, 0x80,
+		0x28, 0x57, 0x00, 0x77,
+	},
+	{
+		0x20, 0xfb, 0xff, 0x3d, 0x20, 0xd9, 0x00, 0xd8, 0x01, 0x0e, 0x02, 0x15, 0x00, 0x00, 0xe4, 0x57,
+		0x00, 0x78, 0xdb, 0xff, 0x08, 0x20, 0x55, 0x01, 0xd7, 0x01, 0x07, 0x02, 0x18, 0x00, 0x80, 0x9f,
+		0x58, 0x00, 0x79, 0x20, 0x00, 0xa2, 0x1f, 0xe2, 0x00, 0xd5, 0x01, 0x14, 0x02, 0x0b, 0x00, 0x00,
+		0x5b, 0x59, 0x00, 0x7a,
+	},
+	{
+		0x20, 0x5e, 0x00, 0xf8, 0x1f, 0x1f, 0x01, 0xe1, 0x01, 0x0c, 0x02, 0x0a, 0x00, 0x80, 0x16, 0x5a,
+		0x00, 0x7b, 0x36, 0x00, 0xec, 0x1f, 0x2f, 0x01, 0xdb, 0x01, 0x18, 0x02, 0x0e, 0x00, 0x00, 0xd2,
+		0x5a, 0x00, 0x7c, 0xb6, 0xff, 0x40, 0x20, 0x17, 0x01, 0xdb, 0x01, 0x17, 0x02, 0x11, 0x00, 0x80,
+		0x8d, 0x5b, 0x00, 0x7d,
+	},
+	{
+		0x20, 0xf5, 0xff, 0x35, 0x20, 0x1f, 0x01, 0xe4, 0x01, 0x25, 0x02, 0x09, 0x00, 0x00, 0x49, 0x5c,
+		0x00, 0x7e, 0xcb, 0xff, 0x31, 0x20, 0xfc, 0x00, 0xe1, 0x01, 0x21, 0x02, 0x13, 0x00, 0x80, 0x04,
+		0x5d, 0x00, 0x7f, 0xcf, 0xff, 0xf5, 0x1f, 0x25, 0x01, 0xe7, 0x01, 0x25, 0x02, 0x0b, 0x00, 0x00,
+		0xc0, 0x5d, 0x00, 0x80,
+	},
+	{
+		0x20, 0xff, 0xff, 0x09, 0x20, 0xd4, 0x00, 0xe6, 0x01, 0x2a, 0x02, 0x04, 0x00, 0x80, 0x7b, 0x5e,
+		0x00, 0x81, 0xf1, 0xff, 0xdc, 0x1f, 0x32, 0x01, 0xe7, 0x01, 0x35, 0x02, 0x11, 0x00, 0x00, 0x37,
+		0x5f, 0x00, 0x82, 0xcc, 0xff, 0x11, 0x20, 0x09, 0x01, 0xef, 0x01, 0x33, 0x02, 0x0c, 0x00, 0x80,
+		0xf2, 0x5f, 0x00, 0x83,
+	},
+	{
+		0x20, 0xa1, 0xff, 0x1e, 0x20, 0xbc, 0x00, 0xef, 0x01, 0x3a, 0x02, 0x16, 0x00, 0x00, 0xae, 0x60,
+		0x00, 0x84, 0x1d, 0x00, 0xfd, 0x1f, 0x15, 0x01, 0xf8, 0x01, 0x3e, 0x02, 0x15, 0x00, 0x80, 0x69,
+		0x61, 0x00, 0x85, 0x14, 0x00, 0x19, 0x20, 0x51, 0x01, 0xf5, 0x01, 0x43, 0x02, 0x0d, 0x00, 0x00,
+		0x25, 0x62, 0x00, 0x86,
+	},
+	{
+		0x20, 0x28, 0x00, 0x19, 0x20, 0x2c, 0x01, 0xf0, 0x01, 0x53, 0x02, 0x0a, 0x00, 0x80, 0xe0, 0x62,
+		0x00, 0x87, 0xe6, 0xff, 0xf3, 0x1f, 0x17, 0x01, 0xfa, 0x01, 0x4a, 0x02, 0x0d, 0x00, 0x00, 0x9c,
+		0x63, 0x00, 0x88, 0x43, 0x00, 0xf1, 0x1f, 0x65, 0x01, 0xfe, 0x01, 0x50, 0x02, 0x13, 0x00, 0x80,
+		0x57, 0x64, 0x00, 0x89,
+	},
+	{
+		0x20, 0x04, 0x00, 0x1f, 0x20, 0x59, 0x01, 0xf8, 0x01, 0x4e, 0x02, 0x08, 0x00, 0x00, 0x13, 0x65,
+		0x00, 0x8a, 0xbf, 0xff, 0xe8, 0x1f, 0x52, 0x01, 0xf8, 0x01, 0x5f, 0x02, 0x0f, 0x00, 0x80, 0xce,
+		0x65, 0x00, 0x8b, 0xda, 0xff, 0xee, 0x1f, 0x74, 0x01, 0x04, 0x02, 0x61, 0x02, 0x1a, 0x00, 0x00,
+		0x8a, 0x66, 0x00, 0x8c,
+	},
+	{
+		0x20, 0x33, 0x00, 0xcd, 0x1f, 0x5f, 0x01, 0x00, 0x02, 0x59, 0x02, 0x14, 0x00, 0x80, 0x45, 0x67,
+		0x00, 0x8d, 0x21, 0x00, 0xc6, 0x1f, 0x57, 0x01, 0x01, 0x02, 0x5c, 0x02, 0x11, 0x00, 0x00, 0x01,
+		0x68, 0x00, 0x8e, 0xbc, 0xff, 0xfe, 0x1f, 0x45, 0x01, 0x07, 0x02, 0x62, 0x02, 0x13, 0x00, 0x80,
+		0xbc, 0x68, 0x00, 0x8f,
+	},
+	{
+		0x20, 0xea, 0xff, 0xd9, 0x1f, 0xa8, 0x01, 0x02, 0x02, 0x64, 0x02, 0x0c, 0x00, 0x00, 0x78, 0x69,
+		0x00, 0x90, 0x38, 0x00, 0xf9, 0x1f, 0xe5, 0x01, 0x0f, 0x02, 0x74, 0x02, 0x15, 0x00, 0x80, 0x33,
+		0x6a, 0x00, 0x91, 0xce, 0xff, 0x45, 0x20, 0x80, 0x01, 0x08, 0x02, 0x6f, 0x02, 0x10, 0x00, 0x00,
+		0xef, 0x6a, 0x00, 0x92,
+	},
+	{
+		0x20, 0xe4, 0xff, 0xfa, 0x1f, 0xb7, 0x01, 0x0c, 0x02, 0x7a, 0x02, 0x10, 0x00, 0x80, 0xaa, 0x6b,
+		0x00, 0x93, 0xe6, 0xff, 0xd5, 0x1f, 0x89, 0x01, 0x10, 0x02, 0x6f, 0x02, 0x0d, 0x00, 0x00, 0x66,
+		0x6c, 0x00, 0x94, 0x36, 0x00, 0x18, 0x20, 0x53, 0x01, 0x1b, 0x02, 0x74, 0x02, 0x0c, 0x00, 0x80,
+		0x21, 0x6d, 0x00, 0x95,
+	},
+	{
+		0x20, 0xca, 0xff, 0xd1, 0x1f, 0x69, 0x01, 0x15, 0x02, 0x80, 0x02, 0x13, 0x00, 0x00, 0xdd, 0x6d,
+		0x00, 0x96, 0x35, 0x00, 0xa4, 0x1f, 0xac, 0x01, 0x1e, 0x02, 0x86, 0x02, 0x0b, 0x00, 0x80, 0x98,
+		0x6e, 0x00, 0x97, 0x23, 0x00, 0xe0, 0x1f, 0xa5, 0x01, 0x15, 0x02, 0x84, 0x02, 0x19, 0x00, 0x00,
+		0x54, 0x6f, 0x00, 0x98,
+	},
+	{
+		0x20, 0xd0, 0xff, 0x1f, 0x20, 0x99, 0x01, 0x0d, 0x02, 0x8e, 0x02, 0x16, 0x00, 0x80, 0x0f, 0x70,
+		0x00, 0x99, 0xdf, 0xff, 0xe7, 0x1f, 0x8c, 0x01, 0x1a, 0x02, 0x91, 0x02, 0x0b, 0x00, 0x00, 0xcb,
+		0x70, 0x00, 0x9a, 0xdd, 0xff, 0xbe, 0x1f, 0x8f, 0x01, 0x12, 0x02, 0x8e, 0x02, 0x19, 0x00, 0x80,
+		0x86, 0x71, 0x00, 0x9b,
+	},
+	{
+		0x20, 0xe6, 0xff, 0xf8, 0x1f, 0x9b, 0x01, 0x1c, 0x02, 0x93, 0x02, 0x0e, 0x00, 0x00, 0x42, 0x72,
+		0x00, 0x9c, 0xd0, 0xff, 0x50, 0x20, 0x7f, 0x01, 0x15, 0x02, 0x9d, 0x02, 0x15, 0x00, 0x80, 0xfd,
+		0x72, 0x00, 0x9d, 0x16, 0x00, 0xca, 0x1f, 0xa8, 0x01, 0x1d, 0x02, 0x9a, 0x02, 0x11, 0x00, 0x00,
+		0xb9, 0x73, 0x00, 0x9e,
+	},
+	{
+		0x20, 0x6d, 0x00, 0xaf, 0x1f, 0xbd, 0x01, 0x1a, 0x02, 0xa1, 0x02, 0x12, 0x00, 0x80, 0x74, 0x74,
+		0x00, 0x9f, 0x02, 0x00, 0xe3, 0x1f, 0xc1, 0x01, 0x28, 0x02, 0x9d, 0x02, 0x14, 0x00, 0x00, 0x30,
+		0x75, 0x00, 0xa0, 0x20, 0x00, 0x00, 0x20, 0xd3, 0x01, 0x29, 0x02, 0xaf, 0x02, 0x09, 0x00, 0x80,
+		0xeb, 0x75, 0x00, 0xa1,
+	},
+	{
+		0x20, 0xe7, 0xff, 0x20, 0x20, 0xec, 0x01, 0x26, 0x02, 0xb4, 0x02, 0x14, 0x00, 0x00, 0xa7, 0x76,
+		0x00, 0xa2, 0x40, 0x00, 0x0d, 0x20, 0x12, 0x02, 0x24, 0x02, 0xb1, 0x02, 0x16, 0x00, 0x80, 0x62,
+		0x77, 0x00, 0xa3, 0x06, 0x00, 0xc4, 0x1f, 0x5c, 0x01, 0x2a, 0x02, 0xc0, 0x02, 0x14, 0x00, 0x00,
+		0x1e, 0x78, 0x00, 0xa4,
+	},
+	{
+		0x20, 0x2e, 0x00, 0xfe, 0x1f, 0xc4, 0x01, 0x2a, 0x02, 0xbd, 0x02, 0x15, 0x00, 0x80, 0xd9, 0x78,
+		0x00, 0xa5, 0x14, 0x00, 0xd8, 0x1f, 0x86, 0x01, 0x2e, 0x02, 0xc7, 0x02, 0x0f, 0x00, 0x00, 0x95,
+		0x79, 0x00, 0xa6, 0x51, 0x00, 0xd3, 0x1f, 0x10, 0x02, 0x2a, 0x02, 0xbf, 0x02, 0x16, 0x00, 0x80,
+		0x50, 0x7a, 0x00, 0xa7,
+	},
+	{
+		0x20, 0x18, 0x00, 0xfe, 0x1f, 0xf2, 0x01, 0x28, 0x02, 0xc2, 0x02, 0x1f, 0x00, 0x00, 0x0c, 0x7b,
+		0x00, 0xa8, 0x2d, 0x00, 0xf6, 0x1f, 0xd3, 0x01, 0x2c, 0x02, 0xca, 0x02, 0x12, 0x00, 0x80, 0xc7,
+		0x7b, 0x00, 0xa9, 0x21, 0x00, 0xfe, 0x1f, 0xe5, 0x01, 0x34, 0x02, 0xc9, 0x02, 0x12, 0x00, 0x00,
+		0x83, 0x7c, 0x00, 0xaa,
+	},
+	{
+		0x20, 0x02, 0x00, 0x05, 0x20, 0xe5, 0x01, 0x29, 0x02, 0xda, 0x02, 0x13, 0x00, 0x80, 0x3e, 0x7d,
+		0x00, 0xab, 0xe0, 0xff, 0xfe, 0x1f, 0xf0, 0x01, 0x31, 0x02, 0xd6, 0x02, 0x17, 0x00, 0x00, 0xfa,
+		0x7d, 0x00, 0xac, 0xf5, 0xff, 0x0a, 0x20, 0xd5, 0x01, 0x30, 0x02, 0xdb, 0x02, 0x10, 0x00, 0x80,
+		0xb5, 0x7e, 0x00, 0xad,
+	},
+	{
+		0x20, 0x04, 0x00, 0xce, 0x1f, 0x02, 0x02, 0x28, 0x02, 0xe1, 0x02, 0x17, 0x00, 0x00, 0x71, 0x7f,
+		0x00, 0xae, 0xc4, 0xff, 0xf9, 0x1f, 0x05, 0x02, 0x35, 0x02, 0xdb, 0x02, 0x12, 0x00, 0x80, 0x2c,
+		0x80, 0x00, 0xaf, 0x3e, 0x00, 0xf7, 0x1f, 0x52, 0x02, 0x2f, 0x02, 0xe1, 0x02, 0x18, 0x00, 0x00,
+		0xe8, 0x80, 0x00, 0xb0,
+	},
+	{
+		0x20, 0xa9, 0xff, 0xed, 0x1f, 0x46, 0x02, 0x29, 0x02, 0xf0, 0x02, 0x12, 0x00, 0x80, 0xa3, 0x81,
+		0x00, 0xb1, 0xfb, 0xff, 0xea, 0x1f, 0xf2, 0x01, 0x39, 0x02, 0xec, 0x02, 0x18, 0x00, 0x00, 0x5f,
+		0x82, 0x00, 0xb2, 0x3e, 0x00, 0xfa, 0x1f, 0x1e, 0x02, 0x2e, 0x02, 0xef, 0x02, 0x16, 0x00, 0x80,
+		0x1a, 0x83, 0x00, 0xb3,
+	},
+	{
+		0x20, 0xdd, 0xff, 0xde, 0x1f, 0x08, 0x02, 0x2f, 0x02, 0xf3, 0x02, 0x10, 0x00, 0x00, 0xd6, 0x83,
+		0x00, 0xb4, 0x08, 0x00, 0x09, 0x20, 0x26, 0x02, 0x2b, 0x02, 0xf8, 0x02, 0x18, 0x00, 0x80, 0x91,
+		0x84, 0x00, 0xb5, 0x06, 0x00, 0x0c, 0x20, 0xe9, 0x01, 0x34, 0x02, 0xfe, 0x02, 0x19, 0x00, 0x00,
+		0x4d, 0x85, 0x00, 0xb6,
+	},
+	{
+		0x20, 0x15, 0x00, 0xbd, 0x1f, 0x65, 0x02, 0x3c, 0x02, 0xfa, 0x02, 0x16, 0x00, 0x80, 0x08, 0x86,
+		0x00, 0xb7, 0xea, 0xff, 0x91, 0x1f, 0x17, 0x02, 0x2e, 0x02, 0x02, 0x03, 0x18, 0x00, 0x00, 0xc4,
+		0x86, 0x00, 0xb8, 0x01, 0x00, 0xf5, 0x1f, 0x6e, 0x02, 0x31, 0x02, 0x06, 0x03, 0x16, 0x00, 0x80,
+		0x7f, 0x87, 0x00, 0xb9,
+	},
+	{
+		0x20, 0x04, 0x00, 0x0a, 0x20, 0x2b, 0x02, 0x2e, 0x02, 0x0a, 0x03, 0x1a, 0x00, 0x00, 0x3b, 0x88,
+		0x00, 0xba, 0xef, 0xff, 0xdb, 0x1f, 0x51, 0x02, 0x34, 0x02, 0x0a, 0x03, 0x1b, 0x00, 0x80, 0xf6,
+		0x88, 0x00, 0xbb, 0x07, 0x00, 0xd3, 0x1f, 0x74, 0x02, 0x34, 0x02, 0x1a, 0x03, 0x1c, 0x00, 0x00,
+		0xb2, 0x89, 0x00, 0xbc,
+	},
+	{
+		0x20, 0x02, 0x00, 0x00, 0x20, 0x76, 0x02, 0x2f, 0x02, 0x18, 0x03, 0x15, 0x00, 0x80, 0x6d, 0x8a,
+		0x00, 0xbd, 0x2f, 0x00, 0xbd, 0x1f, 0x6d, 0x02, 0x2c, 0x02, 0x1a, 0x03, 0x17, 0x00, 0x00, 0x29,
+		0x8b, 0x00, 0xbe, 0x0f, 0x00, 0xce, 0x1f, 0x57, 0x02, 0x31, 0x02, 0x21, 0x03, 0x13, 0x00, 0x80,
+		0xe4, 0x8b, 0x00, 0xbf,
+	},
+};
+
+const bench_corpus bench_corpus_vive = { "vive", 52, 64, &reports[0][0] };
@@ -0,0 +1,45 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - NOLO Decoders */
+
+#include <string.h>
+#include "bench.h"
+#include "drv_nolo/nolo.h"
+
+static drv_priv hmd, controller;
+
+// Reports are decrypted in place, so each one is copied first like the
+// driver does when reading into its receive buffer.
+static bool decrypt(const unsigned char* buf, int size)
+{
+	unsigned char buffer[FEATURE_BUFFER_SIZE];
+	memcpy(buffer, buf, FEATURE_BUFFER_SIZE);
+
+	nolo_decrypt_data(buffer);
+
+	return buffer[0] == NOLO_CONTROLLER_0_HMD_SMP1 || buffer[0] == NOLO_CONTROLLER_1_HMD_SMP2;
+}
+
+static bool decrypt_decode(const unsigned char* buf, int size)
+{
+	unsigned char buffer[FEATURE_BUFFER_SIZE];
+	memcpy(buffer, buf, FEATURE_BUFFER_SIZE);
+
+	nolo_decrypt_data(buffer);
+	nolo_decode_controller(&controller, buffer);
+	nolo_decode_hmd_marker(&hmd, buffer);
+
+	// the corpus headset is held at 1.65 m
+	return fabsf(hmd.base.position.y - 1.65f) < 0.01f;
+}
+
+void bench_decode_nolo(void)
+{
+	hmd.rev = controller.rev = 2;
+
+	bench_run_decoder("nolo_decrypt_data", &bench_corpus_nolo, decrypt);
+	bench_run_decoder("nolo_decrypt_data+decode", &bench_corpus_nolo, decrypt_decode);
+}
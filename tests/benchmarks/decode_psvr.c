@@ -0,0 +1,21 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Sony PSVR Decoders */
+
+#include "bench.h"
+#include "drv_psvr/psvr.h"
+
+static psvr_sensor_packet sensor_packet;
+
+static bool decode_sensor(const unsigned char* buf, int size)
+{
+	return psvr_decode_sensor_packet(&sensor_packet, buf, size);
+}
+
+void bench_decode_psvr(void)
+{
+	bench_run_decoder("psvr_decode_sensor_packet", &bench_corpus_psvr, decode_sensor);
+}
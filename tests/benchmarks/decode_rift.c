@@ -0,0 +1,28 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Oculus Rift Decoders */
+
+#include "bench.h"
+#include "drv_oculus_rift/rift.h"
+
+static pkt_tracker_sensor sensor_msg;
+static pkt_rift_radio_report radio_report;
+
+static bool decode_dk2(const unsigned char* buf, int size)
+{
+	return decode_tracker_sensor_msg_dk2(&sensor_msg, buf, size);
+}
+
+static bool decode_radio(const unsigned char* buf, int size)
+{
+	return decode_rift_radio_report(&radio_report, buf, size);
+}
+
+void bench_decode_rift(void)
+{
+	bench_run_decoder("decode_tracker_sensor_msg_dk2", &bench_corpus_rift_dk2, decode_dk2);
+	bench_run_decoder("decode_rift_radio_report", &bench_corpus_rift_radio, decode_radio);
+}
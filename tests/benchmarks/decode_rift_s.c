@@ -0,0 +1,28 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Oculus Rift S Decoders */
+
+#include "bench.h"
+#include "drv_oculus_rift_s/rift-s-protocol.h"
+
+static rift_s_hmd_report_t hmd_report;
+static rift_s_controller_report_t controller_report;
+
+static bool decode_hmd(const unsigned char* buf, int size)
+{
+	return rift_s_parse_hmd_report(&hmd_report, buf, size);
+}
+
+static bool decode_controller(const unsigned char* buf, int size)
+{
+	return rift_s_parse_controller_report(&controller_report, buf, size) && controller_report.num_info > 0;
+}
+
+void bench_decode_rift_s(void)
+{
+	bench_run_decoder("rift_s_parse_hmd_report", &bench_corpus_rift_s_hmd, decode_hmd);
+	bench_run_decoder("rift_s_parse_controller_report", &bench_corpus_rift_s_controller, decode_controller);
+}
@@ -0,0 +1,21 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - HTC Vive Decoders */
+
+#include "bench.h"
+#include "drv_htc_vive/vive.h"
+
+static vive_headset_imu_packet imu_packet;
+
+static bool decode_imu(const unsigned char* buf, int size)
+{
+	return vive_decode_sensor_packet(&imu_packet, buf, size);
+}
+
+void bench_decode_vive(void)
+{
+	bench_run_decoder("vive_decode_sensor_packet", &bench_corpus_vive, decode_imu);
+}
@@ -0,0 +1,21 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Windows Mixed Reality Decoders */
+
+#include "bench.h"
+#include "drv_wmr/wmr.h"
+
+static hololens_sensors_packet sensor_packet;
+
+static bool decode_sensors(const unsigned char* buf, int size)
+{
+	return hololens_sensors_decode_packet(&sensor_packet, buf, size);
+}
+
+void bench_decode_wmr(void)
+{
+	bench_run_decoder("hololens_sensors_decode_packet", &bench_corpus_wmr, decode_sensors);
+}
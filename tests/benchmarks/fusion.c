@@ -0,0 +1,330 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Sensor Fusion */
+
+#include "bench.h"
+#include "fusion-group.h"
+
+static bench_imu_sample imu_samples[BENCH_IMU_SAMPLES];
+static fusion_sample fusion_samples[BENCH_IMU_SAMPLES];
+static bool imu_ready;
+
+static void imu_prepare(void)
+{
+	if(imu_ready)
+		return;
+
+	bench_imu_generate(imu_samples, BENCH_IMU_SAMPLES, 1234);
+
+	for(int i = 0; i < BENCH_IMU_SAMPLES; i++){
+		fusion_sample* f = &fusion_samples[i];
+
+		f->dt_ns = (uint64_t)llround(imu_samples[i].dt * 1e9);
+		f->sample_ns = (i + 1) * f->dt_ns;
+		f->ang_vel = imu_samples[i].gyro;
+		f->accel = imu_samples[i].accel;
+		f->mag = imu_samples[i].mag;
+	}
+
+	imu_ready = true;
+}
+
+void bench_ofusion_update(int iterations)
+{
+	imu_prepare();
+
+	fusion f;
+	ofusion_init(&f);
+
+	for(int i = 0; i < iterations; i++){
+		const bench_imu_sample* s = &imu_samples[i & (BENCH_IMU_SAMPLES - 1)];
+		ofusion_update(&f, s->dt, &s->gyro, &s->accel, &s->mag);
+	}
+
+	bench_sink = f.orient.w;
+}
+
+// one operation is one sample, fused in reports of `batch` samples like the drivers do
+static void run_batched(int iterations, int batch, ohmd_fusion_backend backend, bool fixed_point)
+{
+	imu_prepare();
+
+	fusion f;
+	ofusion_init(&f);
+	ofusion_set_backend(&f, backend);
+	ofusion_set_fixed_point(&f, fixed_point);
+
+	for(int i = 0; i < iterations; i += batch){
+		int at = i & (BENCH_IMU_SAMPLES - 1);
+		ofusion_update_batch(&f, &fusion_samples[at], OHMD_MIN(batch, iterations - i));
+	}
+
+	bench_sink = f.orient.w;
+}
+
+void bench_ofusion_update_batch_1(int iterations)
+{
+	run_batched(iterations, 1, OHMD_FUSION_COMPLEMENTARY, false);
+}
+
+void bench_ofusion_update_batch_2(int iterations)
+{
+	run_batched(iterations, 2, OHMD_FUSION_COMPLEMENTARY, false);
+}
+
+void bench_ofusion_update_batch_4(int iterations)
+{
+	run_batched(iterations, 4, OHMD_FUSION_COMPLEMENTARY, false);
+}
+
+void bench_ofusion_complementary(int iterations)
+{
+	run_batched(iterations, 3, OHMD_FUSION_COMPLEMENTARY, false);
+}
+
+void bench_ofusion_mahony(int iterations)
+{
+	run_batched(iterations, 3, OHMD_FUSION_MAHONY, false);
+}
+
+void bench_ofusion_madgwick(int iterations)
+{
+	run_batched(iterations, 3, OHMD_FUSION_MADGWICK, false);
+}
+
+void bench_ofusion_fixed_complementary(int iterations)
+{
+	run_batched(iterations, 3, OHMD_FUSION_COMPLEMENTARY, true);
+}
+
+void bench_ofusion_fixed_mahony(int iterations)
+{
+	run_batched(iterations, 3, OHMD_FUSION_MAHONY, true);
+}
+
+void bench_ofusion_fixed_madgwick(int iterations)
+{
+	run_batched(iterations, 3, OHMD_FUSION_MADGWICK, true);
+}
+
+// Many trackers fused with Mahony in reports of 3 samples, one operation is one sample of one tracker.
+// Either a fusion struct each, allocated separately as the drivers do, or the lanes of one fusion_group.
+static void run_trackers(int iterations, int trackers, bool group)
+{
+	imu_prepare();
+
+	fusion** single = calloc(trackers, sizeof(fusion*));
+	fusion_group g;
+
+	if(!single || !ofusion_group_init(&g, OHMD_FUSION_MAHONY, trackers, 3)){
+		free(single);
+		return;
+	}
+
+	for(int t = 0; t < trackers; t++){
+		ofusion_group_add(&g);
+
+		single[t] = malloc(sizeof(fusion));
+		if(single[t]){
+			ofusion_init(single[t]);
+			ofusion_set_backend(single[t], OHMD_FUSION_MAHONY);
+		}
+	}
+
+	for(int i = 0, round = 0; i < iterations; round++){
+		for(int t = 0; t < trackers && i < iterations; t++, i += 3){
+			const fusion_sample* s = &fusion_samples[(t * 97 + round * 3) % (BENCH_IMU_SAMPLES - 2)];
+
+			if(!group){
+				if(single[t])
+					ofusion_update_batch(single[t], s, 3);
+				continue;
+			}
+
+			for(int j = 0; j < 3; j++)
+				ofusion_group_push(&g, t, s + j);
+		}
+
+		if(group)
+			ofusion_group_step(&g);
+	}
+
+	bench_sink = group ? g.qw[0] : single[0] ? single[0]->orient.w : 0.0f;
+
+	for(int t = 0; t < trackers; t++)
+		free(single[t]);
+	free(single);
+	ofusion_group_destroy(&g);
+}
+
+void bench_ofusion_trackers_4(int iterations)
+{
+	run_trackers(iterations, 4, false);
+}
+
+void bench_ofusion_trackers_64(int iterations)
+{
+	run_trackers(iterations, 64, false);
+}
+
+void bench_ofusion_trackers_256(int iterations)
+{
+	run_trackers(iterations, 256, false);
+}
+
+void bench_ofusion_group_4(int iterations)
+{
+	run_trackers(iterations, 4, true);
+}
+
+void bench_ofusion_group_64(int iterations)
+{
+	run_trackers(iterations, 64, true);
+}
+
+void bench_ofusion_group_256(int iterations)
+{
+	run_trackers(iterations, 256, true);
+}
+
+#define CONVERGE_RATE 1000         // Hz
+#define CONVERGE_SECONDS 60
+#define CONVERGE_SETTLED_S 10      // tilt errors are averaged from here on
+#define CONVERGE_TOLERANCE_DEG 2.0 // converged once the tilt error stays below
+
+// Angle between the up directions of the true and the fused orientation,
+// in degrees. Yaw can't be observed without a magnetometer.
+static double tilt_error_deg(const quatf* truth, const quatf* fused)
+{
+	const vec3f up = {{0, 1.0f, 0}};
+	quatf inv_truth = *truth, inv_fused = *fused;
+	vec3f truth_up, fused_up;
+
+	oquatf_inverse(&inv_truth);
+	oquatf_inverse(&inv_fused);
+	oquatf_get_rotated(&inv_truth, &up, &truth_up);
+	oquatf_get_rotated(&inv_fused, &up, &fused_up);
+
+	double dot = ovec3f_get_dot(&truth_up, &fused_up);
+	return acos(dot > 1.0 ? 1.0 : dot) * 180.0 / M_PI;
+}
+
+// Head motion in bursts of 8 s with 2 s of rest in between, a constant gyro
+// bias and accelerometer noise. The device starts 30 degrees off level.
+static void converge_generate(fusion_sample* samples, quatf* truth, int count)
+{
+	const float dt = 1.0f / CONVERGE_RATE;
+	const vec3f gravity = {{0.0f, 9.81f, 0.0f}};
+	const vec3f bias = {{0.005f, -0.003f, 0.004f}};
+	vec3f tilt_axis = {{1.0f, 0.0f, 1.0f}};
+	unsigned int seed = 4321;
+	quatf orient;
+
+	ovec3f_normalize_me(&tilt_axis);
+	oquatf_init_axis(&orient, &tilt_axis, (float)(30.0 * M_PI / 180.0));
+
+	for(int i = 0; i < count; i++){
+		float t = i * dt;
+		float burst = fmodf(t, 10.0f);
+		float moving = t >= 2.0f && burst < 8.0f ? 1.0f : 0.0f;
+		vec3f gyro = {{
+			moving * 0.6f * sinf(2.0f * (float)M_PI * 1.3f * t),
+			moving * 1.5f * sinf(2.0f * (float)M_PI * 0.5f * t),
+			moving * 0.1f * sinf(2.0f * (float)M_PI * 0.2f * t)
+		}};
+
+		float len = ovec3f_get_length(&gyro);
+		if(len > 0.0f){
+			quatf delta;
+			oquatf_init_axis(&delta, &gyro, len * dt);
+			oquatf_mult_me(&orient, &delta);
+			oquatf_normalize_me(&orient);
+		}
+		truth[i] = orient;
+
+		fusion_sample* s = &samples[i];
+		quatf inv = orient;
+		oquatf_inverse(&inv);
+		oquatf_get_rotated(&inv, &gravity, &s->accel);
+
+		for(int j = 0; j < 3; j++){
+			s->ang_vel.arr[j] = gyro.arr[j] + bias.arr[j] + 0.01f * bench_randf(&seed);
+			s->accel.arr[j] += 0.05f * bench_randf(&seed);
+		}
+
+		s->mag.x = s->mag.y = s->mag.z = 0.0f;
+		s->dt_ns = 1000000000 / CONVERGE_RATE;
+		s->sample_ns = (uint64_t)(i + 1) * s->dt_ns;
+	}
+}
+
+void bench_fusion_convergence(void)
+{
+	static const struct {
+		const char* name;
+		ohmd_fusion_backend backend;
+	} backends[] = {
+		{ "complementary", OHMD_FUSION_COMPLEMENTARY },
+		{ "mahony", OHMD_FUSION_MAHONY },
+		{ "madgwick", OHMD_FUSION_MADGWICK },
+	};
+
+	const int count = CONVERGE_RATE * CONVERGE_SECONDS;
+	fusion_sample* samples = malloc(count * sizeof(fusion_sample));
+	quatf* truth = malloc(count * sizeof(quatf));
+
+	if(!samples || !truth){
+		free(samples);
+		free(truth);
+		return;
+	}
+
+	converge_generate(samples, truth, count);
+
+	for(int b = 0; b < (int)(sizeof(backends) / sizeof(backends[0])); b++){
+		char name[64];
+		snprintf(name, sizeof(name), "fusion_convergence_%s", backends[b].name);
+		if(!bench_enabled(name))
+			continue;
+
+		fusion f;
+		ofusion_init(&f);
+		ofusion_set_backend(&f, backends[b].backend);
+
+		// fused in reports of 3 samples
+		double converged_s = -1.0, sum = 0.0, max = 0.0;
+		int settled = 0;
+
+		for(int i = 0; i < count; i += 3){
+			int n = OHMD_MIN(3, count - i);
+			ofusion_update_batch(&f, samples + i, n);
+
+			double error = tilt_error_deg(&truth[i + n - 1], &f.orient);
+			double t = (double)(i + n) / CONVERGE_RATE;
+
+			if(error >= CONVERGE_TOLERANCE_DEG)
+				converged_s = -1.0;
+			else if(converged_s < 0.0)
+				converged_s = t;
+
+			if(t > CONVERGE_SETTLED_S){
+				sum += error;
+				max = error > max ? error : max;
+				settled++;
+			}
+		}
+
+		if(converged_s < 0.0)
+			printf("   %-40s not below %.0f deg  ", name, CONVERGE_TOLERANCE_DEG);
+		else
+			printf("   %-40s below %.0f deg after %5.2f s", name, CONVERGE_TOLERANCE_DEG, converged_s);
+
+		printf("   tilt error mean %.2f deg, max %.2f deg\n", sum / settled, max);
+	}
+
+	free(samples);
+	free(truth);
+}
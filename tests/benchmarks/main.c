@@ -0,0 +1,236 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Main */
+
+#include <string.h>
+#include <stdlib.h>
+#include "bench.h"
+
+#define BENCH_RUNS 11
+#define BENCH_MIN_RUN_NS 20000000ull // 20 ms
+
+volatile float bench_sink;
+
+static const char* bench_filter;
+static int bench_failures;
+
+static int compare_double(const void* a, const void* b)
+{
+	double da = *(const double*)a, db = *(const double*)b;
+	return (da > db) - (da < db);
+}
+
+static void measure(bench_fn fn, double* median, double* min, double* max)
+{
+	// warm up and find an iteration count that runs for at least BENCH_MIN_RUN_NS
+	int iterations = 1;
+	for(;;){
+		uint64_t start = bench_now_ns();
+		fn(iterations);
+		uint64_t elapsed = bench_now_ns() - start;
+
+		if(elapsed >= BENCH_MIN_RUN_NS || iterations >= (1 << 30))
+			break;
+
+		iterations *= elapsed < BENCH_MIN_RUN_NS / 16 ? 8 : 2;
+	}
+
+	double ns_per_op[BENCH_RUNS];
+	for(int i = 0; i < BENCH_RUNS; i++){
+		uint64_t start = bench_now_ns();
+		fn(iterations);
+		ns_per_op[i] = (double)(bench_now_ns() - start) / iterations;
+	}
+
+	qsort(ns_per_op, BENCH_RUNS, sizeof(double), compare_double);
+
+	*median = ns_per_op[BENCH_RUNS / 2];
+	*min = ns_per_op[0];
+	*max = ns_per_op[BENCH_RUNS - 1];
+}
+
+bool bench_enabled(const char* name)
+{
+	return !bench_filter || strstr(name, bench_filter);
+}
+
+void bench_run(const char* name, bench_fn fn)
+{
+	if(!bench_enabled(name))
+		return;
+
+	double median, min, max;
+	measure(fn, &median, &min, &max);
+
+	printf("   %-40s %10.2f ns/op   (min %.2f, max %.2f)\n", name, median, min, max);
+}
+
+void bench_run_rate(const char* name, bench_fn fn, const char* unit)
+{
+	if(!bench_enabled(name))
+		return;
+
+	double median, min, max;
+	measure(fn, &median, &min, &max);
+
+	printf("   %-40s %10.2f ns/op %14.0f %s/s   (min %.2f, max %.2f)\n", name, median,
+		1000000000.0 / median, unit, min, max);
+}
+
+static const bench_corpus* decode_corpus;
+static bench_decode_fn decode_fn;
+
+static void bench_decode(int iterations)
+{
+	const unsigned char* report = decode_corpus->data;
+	const unsigned char* end = report + decode_corpus->report_size * decode_corpus->count;
+	int size = decode_corpus->report_size;
+	int ok = 0;
+
+	for(int i = 0; i < iterations; i++){
+		ok += decode_fn(report, size);
+
+		report += size;
+		if(report == end)
+			report = decode_corpus->data;
+	}
+
+	bench_sink = (float)ok;
+}
+
+void bench_run_decoder(const char* name, const bench_corpus* corpus, bench_decode_fn decode)
+{
+	if(!bench_enabled(name))
+		return;
+
+	for(int i = 0; i < corpus->count; i++){
+		if(!decode(corpus->data + i * corpus->report_size, corpus->report_size)){
+			printf("   %-40s FAILED to decode report %d of %s\n", name, i, corpus->name);
+			bench_failures++;
+			return;
+		}
+	}
+
+	decode_corpus = corpus;
+	decode_fn = decode;
+	bench_run_rate(name, bench_decode, "reports");
+}
+
+float bench_randf(unsigned int* state)
+{
+	// xorshift32, deterministic across platforms
+	unsigned int x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+
+	return (float)(x & 0xffffff) / (float)0x7fffff - 1.0f;
+}
+
+void bench_imu_generate(bench_imu_sample* samples, int count, unsigned int seed)
+{
+	const float dt = 0.001f;
+	const vec3f gravity = {{0.0f, 9.81f, 0.0f}};
+	quatf orient = {{0, 0, 0, 1}};
+
+	for(int i = 0; i < count; i++){
+		float t = i * dt;
+		bench_imu_sample* s = &samples[i];
+
+		// yaw sweeps at ~0.5 Hz, pitch nods at ~1.3 Hz, a bit of roll
+		s->gyro.x = 0.6f * sinf(2.0f * (float)M_PI * 1.3f * t) + 0.01f * bench_randf(&seed);
+		s->gyro.y = 1.5f * sinf(2.0f * (float)M_PI * 0.5f * t) + 0.01f * bench_randf(&seed);
+		s->gyro.z = 0.1f * sinf(2.0f * (float)M_PI * 0.2f * t) + 0.01f * bench_randf(&seed);
+
+		float len = ovec3f_get_length(&s->gyro);
+		if(len > 0.0f){
+			quatf delta;
+			oquatf_init_axis(&delta, &s->gyro, len * dt);
+			oquatf_mult_me(&orient, &delta);
+			oquatf_normalize_me(&orient);
+		}
+
+		// gravity as seen from the device frame
+		quatf inv = orient;
+		oquatf_inverse(&inv);
+		oquatf_get_rotated(&inv, &gravity, &s->accel);
+		for(int j = 0; j < 3; j++)
+			s->accel.arr[j] += 0.05f * bench_randf(&seed);
+
+		s->mag.x = s->mag.y = s->mag.z = 0.0f;
+		s->dt = dt;
+	}
+}
+
+#define Bench(_b) bench_run(#_b, _b)
+
+int main(int argc, char** argv)
+{
+	if(argc > 1)
+		bench_filter = argv[1];
+
+	printf("omath benchmarks\n");
+	Bench(bench_oquatf_mult);
+	Bench(bench_oquatf_get_rotated);
+	Bench(bench_oquatf_normalize_me);
+	Bench(bench_omat4x4f_mult);
+	Bench(bench_omat4x4f_transpose);
+	Bench(bench_omat4x4f_init_look_at);
+	Bench(bench_ofq_add);
+	Bench(bench_ofq_get_mean);
+	printf("\n");
+
+	printf("fusion benchmarks\n");
+	Bench(bench_ofusion_update);
+	Bench(bench_ofusion_update_batch_1);
+	Bench(bench_ofusion_update_batch_2);
+	Bench(bench_ofusion_update_batch_4);
+	Bench(bench_ofusion_complementary);
+	Bench(bench_ofusion_mahony);
+	Bench(bench_ofusion_madgwick);
+	Bench(bench_ofusion_fixed_complementary);
+	Bench(bench_ofusion_fixed_mahony);
+	Bench(bench_ofusion_fixed_madgwick);
+	Bench(bench_ofusion_trackers_4);
+	Bench(bench_ofusion_trackers_64);
+	Bench(bench_ofusion_trackers_256);
+	Bench(bench_ofusion_group_4);
+	Bench(bench_ofusion_group_64);
+	Bench(bench_ofusion_group_256);
+	printf("\n");
+
+	printf("fusion convergence\n");
+	bench_fusion_convergence();
+	printf("\n");
+
+	printf("decoder benchmarks\n");
+#if DRIVER_OCULUS_RIFT
+	bench_decode_rift();
+#endif
+#if DRIVER_OCULUS_RIFT_S
+	bench_decode_rift_s();
+#endif
+#if DRIVER_HTC_VIVE
+	bench_decode_vive();
+#endif
+#if DRIVER_WMR
+	bench_decode_wmr();
+#endif
+#if DRIVER_PSVR
+	bench_decode_psvr();
+#endif
+#if DRIVER_NOLO
+	bench_decode_nolo();
+#endif
+	printf("\n");
+
+	printf("api contention benchmarks\n");
+	bench_contention();
+	printf("\n");
+
+	return bench_failures ? 1 : 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Math */
+
+#include "bench.h"
+
+// power of two, inputs are picked with (i & INPUT_MASK)
+#define INPUT_COUNT 1024
+#define INPUT_MASK (INPUT_COUNT - 1)
+
+static quatf quat_inputs[INPUT_COUNT];
+static vec3f vec_inputs[INPUT_COUNT];
+static mat4x4f mat_inputs[INPUT_COUNT];
+static bool inputs_ready;
+
+static void init_inputs()
+{
+	if(inputs_ready)
+		return;
+
+	unsigned int seed = 0x4f484d44;
+
+	for(int i = 0; i < INPUT_COUNT; i++){
+		for(int j = 0; j < 4; j++)
+			quat_inputs[i].arr[j] = bench_randf(&seed);
+		oquatf_normalize_me(&quat_inputs[i]);
+
+		for(int j = 0; j < 3; j++)
+			vec_inputs[i].arr[j] = 10.0f * bench_randf(&seed);
+
+		for(int j = 0; j < 16; j++)
+			mat_inputs[i].arr[j] = bench_randf(&seed);
+	}
+
+	inputs_ready = true;
+}
+
+void bench_oquatf_mult(int iterations)
+{
+	init_inputs();
+
+	float sum = 0;
+	for(int i = 0; i < iterations; i++){
+		quatf out;
+		oquatf_mult(&quat_inputs[i & INPUT_MASK], &quat_inputs[(i + 1) & INPUT_MASK], &out);
+		sum += out.w;
+	}
+
+	bench_sink = sum;
+}
+
+void bench_oquatf_get_rotated(int iterations)
+{
+	init_inputs();
+
+	float sum = 0;
+	for(int i = 0; i < iterations; i++){
+		vec3f out;
+		oquatf_get_rotated(&quat_inputs[i & INPUT_MASK], &vec_inputs[(i + 1) & INPUT_MASK], &out);
+		sum += out.x;
+	}
+
+	bench_sink = sum;
+}
+
+void bench_oquatf_normalize_me(int iterations)
+{
+	init_inputs();
+
+	float sum = 0;
+	for(int i = 0; i < iterations; i++){
+		quatf q = quat_inputs[i & INPUT_MASK];
+		oquatf_normalize_me(&q);
+		sum += q.w;
+	}
+
+	bench_sink = sum;
+}
+
+void bench_omat4x4f_mult(int iterations)
+{
+	init_inputs();
+
+	float sum = 0;
+	for(int i = 0; i < iterations; i++){
+		mat4x4f out;
+		omat4x4f_mult(&mat_inputs[i & INPUT_MASK], &mat_inputs[(i + 1) & INPUT_MASK], &out);
+		sum += out.m[3][3];
+	}
+
+	bench_sink = sum;
+}
+
+void bench_omat4x4f_transpose(int iterations)
+{
+	init_inputs();
+
+	float sum = 0;
+	for(int i = 0; i < iterations; i++){
+		mat4x4f out;
+		omat4x4f_transpose(&mat_inputs[i & INPUT_MASK], &out);
+		sum += out.m[3][0];
+	}
+
+	bench_sink = sum;
+}
+
+void bench_omat4x4f_init_look_at(int iterations)
+{
+	init_inputs();
+
+	float sum = 0;
+	for(int i = 0; i < iterations; i++){
+		mat4x4f out;
+		omat4x4f_init_look_at(&out, &quat_inputs[i & INPUT_MASK], &vec_inputs[i & INPUT_MASK]);
+		sum += out.m[3][0];
+	}
+
+	bench_sink = sum;
+}
+
+void bench_ofq_add(int iterations)
+{
+	init_inputs();
+
+	// same queue length as the fusion filters
+	filter_queue fq;
+	vec3f elems[20];
+	ofq_init(&fq, elems, 20);
+
+	for(int i = 0; i < iterations; i++)
+		ofq_add(&fq, &vec_inputs[i & INPUT_MASK]);
+
+	bench_sink = fq.sum.x;
+}
+
+void bench_ofq_get_mean(int iterations)
+{
+	init_inputs();
+
+	filter_queue fq;
+	vec3f elems[20];
+	ofq_init(&fq, elems, 20);
+	for(int i = 0; i < 20; i++)
+		ofq_add(&fq, &vec_inputs[i]);
+
+	float sum = 0;
+	for(int i = 0; i < iterations; i++){
+		vec3f mean;
+		ofq_get_mean(&fq, &mean);
+		sum += mean.x;
+	}
+
+	bench_sink = sum;
+}
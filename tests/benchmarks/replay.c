@@ -0,0 +1,381 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Capture Replay */
+
+// Builds a HID capture per headset and replays it through the real driver
+// and sensor fusion code as fast as possible, reporting input reports/s.
+// Headsets with a simulated device get their init handshake recorded from
+// it, the others only need the devices to be present. The driver's input
+// interface then gets the decoder corpus, cycled to a fixed report count.
+//
+// Each capture is replayed fast twice and once stepwise, and the final
+// orientations and sample times have to match exactly, so the benchmark fails
+// if replaying is not deterministic. With "paced" on the command line the captures are also
+// replayed with their recorded timing, which takes a few seconds each. "keep"
+// leaves the captures in the working directory, e.g. for openhmd_replay.
+//
+// usage: openhmd_bench_replay [filter] [paced] [keep]
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "hid.h"
+#include "hid-capture.h"
+#include "simhid.h"
+
+#define REPLAY_REPORTS 8192
+#define REPLAY_PACED_REPORTS 2000
+#define REPLAY_INTERVAL_NS 1000000
+
+typedef struct {
+	unsigned short vendor_id, product_id;
+	int interface_number;
+	const wchar_t* manufacturer;
+	const wchar_t* product;
+} replay_interface;
+
+typedef struct {
+	const char* name;
+	const char* driver;
+	// registers the simulated device to record the handshake from, or NULL
+	// to only write open records for the interfaces
+	void (*register_devices)(void);
+	const replay_interface* interfaces;
+	int num_interfaces;
+	// the interface the corpus is fed to
+	replay_interface input;
+	const bench_corpus* corpus;
+} replay_scenario;
+
+#if DRIVER_PSVR
+static const replay_interface psvr_interfaces[] = {
+	{ 0x054c, 0x09af, 4, L"Sony", L"PS VR" },
+	{ 0x054c, 0x09af, 5, L"Sony", L"PS VR" },
+};
+#endif
+
+#if DRIVER_NOLO
+static const replay_interface nolo_interfaces[] = {
+	{ 0x28e9, 0x028a, 0, L"LYRobotix", L"NOLO HMD" },
+};
+#endif
+
+static const replay_scenario scenarios[] = {
+#if DRIVER_OCULUS_RIFT
+	{ "Rift CV1", "OpenHMD Rift Driver", sim_register_rift_cv1, NULL, 0,
+		{ 0x2833, 0x0031, 0 }, &bench_corpus_rift_dk2 },
+#endif
+#if DRIVER_OCULUS_RIFT_S
+	{ "Rift S", "OpenHMD Rift Driver", sim_register_rift_s, NULL, 0,
+		{ 0x2833, 0x0051, 6 }, &bench_corpus_rift_s_hmd },
+#endif
+#if DRIVER_HTC_VIVE
+	{ "HTC Vive", "OpenHMD HTC Vive Driver", sim_register_vive, NULL, 0,
+		{ 0x28de, 0x2000, 0 }, &bench_corpus_vive },
+#endif
+#if DRIVER_WMR
+	{ "Windows Mixed Reality", "OpenHMD Windows Mixed Reality Driver", sim_register_wmr, NULL, 0,
+		{ 0x045e, 0x0659, -1 }, &bench_corpus_wmr },
+#endif
+#if DRIVER_PSVR
+	{ "PSVR", "OpenHMD Sony PSVR Driver", NULL, psvr_interfaces, 2,
+		{ 0x054c, 0x09af, 4 }, &bench_corpus_psvr },
+#endif
+#if DRIVER_NOLO
+	{ "NOLO CV1", "OpenHMD NOLO VR CV1 driver", NULL, nolo_interfaces, 1,
+		{ 0x28e9, 0x028a, 0 }, &bench_corpus_nolo },
+#endif
+};
+
+static bool write_record(FILE* f, uint16_t interface, capture_record_type type, uint64_t timestamp,
+	int result, const unsigned char* data, uint32_t size)
+{
+	unsigned char header[CAPTURE_RECORD_HEADER_SIZE];
+	capture_record rec = { size, interface, (uint8_t)type, CAPTURE_TO_HOST, timestamp, result };
+
+	capture_write_record_header(header, &rec);
+
+	return fwrite(header, 1, sizeof(header), f) == sizeof(header) &&
+		(size == 0 || fwrite(data, 1, size, f) == size);
+}
+
+static void to_utf8(char* dst, const wchar_t* src)
+{
+	// the scenario strings are ASCII
+	int i = 0;
+	for(; src && src[i] && i < CAPTURE_STRING_SIZE - 1; i++)
+		dst[i] = (char)src[i];
+	dst[i] = 0;
+}
+
+// Records the handshake of the simulated device, leaving the devices open
+// so the capture has no close records and more input can be appended.
+static bool record_handshake(const replay_scenario* sc, const char* path)
+{
+	sim_clear();
+	sc->register_devices();
+	sim_set_transfer_ns(0);
+
+	ohmd_context* ctx = ohmd_ctx_create();
+	ctx->hid_transport = &ohmd_hid_transport_hidapi;
+
+	if(ohmd_ctx_record_hid(ctx, path) != OHMD_S_OK){
+		ohmd_ctx_destroy(ctx);
+		return false;
+	}
+
+	int num_devices = ohmd_ctx_probe(ctx);
+	ohmd_device_settings* settings = ohmd_device_settings_create(ctx);
+	int auto_update = 0;
+	int opened = 0;
+
+	ohmd_device_settings_seti(settings, OHMD_IDS_AUTOMATIC_UPDATE, &auto_update);
+
+	for(int i = 0; i < num_devices; i++){
+		if(strcmp(ctx->list.devices[i].driver, sc->driver) == 0 && ohmd_list_open_device_s(ctx, i, settings))
+			opened++;
+	}
+
+	ohmd_device_settings_destroy(settings);
+
+	ohmd_ctx_update(ctx);
+	ohmd_ctx_record_hid(ctx, NULL);
+	ohmd_ctx_destroy(ctx);
+
+	return opened > 0;
+}
+
+static bool write_opens(const replay_scenario* sc, const char* path)
+{
+	FILE* f = fopen(path, "wb");
+	if(!f)
+		return false;
+
+	unsigned char header[CAPTURE_FILE_HEADER_SIZE];
+	memcpy(header, CAPTURE_MAGIC, CAPTURE_MAGIC_SIZE);
+	capture_put_u32(header + CAPTURE_MAGIC_SIZE, CAPTURE_VERSION);
+	bool ok = fwrite(header, 1, sizeof(header), f) == sizeof(header);
+
+	for(int i = 0; ok && i < sc->num_interfaces; i++){
+		const replay_interface* iface = &sc->interfaces[i];
+		capture_device desc;
+		unsigned char payload[CAPTURE_DEVICE_MAX_SIZE];
+
+		memset(&desc, 0, sizeof(desc));
+		desc.vendor_id = iface->vendor_id;
+		desc.product_id = iface->product_id;
+		desc.interface_number = iface->interface_number;
+		snprintf(desc.path, sizeof(desc.path), "replay:%d", i);
+		to_utf8(desc.manufacturer, iface->manufacturer);
+		to_utf8(desc.product, iface->product);
+		snprintf(desc.serial_number, sizeof(desc.serial_number), "REPLAY%04d", i);
+
+		ok = write_record(f, i, CAPTURE_OPEN, 0, 0, payload, capture_write_device(payload, &desc));
+	}
+
+	return fclose(f) == 0 && ok;
+}
+
+// Appends the corpus to the last open of the input interface.
+static bool append_input(const replay_scenario* sc, const char* path, int num_reports)
+{
+	size_t size;
+	const unsigned char* data = ohmd_map_file(path, &size);
+	int interface = -1;
+	uint64_t timestamp = 0;
+
+	if(!data)
+		return false;
+
+	for(size_t pos = CAPTURE_FILE_HEADER_SIZE; pos + CAPTURE_RECORD_HEADER_SIZE <= size;){
+		capture_record rec;
+		capture_device desc;
+
+		capture_read_record_header(data + pos, &rec);
+
+		if(rec.type == CAPTURE_OPEN && capture_read_device(data + pos + CAPTURE_RECORD_HEADER_SIZE, rec.size, &desc) &&
+		   desc.vendor_id == sc->input.vendor_id && desc.product_id == sc->input.product_id &&
+		   (sc->input.interface_number == -1 || desc.interface_number == sc->input.interface_number))
+			interface = rec.interface;
+
+		timestamp = OHMD_MAX(timestamp, rec.timestamp);
+		pos += CAPTURE_RECORD_HEADER_SIZE + rec.size;
+	}
+
+	ohmd_unmap_file(data, size);
+
+	FILE* f = fopen(path, "ab");
+	if(interface < 0 || !f){
+		if(f)
+			fclose(f);
+		return false;
+	}
+
+	const bench_corpus* corpus = sc->corpus;
+	bool ok = true;
+
+	for(int i = 0; ok && i < num_reports; i++){
+		timestamp += REPLAY_INTERVAL_NS;
+		ok = write_record(f, interface, CAPTURE_INPUT, timestamp, corpus->report_size,
+			corpus->data + (i % corpus->count) * corpus->report_size, corpus->report_size);
+	}
+
+	return fclose(f) == 0 && ok;
+}
+
+static bool build_capture(const replay_scenario* sc, const char* path, int num_reports)
+{
+	if(sc->register_devices ? !record_handshake(sc, path) : !write_opens(sc, path))
+		return false;
+
+	return append_input(sc, path, num_reports);
+}
+
+typedef struct {
+	uint64_t open_ns;
+	uint64_t replay_ns;
+	int reports;
+	quatf rotation;
+	int64_t sample_ns;
+} replay_result;
+
+static bool replay_run(const replay_scenario* sc, const char* path, ohmd_replay_mode mode, replay_result* res)
+{
+	uint64_t start = bench_now_ns();
+	ohmd_context* ctx = ohmd_ctx_create();
+
+	if(ohmd_ctx_replay_hid(ctx, path, mode) != OHMD_S_OK){
+		ohmd_ctx_destroy(ctx);
+		return false;
+	}
+
+	int num_devices = ohmd_ctx_probe(ctx);
+	ohmd_device_settings* settings = ohmd_device_settings_create(ctx);
+	ohmd_device* hmd = NULL;
+	int auto_update = 0;
+
+	ohmd_device_settings_seti(settings, OHMD_IDS_AUTOMATIC_UPDATE, &auto_update);
+
+	for(int i = 0; i < num_devices; i++){
+		if(strcmp(ctx->list.devices[i].driver, sc->driver) != 0)
+			continue;
+
+		ohmd_device* dev = ohmd_list_open_device_s(ctx, i, settings);
+		if(!hmd)
+			hmd = dev;
+	}
+
+	ohmd_device_settings_destroy(settings);
+
+	if(!hmd){
+		ohmd_ctx_destroy(ctx);
+		return false;
+	}
+
+	res->reports = ohmd_ctx_replay_hid_pending(ctx);
+	res->open_ns = bench_now_ns() - start;
+
+	start = bench_now_ns();
+	if(mode == OHMD_REPLAY_STEPPED){
+		while(ohmd_ctx_replay_hid_step(ctx) >= 0)
+			ohmd_ctx_update(ctx);
+	}else{
+		while(ohmd_ctx_replay_hid_pending(ctx) > 0)
+			ohmd_ctx_update(ctx);
+	}
+	res->replay_ns = bench_now_ns() - start;
+
+	ohmd_device_getf(hmd, OHMD_ROTATION_QUAT, (float*)&res->rotation);
+	if(ohmd_device_get_sample_time(hmd, &res->sample_ns) != OHMD_S_OK)
+		res->sample_ns = -1;
+	ohmd_ctx_destroy(ctx);
+
+	return true;
+}
+
+static bool replay_bench(const replay_scenario* sc, bool paced, bool keep)
+{
+	char path[64];
+	replay_result runs[2], stepped;
+
+	snprintf(path, sizeof(path), "openhmd_bench_replay_%d.ohmdhid", (int)(sc - scenarios));
+
+	if(!build_capture(sc, path, REPLAY_REPORTS)){
+		printf("%s: FAILED to build the capture\n", sc->name);
+		remove(path);
+		return false;
+	}
+
+	bool ok = replay_run(sc, path, OHMD_REPLAY_FAST, &runs[0]) && replay_run(sc, path, OHMD_REPLAY_FAST, &runs[1]) &&
+		replay_run(sc, path, OHMD_REPLAY_STEPPED, &stepped);
+	if(!keep)
+		remove(path);
+
+	if(!ok){
+		printf("%s: FAILED to replay the capture\n", sc->name);
+		return false;
+	}
+
+	bool deterministic = memcmp(&runs[0].rotation, &runs[1].rotation, sizeof(quatf)) == 0 &&
+		memcmp(&runs[0].rotation, &stepped.rotation, sizeof(quatf)) == 0 &&
+		runs[0].sample_ns > 0 && runs[0].sample_ns == runs[1].sample_ns && runs[0].sample_ns == stepped.sample_ns;
+	const char* outcome = deterministic ? "reproduced" : "MISMATCH";
+
+	printf("%s\n", sc->name);
+	printf("  %-32s %10.3f ms\n", "index, probe and open", runs[1].open_ns / 1e6);
+	printf("  %-32s %10.3f ms %14.0f reports/s\n", "replay (fast)", runs[1].replay_ns / 1e6,
+		runs[1].reports / (runs[1].replay_ns / 1e9));
+	printf("  %-32s %10.3f ms %14.0f reports/s\n", "replay (stepped)", stepped.replay_ns / 1e6,
+		stepped.reports / (stepped.replay_ns / 1e9));
+	printf("  %-32s %s (%f %f %f %f)\n", "final orientation", outcome,
+		runs[1].rotation.x, runs[1].rotation.y, runs[1].rotation.z, runs[1].rotation.w);
+	printf("  %-32s %10.3f ms on the capture clock\n", "last sample time", runs[1].sample_ns / 1e6);
+
+	if(paced){
+		replay_result res;
+
+		ok = build_capture(sc, path, REPLAY_PACED_REPORTS) && replay_run(sc, path, OHMD_REPLAY_PACED, &res);
+		remove(path);
+
+		if(ok){
+			printf("  %-32s %10.3f ms for %.3f ms of recorded input\n", "replay (paced)", res.replay_ns / 1e6,
+				REPLAY_PACED_REPORTS * REPLAY_INTERVAL_NS / 1e6);
+		}else{
+			printf("  replay (paced) FAILED\n");
+		}
+	}
+
+	printf("\n");
+
+	return ok && deterministic;
+}
+
+int main(int argc, char** argv)
+{
+	const char* filter = NULL;
+	bool paced = false, keep = false;
+	bool ok = true;
+
+	for(int i = 1; i < argc; i++){
+		if(strcmp(argv[i], "paced") == 0)
+			paced = true;
+		else if(strcmp(argv[i], "keep") == 0)
+			keep = true;
+		else
+			filter = argv[i];
+	}
+
+	printf("OpenHMD capture replay benchmarks, %d input reports per capture\n\n", REPLAY_REPORTS);
+
+	for(size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++){
+		if(filter && !strstr(scenarios[i].name, filter))
+			continue;
+		ok = replay_bench(&scenarios[i], paced, keep) && ok;
+	}
+
+	return ok ? 0 : 1;
+}
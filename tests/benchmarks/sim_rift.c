@@ -0,0 +1,265 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Simulated Oculus Rift CV1 */
+
+// Interface 0 is the HMD with its sensor configuration, LED model and the
+// radio address, interface 1 is the radio the touch controllers talk through.
+// The controllers' calibration JSON is read from their flash 20 bytes at a
+// time through radio commands the first time the driver sees them.
+
+#include <string.h>
+
+#include "bench.h"
+#include "simhid.h"
+
+#define RIFT_NUM_LEDS 44
+#define RIFT_FLASH_SIZE 0x1c00
+#define RIFT_FLASH_HASH 0x1bf0
+
+typedef struct {
+	unsigned char sensor_config[7];
+	int position_index, pattern_index;
+
+	// last radio command and how many more polls report it busy
+	unsigned char radio_cmd[3];
+	int radio_busy;
+	uint16_t read_offset, read_length;
+} rift_iface;
+
+static sim_device hmd, radio;
+static rift_iface hmd_iface, radio_iface;
+static unsigned char touch_flash[RIFT_FLASH_SIZE];
+
+static void write16(unsigned char* p, int v)
+{
+	p[0] = v & 0xff;
+	p[1] = (v >> 8) & 0xff;
+}
+
+static void write32(unsigned char* p, int32_t v)
+{
+	write16(p, v & 0xffff);
+	write16(p + 2, (v >> 16) & 0xffff);
+}
+
+static int position_info(unsigned char* buf, int index)
+{
+	memset(buf, 0, 30);
+	buf[0] = 0x0f;
+
+	if(index == RIFT_NUM_LEDS){
+		// the IMU comes last, its position is reported as zero
+		buf[3] = 1;
+	}else{
+		// LEDs spread over the front and sides of the headset, in micrometers
+		float angle = (index - RIFT_NUM_LEDS / 2) * (float)M_PI / RIFT_NUM_LEDS;
+		buf[3] = 2;
+		write32(buf + 4, (int32_t)(90000 * sinf(angle)));
+		write32(buf + 8, (int32_t)(((index % 5) - 2) * 15000));
+		write32(buf + 12, (int32_t)(-90000 * cosf(angle)));
+		write16(buf + 16, (int)(10000 * sinf(angle)));
+		write16(buf + 18, 0);
+		write16(buf + 20, (int)(-10000 * cosf(angle)));
+	}
+
+	buf[24] = index;
+	buf[26] = RIFT_NUM_LEDS;
+
+	return 30;
+}
+
+static int pattern_info(unsigned char* buf, int index)
+{
+	// 10 two bit symbols, each 1 (dark) or 3 (bright)
+	int32_t pattern = 0x55555;
+	int code = (index * 0x2a5 + 0x133) & 0x3ff;
+	for(int i = 0; i < 10; i++)
+		if(code & (1 << i))
+			pattern |= 2 << (2 * i);
+
+	memset(buf, 0, 12);
+	buf[0] = 0x10;
+	buf[3] = 10;
+	write32(buf + 4, pattern);
+	write16(buf + 8, index);
+	write16(buf + 10, RIFT_NUM_LEDS);
+
+	return 12;
+}
+
+static int get_feature(sim_device* dev, unsigned char* buf, size_t length)
+{
+	rift_iface* s = (rift_iface*)dev->priv;
+	(void)length;
+
+	switch(buf[0]){
+	case 0x02: // sensor config
+		memcpy(buf, s->sensor_config, 7);
+		return 7;
+
+	case 0x04: // range
+		memset(buf, 0, 8);
+		buf[0] = 0x04;
+		buf[3] = 4;
+		write16(buf + 4, 2000);
+		write16(buf + 6, 4000);
+		return 8;
+
+	case 0x09: // display info
+		memset(buf, 0, 56);
+		buf[0] = 0x09;
+		buf[3] = 1;
+		write16(buf + 4, 2160);
+		write16(buf + 6, 1200);
+		write32(buf + 8, 133920);
+		write32(buf + 12, 74400);
+		write32(buf + 16, 37200);
+		write32(buf + 20, 63500);
+		write32(buf + 24, 37700);
+		write32(buf + 28, 37700);
+		return 56;
+
+	case 0x0f: { // position info, one LED per read, round robin
+		int size = position_info(buf, s->position_index);
+		s->position_index = (s->position_index + 1) % (RIFT_NUM_LEDS + 1);
+		return size;
+	}
+
+	case 0x10: { // LED pattern, one LED per read, round robin
+		int size = pattern_info(buf, s->pattern_index);
+		s->pattern_index = (s->pattern_index + 1) % RIFT_NUM_LEDS;
+		return size;
+	}
+
+	case 0x1a: // radio command status
+		memset(buf, 0, 6);
+		buf[0] = 0x1a;
+		if(s->radio_busy > 0){
+			buf[3] = 0x80;
+			s->radio_busy--;
+		}
+		return 6;
+
+	case 0x1b: // radio data, the result of the last radio command
+		memset(buf, 0, 31);
+		buf[0] = 0x1b;
+		if(s->radio_cmd[0] == 0x05){
+			static const unsigned char address[5] = { 0x3e, 0x5a, 0x21, 0x9c, 0x07 };
+			memcpy(buf + 3, address, 5);
+		}else if(s->radio_cmd[0] == 0x03 && s->read_offset + s->read_length <= RIFT_FLASH_SIZE){
+			memcpy(buf + 7, touch_flash + s->read_offset, OHMD_MIN(s->read_length, 24));
+		}
+		return 31;
+
+	default:
+		return -1;
+	}
+}
+
+static int send_feature(sim_device* dev, const unsigned char* buf, size_t length)
+{
+	rift_iface* s = (rift_iface*)dev->priv;
+
+	switch(buf[0]){
+	case 0x02:
+		memcpy(s->sensor_config, buf, 7);
+		break;
+
+	case 0x1a:
+		// each command makes a round trip over the air, the first poll sees it busy
+		memcpy(s->radio_cmd, buf + 3, 3);
+		s->radio_busy = 1;
+		break;
+
+	case 0x1b:
+		s->read_offset = buf[3] | (buf[4] << 8);
+		s->read_length = buf[5] | (buf[6] << 8);
+		break;
+	}
+
+	return (int)length;
+}
+
+static const sim_device_ops rift_ops = { get_feature, send_feature, NULL };
+
+static void build_touch_flash(void)
+{
+	char json[4096];
+	int len = 0;
+
+	len += snprintf(json + len, sizeof(json) - len,
+		"{\"TrackedObject\":{\"FlexVersion\":1,\"JsonVersion\":2,\"ImuPosition\":[0.002514,-0.011012,-0.051310],"
+		"\"JoyXRangeMin\":-128,\"JoyXRangeMax\":127,\"JoyXDeadMin\":-12,\"JoyXDeadMax\":12,"
+		"\"JoyYRangeMin\":-128,\"JoyYRangeMax\":127,\"JoyYDeadMin\":-12,\"JoyYDeadMax\":12,"
+		"\"TriggerMinRange\":16,\"TriggerMidRange\":512,\"TriggerMaxRange\":1008,"
+		"\"GyroCalibration\":[1.000312,0.001211,-0.000853,-0.001172,0.999804,0.000446,0.000812,-0.000431,1.000122,0.003117,-0.002214,0.001046],"
+		"\"MiddleMinRange\":20,\"MiddleMidRange\":520,\"MiddleMaxRange\":1012,\"MiddleFlipped\":0,"
+		"\"AccCalibration\":[0.998722,0.000913,-0.001417,-0.000887,1.001116,0.000213,0.001402,-0.000224,0.999531,0.041231,-0.022137,0.013542],"
+		"\"CapSenseMin\":[120,118,122,130,127,119,121,125],\"CapSenseTouch\":[560,548,572,601,590,553,566,579],"
+		"\"ModelPoints\":{");
+
+	// the LED model, which makes up most of the calibration data
+	for(int i = 0; i < 22; i++){
+		float a = i * 2.0f * (float)M_PI / 22;
+		len += snprintf(json + len, sizeof(json) - len,
+			"%s\"Point%d\":[%.6f,%.6f,%.6f,%.6f,%.6f,%.6f]", i ? "," : "", i,
+			0.045f * cosf(a), 0.012f * sinf(3 * a), 0.045f * sinf(a), cosf(a), 0.0f, sinf(a));
+	}
+	len += snprintf(json + len, sizeof(json) - len, "}}}");
+
+	memset(touch_flash, 0xff, sizeof(touch_flash));
+	touch_flash[0] = 1;
+	touch_flash[1] = 0;
+	write16(touch_flash + 2, len);
+	memcpy(touch_flash + 4, json, len);
+	memset(touch_flash + RIFT_FLASH_HASH, 0x5a, 16);
+}
+
+static void touch_message(unsigned char* buf, int device_type, uint32_t timestamp)
+{
+	write16(buf, 0x1c);
+	buf[2] = device_type;
+	write32(buf + 3, timestamp);
+	write16(buf + 7, 12);
+	write16(buf + 9, -20);
+	write16(buf + 11, 2048); // 1 g
+	write16(buf + 13, 3);
+	write16(buf + 15, -2);
+	write16(buf + 17, 1);
+}
+
+void sim_register_rift_cv1(void)
+{
+	memset(&hmd, 0, sizeof(hmd));
+	memset(&radio, 0, sizeof(radio));
+	memset(&hmd_iface, 0, sizeof(hmd_iface));
+	memset(&radio_iface, 0, sizeof(radio_iface));
+
+	static const unsigned char default_config[7] = { 0x02, 0, 0, 0x20, 0, 0xe8, 0x03 };
+	memcpy(hmd_iface.sensor_config, default_config, 7);
+
+	build_touch_flash();
+
+	sim_device* ifaces[2] = { &hmd, &radio };
+	rift_iface* state[2] = { &hmd_iface, &radio_iface };
+	for(int i = 0; i < 2; i++){
+		ifaces[i]->vendor_id = 0x2833;
+		ifaces[i]->product_id = 0x0031;
+		ifaces[i]->interface_number = i;
+		ifaces[i]->manufacturer = L"Oculus VR, Inc.";
+		ifaces[i]->product = L"Rift";
+		ifaces[i]->serial = L"WMHD30000000SIM";
+		ifaces[i]->ops = &rift_ops;
+		ifaces[i]->priv = state[i];
+		sim_register(ifaces[i]);
+	}
+
+	// both controllers report in, which makes the driver fetch their calibration
+	unsigned char report[64] = { 0x0c };
+	touch_message(report + 3, 3, 1000);
+	touch_message(report + 31, 2, 1000);
+	sim_queue_input(&radio, report, sizeof(report));
+}
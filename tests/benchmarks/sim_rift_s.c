@@ -0,0 +1,173 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Simulated Oculus Rift S */
+
+// The HMD interface answers the device info, IMU config and firmware block
+// reads the driver makes on open. Firmware blocks are read through report
+// 0x4a, 56 bytes at a time. The simulated firmware answers the first poll of
+// each read with busy, so the driver's retry path (and its 2 ms sleep) is part
+// of the measurement. The controllers' radio configuration is not simulated.
+
+#include <string.h>
+
+#include "bench.h"
+#include "simhid.h"
+
+#define RIFT_S_IMU_CALIB_BLOCK 0x0e
+#define RIFT_S_BLOCK_HEADER 12
+
+static sim_device hmd, status, controllers;
+
+static unsigned char imu_calib_block[4096];
+static uint32_t imu_calib_size;
+
+static unsigned char fw_request[8];
+static int fw_busy;
+
+static void write_u32(unsigned char* p, uint32_t v)
+{
+	memcpy(p, &v, 4); // the device and the driver are both little endian
+}
+
+static int get_feature(sim_device* dev, unsigned char* buf, size_t length)
+{
+	(void)dev;
+	(void)length;
+
+	switch(buf[0]){
+	case 0x01:
+		memset(buf + 1, 0, 42);
+		return 43;
+
+	case 0x06: { // device info
+		memset(buf, 0, 22);
+		buf[0] = 0x06;
+		uint16_t v_res = 1440, h_res = 2560;
+		memcpy(buf + 1, &v_res, 2);
+		memcpy(buf + 3, &h_res, 2);
+		buf[7] = 80;
+		return 22;
+	}
+
+	case 0x09: { // IMU config
+		uint32_t imu_hz = 1000;
+		float scales[4] = { 16.384f, 2048.0f, 333.87f, 21.0f };
+		buf[0] = 0x09;
+		memcpy(buf + 1, &imu_hz, 4);
+		memcpy(buf + 5, scales, sizeof(scales));
+		return 21;
+	}
+
+	case 0x0c: // no controllers paired
+		buf[1] = buf[2] = 0;
+		return 3;
+
+	case 0x4a: { // firmware block read
+		memset(buf, 0, 64);
+		buf[0] = 0x4a;
+
+		if(fw_busy){
+			buf[1] = 0x01;
+			fw_busy = 0;
+			return 64;
+		}
+
+		memcpy(buf, fw_request, 8);
+
+		uint32_t pos, len = fw_request[7];
+		memcpy(&pos, fw_request + 3, 4);
+
+		if(fw_request[2] == RIFT_S_IMU_CALIB_BLOCK){
+			if(pos + len <= imu_calib_size)
+				memcpy(buf + 8, imu_calib_block + pos, len);
+		}else if(pos == 0){
+			write_u32(buf + 16, 0xffffffff); // erased block
+		}
+		return 64;
+	}
+
+	default:
+		return -1;
+	}
+}
+
+static int send_feature(sim_device* dev, const unsigned char* buf, size_t length)
+{
+	(void)dev;
+
+	if(buf[0] == 0x4a){
+		memcpy(fw_request, buf, 8);
+		fw_busy = 1;
+	}
+
+	return (int)length;
+}
+
+static const sim_device_ops hmd_ops = { get_feature, send_feature, NULL };
+static const sim_device_ops other_ops = { NULL, NULL, NULL };
+
+// small fixed deviations from identity, like a factory calibration
+static double jitter(int* n, double scale)
+{
+	return scale * sin(++*n * 12.9898);
+}
+
+static void build_imu_calib_block(void)
+{
+	char* json = (char*)imu_calib_block + RIFT_S_BLOCK_HEADER;
+	size_t size = sizeof(imu_calib_block) - RIFT_S_BLOCK_HEADER;
+	int n = 0;
+	int len = 0;
+
+	len += snprintf(json + len, size - len,
+		"{\"FileFormat\":{\"Version\":\"1.0\",\"Date\":\"2019-04-02\"},"
+		"\"ImuCalibration\":{\"DeviceFromImu\":[");
+	for(int i = 0; i < 12; i++)
+		len += snprintf(json + len, size - len, "%s%.9f", i ? "," : "",
+			(i % 5 == 0 ? 1.0 : 0.0) + jitter(&n, 0.002));
+
+	len += snprintf(json + len, size - len, "],\"Gyroscope\":{\"RectificationMatrix\":[");
+	for(int i = 0; i < 9; i++)
+		len += snprintf(json + len, size - len, "%s%.9f", i ? "," : "",
+			(i % 4 == 0 ? 1.0 : 0.0) + jitter(&n, 0.004));
+	len += snprintf(json + len, size - len, "],\"Offset\":{\"Type\":\"Constant\",\"ConstantOffset\":[%.9f,%.9f,%.9f]}},",
+		jitter(&n, 0.01), jitter(&n, 0.01), jitter(&n, 0.01));
+
+	len += snprintf(json + len, size - len, "\"Accelerometer\":{\"RectificationMatrix\":[");
+	for(int i = 0; i < 9; i++)
+		len += snprintf(json + len, size - len, "%s%.9f", i ? "," : "",
+			(i % 4 == 0 ? 1.0 : 0.0) + jitter(&n, 0.004));
+	len += snprintf(json + len, size - len,
+		"],\"Offset\":{\"Type\":\"Linear\",\"OffsetAtZeroDegC\":[%.9f,%.9f,%.9f],"
+		"\"OffsetTemperatureCoefficient\":[%.9f,%.9f,%.9f]}}}}",
+		jitter(&n, 0.1), jitter(&n, 0.1), jitter(&n, 0.1),
+		jitter(&n, 0.001), jitter(&n, 0.001), jitter(&n, 0.001));
+
+	// 8 byte checksum then the size of the data
+	memset(imu_calib_block, 0xa5, 8);
+	write_u32(imu_calib_block + 8, len);
+	imu_calib_size = RIFT_S_BLOCK_HEADER + len;
+}
+
+void sim_register_rift_s(void)
+{
+	sim_device* ifaces[3] = { &hmd, &status, &controllers };
+
+	fw_busy = 0;
+	build_imu_calib_block();
+
+	for(int i = 0; i < 3; i++){
+		memset(ifaces[i], 0, sizeof(sim_device));
+		ifaces[i]->vendor_id = 0x2833;
+		ifaces[i]->product_id = 0x0051;
+		ifaces[i]->interface_number = 6 + i;
+		ifaces[i]->manufacturer = L"Oculus VR, Inc.";
+		ifaces[i]->product = L"Rift S";
+		ifaces[i]->serial = L"1WMHHA000SIM";
+		ifaces[i]->ops = i == 0 ? &hmd_ops : &other_ops;
+		sim_register(ifaces[i]);
+	}
+}
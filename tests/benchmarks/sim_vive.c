@@ -0,0 +1,149 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Simulated HTC Vive */
+
+// The HTC device only takes the display power reports. The IMU and the
+// factory configuration live on the first interface of the Valve lighthouse
+// FPGA device, the configuration is zlib compressed JSON read 62 bytes per
+// report, most of it the lighthouse sensor model.
+
+#include <string.h>
+
+#include "bench.h"
+#include "simhid.h"
+
+// miniz is built into the Vive driver (src/drv_htc_vive/packet.c)
+int mz_compress(unsigned char* pDest, unsigned long* pDest_len, const unsigned char* pSource, unsigned long source_len);
+
+#define VIVE_NUM_SENSORS 32
+
+static sim_device htc, imu, lighthouse;
+
+static unsigned char config[4096];
+static unsigned long config_size;
+static unsigned long config_offset;
+
+static int imu_get_feature(sim_device* dev, unsigned char* buf, size_t length)
+{
+	(void)dev;
+
+	unsigned char id = buf[0];
+	memset(buf, 0, OHMD_MIN(length, (size_t)64));
+	buf[0] = id;
+
+	switch(id){
+	case 0x01: // IMU range modes, 500 deg/s and 4 g
+		buf[1] = 1;
+		buf[2] = 1;
+		return 64;
+
+	case 0x05: // firmware version
+		buf[1] = 0xf5; buf[2] = 0x22; buf[3] = 0x2d; buf[4] = 0x57;
+		strcpy((char*)buf + 9, "vive_bridge");
+		strcpy((char*)buf + 25, "lighthouse_fpga");
+		buf[44] = 2; // hardware revision
+		buf[49] = 1; // FPGA version
+		buf[50] = 2;
+		return 64;
+
+	case 0x10: // config start
+		config_offset = 0;
+		return 64;
+
+	case 0x11: { // config read, 62 bytes a time until an empty report
+		int len = (int)OHMD_MIN(config_size - config_offset, 62ul);
+		buf[1] = len;
+		memcpy(buf + 2, config + config_offset, len);
+		config_offset += len;
+		return 64;
+	}
+
+	default:
+		return -1;
+	}
+}
+
+// accepts every report, answers no feature requests
+static const sim_device_ops plain_ops = { NULL, NULL, NULL };
+static const sim_device_ops imu_ops = { imu_get_feature, NULL, NULL };
+
+static void build_config(void)
+{
+	static char json[16384];
+	size_t size = sizeof(json);
+	int len = 0;
+
+	len += snprintf(json + len, size - len,
+		"{\n\t\"acc_bias\": [0.0312, -0.1425, 0.0823],\n"
+		"\t\"acc_scale\": [0.9981, 1.0012, 0.9995],\n"
+		"\t\"device\": {\n\t\t\"eye_target_height_in_pixels\": 1080,\n\t\t\"eye_target_width_in_pixels\": 1200,\n"
+		"\t\t\"first_eye\": \"eEYE_LEFT\",\n\t\t\"last_eye\": \"eEYE_RIGHT\",\n"
+		"\t\t\"num_windows\": 1,\n\t\t\"persistence\": 0.01666999980807304,\n"
+		"\t\t\"physical_aspect_x_over_y\": 0.8999999761581421\n\t},\n"
+		"\t\"device_class\": \"hmd\",\n\t\"device_pid\": 8192,\n"
+		"\t\"device_serial_number\": \"LHR-SIM00001\",\n\t\"device_vid\": 10462,\n"
+		"\t\"gyro_bias\": [-0.0042, 0.0117, 0.0021],\n"
+		"\t\"gyro_scale\": [1.0003, 0.9997, 1.0001],\n"
+		"\t\"imu\": {\n\t\t\"plus_x\": [1, 0, 0],\n\t\t\"plus_z\": [0, 0, 1],\n\t\t\"position\": [0.0386, -0.0242, 0.0171]\n\t},\n"
+		"\t\"lens_separation\": 0.06230000033974648,\n"
+		"\t\"lighthouse_config\": {\n\t\t\"channelMap\": [");
+
+	for(int i = 0; i < VIVE_NUM_SENSORS; i++)
+		len += snprintf(json + len, size - len, "%s%d", i ? ", " : "", (i * 7) % VIVE_NUM_SENSORS);
+
+	// sensors spread over the front and sides of the headset
+	len += snprintf(json + len, size - len, "],\n\t\t\"modelNormals\": [");
+	for(int i = 0; i < VIVE_NUM_SENSORS; i++){
+		float a = (i - VIVE_NUM_SENSORS / 2) * (float)M_PI / VIVE_NUM_SENSORS;
+		len += snprintf(json + len, size - len, "%s\n\t\t\t[%.9f, %.9f, %.9f]", i ? "," : "",
+			sinf(a), 0.3f * cosf(3 * a), -cosf(a));
+	}
+
+	len += snprintf(json + len, size - len, "\n\t\t],\n\t\t\"modelPoints\": [");
+	for(int i = 0; i < VIVE_NUM_SENSORS; i++){
+		float a = (i - VIVE_NUM_SENSORS / 2) * (float)M_PI / VIVE_NUM_SENSORS;
+		len += snprintf(json + len, size - len, "%s\n\t\t\t[%.9f, %.9f, %.9f]", i ? "," : "",
+			0.09f * sinf(a), 0.04f * ((i % 5) - 2) / 2.0f, -0.09f * cosf(a));
+	}
+
+	len += snprintf(json + len, size - len,
+		"\n\t\t]\n\t},\n\t\"manufacturer\": \"HTC\",\n\t\"mb_serial_number\": \"SIM000000001\",\n"
+		"\t\"model_number\": \"Vive MV\",\n\t\"revision\": 3\n}\n");
+
+	config_size = sizeof(config);
+	if(mz_compress(config, &config_size, (const unsigned char*)json, len) != 0)
+		config_size = 0;
+}
+
+void sim_register_vive(void)
+{
+	memset(&htc, 0, sizeof(htc));
+	memset(&imu, 0, sizeof(imu));
+	memset(&lighthouse, 0, sizeof(lighthouse));
+
+	build_config();
+	config_offset = 0;
+
+	htc.vendor_id = 0x0bb4;
+	htc.product_id = 0x2c87;
+	htc.manufacturer = L"HTC";
+	htc.product = L"HTC Vive";
+	htc.serial = L"SIM000000001";
+	htc.ops = &plain_ops;
+	sim_register(&htc);
+
+	sim_device* valve[2] = { &imu, &lighthouse };
+	for(int i = 0; i < 2; i++){
+		valve[i]->vendor_id = 0x28de;
+		valve[i]->product_id = 0x2000;
+		valve[i]->interface_number = i;
+		valve[i]->manufacturer = L"Valve";
+		valve[i]->product = L"Lighthouse FPGA RX";
+		valve[i]->serial = L"LHR-SIM00001";
+		valve[i]->ops = i == 0 ? &imu_ops : &plain_ops;
+		sim_register(valve[i]);
+	}
+}
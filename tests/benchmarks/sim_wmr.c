@@ -0,0 +1,184 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Simulated Windows Mixed Reality (HoloLens Sensors) */
+
+// The configuration store is read with output reports: 0x0b, the store to
+// read (0x06 metadata, 0x04 data), then 0x08 for every 30 byte chunk, each
+// answered with a 33 byte input report. The data holds a header and the
+// obfuscated calibration JSON with the display, camera and IMU models.
+
+#include <string.h>
+
+#include "bench.h"
+#include "simhid.h"
+
+// defined by the WMR driver (src/drv_wmr/config_key.h)
+extern const uint8_t wmr_config_key[0x400];
+
+#define WMR_JSON_START 0x400
+#define WMR_CHUNK 30
+
+static sim_device imu;
+
+static unsigned char meta[66];
+static unsigned char data[32768];
+static int data_size;
+
+static const unsigned char* store;
+static int store_size, store_offset;
+
+static void write_u32(unsigned char* p, uint32_t v)
+{
+	p[0] = v & 0xff;
+	p[1] = (v >> 8) & 0xff;
+	p[2] = (v >> 16) & 0xff;
+	p[3] = (v >> 24) & 0xff;
+}
+
+static int imu_write(sim_device* dev, const unsigned char* buf, size_t length)
+{
+	unsigned char response[33] = { 0x02 };
+
+	if(buf[0] != 0x02)
+		return (int)length;
+
+	switch(buf[1]){
+	case 0x0b:
+		break;
+
+	case 0x06:
+		store = meta;
+		store_size = sizeof(meta);
+		store_offset = 0;
+		break;
+
+	case 0x04:
+		store = data;
+		store_size = data_size;
+		store_offset = 0;
+		break;
+
+	case 0x08: {
+		int len = OHMD_MIN(store_size - store_offset, WMR_CHUNK);
+		if(len > 0){
+			response[1] = 0x01;
+			response[2] = len;
+			memcpy(response + 3, store + store_offset, len);
+			store_offset += len;
+		}else{
+			response[1] = 0x02;
+		}
+		break;
+	}
+
+	default:
+		// 0x07 turns the IMU on, nothing to answer
+		return (int)length;
+	}
+
+	sim_queue_input(dev, response, sizeof(response));
+
+	return (int)length;
+}
+
+static const sim_device_ops imu_ops = { NULL, NULL, imu_write };
+
+static int json_vec(char* out, size_t size, const char* name, int n, int seed)
+{
+	int len = snprintf(out, size, "\"%s\":[", name);
+	for(int i = 0; i < n; i++)
+		len += snprintf(out + len, size - len, "%s%.8f", i ? "," : "", 0.01 * sin((seed + i) * 12.9898));
+	len += snprintf(out + len, size - len, "]");
+	return len;
+}
+
+static void build_config(void)
+{
+	char* json = (char*)data + WMR_JSON_START + 2;
+	size_t size = sizeof(data) - WMR_JSON_START - 2 - 16;
+	int len = 0;
+
+	len += snprintf(json + len, size - len, "{\"CalibrationInformation\":{\"Displays\":[");
+	for(int i = 0; i < 2; i++){
+		len += snprintf(json + len, size - len,
+			"%s{\"AffineDistortion\":[1.0,0.0,0.0,1.0],\"DisplayHeight\":1440,\"DisplayWidth\":1440,"
+			"\"Location\":\"%s\",\"VisibleAreaCenter\":[720.0,720.0],\"VisibleAreaRadius\":720.0,", i ? "," : "", i ? "Right" : "Left");
+		const char* channels[3] = { "DistortionRed", "DistortionGreen", "DistortionBlue" };
+		for(int c = 0; c < 3; c++){
+			len += snprintf(json + len, size - len, "\"%s\":{\"ModelType\":\"Polynomial3K\",", channels[c]);
+			len += json_vec(json + len, size - len, "ModelParameters", 8, i * 31 + c * 7);
+			len += snprintf(json + len, size - len, "},");
+		}
+		len += json_vec(json + len, size - len, "Rt", 12, i * 17);
+		len += snprintf(json + len, size - len, "}");
+	}
+
+	len += snprintf(json + len, size - len, "],\"Cameras\":[");
+	for(int i = 0; i < 2; i++){
+		len += snprintf(json + len, size - len,
+			"%s{\"Location\":\"CAMERA_%s\",\"Purpose\":\"CALIBRATION_CameraPurposeHeadTracking\","
+			"\"SensorHeight\":480,\"SensorWidth\":640,\"Intrinsics\":{\"ModelType\":\"CALIBRATION_LensDistortionModelRational6KT\",",
+			i ? "," : "", i ? "RIGHT" : "LEFT");
+		len += json_vec(json + len, size - len, "ModelParameters", 15, 100 + i * 15);
+		len += snprintf(json + len, size - len, "},\"Rt\":{");
+		len += json_vec(json + len, size - len, "Rotation", 9, 200 + i * 9);
+		len += snprintf(json + len, size - len, ",");
+		len += json_vec(json + len, size - len, "Translation", 3, 300 + i * 3);
+		len += snprintf(json + len, size - len, "}}");
+	}
+
+	len += snprintf(json + len, size - len, "],\"InertialSensors\":[");
+	const char* sensors[3] = { "CALIBRATION_InertialSensorType_Gyro", "CALIBRATION_InertialSensorType_Accelerometer", "CALIBRATION_InertialSensorType_Magnetometer" };
+	for(int i = 0; i < 3; i++){
+		len += snprintf(json + len, size - len, "%s{\"SensorType\":\"%s\",", i ? "," : "", sensors[i]);
+		len += json_vec(json + len, size - len, "BiasTemperatureModel", 12, 400 + i * 12);
+		len += snprintf(json + len, size - len, ",");
+		len += json_vec(json + len, size - len, "MixingMatrixTemperatureModel", 36, 500 + i * 36);
+		len += snprintf(json + len, size - len, ",");
+		len += json_vec(json + len, size - len, "BiasUncertainty", 3, 600 + i * 3);
+		len += snprintf(json + len, size - len, ",\"Rt\":{");
+		len += json_vec(json + len, size - len, "Rotation", 9, 700 + i * 9);
+		len += snprintf(json + len, size - len, ",");
+		len += json_vec(json + len, size - len, "Translation", 3, 800 + i * 3);
+		len += snprintf(json + len, size - len, "},\"TemperatureBounds\":[5.0,60.0]}");
+	}
+	len += snprintf(json + len, size - len, "]}}");
+
+	memset(data + WMR_JSON_START + 2 + len, 0, 16);
+	memset(data, 0, WMR_JSON_START);
+	write_u32(data, WMR_JSON_START);
+	write_u32(data + 4, len + 2);
+	strcpy((char*)data + 8, "Microsoft");
+	strcpy((char*)data + 8 + 0x40, "HoloLens Sensors");
+	strcpy((char*)data + 8 + 0x40 * 3 + 0x26 + 0xd5, "Simulated Windows Mixed Reality Headset");
+
+	for(int i = 0; i < len; i++)
+		json[i] ^= wmr_config_key[i % 0x400];
+
+	// the store is padded, which also terminates the JSON
+	data_size = (WMR_JSON_START + 2 + len + 16) & ~15;
+
+	memset(meta, 0, sizeof(meta));
+	meta[0] = data_size & 0xff;
+	meta[1] = (data_size >> 8) & 0xff;
+}
+
+void sim_register_wmr(void)
+{
+	memset(&imu, 0, sizeof(imu));
+
+	build_config();
+	store = NULL;
+	store_size = store_offset = 0;
+
+	imu.vendor_id = 0x045e;
+	imu.product_id = 0x0659;
+	imu.manufacturer = L"Microsoft";
+	imu.product = L"HoloLens Sensors";
+	imu.serial = L"SIM0000001";
+	imu.ops = &imu_ops;
+	sim_register(&imu);
+}
@@ -0,0 +1,283 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Simulated HID Devices */
+
+#include <hidapi.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "simhid.h"
+
+struct hid_device_ {
+	sim_device* dev;
+	int nonblocking;
+};
+
+static sim_device* devices[SIM_MAX_DEVICES];
+static int num_devices;
+static uint64_t transfer_ns = 1000000;
+
+sim_stats sim_transfer_stats;
+
+void sim_clear(void)
+{
+	num_devices = 0;
+}
+
+void sim_register(sim_device* dev)
+{
+	if(num_devices < SIM_MAX_DEVICES)
+		devices[num_devices++] = dev;
+}
+
+void sim_queue_input(sim_device* dev, const unsigned char* buf, int size)
+{
+	if(dev->input_count == SIM_MAX_INPUT || size > SIM_MAX_REPORT)
+		return;
+
+	int slot = (dev->input_head + dev->input_count) % SIM_MAX_INPUT;
+	memcpy(dev->input[slot], buf, size);
+	dev->input_size[slot] = size;
+	dev->input_count++;
+}
+
+void sim_set_transfer_ns(uint64_t ns)
+{
+	transfer_ns = ns;
+}
+
+void sim_stats_reset(void)
+{
+	memset(&sim_transfer_stats, 0, sizeof(sim_transfer_stats));
+}
+
+const char* sim_op_name(sim_op op)
+{
+	switch(op){
+	case SIM_GET_FEATURE: return "get feature";
+	case SIM_SEND_FEATURE: return "send feature";
+	case SIM_WRITE: return "write";
+	case SIM_READ: return "read";
+	default: return "?";
+	}
+}
+
+// spin rather than sleep, sleeping would add the scheduler's wake up latency
+static void transfer_wait(uint64_t start)
+{
+	while(bench_now_ns() - start < transfer_ns)
+		;
+}
+
+static void account(sim_op op, unsigned char report_id, uint64_t start)
+{
+	sim_transfer_stats.count[op][report_id]++;
+	sim_transfer_stats.ns[op][report_id] += bench_now_ns() - start;
+}
+
+int hid_init(void)
+{
+	return 0;
+}
+
+int hid_exit(void)
+{
+	return 0;
+}
+
+struct hid_device_info* hid_enumerate(unsigned short vendor_id, unsigned short product_id)
+{
+	struct hid_device_info* head = NULL;
+	struct hid_device_info** tail = &head;
+
+	sim_transfer_stats.enumerations++;
+
+	for(int i = 0; i < num_devices; i++){
+		sim_device* dev = devices[i];
+
+		if((vendor_id && dev->vendor_id != vendor_id) || (product_id && dev->product_id != product_id))
+			continue;
+
+		struct hid_device_info* info = calloc(1, sizeof(struct hid_device_info));
+		info->path = malloc(16);
+		snprintf(info->path, 16, "sim:%d", i);
+		info->vendor_id = dev->vendor_id;
+		info->product_id = dev->product_id;
+		info->interface_number = dev->interface_number;
+		info->manufacturer_string = (wchar_t*)dev->manufacturer;
+		info->product_string = (wchar_t*)dev->product;
+		info->serial_number = (wchar_t*)dev->serial;
+
+		*tail = info;
+		tail = &info->next;
+	}
+
+	return head;
+}
+
+void hid_free_enumeration(struct hid_device_info* devs)
+{
+	while(devs){
+		struct hid_device_info* next = devs->next;
+		free(devs->path);
+		free(devs);
+		devs = next;
+	}
+}
+
+hid_device* hid_open_path(const char* path)
+{
+	int index;
+
+	if(sscanf(path, "sim:%d", &index) != 1 || index < 0 || index >= num_devices)
+		return NULL;
+
+	hid_device* handle = calloc(1, sizeof(hid_device));
+	handle->dev = devices[index];
+
+	sim_transfer_stats.opens++;
+
+	return handle;
+}
+
+hid_device* hid_open(unsigned short vendor_id, unsigned short product_id, const wchar_t* serial_number)
+{
+	(void)serial_number;
+
+	for(int i = 0; i < num_devices; i++){
+		if(devices[i]->vendor_id == vendor_id && devices[i]->product_id == product_id){
+			char path[16];
+			snprintf(path, sizeof(path), "sim:%d", i);
+			return hid_open_path(path);
+		}
+	}
+
+	return NULL;
+}
+
+void hid_close(hid_device* handle)
+{
+	free(handle);
+}
+
+int hid_set_nonblocking(hid_device* handle, int nonblock)
+{
+	handle->nonblocking = nonblock;
+	return 0;
+}
+
+int hid_get_feature_report(hid_device* handle, unsigned char* data, size_t length)
+{
+	uint64_t start = bench_now_ns();
+	unsigned char report_id = data[0];
+	int ret = -1;
+
+	if(handle->dev->ops->get_feature)
+		ret = handle->dev->ops->get_feature(handle->dev, data, length);
+
+	transfer_wait(start);
+	account(SIM_GET_FEATURE, report_id, start);
+
+	return ret;
+}
+
+int hid_send_feature_report(hid_device* handle, const unsigned char* data, size_t length)
+{
+	uint64_t start = bench_now_ns();
+	int ret = (int)length;
+
+	if(handle->dev->ops->send_feature)
+		ret = handle->dev->ops->send_feature(handle->dev, data, length);
+
+	transfer_wait(start);
+	account(SIM_SEND_FEATURE, data[0], start);
+
+	return ret;
+}
+
+int hid_write(hid_device* handle, const unsigned char* data, size_t length)
+{
+	uint64_t start = bench_now_ns();
+	int ret = (int)length;
+
+	if(handle->dev->ops->write)
+		ret = handle->dev->ops->write(handle->dev, data, length);
+
+	transfer_wait(start);
+	account(SIM_WRITE, data[0], start);
+
+	return ret;
+}
+
+int hid_read_timeout(hid_device* handle, unsigned char* data, size_t length, int milliseconds)
+{
+	(void)milliseconds;
+
+	sim_device* dev = handle->dev;
+
+	// nothing is ever going to arrive, so a blocking read returns like a timeout
+	if(dev->input_count == 0)
+		return 0;
+
+	uint64_t start = bench_now_ns();
+	int size = (int)OHMD_MIN((size_t)dev->input_size[dev->input_head], length);
+	memcpy(data, dev->input[dev->input_head], size);
+
+	dev->input_head = (dev->input_head + 1) % SIM_MAX_INPUT;
+	dev->input_count--;
+
+	account(SIM_READ, data[0], start);
+
+	return size;
+}
+
+int hid_read(hid_device* handle, unsigned char* data, size_t length)
+{
+	return hid_read_timeout(handle, data, length, handle->nonblocking ? 0 : -1);
+}
+
+static int get_string(const wchar_t* str, wchar_t* out, size_t maxlen)
+{
+	if(!str || maxlen == 0)
+		return -1;
+
+	wcsncpy(out, str, maxlen);
+	out[maxlen - 1] = L'\0';
+
+	return 0;
+}
+
+int hid_get_manufacturer_string(hid_device* handle, wchar_t* string, size_t maxlen)
+{
+	return get_string(handle->dev->manufacturer, string, maxlen);
+}
+
+int hid_get_product_string(hid_device* handle, wchar_t* string, size_t maxlen)
+{
+	return get_string(handle->dev->product, string, maxlen);
+}
+
+int hid_get_serial_number_string(hid_device* handle, wchar_t* string, size_t maxlen)
+{
+	return get_string(handle->dev->serial, string, maxlen);
+}
+
+int hid_get_indexed_string(hid_device* handle, int string_index, wchar_t* string, size_t maxlen)
+{
+	(void)handle;
+	(void)string_index;
+
+	return get_string(NULL, string, maxlen);
+}
+
+const wchar_t* hid_error(hid_device* handle)
+{
+	(void)handle;
+
+	return L"simulated device error";
+}
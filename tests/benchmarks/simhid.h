@@ -0,0 +1,87 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Simulated HID Devices */
+
+// simhid.c implements the hidapi functions the drivers use on top of a set of
+// registered virtual devices, so the startup benchmark can run the real
+// driver code against scripted device firmware without any hardware.
+
+#ifndef SIMHID_H
+#define SIMHID_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#define SIM_MAX_DEVICES 16
+#define SIM_MAX_INPUT 8
+#define SIM_MAX_REPORT 512
+
+typedef struct sim_device sim_device;
+
+// Device firmware callbacks, any of them may be NULL. For get_feature buf[0]
+// holds the requested report id, the callback fills in the report and
+// returns its size (or -1 to fail the transfer).
+typedef struct {
+	int (*get_feature)(sim_device* dev, unsigned char* buf, size_t length);
+	int (*send_feature)(sim_device* dev, const unsigned char* buf, size_t length);
+	int (*write)(sim_device* dev, const unsigned char* buf, size_t length);
+} sim_device_ops;
+
+struct sim_device {
+	unsigned short vendor_id, product_id;
+	int interface_number;
+	const wchar_t* manufacturer;
+	const wchar_t* product;
+	const wchar_t* serial;
+
+	const sim_device_ops* ops;
+	void* priv;
+
+	// input reports waiting to be returned by hid_read
+	unsigned char input[SIM_MAX_INPUT][SIM_MAX_REPORT];
+	int input_size[SIM_MAX_INPUT];
+	int input_head, input_count;
+};
+
+// Removes all devices, then devices are enumerated in registration order.
+void sim_clear(void);
+void sim_register(sim_device* dev);
+void sim_queue_input(sim_device* dev, const unsigned char* buf, int size);
+
+// Time each control transfer (get/send feature report, write) takes, the
+// default of 1 ms is a full speed USB control transfer round trip.
+void sim_set_transfer_ns(uint64_t ns);
+
+typedef enum {
+	SIM_GET_FEATURE,
+	SIM_SEND_FEATURE,
+	SIM_WRITE,
+	SIM_READ,
+	SIM_NUM_OPS
+} sim_op;
+
+// Transfers by operation and report id, with the time spent in the calls.
+typedef struct {
+	uint64_t count[SIM_NUM_OPS][256];
+	uint64_t ns[SIM_NUM_OPS][256];
+	uint64_t enumerations;
+	uint64_t opens;
+} sim_stats;
+
+extern sim_stats sim_transfer_stats;
+
+void sim_stats_reset(void);
+const char* sim_op_name(sim_op op);
+
+// simulated devices, each function resets and registers the interfaces of
+// one headset and queues the reports it sends right after being opened
+void sim_register_rift_cv1(void);
+void sim_register_rift_s(void);
+void sim_register_vive(void);
+void sim_register_wmr(void);
+
+#endif
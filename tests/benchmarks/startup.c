@@ -0,0 +1,237 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Benchmarks - Startup */
+
+// Times ohmd_ctx_create, ohmd_ctx_probe, opening every device and the first
+// ohmd_ctx_update (where the Rift fetches the touch controller calibration)
+// against simulated devices that replay each driver's init handshake. Every
+// control transfer takes a fixed simulated latency, so the results show how
+// much of the startup time is spent waiting on the device and which reports
+// it goes to.
+//
+// usage: openhmd_bench_startup [filter] [control transfer latency in us]
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "hid.h"
+#include "simhid.h"
+
+#define STARTUP_RUNS 5
+#define STARTUP_MAX_PHASES 16
+
+typedef struct {
+	const char* name;
+	const char* driver;
+	void (*register_devices)(void);
+} startup_scenario;
+
+static const startup_scenario scenarios[] = {
+#if DRIVER_OCULUS_RIFT
+	{ "Rift CV1", "OpenHMD Rift Driver", sim_register_rift_cv1 },
+#endif
+#if DRIVER_OCULUS_RIFT_S
+	{ "Rift S", "OpenHMD Rift Driver", sim_register_rift_s },
+#endif
+#if DRIVER_HTC_VIVE
+	{ "HTC Vive", "OpenHMD HTC Vive Driver", sim_register_vive },
+#endif
+#if DRIVER_WMR
+	{ "Windows Mixed Reality", "OpenHMD Windows Mixed Reality Driver", sim_register_wmr },
+#endif
+};
+
+typedef struct {
+	int num_phases;
+	char names[STARTUP_MAX_PHASES][64];
+	uint64_t ns[STARTUP_RUNS][STARTUP_MAX_PHASES];
+	uint64_t transfers[STARTUP_RUNS][STARTUP_MAX_PHASES];
+	bool failed;
+} startup_result;
+
+static uint64_t total_transfers(void)
+{
+	uint64_t total = 0;
+	for(int op = 0; op < SIM_NUM_OPS; op++)
+		for(int id = 0; id < 256; id++)
+			total += sim_transfer_stats.count[op][id];
+	return total;
+}
+
+static void end_phase(startup_result* res, int run, int* phase, const char* name, uint64_t start, uint64_t* transfers_before)
+{
+	uint64_t transfers = total_transfers();
+
+	if(*phase >= STARTUP_MAX_PHASES)
+		return;
+
+	if(run == 0)
+		snprintf(res->names[*phase], sizeof(res->names[*phase]), "%s", name);
+
+	res->ns[run][*phase] = bench_now_ns() - start;
+	res->transfers[run][*phase] = transfers - *transfers_before;
+	*transfers_before = transfers;
+	(*phase)++;
+}
+
+static void startup_run(const startup_scenario* sc, startup_result* res, int run)
+{
+	char name[64];
+	int phase = 0;
+	uint64_t transfers = 0;
+
+	sim_clear();
+	sc->register_devices();
+	sim_stats_reset();
+
+	uint64_t start = bench_now_ns();
+	ohmd_context* ctx = ohmd_ctx_create();
+	end_phase(res, run, &phase, "ohmd_ctx_create", start, &transfers);
+
+	// the simulated devices stand in for hidapi, whatever the default transport is
+	ctx->hid_transport = &ohmd_hid_transport_hidapi;
+
+	start = bench_now_ns();
+	int num_devices = ohmd_ctx_probe(ctx);
+	end_phase(res, run, &phase, "ohmd_ctx_probe", start, &transfers);
+
+	ohmd_device_settings* settings = ohmd_device_settings_create(ctx);
+	int opened = 0;
+
+	for(int i = 0; i < num_devices; i++){
+		if(strcmp(ctx->list.devices[i].driver, sc->driver) != 0)
+			continue;
+
+		start = bench_now_ns();
+		ohmd_device* dev = ohmd_list_open_device_s(ctx, i, settings);
+		snprintf(name, sizeof(name), "open %s", ohmd_list_gets(ctx, i, OHMD_PRODUCT));
+		end_phase(res, run, &phase, name, start, &transfers);
+
+		if(dev)
+			opened++;
+	}
+
+	ohmd_device_settings_destroy(settings);
+
+	if(opened == 0){
+		res->failed = true;
+		ohmd_ctx_destroy(ctx);
+		return;
+	}
+
+	start = bench_now_ns();
+	ohmd_ctx_update(ctx);
+	end_phase(res, run, &phase, "first ohmd_ctx_update", start, &transfers);
+
+	start = bench_now_ns();
+	ohmd_ctx_destroy(ctx);
+	end_phase(res, run, &phase, "ohmd_ctx_destroy", start, &transfers);
+
+	if(run == 0)
+		res->num_phases = phase;
+	else if(res->num_phases != phase)
+		res->failed = true;
+}
+
+static int cmp_u64(const void* a, const void* b)
+{
+	uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+	return (x > y) - (x < y);
+}
+
+static uint64_t median_phase(const startup_result* res, int phase)
+{
+	uint64_t values[STARTUP_RUNS];
+	for(int run = 0; run < STARTUP_RUNS; run++)
+		values[run] = res->ns[run][phase];
+	qsort(values, STARTUP_RUNS, sizeof(uint64_t), cmp_u64);
+	return values[STARTUP_RUNS / 2];
+}
+
+typedef struct {
+	int op, id;
+	uint64_t ns;
+} transfer_row;
+
+// the transfers of the last run by operation and report id, slowest first
+static void print_transfers(void)
+{
+	static transfer_row rows[SIM_NUM_OPS * 256];
+	int count = 0;
+
+	for(int op = 0; op < SIM_NUM_OPS; op++){
+		for(int id = 0; id < 256; id++){
+			if(sim_transfer_stats.count[op][id] == 0)
+				continue;
+			rows[count].op = op;
+			rows[count].id = id;
+			rows[count].ns = sim_transfer_stats.ns[op][id];
+			count++;
+		}
+	}
+
+	for(int i = 1; i < count; i++){
+		for(int j = i; j > 0 && rows[j].ns > rows[j - 1].ns; j--){
+			transfer_row tmp = rows[j];
+			rows[j] = rows[j - 1];
+			rows[j - 1] = tmp;
+		}
+	}
+
+	for(int i = 0; i < count; i++){
+		printf("      %-12s 0x%02x %6llu x %10.3f ms\n", sim_op_name((sim_op)rows[i].op), rows[i].id,
+			(unsigned long long)sim_transfer_stats.count[rows[i].op][rows[i].id], rows[i].ns / 1e6);
+	}
+}
+
+static void startup_bench(const startup_scenario* sc)
+{
+	static startup_result res;
+	memset(&res, 0, sizeof(res));
+
+	for(int run = 0; run < STARTUP_RUNS && !res.failed; run++)
+		startup_run(sc, &res, run);
+
+	if(res.failed){
+		printf("%s: FAILED to open the simulated devices\n", sc->name);
+		return;
+	}
+
+	printf("%s (median of %d runs)\n", sc->name, STARTUP_RUNS);
+
+	uint64_t total = 0;
+	for(int phase = 0; phase < res.num_phases; phase++){
+		uint64_t ns = median_phase(&res, phase);
+		total += ns;
+		printf("  %-48s %10.3f ms %6llu transfers\n", res.names[phase], ns / 1e6,
+			(unsigned long long)res.transfers[STARTUP_RUNS - 1][phase]);
+	}
+	printf("  %-48s %10.3f ms, %llu enumerations\n", "total", total / 1e6,
+		(unsigned long long)sim_transfer_stats.enumerations);
+
+	printf("    transfers:\n");
+	print_transfers();
+	printf("\n");
+}
+
+int main(int argc, char** argv)
+{
+	const char* filter = argc > 1 ? argv[1] : NULL;
+	uint64_t transfer_us = argc > 2 ? strtoull(argv[2], NULL, 10) : 1000;
+
+	sim_set_transfer_ns(transfer_us * 1000);
+
+	printf("OpenHMD startup benchmarks, %llu us per control transfer\n\n", (unsigned long long)transfer_us);
+
+	for(size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++){
+		if(filter && !strstr(scenarios[i].name, filter))
+			continue;
+		startup_bench(&scenarios[i]);
+	}
+
+	return 0;
+}
@@ -0,0 +1,249 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Unit Tests - Math Kernel Accuracy Tests */
+
+// The hot math kernels have SIMD versions (see omath.c), these compare
+// whichever version is built against a double precision reference.
+
+#include "tests.h"
+
+#define RUNS 10000
+
+// uniform in [-1, 1]
+static float randf(uint32_t* seed)
+{
+	*seed = *seed * 1664525u + 1013904223u;
+	return (float)(*seed >> 8) / (float)(1 << 23) - 1.0f;
+}
+
+static void rand_unit_quat(uint32_t* seed, quatf* q)
+{
+	for(int i = 0; i < 4; i++)
+		q->arr[i] = randf(seed);
+
+	double len = sqrt((double)q->x * q->x + (double)q->y * q->y + (double)q->z * q->z + (double)q->w * q->w);
+	for(int i = 0; i < 4; i++)
+		q->arr[i] = (float)(q->arr[i] / len);
+}
+
+// x, y, z, w
+static void quat_mult_ref(const double* a, const double* b, double* out)
+{
+	double ax = a[0], ay = a[1], az = a[2], aw = a[3];
+	double bx = b[0], by = b[1], bz = b[2], bw = b[3];
+
+	out[0] = aw * bx + ax * bw + ay * bz - az * by;
+	out[1] = aw * by - ax * bz + ay * bw + az * bx;
+	out[2] = aw * bz + ax * by - ay * bx + az * bw;
+	out[3] = aw * bw - ax * bx - ay * by - az * bz;
+}
+
+void test_oquatf_mult_accuracy()
+{
+	uint32_t seed = 1;
+	double max_error = 0;
+
+	for(int i = 0; i < RUNS; i++){
+		quatf a, b, out;
+		double ref[4];
+
+		rand_unit_quat(&seed, &a);
+		rand_unit_quat(&seed, &b);
+
+		oquatf_mult(&a, &b, &out);
+
+		double da[4] = { a.x, a.y, a.z, a.w }, db[4] = { b.x, b.y, b.z, b.w };
+		quat_mult_ref(da, db, ref);
+
+		for(int j = 0; j < 4; j++)
+			max_error = fmax(max_error, fabs(out.arr[j] - ref[j]));
+	}
+
+	TAssert(max_error < 4e-7);
+}
+
+void test_oquatf_get_rotated_accuracy()
+{
+	uint32_t seed = 2;
+	double max_error = 0;
+
+	for(int i = 0; i < RUNS; i++){
+		quatf q;
+		vec3f v, out;
+
+		rand_unit_quat(&seed, &q);
+		for(int j = 0; j < 3; j++)
+			v.arr[j] = 10.0f * randf(&seed);
+
+		oquatf_get_rotated(&q, &v, &out);
+
+		// q v q*
+		double dq[4] = { q.x, q.y, q.z, q.w }, conj[4] = { -q.x, -q.y, -q.z, q.w };
+		double pure[4] = { v.x, v.y, v.z, 0 }, qv[4], ref[4];
+		quat_mult_ref(pure, conj, qv);
+		quat_mult_ref(dq, qv, ref);
+
+		double len = sqrt((double)v.x * v.x + (double)v.y * v.y + (double)v.z * v.z);
+		for(int j = 0; j < 3; j++)
+			max_error = fmax(max_error, fabs(out.arr[j] - ref[j]) / len);
+	}
+
+	// relative to the length of the vector
+	TAssert(max_error < 1e-6);
+}
+
+void test_oquatf_normalize_me_accuracy()
+{
+	uint32_t seed = 3;
+	double max_error = 0;
+
+	for(int i = 0; i < RUNS; i++){
+		quatf q;
+		float scale = powf(10.0f, 3.0f * randf(&seed));
+
+		for(int j = 0; j < 4; j++)
+			q.arr[j] = scale * randf(&seed);
+
+		double len = sqrt((double)q.x * q.x + (double)q.y * q.y + (double)q.z * q.z + (double)q.w * q.w);
+		double ref[4] = { q.x / len, q.y / len, q.z / len, q.w / len };
+
+		oquatf_normalize_me(&q);
+
+		for(int j = 0; j < 4; j++)
+			max_error = fmax(max_error, fabs(q.arr[j] - ref[j]));
+	}
+
+	TAssert(max_error < 2e-7);
+}
+
+void test_omat4x4f_mult_accuracy()
+{
+	uint32_t seed = 4;
+	double max_error = 0;
+
+	for(int i = 0; i < RUNS; i++){
+		mat4x4f l, r, out;
+
+		for(int j = 0; j < 16; j++){
+			l.arr[j] = randf(&seed);
+			r.arr[j] = randf(&seed);
+		}
+
+		omat4x4f_mult(&l, &r, &out);
+
+		for(int row = 0; row < 4; row++){
+			for(int col = 0; col < 4; col++){
+				double ref = 0;
+				for(int k = 0; k < 4; k++)
+					ref += (double)l.m[row][k] * r.m[k][col];
+
+				max_error = fmax(max_error, fabs(out.m[row][col] - ref));
+			}
+		}
+	}
+
+	TAssert(max_error < 1e-6);
+}
+
+void test_omat4x4f_transpose()
+{
+	mat4x4f m, out;
+
+	for(int i = 0; i < 16; i++)
+		m.arr[i] = (float)i;
+
+	omat4x4f_transpose(&m, &out);
+
+	for(int row = 0; row < 4; row++)
+		for(int col = 0; col < 4; col++)
+			TAssert(out.m[row][col] == m.m[col][row]);
+}
+
+// The fixed point math of omath-fixed.c
+
+void test_ofix_sincos_accuracy()
+{
+	uint32_t seed = 5;
+	double max_error = 0;
+
+	for(int i = 0; i < RUNS; i++){
+		// a few turns either way, sincos reduces any angle
+		double angle = 20.0 * randf(&seed);
+		int32_t s, c;
+
+		ofix_sincos((int64_t)llround(angle * OFIX_ONE(30)), &s, &c);
+
+		max_error = fmax(max_error, fabs(ofix_to_float(s, 30) - sin(angle)));
+		max_error = fmax(max_error, fabs(ofix_to_float(c, 30) - cos(angle)));
+	}
+
+	// the float conversion rounds at 6e-8
+	TAssert(max_error < 1e-7);
+}
+
+void test_ofix_atan2_accuracy()
+{
+	uint32_t seed = 6;
+	double max_error = 0;
+
+	for(int i = 0; i < RUNS; i++){
+		// Q16 vectors of 0.01 to 1000 in length
+		double len = pow(10.0, 1.0 + 3.0 * randf(&seed));
+		int32_t y = (int32_t)(len * randf(&seed) * OFIX_ONE(16)), x = (int32_t)(len * randf(&seed) * OFIX_ONE(16));
+
+		max_error = fmax(max_error, fabs(ofix_atan2(y, x) / (double)OFIX_ONE(29) - atan2(y, x)));
+	}
+
+	TAssert(max_error < 1e-8);
+	TAssert(ofix_atan2(0, 0) == 0);
+}
+
+void test_oquatx_accuracy()
+{
+	uint32_t seed = 7;
+	double max_error = 0, max_rotated_error = 0;
+
+	for(int i = 0; i < RUNS; i++){
+		quatf a, b;
+		quatx ax, bx, out;
+		vec3f v;
+		vec3x vx, rotated;
+
+		rand_unit_quat(&seed, &a);
+		rand_unit_quat(&seed, &b);
+		for(int j = 0; j < 4; j++){
+			ax.arr[j] = ofix_from_float(a.arr[j], 30);
+			bx.arr[j] = ofix_from_float(b.arr[j], 30);
+		}
+		for(int j = 0; j < 3; j++)
+			v.arr[j] = 10.0f * randf(&seed);
+		ovec3x_from_vec3f(&v, 16, &vx);
+
+		double da[4] = { a.x, a.y, a.z, a.w }, db[4] = { b.x, b.y, b.z, b.w }, ref[4];
+		quat_mult_ref(da, db, ref);
+
+		oquatx_mult(&ax, &bx, &out);
+		for(int j = 0; j < 4; j++)
+			max_error = fmax(max_error, fabs(ofix_to_float(out.arr[j], 30) - ref[j]));
+
+		// normalizing the product of unit quaternions leaves it alone
+		oquatx_normalize_me(&out);
+		for(int j = 0; j < 4; j++)
+			max_error = fmax(max_error, fabs(ofix_to_float(out.arr[j], 30) - ref[j]));
+
+		double conj[4] = { -a.x, -a.y, -a.z, a.w }, pure[4] = { v.x, v.y, v.z, 0 }, qv[4];
+		quat_mult_ref(pure, conj, qv);
+		quat_mult_ref(da, qv, ref);
+
+		oquatx_get_rotated(&ax, &vx, &rotated);
+		for(int j = 0; j < 3; j++)
+			max_rotated_error = fmax(max_rotated_error, fabs(ofix_to_float(rotated.arr[j], 16) - ref[j]));
+	}
+
+	TAssert(max_error < 2e-7);
+	// Q16 vectors, a few steps of 1.5e-5
+	TAssert(max_rotated_error < 4e-5);
+}
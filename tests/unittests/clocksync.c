@@ -0,0 +1,99 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Unit Tests - Clock Synchronization Tests */
+
+#include "tests.h"
+
+#define MS 1000000ull
+
+// deterministic read latency between min_ns and min_ns + spread_ns, with a late spike now and then
+static uint64_t latency(uint32_t* seed, uint64_t min_ns, uint64_t spread_ns)
+{
+	*seed = *seed * 1664525u + 1013904223u;
+	uint64_t ns = min_ns + (*seed >> 8) % spread_ns;
+
+	if((*seed >> 4) % 100 == 0)
+		ns += 20 * MS;
+
+	return ns;
+}
+
+void test_oclock_sync_rollover()
+{
+	clock_sync cs;
+	oclock_sync_init(&cs, 1000000.0, 24); // 1 MHz, wraps every 16.8 s
+
+	uint64_t t0 = 1000 * MS;
+	uint32_t tick = 0xff0000;
+
+	for(int i = 0; i < 40000; i++){
+		uint64_t sample_ns = oclock_sync_update(&cs, tick, t0 + i * MS + 2 * MS);
+
+		if(i > 0)
+			TAssert(cs.dt_ns == MS);
+		TAssert(sample_ns <= t0 + i * MS + 2 * MS && sample_ns + MS / 10 > t0 + i * MS + 2 * MS);
+
+		tick = (tick + 1000) & 0xffffff;
+	}
+
+	// a 40 s gap wraps the counter twice, the host clock tells
+	uint64_t gap = 40000 * MS;
+	tick = (tick + 40000 * 1000) & 0xffffff;
+	oclock_sync_update(&cs, tick, t0 + 40000 * MS + 2 * MS + gap);
+	TAssert(cs.dt_ns == gap + MS);
+}
+
+void test_oclock_sync_drift()
+{
+	clock_sync cs;
+	oclock_sync_init(&cs, 1000000.0, 32);
+
+	uint32_t seed = 1;
+	uint64_t t0 = 5000 * MS;
+	uint64_t last_ns = 0;
+
+	for(int i = 0; i < 60000; i++){
+		uint64_t true_ns = t0 + i * MS;
+		uint32_t tick = (uint32_t)(i * 1000.1); // 100 ppm fast
+		uint64_t sample_ns = oclock_sync_update(&cs, tick, true_ns + latency(&seed, MS, 3 * MS));
+
+		TAssert(sample_ns >= last_ns);
+		last_ns = sample_ns;
+
+		if(i > 20000){
+			// samples follow the earliest reads, without their 3 ms of jitter
+			int64_t error = (int64_t)(sample_ns - true_ns);
+			TAssert(error >= (int64_t)MS && error < (int64_t)(MS + MS / 2));
+		}
+	}
+
+	// the offset shrinks by 100 us per s of device time
+	TAssert(fabs(cs.drift + 100000.0) < 10000.0);
+}
+
+void test_oclock_sync_restart()
+{
+	clock_sync cs;
+	oclock_sync_init(&cs, 1000000.0, 32);
+
+	uint64_t t = 1000 * MS, last_ns = 0;
+	uint32_t tick = 500000;
+
+	for(int i = 0; i < 1000; i++, t += MS, tick += 1000)
+		last_ns = oclock_sync_update(&cs, tick, t);
+
+	// the device resets its counter, after a few samples the fit follows
+	tick = 0;
+	for(int i = 0; i < 20; i++, t += MS, tick += 1000){
+		uint64_t sample_ns = oclock_sync_update(&cs, tick, t);
+		TAssert(sample_ns >= last_ns);
+		last_ns = sample_ns;
+	}
+
+	TAssert(cs.samples > 1 && cs.samples < 20);
+	TAssert(cs.dt_ns == MS);
+	TAssert(last_ns + MS / 10 > t - MS);
+}
@@ -0,0 +1,433 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Unit Tests - Sensor Fusion Tests */
+
+#include "tests.h"
+#include "fusion-group.h"
+
+#define LANES 9
+#define STEPS 3000
+#define FIXED_STEPS 15000
+
+static float randf(uint32_t* seed)
+{
+	*seed = *seed * 1664525u + 1013904223u;
+	return (*seed >> 8) / 8388608.0f - 1.0f;
+}
+
+// up to 3 samples per lane and step, some steps without any, fast turns and accelerations off gravity now and then
+static int make_samples(uint32_t* seed, uint64_t* t, fusion_sample* samples)
+{
+	int count = (int)((randf(seed) + 1.0f) * 2.0f);
+
+	for(int i = 0; i < count; i++){
+		fusion_sample* s = samples + i;
+		float turn = randf(seed) > 0.9f ? 50.0f : 1.0f;
+
+		s->dt_ns = 1000000 + (uint64_t)((randf(seed) + 1.0f) * 10000000.0f);
+		*t += s->dt_ns;
+		s->sample_ns = *t;
+
+		for(int j = 0; j < 3; j++){
+			s->ang_vel.arr[j] = turn * randf(seed);
+			s->accel.arr[j] = 2.0f * randf(seed);
+			s->mag.arr[j] = 0.0f;
+		}
+		s->accel.y += randf(seed) > 0.8f ? 15.0f : 9.81f;
+	}
+
+	return count;
+}
+
+static void check_group(ohmd_fusion_backend backend)
+{
+	fusion_group group;
+	fusion single[LANES];
+	int lanes[LANES];
+	uint64_t t[LANES] = {0};
+	uint32_t seed = 42;
+
+	TAssert(ofusion_group_init(&group, backend, LANES, 3));
+	TAssert(group.capacity >= LANES && group.capacity % FUSION_GROUP_WIDTH == 0);
+
+	for(int l = 0; l < LANES; l++){
+		lanes[l] = ofusion_group_add(&group);
+		TAssert(lanes[l] >= 0);
+
+		ofusion_init(&single[l]);
+		ofusion_set_backend(&single[l], backend);
+	}
+
+	for(int step = 0; step < STEPS; step++){
+		// a tracker leaves and a new one takes its lane
+		if(step == STEPS / 2){
+			ofusion_group_remove(&group, lanes[4]);
+			lanes[4] = ofusion_group_add(&group);
+			ofusion_reset(&single[4]);
+			t[4] = 0;
+		}
+
+		for(int l = 0; l < LANES; l++){
+			fusion_sample samples[3];
+			int count = make_samples(&seed, &t[l], samples);
+
+			for(int i = 0; i < count; i++)
+				TAssert(ofusion_group_push(&group, lanes[l], samples + i));
+
+			ofusion_update_batch(&single[l], samples, count);
+		}
+
+		ofusion_group_step(&group);
+
+		for(int l = 0; l < LANES; l++){
+			quatf orient;
+			ofusion_group_get_orient(&group, lanes[l], &orient);
+
+			for(int j = 0; j < 4; j++)
+				TAssert(float_eq(orient.arr[j], single[l].orient.arr[j], 0.0001f));
+
+			TAssert(group.time_ns[lanes[l]] == single[l].time_ns);
+			TAssert(group.sample_ns[lanes[l]] == single[l].sample_ns);
+		}
+	}
+
+	// the queue of a lane is bounded, unused lanes take nothing
+	fusion_sample s = { 0, 1000000, {{0, 0, 0}}, {{0, 9.81f, 0}}, {{0, 0, 0}} };
+	for(int i = 0; i < 3; i++)
+		TAssert(ofusion_group_push(&group, lanes[0], &s));
+	TAssert(!ofusion_group_push(&group, lanes[0], &s));
+	if(group.capacity > LANES)
+		TAssert(!ofusion_group_push(&group, group.capacity - 1, &s));
+
+	ofusion_group_destroy(&group);
+}
+
+void test_ofusion_group_mahony()
+{
+	check_group(OHMD_FUSION_MAHONY);
+}
+
+void test_ofusion_group_madgwick()
+{
+	check_group(OHMD_FUSION_MADGWICK);
+}
+
+void test_ofusion_group_backends()
+{
+	fusion_group group;
+
+	TAssert(!ofusion_group_init(&group, OHMD_FUSION_COMPLEMENTARY, 4, 3));
+	TAssert(!ofusion_group_init(&group, OHMD_FUSION_MAHONY, 0, 3));
+
+	TAssert(ofusion_group_init(&group, OHMD_FUSION_MADGWICK, 2, 1));
+	for(int l = 0; l < group.capacity; l++)
+		TAssert(ofusion_group_add(&group) == l);
+	TAssert(ofusion_group_add(&group) == -1);
+
+	ofusion_group_remove(&group, 1);
+	TAssert(ofusion_group_add(&group) == 1);
+
+	ofusion_group_destroy(&group);
+}
+
+// A tracker turning about and resting now and then at 1 kHz with gyro bias and noise, the accelerometer
+// reading a slightly tilted gravity through the orientation of the float filter. The fixed point filter
+// is fed the same samples and has to stay with it.
+static void check_fixed_point(ohmd_fusion_backend backend)
+{
+	fusion ref, fixed;
+	uint32_t seed = 7;
+	uint64_t t = 0;
+
+	ofusion_init(&ref);
+	ofusion_set_backend(&ref, backend);
+	ofusion_set_fixed_point(&ref, false);
+
+	ofusion_init(&fixed);
+	ofusion_set_backend(&fixed, backend);
+	ofusion_set_fixed_point(&fixed, true);
+
+	for(int step = 0; step < FIXED_STEPS; step++){
+		fusion_sample samples[4];
+		quatf inv = ref.orient;
+		oquatf_inverse(&inv);
+
+		for(int i = 0; i < 4; i++){
+			fusion_sample* s = samples + i;
+			float tt = (step * 4 + i) * 0.001f;
+			bool resting = (step * 4 + i) % 10000 > 7000;
+
+			s->dt_ns = 1000000;
+			t += s->dt_ns;
+			s->sample_ns = t;
+
+			s->ang_vel.x = 0.01f + 0.01f * randf(&seed) + (resting ? 0 : 0.5f * sinf(tt * 0.7f));
+			s->ang_vel.y = -0.02f + 0.01f * randf(&seed) + (resting ? 0 : 0.8f * sinf(tt * 0.3f));
+			s->ang_vel.z = 0.005f + 0.01f * randf(&seed) + (resting ? 0 : 0.4f * cosf(tt * 0.5f));
+
+			vec3f gravity = {{ 0.5f, 9.8f, -0.3f }};
+			oquatf_get_rotated(&inv, &gravity, &s->accel);
+			for(int j = 0; j < 3; j++){
+				s->accel.arr[j] += 0.1f * randf(&seed);
+				s->mag.arr[j] = 0.0f;
+			}
+		}
+
+		ofusion_update_batch(&ref, samples, 4);
+		ofusion_update_batch(&fixed, samples, 4);
+
+		for(int j = 0; j < 4; j++)
+			TAssert(float_eq(fixed.orient.arr[j], ref.orient.arr[j], 0.001f));
+
+		TAssert(fixed.time_ns == ref.time_ns);
+		TAssert(fixed.sample_ns == ref.sample_ns);
+	}
+
+	// the gravity correction ran
+	if(backend == OHMD_FUSION_COMPLEMENTARY)
+		TAssert(ovec3x_get_dot(&fixed.fx.grav_error_axis, &fixed.fx.grav_error_axis) != 0);
+	if(backend == OHMD_FUSION_MAHONY)
+		TAssert(ovec3x_get_dot(&fixed.fx.integral_error, &fixed.fx.integral_error) != 0);
+}
+
+void test_ofusion_fixed_point()
+{
+	check_fixed_point(OHMD_FUSION_COMPLEMENTARY);
+	check_fixed_point(OHMD_FUSION_MAHONY);
+	check_fixed_point(OHMD_FUSION_MADGWICK);
+}
+
+void test_ofusion_fixed_point_fallback()
+{
+	fusion ref, fixed;
+	fusion_sample s = { 1000000, 1000000, {{0.5f, 0, 0}}, {{3.0f, 9.0f, 1.0f}}, {{0, 0, 0}} };
+
+	ofusion_init(&fixed);
+	TAssert(fixed.fixed_point == FUSION_FIXED_POINT_DEFAULT);
+
+	// the accelerometer only backend has no fixed point version and fuses in float
+	ofusion_init(&ref);
+	ofusion_set_backend(&ref, OHMD_FUSION_ACCEL_ONLY);
+	ofusion_set_fixed_point(&ref, false);
+	ofusion_set_backend(&fixed, OHMD_FUSION_ACCEL_ONLY);
+	ofusion_set_fixed_point(&fixed, true);
+
+	ofusion_update_batch(&ref, &s, 1);
+	ofusion_update_batch(&fixed, &s, 1);
+	for(int j = 0; j < 4; j++)
+		TAssert(fixed.orient.arr[j] == ref.orient.arr[j]);
+
+	// switching starts over
+	ofusion_set_backend(&fixed, OHMD_FUSION_MAHONY);
+	ofusion_update_batch(&fixed, &s, 1);
+	TAssert(fixed.orient.w < 1.0f);
+	ofusion_set_fixed_point(&fixed, false);
+	TAssert(fixed.orient.w == 1.0f && fixed.fx.orient.w == OFIX_ONE(30) && fixed.time_ns == 0);
+}
+
+// held still at a tilt of angle about z, with a small gyro bias
+static void still_sample(fusion_sample* s, uint64_t* t, float angle)
+{
+	*t += 1000000;
+	s->sample_ns = *t;
+	s->dt_ns = 1000000;
+
+	vec3f ang_vel = {{0.002f, -0.004f, 0.001f}}, accel = {{9.81f * sinf(angle), 9.81f * cosf(angle), 0}}, mag = {{0, 0, 0}};
+	s->ang_vel = ang_vel;
+	s->accel = accel;
+	s->mag = mag;
+}
+
+static void init_fusion(fusion* f, ohmd_fusion_backend backend, bool fixed_point)
+{
+	ofusion_init(f);
+	ofusion_set_backend(f, backend);
+	ofusion_set_fixed_point(f, fixed_point);
+}
+
+static void check_save_restore(ohmd_fusion_backend backend, bool fixed_point)
+{
+	fusion warm, restored, moved;
+	fusion_state state;
+	fusion_sample s;
+	uint64_t t = 0;
+
+	init_fusion(&warm, backend, fixed_point);
+	for(int i = 0; i < 5000; i++){
+		still_sample(&s, &t, 0.3f);
+		ofusion_update_batch(&warm, &s, 1);
+	}
+
+	ofusion_save_state(&warm, &state);
+
+	init_fusion(&restored, backend, fixed_point);
+	TAssert(ofusion_restore_state(&restored, &state));
+	for(int i = 0; i < 4; i++)
+		TAssert(restored.orient.arr[i] == warm.orient.arr[i]);
+
+	// carries on as the fusion it was saved from, past the start
+	for(int i = 0; i < 1000; i++){
+		still_sample(&s, &t, 0.3f);
+		ofusion_update_batch(&warm, &s, 1);
+		ofusion_update_batch(&restored, &s, 1);
+	}
+
+	TAssert(!restored.restored);
+	TAssert(restored.iterations >= FUSION_SNAP_ITERATIONS && restored.time_ns > FUSION_STARTUP_NS);
+	for(int i = 0; i < 4; i++)
+		TAssert(float_eq(restored.orient.arr[i], warm.orient.arr[i], 1e-4f));
+
+	// the device was tilted further in between, the fusion starts over from where it was
+	init_fusion(&moved, backend, fixed_point);
+	TAssert(ofusion_restore_state(&moved, &state));
+	still_sample(&s, &t, 0.6f);
+	ofusion_update_batch(&moved, &s, 1);
+	TAssert(!moved.restored && moved.time_ns < FUSION_STARTUP_NS && moved.iterations < FUSION_SNAP_ITERATIONS);
+
+	// only into a fusion like the one it was saved from
+	init_fusion(&moved, backend, !fixed_point);
+	TAssert(!ofusion_restore_state(&moved, &state));
+	init_fusion(&moved, backend == OHMD_FUSION_MAHONY ? OHMD_FUSION_MADGWICK : OHMD_FUSION_MAHONY, fixed_point);
+	TAssert(!ofusion_restore_state(&moved, &state));
+
+	state.version++;
+	init_fusion(&moved, backend, fixed_point);
+	TAssert(!ofusion_restore_state(&moved, &state));
+}
+
+void test_ofusion_save_restore()
+{
+	ohmd_fusion_backend backends[] = { OHMD_FUSION_COMPLEMENTARY, OHMD_FUSION_MAHONY, OHMD_FUSION_MADGWICK };
+
+	for(int i = 0; i < 3; i++){
+		check_save_restore(backends[i], false);
+		check_save_restore(backends[i], true);
+	}
+}
+
+// level and turning about y, read by a gyro with a bias and noise of up to noise rad/s
+static void gyro_sample(fusion_sample* s, uint64_t* t, uint32_t* seed, float turn, float noise)
+{
+	const vec3f bias = {{0.02f, -0.03f, 0.01f}};
+
+	*t += 1000000;
+	s->sample_ns = *t;
+	s->dt_ns = 1000000;
+
+	vec3f accel = {{0, 9.81f, 0}}, mag = {{0, 0, 0}};
+	s->accel = accel;
+	s->mag = mag;
+
+	for(int i = 0; i < 3; i++)
+		s->ang_vel.arr[i] = bias.arr[i] + noise * randf(seed);
+	s->ang_vel.y += turn;
+}
+
+static void check_gyro_bias(ohmd_fusion_backend backend, bool fixed_point)
+{
+	fusion f;
+	fusion_sample s;
+	uint64_t t = 0;
+	uint32_t seed = 7;
+
+	// fused from the first sample on
+	init_fusion(&f, backend, fixed_point);
+	gyro_sample(&s, &t, &seed, 0, 0.005f);
+	ofusion_update_batch(&f, &s, 1);
+	TAssert(f.sample_ns == t && f.time_ns == 1000000 && f.orient.x != 0.0f);
+
+	for(int i = 0; i < 2000; i++){
+		gyro_sample(&s, &t, &seed, 0, 0.005f);
+		ofusion_update_batch(&f, &s, 1);
+	}
+	TAssert(f.gyro_bias_windows > 0);
+
+	// lying still, what's left of the bias is noise and barely turns the device
+	quatf before = f.orient;
+	vec3f mean = {{0, 0, 0}};
+	for(int i = 0; i < 5000; i++){
+		vec3f ang_vel;
+		gyro_sample(&s, &t, &seed, 0, 0.005f);
+		ofusion_update_batch(&f, &s, 1);
+		ofusion_get_ang_vel(&f, &ang_vel);
+
+		for(int j = 0; j < 3; j++)
+			mean.arr[j] += ang_vel.arr[j] / 5000;
+	}
+
+	for(int j = 0; j < 3; j++)
+		TAssert(fabsf(mean.arr[j]) < 0.002f);
+	TAssert(fabsf(oquatf_get_dot(&before, &f.orient)) > cosf(0.01f / 2));
+
+	// a slow turn by hand is not taken for a bias
+	init_fusion(&f, backend, fixed_point);
+	for(int i = 0; i < 3000; i++){
+		gyro_sample(&s, &t, &seed, 0.05f, 0.03f);
+		ofusion_update_batch(&f, &s, 1);
+	}
+	TAssert(f.gyro_bias_windows == 0);
+
+	// nor estimated when switched off
+	init_fusion(&f, backend, fixed_point);
+	f.flags &= ~FF_ESTIMATE_GYRO_BIAS;
+	for(int i = 0; i < 3000; i++){
+		gyro_sample(&s, &t, &seed, 0, 0.005f);
+		ofusion_update_batch(&f, &s, 1);
+	}
+	TAssert(f.gyro_bias_windows == 0 && f.gyro_bias.x == 0 && f.gyro_bias.y == 0 && f.gyro_bias.z == 0);
+}
+
+// The samples of a report fused in one batch end up where fusing them one by one does, the gravity correction in
+// progress included, for the filters that defer it to the end of the batch
+static void check_batch(bool fixed_point)
+{
+	fusion one, batched;
+	fusion_sample s[3];
+	uint64_t t = 0;
+	uint32_t seed = 11;
+	float max_angle = 0.0f;
+
+	init_fusion(&one, OHMD_FUSION_COMPLEMENTARY, fixed_point);
+	init_fusion(&batched, OHMD_FUSION_COMPLEMENTARY, fixed_point);
+
+	for(int i = 0; i < 4000; i++){
+		// held still past the startup, tilted over a bit more every second so there is always a correction running
+		for(int j = 0; j < 3; j++){
+			float tilt = 0.1f + 0.2f * (i / 333);
+			still_sample(s + j, &t, tilt);
+			for(int k = 0; k < 3; k++)
+				s[j].ang_vel.arr[k] += 0.01f * randf(&seed);
+
+			ofusion_update_batch(&one, s + j, 1);
+		}
+		ofusion_update_batch(&batched, s, 3);
+
+		// the angle between them from the vector part of the difference, acos is too coarse near 1
+		quatf diff;
+		oquatf_diff(&one.orient, &batched.orient, &diff);
+		float sin_half = sqrtf(diff.x * diff.x + diff.y * diff.y + diff.z * diff.z);
+		max_angle = fmaxf(max_angle, 2.0f * asinf(fminf(sin_half, 1.0f)));
+	}
+
+	// measuring the tilt with the orientation before the corrections of the batch was about 0.00015 rad off
+	TAssert(max_angle < 0.00005f);
+}
+
+void test_ofusion_batch()
+{
+	check_batch(false);
+	check_batch(true);
+}
+
+void test_ofusion_gyro_bias()
+{
+	ohmd_fusion_backend backends[] = { OHMD_FUSION_COMPLEMENTARY, OHMD_FUSION_MAHONY, OHMD_FUSION_MADGWICK };
+
+	for(int i = 0; i < 3; i++){
+		check_gyro_bias(backends[i], false);
+		check_gyro_bias(backends[i], true);
+	}
+}
@@ -10,6 +10,8 @@
 #include "tests.h"
 #include "openhmd.h"
 
+#include <string.h>
+
 void test_highlevel_open_close_device()
 {
 	ohmd_context* ctx = ohmd_ctx_create();
@@ -67,3 +69,190 @@ void test_highlevel_open_close_many_devices()
 	
 	ohmd_ctx_destroy(ctx);	
 }
+
+static int find_device(ohmd_context* ctx, int num_devices, const char* product)
+{
+	for(int i = 0; i < num_devices; i++){
+		if(strcmp(ohmd_list_gets(ctx, i, OHMD_PRODUCT), product) == 0)
+			return i;
+	}
+
+	return -1;
+}
+
+void test_highlevel_predicted_pose()
+{
+	ohmd_context* ctx = ohmd_ctx_create();
+	TAssert(ctx);
+
+	int num_devices = ohmd_ctx_probe(ctx);
+	int index = find_device(ctx, num_devices, "External Device");
+	TAssert(index >= 0);
+
+	ohmd_device_settings* settings = ohmd_device_settings_create(ctx);
+	int manual = 0;
+	ohmd_device_settings_seti(settings, OHMD_IDS_AUTOMATIC_UPDATE, &manual);
+	ohmd_device* hmd = ohmd_list_open_device_s(ctx, index, settings);
+	ohmd_device_settings_destroy(settings);
+	TAssert(hmd);
+
+	int horizon_us;
+	TAssert(ohmd_device_geti(hmd, OHMD_PREDICTION_MAX_HORIZON_US, &horizon_us) == OHMD_S_OK && horizon_us == 50000);
+
+	// turning at 2 rad/s about y
+	float sample[10] = { 0.001f, 0, 2.0f, 0, 0, 9.81f, 0, 0, 0, 0 };
+	for(int i = 0; i < 10; i++)
+		TAssert(ohmd_device_setf(hmd, OHMD_EXTERNAL_SENSOR_FUSION, sample) == 0);
+	ohmd_ctx_update(ctx);
+
+	int64_t sample_ns;
+	quatf rot, predicted, expected, step;
+	vec3f pos, y_axis = {{0, 1, 0}};
+	TAssert(ohmd_device_get_sample_time(hmd, &sample_ns) == OHMD_S_OK);
+	ohmd_device_getf(hmd, OHMD_ROTATION_QUAT, rot.arr);
+
+	// 20 ms ahead
+	TAssert(ohmd_device_get_predicted_pose(hmd, sample_ns + 20000000, predicted.arr, pos.arr) == OHMD_S_OK);
+	oquatf_init_axis(&step, &y_axis, 0.04f);
+	oquatf_mult(&rot, &step, &expected);
+	for(int i = 0; i < 4; i++)
+		TAssert(float_eq(predicted.arr[i], expected.arr[i], 1e-5f));
+	TAssert(pos.x == 0 && pos.y == 0 && pos.z == 0);
+
+	// clamped to 10 ms
+	horizon_us = 10000;
+	TAssert(ohmd_device_seti(hmd, OHMD_PREDICTION_MAX_HORIZON_US, &horizon_us) == OHMD_S_OK);
+	TAssert(ohmd_device_get_predicted_pose(hmd, sample_ns + 20000000, predicted.arr, NULL) == OHMD_S_OK);
+	oquatf_init_axis(&step, &y_axis, 0.02f);
+	oquatf_mult(&rot, &step, &expected);
+	for(int i = 0; i < 4; i++)
+		TAssert(float_eq(predicted.arr[i], expected.arr[i], 1e-5f));
+
+	// disabled
+	horizon_us = 0;
+	TAssert(ohmd_device_seti(hmd, OHMD_PREDICTION_MAX_HORIZON_US, &horizon_us) == OHMD_S_OK);
+	TAssert(ohmd_device_get_predicted_pose(hmd, sample_ns + 20000000, predicted.arr, NULL) == OHMD_S_OK);
+	for(int i = 0; i < 4; i++)
+		TAssert(float_eq(predicted.arr[i], rot.arr[i], 1e-6f));
+
+	horizon_us = -1;
+	TAssert(ohmd_device_seti(hmd, OHMD_PREDICTION_MAX_HORIZON_US, &horizon_us) == OHMD_S_INVALID_PARAMETER);
+
+	// the dummy device has no sensor fusion
+	ohmd_device* dummy = ohmd_list_open_device(ctx, find_device(ctx, num_devices, "HMD Null Device"));
+	TAssert(dummy);
+	TAssert(ohmd_device_get_predicted_pose(dummy, sample_ns, predicted.arr, NULL) == OHMD_S_UNSUPPORTED);
+
+	ohmd_ctx_destroy(ctx);
+}
+
+void test_highlevel_fusion_state()
+{
+	ohmd_context* ctx = ohmd_ctx_create();
+	TAssert(ctx);
+
+	int num_devices = ohmd_ctx_probe(ctx);
+	int index = find_device(ctx, num_devices, "External Device");
+	TAssert(index >= 0);
+	TAssert(strcmp(ohmd_list_gets(ctx, index, OHMD_SERIAL), "") == 0);
+
+	ohmd_device* hmd = ohmd_list_open_device(ctx, index);
+	TAssert(hmd);
+
+	// held still, tilted about z
+	float sample[10] = { 0.001f, 0, 0, 0, 2.0f, 9.6f, 0, 0, 0, 0 };
+	for(int i = 0; i < 3000; i++)
+		TAssert(ohmd_device_setf(hmd, OHMD_EXTERNAL_SENSOR_FUSION, sample) == 0);
+	ohmd_ctx_update(ctx);
+
+	int size = 0;
+	TAssert(ohmd_device_get_fusion_state(hmd, NULL, &size) == OHMD_S_OK && size > 0);
+
+	char* state = malloc(size);
+	int small = size - 1;
+	TAssert(ohmd_device_get_fusion_state(hmd, state, &small) == OHMD_S_INVALID_PARAMETER && small == size);
+	TAssert(ohmd_device_get_fusion_state(hmd, state, &size) == OHMD_S_OK);
+
+	quatf saved, rot;
+	ohmd_device_getf(hmd, OHMD_ROTATION_QUAT, saved.arr);
+	TAssert(ohmd_close_device(hmd) == 0);
+
+	// the same device opened again picks up where it was
+	hmd = ohmd_list_open_device(ctx, index);
+	TAssert(hmd);
+	TAssert(ohmd_device_set_fusion_state(hmd, state, size) == OHMD_S_OK);
+	TAssert(ohmd_device_setf(hmd, OHMD_EXTERNAL_SENSOR_FUSION, sample) == 0);
+	ohmd_ctx_update(ctx);
+
+	ohmd_device_getf(hmd, OHMD_ROTATION_QUAT, rot.arr);
+	for(int i = 0; i < 4; i++)
+		TAssert(float_eq(rot.arr[i], saved.arr[i], 1e-4f));
+
+	TAssert(ohmd_device_set_fusion_state(hmd, state, size - 1) == OHMD_S_INVALID_PARAMETER);
+
+	// not the state of another device
+	state[0] ^= 1;
+	TAssert(ohmd_device_set_fusion_state(hmd, state, size) == OHMD_S_INVALID_PARAMETER);
+
+	ohmd_device* dummy = ohmd_list_open_device(ctx, find_device(ctx, num_devices, "HMD Null Device"));
+	TAssert(dummy);
+	TAssert(ohmd_device_get_fusion_state(dummy, NULL, &size) == OHMD_S_UNSUPPORTED);
+
+	free(state);
+	ohmd_ctx_destroy(ctx);
+}
+
+void test_highlevel_imu_samples()
+{
+	ohmd_context* ctx = ohmd_ctx_create();
+	TAssert(ctx);
+
+	int num_devices = ohmd_ctx_probe(ctx);
+	int index = find_device(ctx, num_devices, "External Device");
+	TAssert(index >= 0);
+
+	ohmd_device_settings* settings = ohmd_device_settings_create(ctx);
+	int on = 1, off = 0;
+	TAssert(ohmd_device_settings_seti(settings, OHMD_IDS_AUTOMATIC_UPDATE, &off) == OHMD_S_OK);
+	TAssert(ohmd_device_settings_seti(settings, OHMD_IDS_IMU_SAMPLES, &on) == OHMD_S_OK);
+	TAssert(ohmd_device_settings_seti(settings, OHMD_IDS_SENSOR_FUSION, &off) == OHMD_S_OK);
+
+	ohmd_device* hmd = ohmd_list_open_device_s(ctx, index, settings);
+	TAssert(hmd);
+	ohmd_device_settings_destroy(settings);
+
+	// turning about y, with gravity along y
+	for(int i = 0; i < 10; i++){
+		float sample[10] = { 0.001f, 0, 1.0f + i, 0, 0, 9.81f, 0, 0.2f, 0, i * 0.1f };
+		TAssert(ohmd_device_setf(hmd, OHMD_EXTERNAL_SENSOR_FUSION, sample) == 0);
+	}
+	ohmd_ctx_update(ctx);
+
+	ohmd_imu_sample samples[16];
+	int count = 0;
+	TAssert(ohmd_device_read_imu_samples(hmd, samples, 16, &count) == OHMD_S_OK);
+	TAssert(count == 10);
+
+	for(int i = 0; i < count; i++){
+		TAssert(samples[i].dt_ns == 1000000);
+		TAssert(float_eq(samples[i].ang_vel[1], 1.0f + i, 1e-6f));
+		TAssert(float_eq(samples[i].accel[1], 9.81f, 1e-6f));
+		TAssert(float_eq(samples[i].mag[2], i * 0.1f, 1e-6f));
+		TAssert(i == 0 || samples[i].sample_ns >= samples[i - 1].sample_ns);
+	}
+
+	TAssert(ohmd_device_read_imu_samples(hmd, samples, 16, &count) == OHMD_S_OK && count == 0);
+	TAssert(ohmd_device_read_imu_samples(hmd, samples, -1, &count) == OHMD_S_INVALID_PARAMETER);
+
+	// no fusion ran on them
+	quatf rot;
+	ohmd_device_getf(hmd, OHMD_ROTATION_QUAT, rot.arr);
+	TAssert(rot.x == 0 && rot.y == 0 && rot.z == 0 && rot.w == 1.0f);
+
+	// devices keep no samples unless asked to
+	ohmd_device* other = ohmd_list_open_device(ctx, index);
+	TAssert(other);
+	TAssert(ohmd_device_read_imu_samples(other, samples, 16, &count) == OHMD_S_UNSUPPORTED);
+
+	ohmd_ctx_destroy(ctx);
+}
@@ -0,0 +1,110 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Unit Tests - IMU Ring Tests */
+
+#include "tests.h"
+
+#define MS 1000000ll
+#define WRITES 2000000
+#define READ_MAX 100
+
+// sample i, a ms after the one before with values derived from i
+static void push_sample(imu_ring* ring, uint32_t i)
+{
+	ohmd_imu_sample sample = { i * MS, MS, { i * 0.5f, 1, 2 }, { 0, i * 0.25f, 9.81f }, { 0, 0, i * 0.125f } };
+	oimu_ring_push(ring, &sample);
+}
+
+static bool is_sample(const ohmd_imu_sample* s, int64_t i)
+{
+	return s->sample_ns == i * MS && s->dt_ns == MS && s->ang_vel[0] == i * 0.5f && s->accel[1] == i * 0.25f
+		&& s->mag[2] == i * 0.125f;
+}
+
+void test_oimu_ring_read()
+{
+	imu_ring* ring = malloc(sizeof(imu_ring));
+	ohmd_imu_sample out[READ_MAX];
+
+	oimu_ring_init(ring);
+	TAssert(oimu_ring_read(ring, out, READ_MAX) == 0);
+
+	for(uint32_t i = 1; i <= 30; i++)
+		push_sample(ring, i);
+
+	// in order, in parts, each sample once
+	TAssert(oimu_ring_read(ring, out, 20) == 20);
+	for(int i = 0; i < 20; i++)
+		TAssert(is_sample(out + i, i + 1));
+
+	TAssert(oimu_ring_read(ring, out, READ_MAX) == 10);
+	TAssert(is_sample(out, 21) && is_sample(out + 9, 30));
+	TAssert(oimu_ring_read(ring, out, READ_MAX) == 0);
+	TAssert(oimu_ring_read(ring, out, 0) == 0);
+
+	// a reader falling behind loses the oldest ones, and picks up after them
+	for(uint32_t i = 31; i <= 30 + IMU_RING_SIZE + 500; i++)
+		push_sample(ring, i);
+
+	int64_t next = 30 + IMU_RING_SIZE + 500 - (IMU_RING_SIZE - 1) + 1;
+	TAssert(oimu_ring_read(ring, out, READ_MAX) == READ_MAX);
+	for(int i = 0; i < READ_MAX; i++)
+		TAssert(is_sample(out + i, next + i));
+
+	free(ring);
+}
+
+typedef struct {
+	imu_ring* ring;
+	volatile bool done;
+} writer_state;
+
+static unsigned int writer(void* arg)
+{
+	writer_state* state = arg;
+
+	for(uint32_t i = 1; i <= WRITES; i++)
+		push_sample(state->ring, i);
+
+	state->done = true;
+	return 0;
+}
+
+void test_oimu_ring_concurrent()
+{
+	ohmd_context* ctx = ohmd_ctx_create();
+	writer_state state = { malloc(sizeof(imu_ring)), false };
+	ohmd_imu_sample out[READ_MAX];
+	int64_t last = 0;
+	int read = 0;
+
+	oimu_ring_init(state.ring);
+	ohmd_thread* thread = ohmd_create_thread(ctx, writer, &state);
+
+	// whatever the reader gets while the writer laps the ring are whole samples that were pushed, in order
+	bool done;
+	do{
+		done = state.done;
+
+		int count = oimu_ring_read(state.ring, out, READ_MAX);
+		for(int i = 0; i < count; i++){
+			int64_t at = out[i].sample_ns / MS;
+			TAssert(at > last && is_sample(out + i, at));
+			last = at;
+		}
+		read += count;
+
+		// until a read after the writer is done leaves nothing behind
+		if(count == READ_MAX)
+			done = false;
+	}while(!done);
+
+	ohmd_destroy_thread(thread);
+	TAssert(read > 0 && last == WRITES);
+
+	free(state.ring);
+	ohmd_ctx_destroy(ctx);
+}
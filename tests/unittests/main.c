@@ -24,6 +24,7 @@ int main()
 	Test(test_ovec3f_get_length);
 	Test(test_ovec3f_get_angle);
 	Test(test_ovec3f_get_dot);
+	Test(test_ofq_get_mean);
 	printf("\n");
 	
 	printf("quatf tests\n");
@@ -32,11 +33,54 @@ int main()
 	Test(test_oquatf_get_dot);
 	Test(test_oquatf_inverse);
 	Test(test_oquatf_diff);
+	Test(test_oquatf_slerp);
+	printf("\n");
+
+	printf("math kernel accuracy tests\n");
+	Test(test_oquatf_mult_accuracy);
+	Test(test_oquatf_get_rotated_accuracy);
+	Test(test_oquatf_normalize_me_accuracy);
+	Test(test_omat4x4f_mult_accuracy);
+	Test(test_omat4x4f_transpose);
+	Test(test_ofix_sincos_accuracy);
+	Test(test_ofix_atan2_accuracy);
+	Test(test_oquatx_accuracy);
+	printf("\n");
+
+	printf("fusion tests\n");
+	Test(test_ofusion_group_mahony);
+	Test(test_ofusion_group_madgwick);
+	Test(test_ofusion_group_backends);
+	Test(test_ofusion_fixed_point);
+	Test(test_ofusion_fixed_point_fallback);
+	Test(test_ofusion_save_restore);
+	Test(test_ofusion_gyro_bias);
+	Test(test_ofusion_batch);
+	printf("\n");
+
+	printf("pose history tests\n");
+	Test(test_opose_history_get_at);
+	Test(test_opose_history_frame);
+	Test(test_opose_history_concurrent);
+	printf("\n");
+
+	printf("imu ring tests\n");
+	Test(test_oimu_ring_read);
+	Test(test_oimu_ring_concurrent);
+	printf("\n");
+
+	printf("clock sync tests\n");
+	Test(test_oclock_sync_rollover);
+	Test(test_oclock_sync_drift);
+	Test(test_oclock_sync_restart);
 	printf("\n");
 
 	printf("high level tests\n");
 	Test(test_highlevel_open_close_device);
 	Test(test_highlevel_open_close_many_devices);
+	Test(test_highlevel_predicted_pose);
+	Test(test_highlevel_fusion_state);
+	Test(test_highlevel_imu_samples);
 	printf("\n");
 
 	printf("all a-ok\n");
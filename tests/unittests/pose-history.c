@@ -0,0 +1,153 @@
+/*
+ * OpenHMD - Free and Open Source API and drivers for immersive technology.
+ * Distributed under the Boost 1.0 licence, see LICENSE for full text.
+ */
+
+/* Unit Tests - Pose History Tests */
+
+#include "tests.h"
+
+#define MS 1000000ull
+#define WRITES 2000000
+
+static const vec3f y_axis = {{0, 1, 0}};
+
+// turning about y at 2 rad/s, a pose every ms
+static void push_turn(pose_history* history, uint32_t i)
+{
+	quatf orient;
+	vec3f ang_vel = {{0, 2.0f, 0}};
+
+	oquatf_init_axis(&orient, &y_axis, i * 0.002f);
+	opose_history_push(history, i * MS, &orient, &ang_vel);
+}
+
+// the same rotation, either sign
+static bool same_rotation(const quatf* q, float angle, float t)
+{
+	quatf expected;
+	oquatf_init_axis(&expected, &y_axis, angle);
+
+	return fabsf(oquatf_get_dot(q, &expected)) > 1.0f - t;
+}
+
+void test_opose_history_get_at()
+{
+	pose_history* history = malloc(sizeof(pose_history));
+	quatf rot;
+	vec3f pos, position = {{0, 0, 0}};
+
+	opose_history_init(history);
+	history->position = &position;
+
+	TAssert(!opose_history_get_at(history, 0, 0, &rot, &pos));
+
+	for(uint32_t i = 1; i <= 100; i++){
+		position.x = i * 0.001f;
+		push_turn(history, i);
+	}
+
+	// between two poses, and on one
+	TAssert(opose_history_get_at(history, 50 * MS + MS / 4, 0, &rot, &pos));
+	TAssert(same_rotation(&rot, 50.25f * 0.002f, 1e-6f));
+	TAssert(float_eq(pos.x, 0.05025f, 1e-6f));
+
+	TAssert(opose_history_get_at(history, 1 * MS, 0, &rot, &pos));
+	TAssert(same_rotation(&rot, 0.002f, 1e-6f));
+
+	// before the first, after the last with and without extrapolation
+	TAssert(!opose_history_get_at(history, 1 * MS - 1, 0, &rot, &pos));
+
+	TAssert(opose_history_get_at(history, 110 * MS, 0, &rot, &pos));
+	TAssert(same_rotation(&rot, 0.2f, 1e-6f));
+
+	TAssert(opose_history_get_at(history, 110 * MS, 5 * MS, &rot, &pos));
+	TAssert(same_rotation(&rot, 0.21f, 1e-6f));
+	TAssert(float_eq(pos.x, 0.1f, 1e-6f));
+
+	// older poses are overwritten
+	for(uint32_t i = 101; i <= 2000; i++)
+		push_turn(history, i);
+
+	TAssert(!opose_history_get_at(history, 100 * MS, 0, &rot, &pos));
+	TAssert(opose_history_get_at(history, (2000 - POSE_HISTORY_SIZE + 2) * MS, 0, &rot, &pos));
+	TAssert(same_rotation(&rot, (2000 - POSE_HISTORY_SIZE + 2) * 0.002f, 1e-5f));
+
+	free(history);
+}
+
+void test_opose_history_frame()
+{
+	pose_history* history = malloc(sizeof(pose_history));
+	quatf orient = {{0, 0, 0, 1}}, rot, step, expected;
+	vec3f ang_vel = {{1.0f, 0, 0}}, x_axis = {{1, 0, 0}}, z_axis = {{0, 0, 1}}, pos;
+
+	opose_history_init(history);
+	oquatf_init_axis(&history->frame, &y_axis, 0.5f);
+	oquatf_init_axis(&history->correction, &z_axis, 0.3f);
+
+	opose_history_push(history, MS, &orient, &ang_vel);
+
+	// frame * orient * correction, extrapolated about x in the body frame of the fusion
+	TAssert(opose_history_get_at(history, 11 * MS, 10 * MS, &rot, &pos));
+
+	oquatf_init_axis(&step, &x_axis, 0.01f);
+	oquatf_mult(&history->frame, &step, &expected);
+	oquatf_mult_me(&expected, &history->correction);
+
+	for(int i = 0; i < 4; i++)
+		TAssert(float_eq(rot.arr[i], expected.arr[i], 1e-6f));
+
+	free(history);
+}
+
+typedef struct {
+	pose_history* history;
+	volatile bool done;
+} writer_state;
+
+static unsigned int writer(void* arg)
+{
+	writer_state* state = arg;
+
+	for(uint32_t i = 1; i <= WRITES; i++)
+		push_turn(state->history, i);
+
+	state->done = true;
+	return 0;
+}
+
+void test_opose_history_concurrent()
+{
+	ohmd_context* ctx = ohmd_ctx_create();
+	writer_state state = { malloc(sizeof(pose_history)), false };
+	uint32_t seed = 1;
+	int found = 0;
+
+	opose_history_init(state.history);
+	ohmd_thread* thread = ohmd_create_thread(ctx, writer, &state);
+
+	// whatever the reader gets while the writer laps the ring has to be a pose that was pushed
+	while(!state.done){
+		uint32_t count = state.history->count;
+		if(count < 2)
+			continue;
+
+		seed = seed * 1664525u + 1013904223u;
+		uint64_t time_ns = count * MS - (seed >> 16) % (400 * MS);
+		quatf rot;
+		vec3f pos;
+
+		if(opose_history_get_at(state.history, time_ns, 0, &rot, &pos)){
+			// float angles of millions of ms, compared at the resolution of the pushed ones
+			TAssert(same_rotation(&rot, (float)(time_ns / 1000000.0 * 0.002), 1e-4f));
+			found++;
+		}
+	}
+
+	ohmd_destroy_thread(thread);
+	TAssert(found > 0);
+
+	free(state.history);
+	ohmd_ctx_destroy(ctx);
+}
@@ -152,3 +152,28 @@ void test_oquatf_diff()
 		TAssert(quatf_eq(q, list[i].q3, t));
 	}
 }
+
+void test_oquatf_slerp()
+{
+	vec3f axis = {{1, 2, 3}};
+	quatf p, q, neg_q, out, expected;
+
+	oquatf_init_axis(&p, &axis, 0.2f);
+	oquatf_init_axis(&q, &axis, 1.0f);
+	oquatf_init_axis(&expected, &axis, 0.4f);
+
+	oquatf_slerp(0.25f, &p, &q, true, &out);
+	TAssert(quatf_eq(out, expected, t));
+
+	// -q is the same rotation, the shortest path leads to -expected
+	for(int i = 0; i < 4; i++)
+		neg_q.arr[i] = -q.arr[i];
+
+	oquatf_slerp(0.25f, &p, &neg_q, true, &out);
+	TAssert(quatf_eq(out, expected, t));
+
+	// nearly the same, interpolated linearly
+	oquatf_init_axis(&q, &axis, 0.2001f);
+	oquatf_slerp(0.5f, &p, &q, true, &out);
+	TAssert(quatf_eq(out, p, t));
+}
@@ -26,6 +26,7 @@ void test_ovec3f_normalize_me();
 void test_ovec3f_get_length();
 void test_ovec3f_get_angle();
 void test_ovec3f_get_dot();
+void test_ofq_get_mean();
 
 // quatf tests
 void test_oquatf_init_axis();
@@ -37,11 +38,49 @@ void test_oquatf_get_length();
 void test_oquatf_get_dot();
 void test_oquatf_inverse();
 void test_oquatf_diff();
+void test_oquatf_slerp();
 
 void test_oquatf_get_mat4x4();
 
+// math kernel accuracy tests
+void test_oquatf_mult_accuracy();
+void test_oquatf_get_rotated_accuracy();
+void test_oquatf_normalize_me_accuracy();
+void test_omat4x4f_mult_accuracy();
+void test_omat4x4f_transpose();
+void test_ofix_sincos_accuracy();
+void test_ofix_atan2_accuracy();
+void test_oquatx_accuracy();
+
+// fusion tests
+void test_ofusion_group_mahony();
+void test_ofusion_group_madgwick();
+void test_ofusion_group_backends();
+void test_ofusion_fixed_point();
+void test_ofusion_fixed_point_fallback();
+void test_ofusion_save_restore();
+void test_ofusion_gyro_bias();
+void test_ofusion_batch();
+
+// pose history tests
+void test_opose_history_get_at();
+void test_opose_history_frame();
+void test_opose_history_concurrent();
+
+// imu ring tests
+void test_oimu_ring_read();
+void test_oimu_ring_concurrent();
+
+// clock sync tests
+void test_oclock_sync_rollover();
+void test_oclock_sync_drift();
+void test_oclock_sync_restart();
+
 // high-level tests
 void test_highlevel_open_close_device();
 void test_highlevel_open_close_many_devices();
+void test_highlevel_predicted_pose();
+void test_highlevel_fusion_state();
+void test_highlevel_imu_samples();
 
 #endif
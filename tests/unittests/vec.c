@@ -105,3 +105,32 @@ void test_ovec3f_get_dot()
 }
 
 
+
+void test_ofq_get_mean()
+{
+	filter_queue fq;
+	vec3f elems[20], mean;
+	ofq_init(&fq, elems, 20);
+
+	// the mean is over the whole queue, unfilled elements count as zero
+	vec3f v = {{2, -4, 1}};
+	ofq_add(&fq, &v);
+	ofq_get_mean(&fq, &mean);
+	TAssert(vec3f_eq(mean, (vec3f){{0.1, -0.2, 0.05}}, 0.0001));
+
+	// the running sum follows the last 20 elements of a long stream
+	for(int i = 0; i < 100013; i++){
+		vec3f s = {{1000.0f + (i % 7), -0.001f * (i % 13), 9.81f}};
+		ofq_add(&fq, &s);
+	}
+
+	vec3f expected = {{0, 0, 0}};
+	for(int i = 0; i < 20; i++){
+		expected.x += elems[i].x / 20.0f;
+		expected.y += elems[i].y / 20.0f;
+		expected.z += elems[i].z / 20.0f;
+	}
+
+	ofq_get_mean(&fq, &mean);
+	TAssert(vec3f_eq(mean, expected, 0.001));
+}